@@ -19,7 +19,8 @@
 #include <assert.h>
 #include <stdint.h>
 
-#ifdef USE_PEXT
+#if defined(USE_PEXT) || defined(USE_DISPATCH)
+#include <cpuid.h>
 #include <immintrin.h>
 #endif
 
@@ -37,6 +38,10 @@ ALIGN64 uint64_t KingAttacks[SQUARE_NB];
 ALIGN64 Magic BishopTable[SQUARE_NB];
 ALIGN64 Magic RookTable[SQUARE_NB];
 
+#if defined(USE_PEXT) || defined(USE_DISPATCH)
+static int SliderPext; // Chosen by initAttacks(), before building the tables
+#endif
+
 static int validCoordinate(int rank, int file) {
     return 0 <= rank && rank < RANK_NB
         && 0 <= file && file < FILE_NB;
@@ -47,12 +52,68 @@ static void setSquare(uint64_t *bb, int rank, int file) {
         *bb |= 1ull << square(rank, file);
 }
 
-static int sliderIndex(uint64_t occupied, Magic *table) {
-#ifdef USE_PEXT
-    return _pext_u64(occupied, table->mask);
+#if defined(USE_PEXT) || defined(USE_DISPATCH)
+
+static int slowPextCPU() {
+
+    // AMD's Zen, Zen+ and Zen 2 (family 17h), as well as Hygon's licensed
+    // copies (family 18h), implement PEXT in microcode. The latency of
+    // PEXT there grows with the number of bits set in the mask, and is
+    // far slower than a magic multiply for the Rook and Bishop masks
+
+    unsigned eax, ebx, ecx, edx;
+
+    if (!__get_cpuid(0, &eax, &ebx, &ecx, &edx))
+        return 0;
+
+    const int amd   = ebx == 0x68747541 && edx == 0x69746E65 && ecx == 0x444D4163; // AuthenticAMD
+    const int hygon = ebx == 0x6F677948 && edx == 0x6E65476E && ecx == 0x656E6975; // HygonGenuine
+
+    if ((!amd && !hygon) || !__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+        return 0;
+
+    const int family = ((eax >> 8) & 0xF) + ((eax >> 20) & 0xFF);
+    return family == 0x17 || family == 0x18;
+}
+
+static int fastPextCPU() {
+
+    unsigned eax, ebx, ecx, edx;
+
+    // CPUID.(EAX=07H, ECX=0):EBX.BMI2[bit 8]
+    if (   !__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)
+        || !(ebx & bit_BMI2))
+        return 0;
+
+    return !slowPextCPU();
+}
+
+INLINE uint64_t pext(uint64_t occupied, uint64_t mask) {
+
+#if defined(USE_PEXT)
+    return _pext_u64(occupied, mask);
 #else
-    return ((occupied & table->mask) * table->magic) >> table->shift;
+
+    // Dispatched builds are not compiled with BMI2 enabled, so
+    // _pext_u64() is unavailable. Instead emit PEXT directly, which
+    // keeps sliderIndex() inlined into both of its callers
+
+    uint64_t index;
+    __asm__("pextq %2, %1, %0" : "=r" (index) : "r" (occupied), "r" (mask));
+    return index;
+#endif
+}
+
+#endif
+
+static int sliderIndex(uint64_t occupied, Magic *table) {
+
+#if defined(USE_PEXT) || defined(USE_DISPATCH)
+    if (SliderPext)
+        return pext(occupied, table->mask);
 #endif
+
+    return ((occupied & table->mask) * table->magic) >> table->shift;
 }
 
 static uint64_t sliderAttacks(int sq, uint64_t occupied, const int delta[4][2]) {
@@ -106,6 +167,10 @@ void initAttacks() {
     const int BishopDelta[4][2] = {{-1,-1}, {-1, 1}, { 1,-1}, { 1, 1}};
     const int RookDelta[4][2]   = {{-1, 0}, { 0,-1}, { 0, 1}, { 1, 0}};
 
+#if defined(USE_PEXT) || defined(USE_DISPATCH)
+    SliderPext = fastPextCPU();
+#endif
+
     // First square has initial offset
     BishopTable[0].offset = BishopAttacks;
     RookTable[0].offset = RookAttacks;
@@ -133,6 +198,14 @@ void initAttacks() {
     }
 }
 
+const char* sliderIndexName() {
+#if defined(USE_PEXT) || defined(USE_DISPATCH)
+    return SliderPext ? "pext" : "magic";
+#else
+    return "magic";
+#endif
+}
+
 uint64_t pawnAttacks(int colour, int sq) {
     assert(0 <= colour && colour < COLOUR_NB);
     assert(0 <= sq && sq < SQUARE_NB);
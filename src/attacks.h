@@ -30,6 +30,7 @@ struct Magic {
 };
 
 void initAttacks();
+const char* sliderIndexName();
 
 uint64_t pawnAttacks(int colour, int sq);
 uint64_t knightAttacks(int sq);
@@ -105,7 +105,7 @@ void boardFromFEN(Board *board, const char *fen, int chess960) {
     char ch;
     char *str = strdup(fen), *strPos = NULL;
     char *token = strtok_r(str, " ", &strPos);
-    uint64_t rooks, kings, white, black;
+    uint64_t rooks, white, black;
 
     clearBoard(board); // Zero out, set squares to EMPTY
 
@@ -133,7 +133,6 @@ void boardFromFEN(Board *board, const char *fen, int chess960) {
     token = strtok_r(NULL, " ", &strPos);
 
     rooks = board->pieces[ROOK];
-    kings = board->pieces[KING];
     white = board->colours[WHITE];
     black = board->colours[BLACK];
 
@@ -146,13 +145,6 @@ void boardFromFEN(Board *board, const char *fen, int chess960) {
         if ('a' <= ch && ch <= 'h') setBit(&board->castleRooks, square(7, ch - 'a'));
     }
 
-    for (sq = 0; sq < SQUARE_NB; sq++) {
-        board->castleMasks[sq] = ~0ull;
-        if (testBit(board->castleRooks, sq)) clearBit(&board->castleMasks[sq], sq);
-        if (testBit(white & kings, sq)) board->castleMasks[sq] &= ~white;
-        if (testBit(black & kings, sq)) board->castleMasks[sq] &= ~black;
-    }
-
     rooks = board->castleRooks;
     while (rooks) board->hash ^= ZobristCastleKeys[poplsb(&rooks)];
 
@@ -168,11 +160,8 @@ void boardFromFEN(Board *board, const char *fen, int chess960) {
     // Move count: ignore and use zero, as we count since root
     board->numMoves = 0;
 
-    // Need king attackers for move generation
-    board->kingAttackers = attackersToKingSquare(board);
-
-    // Need squares attacked by the opposing player
-    board->threats = allAttackedSquares(board, !board->turn);
+    // King attackers and the squares attacked by the opposing player
+    board->hasThreats = board->hasKingAttackers = 0;
 
     // We save the game mode in order to comply with the UCI rules for printing
     // moves. If chess960 is not enabled, but we have detected an unconventional
@@ -280,6 +269,62 @@ void printBoard(Board *board) {
     printf("\n%s\n\n", fen);
 }
 
+uint64_t boardThreats(Board *board) {
+
+    // Squares attacked by the side which just moved. Many nodes never
+    // look at them, such as those cut by the TT or a stand pat, as well
+    // as illegal moves, so they are only computed the first time needed
+
+    if (!board->hasThreats) {
+        board->threats    = allAttackedSquares(board, !board->turn);
+        board->hasThreats = 1;
+    }
+
+    return board->threats;
+}
+
+uint64_t boardKingAttackers(Board *board) {
+
+    // Pieces of the side which just moved which are giving check, and our
+    // pieces pinned to our King. Both come from the same scan out of the King
+    // square, and almost every node needs them, but illegal moves do not
+
+    if (!board->hasKingAttackers) {
+
+        const uint64_t us    = board->colours[ board->turn];
+        const uint64_t enemy = board->colours[!board->turn];
+        const int kingsq     = getlsb(us & board->pieces[KING]);
+
+        uint64_t bishops = enemy & (board->pieces[BISHOP] | board->pieces[QUEEN]);
+        uint64_t rooks   = enemy & (board->pieces[ROOK  ] | board->pieces[QUEEN]);
+
+        // Sliders which would attack the King if only our own pieces were removed
+        uint64_t sliders = (bishopAttacks(kingsq, enemy) & bishops)
+                         | (rookAttacks(kingsq, enemy) & rooks);
+
+        board->kingAttackers = (knightAttacks(kingsq) & enemy & board->pieces[KNIGHT])
+                             | (pawnAttacks(board->turn, kingsq) & enemy & board->pieces[PAWN]);
+        board->pinned = 0ull;
+
+        // Nothing in the way is a check, and a lone blocker is pinned
+        while (sliders) {
+            int sq = poplsb(&sliders);
+            uint64_t blockers = bitsBetweenMasks(kingsq, sq) & us;
+            if (!blockers) setBit(&board->kingAttackers, sq);
+            else if (onlyOne(blockers)) board->pinned |= blockers;
+        }
+
+        board->hasKingAttackers = 1;
+    }
+
+    return board->kingAttackers;
+}
+
+uint64_t boardPinned(Board *board) {
+    boardKingAttackers(board);
+    return board->pinned;
+}
+
 int boardHasNonPawnMaterial(Board *board, int turn) {
     uint64_t friendly = board->colours[turn];
     uint64_t kings = board->pieces[KING];
@@ -307,16 +352,16 @@ int boardDrawnByRepetition(Board *board, int height) {
 
     int reps = 0;
 
-    // Look through hash histories for our moves
-    for (int i = board->numMoves - 2; i >= 0; i -= 2) {
+    // No draw can occur before a zeroing move, or outside the history
+    const int end = MAX(0, board->numMoves - MIN(board->halfMoveCounter, HISTORY_SIZE));
 
-        // No draw can occur before a zeroing move
-        if (i < board->numMoves - board->halfMoveCounter)
-            break;
+    // Look through hash histories for our moves. Repeating a position
+    // takes at least four plies, since null moves are never consecutive
+    for (int i = board->numMoves - 4; i >= end; i -= 2) {
 
         // Check for matching hash with a two fold after the root,
         // or a three fold which occurs in part before the root move
-        if (    board->history[i] == board->hash
+        if (    board->history[i & (HISTORY_SIZE - 1)] == board->hash
             && (i > board->numMoves - height || ++reps == 2))
             return 1;
     }
@@ -324,35 +369,51 @@ int boardDrawnByRepetition(Board *board, int height) {
     return 0;
 }
 
-int boardDrawnByInsufficientMaterial(Board *board) {
+int boardHasGameCycle(Board *board, int height) {
 
-    // Check for KvK, KvN, KvB, and KvNN.
+    // Detect if the side to move has a reversible move which repeats an earlier
+    // position, using the Cuckoo tables of single move hash differences. Only
+    // the path of the move is checked, so the move might not actually be legal
 
-    return !(board->pieces[PAWN] | board->pieces[ROOK] | board->pieces[QUEEN])
-        && (!several(board->colours[WHITE]) || !several(board->colours[BLACK]))
-        && (    !several(board->pieces[KNIGHT] | board->pieces[BISHOP])
-            || (!board->pieces[BISHOP] && popcount(board->pieces[KNIGHT]) <= 2));
-}
+    const uint64_t occupied = board->colours[WHITE] | board->colours[BLACK];
+    const int end = MIN(MIN(board->halfMoveCounter, HISTORY_SIZE), board->numMoves);
+
+    for (int i = 3; i <= end; i += 2) {
+
+        const uint64_t prev = board->history[(board->numMoves - i) & (HISTORY_SIZE - 1)];
+        const uint64_t key  = board->hash ^ prev;
 
-uint64_t perft(Board *board, int depth) {
+        int slot = CuckooH1(key);
+        if (CuckooKeys[slot] != key && CuckooKeys[slot = CuckooH2(key)] != key)
+            continue;
 
-    Undo undo[1];
-    int size = 0;
-    uint64_t found = 0ull;
-    uint16_t moves[MAX_MOVES];
+        const int sq1 = MoveFrom(CuckooMoves[slot]);
+        const int sq2 = MoveTo(CuckooMoves[slot]);
+        const int sq  = board->squares[sq1] != EMPTY ? sq1 : sq2;
 
-    if (depth == 0) return 1ull;
+        // The piece must be ours, and have nothing in its way
+        if (   (bitsBetweenMasks(sq1, sq2) & occupied)
+            ||  pieceColour(board->squares[sq]) != board->turn)
+            continue;
 
-    // Call genAllNoisyMoves() & genAllNoisyMoves()
-    size += genAllNoisyMoves(board, moves);
-    size += genAllQuietMoves(board, moves + size);
+        // Repeating a position after the root is enough
+        if (i < height) return 1;
 
-    // Recurse on all valid moves
-    for(size -= 1; size >= 0; size--) {
-        applyMove(board, moves[size], undo);
-        if (moveWasLegal(board)) found += perft(board, depth-1);
-        revertMove(board, moves[size], undo);
+        // Before the root, the position must have already repeated once
+        for (int j = board->numMoves - i - 4; j >= board->numMoves - end; j -= 2)
+            if (board->history[j & (HISTORY_SIZE - 1)] == prev)
+                return 1;
     }
 
-    return found;
+    return 0;
+}
+
+int boardDrawnByInsufficientMaterial(Board *board) {
+
+    // Check for KvK, KvN, KvB, and KvNN.
+
+    return !(board->pieces[PAWN] | board->pieces[ROOK] | board->pieces[QUEEN])
+        && (!several(board->colours[WHITE]) || !several(board->colours[BLACK]))
+        && (    !several(board->pieces[KNIGHT] | board->pieces[BISHOP])
+            || (!board->pieces[BISHOP] && popcount(board->pieces[KNIGHT]) <= 2));
 }
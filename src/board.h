@@ -22,30 +22,37 @@
 
 extern const char *PieceLabel[COLOUR_NB];
 
+// Repetitions can only span the moves since the last zeroing move, which are
+// never more than a hundred when checked, so the history is a ring this size
+enum { HISTORY_SIZE = 128 };
+
 struct Board {
     uint8_t squares[SQUARE_NB];
     uint64_t pieces[8], colours[3];
-    uint64_t hash, pkhash, kingAttackers, threats;
-    uint64_t castleRooks, castleMasks[SQUARE_NB];
+    uint64_t hash, pkhash, kingAttackers, pinned, threats;
+    uint64_t castleRooks;
     int turn, epSquare, halfMoveCounter, fullMoveCounter;
-    int psqtmat, numMoves, chess960;
-    uint64_t history[8192];
+    int psqtmat, numMoves, chess960, hasThreats, hasKingAttackers;
+    uint64_t history[HISTORY_SIZE];
     Thread *thread;
 };
 
 struct Undo {
-    uint64_t hash, pkhash, kingAttackers, threats, castleRooks;
-    int epSquare, halfMoveCounter, psqtmat, capturePiece;
+    uint64_t hash, pkhash, kingAttackers, pinned, threats, castleRooks;
+    int epSquare, halfMoveCounter, psqtmat, capturePiece, hasThreats, hasKingAttackers;
 };
 
 void squareToString(int sq, char *str);
 void boardFromFEN(Board *board, const char *fen, int chess960);
 void boardToFEN(Board *board, char *fen);
 void printBoard(Board *board);
+uint64_t boardThreats(Board *board);
+uint64_t boardKingAttackers(Board *board);
+uint64_t boardPinned(Board *board);
 int boardHasNonPawnMaterial(Board *board, int turn);
 int boardIsDrawn(Board *board, int height);
 int boardDrawnByFiftyMoveRule(Board *board);
 int boardDrawnByRepetition(Board *board, int height);
+int boardHasGameCycle(Board *board, int height);
 int boardDrawnByInsufficientMaterial(Board *board);
 
-uint64_t perft(Board *board, int depth);
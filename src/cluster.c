@@ -0,0 +1,409 @@
+/*
+  Ethereal is a UCI chess playing engine authored by Andrew Grant.
+  <https://github.com/AndyGrant/Ethereal>     <andrew@grantnet.us>
+
+  Ethereal is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Ethereal is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <inttypes.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if !defined(_WIN32) && !defined(_WIN64)
+    #include <netdb.h>
+    #include <netinet/in.h>
+    #include <sys/socket.h>
+    #include <sys/time.h>
+    #include <unistd.h>
+#endif
+
+#include "cluster.h"
+#include "move.h"
+#include "search.h"
+#include "thread.h"
+#include "transposition.h"
+
+int ClusterDepth   = CLUSTER_DEPTH_DEFAULT; // Set by UCI options
+int ClusterSharing = 0; // Set only while searching with a socket and peers
+
+#if !defined(_WIN32) && !defined(_WIN64)
+
+enum { CLUSTER_ENTRIES = 1, CLUSTER_STATUS = 2 };
+
+typedef struct ClusterStatus {
+    uint64_t root, nodes;
+    int32_t depth, score;
+    uint16_t best, ponder;
+    uint32_t padding;
+} ClusterStatus;
+
+typedef struct ClusterPeer {
+    uint64_t sender;
+    ClusterStatus status;
+} ClusterPeer;
+
+static struct {
+
+    int fd, port;                    // Bound UDP socket, or -1 when closed
+    uint64_t id;                     // Random identifier of this process
+    pthread_t receiver;
+    volatile int running;
+
+    int npeers;                      // Addresses that Entries are sent out to
+    struct sockaddr_in addrs[CLUSTER_PEERS_MAX];
+
+    pthread_mutex_t lock;            // Guards everything below from the receiver
+    bool searching;
+    uint64_t root;
+    int nstatus;                     // Latest status of each sender on our root
+    ClusterPeer statuses[CLUSTER_PEERS_MAX];
+
+    TTStats stats;                   // Stores made on behalf of every peer
+    uint64_t sent, received;
+
+} Cluster = { .fd = -1, .lock = PTHREAD_MUTEX_INITIALIZER };
+
+
+static void cluster_send(const void *datagram, size_t length) {
+
+    // Datagrams which fail to send are dropped, like those lost in transit
+    for (int i = 0; i < Cluster.npeers; i++)
+        sendto(Cluster.fd, datagram, length, 0, (struct sockaddr*) &Cluster.addrs[i], sizeof(Cluster.addrs[i]));
+}
+
+static void cluster_receive_entries(const ClusterBatch *batch) {
+
+    // Entries are only accepted while searching, since the Table is
+    // otherwise free to be resized or cleared by the UCI thread
+
+    pthread_mutex_lock(&Cluster.lock);
+
+    for (int i = 0; Cluster.searching && i < batch->header.count; i++) {
+
+        const ClusterEntry *entry = &batch->entries[i];
+
+        if (entry->bound < BOUND_LOWER || entry->bound > BOUND_EXACT || entry->depth < 1)
+            continue;
+
+        tt_store_remote(&Cluster.stats, entry->hash, entry->move,
+                        entry->value, entry->eval, entry->depth, entry->bound);
+    }
+
+    Cluster.received += batch->header.count;
+    pthread_mutex_unlock(&Cluster.lock);
+}
+
+static void cluster_receive_status(uint64_t sender, const ClusterStatus *status) {
+
+    int i;
+
+    pthread_mutex_lock(&Cluster.lock);
+
+    // Statuses from other roots are of no use, even if they are stale
+    if (Cluster.searching && status->root == Cluster.root) {
+
+        for (i = 0; i < Cluster.nstatus && Cluster.statuses[i].sender != sender; i++);
+
+        if (i < CLUSTER_PEERS_MAX) {
+            Cluster.statuses[i].sender = sender;
+            Cluster.statuses[i].status = *status;
+            Cluster.nstatus += i == Cluster.nstatus;
+        }
+    }
+
+    pthread_mutex_unlock(&Cluster.lock);
+}
+
+static void *cluster_receive(void *unused) {
+
+    // Wake up at least every 100ms to check if the socket is closing,
+    // and otherwise decode each well formed datagram from another process
+
+    uint64_t buffer[(sizeof(ClusterBatch) + 7) / 8];
+    const ClusterHeader *header = (const ClusterHeader*) buffer;
+
+    (void) unused;
+
+    while (Cluster.running) {
+
+        ssize_t length = recv(Cluster.fd, buffer, sizeof(buffer), 0);
+
+        if (   length < (ssize_t) sizeof(ClusterHeader)
+            || header->magic != CLUSTER_MAGIC || header->sender == Cluster.id)
+            continue;
+
+        if (   header->type == CLUSTER_ENTRIES && header->count <= CLUSTER_BATCH
+            && length == (ssize_t) (sizeof(ClusterHeader) + header->count * sizeof(ClusterEntry)))
+            cluster_receive_entries((const ClusterBatch*) buffer);
+
+        if (   header->type == CLUSTER_STATUS
+            && length == (ssize_t) (sizeof(ClusterHeader) + sizeof(ClusterStatus)))
+            cluster_receive_status(header->sender, (const ClusterStatus*) (header + 1));
+    }
+
+    return NULL;
+}
+
+bool cluster_init(int port) {
+
+    struct sockaddr_in addr = {0};
+    struct timeval timeout = { 0, 100000 }, now;
+
+    // Close down any existing socket, after the receiver has noticed
+    if (Cluster.fd >= 0) {
+        Cluster.running = 0;
+        pthread_join(Cluster.receiver, NULL);
+        close(Cluster.fd), Cluster.fd = -1;
+    }
+
+    if ((Cluster.port = port) <= 0)
+        return false;
+
+    addr.sin_family      = AF_INET;
+    addr.sin_port        = htons((uint16_t) port);
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+
+    if (   (Cluster.fd = socket(AF_INET, SOCK_DGRAM, 0)) < 0
+        || setsockopt(Cluster.fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout))
+        || bind(Cluster.fd, (struct sockaddr*) &addr, sizeof(addr))) {
+        if (Cluster.fd >= 0) close(Cluster.fd);
+        return (Cluster.fd = -1), false;
+    }
+
+    // Each process only needs an identifier unlikely to match another's
+    gettimeofday(&now, NULL);
+    Cluster.id = ((uint64_t) getpid() << 40) ^ ((uint64_t) now.tv_sec << 20) ^ (uint64_t) now.tv_usec;
+
+    Cluster.running = 1;
+    pthread_create(&Cluster.receiver, NULL, &cluster_receive, NULL);
+    return true;
+}
+
+int cluster_set_peers(const char *list) {
+
+    // Parse a comma separated list of host:port pairs. Those which fail
+    // to resolve are reported and skipped, as are any beyond the limit
+
+    char copy[4096], *saveptr = NULL;
+    struct addrinfo hints = { .ai_family = AF_INET, .ai_socktype = SOCK_DGRAM };
+
+    Cluster.npeers = 0;
+    snprintf(copy, sizeof(copy), "%s", list);
+
+    for (char *peer = strtok_r(copy, ", ", &saveptr); peer; peer = strtok_r(NULL, ", ", &saveptr)) {
+
+        struct addrinfo *result = NULL;
+        char *port = strrchr(peer, ':');
+
+        if (port == NULL || Cluster.npeers == CLUSTER_PEERS_MAX) {
+            printf("info string unable to add cluster peer %s\n", peer);
+            continue;
+        }
+
+        *port++ = '\0';
+
+        if (getaddrinfo(peer, port, &hints, &result) || result == NULL) {
+            printf("info string unable to resolve cluster peer %s:%s\n", peer, port);
+            continue;
+        }
+
+        memcpy(&Cluster.addrs[Cluster.npeers++], result->ai_addr, sizeof(struct sockaddr_in));
+        freeaddrinfo(result);
+    }
+
+    return Cluster.npeers;
+}
+
+void cluster_new_search(uint64_t root) {
+
+    pthread_mutex_lock(&Cluster.lock);
+    Cluster.searching = true;
+    Cluster.root      = root;
+    Cluster.nstatus   = 0;
+    ClusterSharing    = Cluster.fd >= 0 && Cluster.npeers > 0;
+    pthread_mutex_unlock(&Cluster.lock);
+}
+
+void cluster_end_search() {
+
+    pthread_mutex_lock(&Cluster.lock);
+    Cluster.searching = false;
+    ClusterSharing    = 0;
+    pthread_mutex_unlock(&Cluster.lock);
+}
+
+void cluster_share(Thread *thread, uint64_t hash, uint16_t move, int value, int eval, int depth, int bound) {
+
+    ClusterBatch *batch = &thread->cluster;
+
+    batch->entries[batch->header.count++] = (ClusterEntry) {
+        hash, (int16_t) value, (int16_t) eval, move, (int8_t) depth, (uint8_t) bound
+    };
+
+    if (batch->header.count == CLUSTER_BATCH)
+        cluster_flush(thread);
+}
+
+void cluster_flush(Thread *thread) {
+
+    ClusterBatch *batch = &thread->cluster;
+
+    if (!batch->header.count)
+        return;
+
+    batch->header.magic  = CLUSTER_MAGIC;
+    batch->header.type   = CLUSTER_ENTRIES;
+    batch->header.sender = Cluster.id;
+
+    cluster_send(batch, sizeof(ClusterHeader) + batch->header.count * sizeof(ClusterEntry));
+    __atomic_fetch_add(&Cluster.sent, batch->header.count, __ATOMIC_RELAXED);
+    batch->header.count = 0;
+}
+
+void cluster_report(Thread *thread) {
+
+    // Sent by the main thread after each completed depth, so that the
+    // root process may count our nodes, and consider our line of play
+
+    struct { ClusterHeader header; ClusterStatus status; } datagram = {0};
+    const PVariation *pv = &thread->pvs[thread->completed];
+
+    if (!ClusterSharing)
+        return;
+
+    datagram.header = (ClusterHeader) { CLUSTER_MAGIC, CLUSTER_STATUS, 0, Cluster.id };
+    datagram.status.root   = Cluster.root;
+    datagram.status.nodes  = nodesSearchedThreadPool(thread->threads);
+    datagram.status.depth  = thread->completed;
+    datagram.status.score  = pv->score;
+    datagram.status.best   = pv->length > 0 ? pv->line[0] : NONE_MOVE;
+    datagram.status.ponder = pv->length > 1 ? pv->line[1] : NONE_MOVE;
+
+    cluster_send(&datagram, sizeof(datagram));
+}
+
+uint64_t cluster_nodes() {
+
+    uint64_t nodes = 0;
+
+    pthread_mutex_lock(&Cluster.lock);
+    for (int i = 0; i < Cluster.nstatus; i++)
+        nodes += Cluster.statuses[i].status.nodes;
+    pthread_mutex_unlock(&Cluster.lock);
+
+    return nodes;
+}
+
+static bool cluster_playable(Thread *threads, const Board *board, const ClusterStatus *status) {
+
+    // A status is only matched to our root by its hash, so a collision or a
+    // corrupt datagram could name any move. Only a legal root move, which
+    // is also one we were permitted to search, may be taken as our own
+
+    Board copy;
+
+    memcpy(&copy, board, sizeof(Board));
+    copy.thread = NULL;
+
+    return status->best != NONE_MOVE
+        && moveIsLegal(&copy, status->best)
+        && moveIsInRootMoves(threads, status->best);
+}
+
+static uint16_t cluster_ponder(const Board *board, uint16_t best, uint16_t ponder) {
+
+    // The ponder move must also be legal, once the best move has been played
+
+    Board copy;
+    Undo undo[1];
+
+    memcpy(&copy, board, sizeof(Board));
+    copy.thread = NULL;
+    applyMove(&copy, best, undo);
+
+    return ponder != NONE_MOVE && moveIsLegal(&copy, ponder) ? ponder : NONE_MOVE;
+}
+
+bool cluster_select(Thread *threads, const Board *board, int *depth, int *score, uint16_t *best, uint16_t *ponder) {
+
+    // Peers are compared to our own best line with the rules used for
+    // the Threads, but we only defer to a peer with a greater depth
+
+    int found = -1;
+
+    pthread_mutex_lock(&Cluster.lock);
+
+    for (int i = 0; i < Cluster.nstatus; i++) {
+
+        const ClusterStatus *status = &Cluster.statuses[i].status;
+
+        if (    status->depth > *depth
+            && (status->score > *score || *score < MATE_IN_MAX)
+            &&  cluster_playable(threads, board, status)) {
+            *depth = status->depth, *score = status->score;
+            *best  = status->best,  *ponder = status->ponder;
+            found  = i;
+        }
+    }
+
+    pthread_mutex_unlock(&Cluster.lock);
+
+    if (found != -1)
+        *ponder = cluster_ponder(board, *best, *ponder);
+
+    return found != -1;
+}
+
+void cluster_report_stats() {
+
+    if (Cluster.fd < 0 || !Cluster.npeers)
+        return;
+
+    // The receiver is still writing, so take a consistent snapshot
+    pthread_mutex_lock(&Cluster.lock);
+
+    printf("info string cluster peers %d responding %d sent %"PRIu64" received %"PRIu64
+           " stored %"PRIu64" skipped %"PRIu64"\n", Cluster.npeers, Cluster.nstatus,
+           __atomic_load_n(&Cluster.sent, __ATOMIC_RELAXED), Cluster.received, Cluster.stats.stores - Cluster.stats.skipped,
+           Cluster.stats.skipped);
+
+    pthread_mutex_unlock(&Cluster.lock);
+}
+
+#else
+
+bool cluster_init(int port) { (void) port; return false; }
+int cluster_set_peers(const char *list) { (void) list; return 0; }
+
+void cluster_new_search(uint64_t root) { (void) root; }
+void cluster_end_search() {}
+
+void cluster_share(Thread *thread, uint64_t hash, uint16_t move, int value, int eval, int depth, int bound) {
+    (void) thread; (void) hash; (void) move; (void) value; (void) eval; (void) depth; (void) bound;
+}
+
+void cluster_flush(Thread *thread) { (void) thread; }
+void cluster_report(Thread *thread) { (void) thread; }
+
+uint64_t cluster_nodes() { return 0; }
+
+bool cluster_select(Thread *threads, const Board *board, int *depth, int *score, uint16_t *best, uint16_t *ponder) {
+    (void) threads; (void) board; (void) depth; (void) score; (void) best; (void) ponder; return false;
+}
+
+void cluster_report_stats() {}
+
+#endif
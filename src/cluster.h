@@ -0,0 +1,84 @@
+/*
+  Ethereal is a UCI chess playing engine authored by Andrew Grant.
+  <https://github.com/AndyGrant/Ethereal>     <andrew@grantnet.us>
+
+  Ethereal is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Ethereal is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "types.h"
+
+/// Several Ethereal processes, typically one per host of a rack, may search the
+/// same position together. Each runs its Thread Pool as usual, sharing its own
+/// Table, while also sending every Entry stored at or above ClusterDepth to the
+/// other processes over UDP. Entries arrive asynchronously, and are stored into
+/// the receiver's Table as if they had been found locally. The main thread of
+/// each process also sends a status after every completed depth, holding its
+/// root, node count, and best line. Any process acts as the root for its own
+/// search, by adding the nodes of the peers searching the same root to its UCI
+/// reports, and by taking a peer's line if it reached a greater depth.
+///
+/// Every process is driven by its own UCI commands, such as with a tool which
+/// fans the commands of one GUI out to each host. Hosts are expected to be
+/// identical, so Entries are sent in the native byte order. The magic mixes in
+/// the protocol version and the layout of a batch, so that peers which would
+/// misread each other's datagrams ignore them. Lost datagrams are simply lost.
+/// Only POSIX sockets over IPv4 are supported; elsewhere it is never enabled.
+
+enum {
+    CLUSTER_DEPTH_DEFAULT = 10,
+    CLUSTER_BATCH         = 80, // Entries per datagram, within a 1500 byte MTU
+    CLUSTER_PEERS_MAX     = 64,
+    CLUSTER_VERSION       = 1,  // Bumped whenever the contents of a datagram change
+};
+
+struct ClusterHeader {
+    uint32_t magic;
+    uint16_t type, count;
+    uint64_t sender;  // Random identifier of the sending process
+};
+
+struct ClusterEntry {
+    uint64_t hash;
+    int16_t value, eval; // The value is as stored, independent of the height
+    uint16_t move;
+    int8_t depth;
+    uint8_t bound;
+};
+
+struct ClusterBatch {
+    ClusterHeader header;
+    ClusterEntry entries[CLUSTER_BATCH];
+};
+
+// "ETHC", mixed with the protocol version and the layout of a ClusterBatch
+#define CLUSTER_MAGIC (0x45544843u ^ ((uint32_t) CLUSTER_VERSION << 24) \
+                     ^ ((uint32_t) sizeof(ClusterEntry) << 16) ^ (uint32_t) CLUSTER_BATCH)
+
+bool cluster_init(int port);
+int cluster_set_peers(const char *list);
+
+void cluster_new_search(uint64_t root);
+void cluster_end_search();
+
+void cluster_share(Thread *thread, uint64_t hash, uint16_t move, int value, int eval, int depth, int bound);
+void cluster_flush(Thread *thread);
+void cluster_report(Thread *thread);
+
+uint64_t cluster_nodes();
+bool cluster_select(Thread *threads, const Board *board, int *depth, int *score, uint16_t *best, uint16_t *ponder);
+void cluster_report_stats();
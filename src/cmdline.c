@@ -17,16 +17,28 @@
 */
 
 #include <inttypes.h>
+#include <math.h>
+#include <pthread.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
+#include "attacks.h"
 #include "bitboards.h"
 #include "board.h"
 #include "cmdline.h"
+#include "evaluate.h"
+#include "gendata.h"
+#include "microbench.h"
 #include "move.h"
+#include "network.h"
+#include "nnchain.h"
+#include "nnshuffle.h"
+#include "perfcounters.h"
+#include "perft.h"
 #include "pgn.h"
 #include "search.h"
+#include "searchstats.h"
 #include "thread.h"
 #include "timeman.h"
 #include "transposition.h"
@@ -35,6 +47,216 @@
 
 #include "nnue/nnue.h"
 
+extern int HelperSchedule;      // Defined by search.c
+extern int PerfCountersEnabled; // Defined by perfcounters.c
+
+#define BENCH_MAX_POSITIONS 256
+#define BENCH_MAX_CONFIGS    16
+#define BENCH_MAX_RUNS      100
+
+typedef struct BenchRun {
+    int scores[BENCH_MAX_POSITIONS];
+    double times[BENCH_MAX_POSITIONS];
+    uint64_t nodes[BENCH_MAX_POSITIONS];
+    uint16_t bestMoves[BENCH_MAX_POSITIONS];
+    uint16_t ponderMoves[BENCH_MAX_POSITIONS];
+    uint64_t depthNodes[MAX_PLY];
+    double depthTimes[MAX_PLY];
+    uint64_t totalNodes;
+    double elapsed;
+    TTStats stats;
+    PerfCounters *perf; // Per Thread, summed over the positions
+} BenchRun;
+
+typedef struct BenchSummary {
+    int nthreads;
+    double npsMean, npsStddev, timeMean, timeStddev, timeMin, ttdMean;
+    double speedup, ttdSpeedup, efficiency;
+    bool stable;
+} BenchSummary;
+
+static void benchMoments(const double *values, int count, double *mean, double *stddev, double *min) {
+
+    // Sample mean, sample standard deviation, and minimum of a set of values
+    double sum = 0.0, sq = 0.0;
+    *min = 0.0;
+
+    for (int i = 0; i < count; i++)
+        sum += values[i], *min = i ? MIN(*min, values[i]) : values[i];
+
+    *mean = sum / count;
+
+    for (int i = 0; i < count; i++)
+        sq += (values[i] - *mean) * (values[i] - *mean);
+
+    *stddev = count > 1 ? sqrt(sq / (count - 1)) : 0.0;
+}
+
+static void benchSearch(const char **fens, int count, int depth, int nthreads, int megabytes, bool report, BenchRun *run) {
+
+    Board board;
+    TTStats stats;
+    Limits limits = {0};
+
+    // Every run starts from a new Table and fresh Threads, which keeps
+    // the node counts of a single threaded run identical from run to run
+    memset(run, 0, sizeof(BenchRun));
+    run->perf = calloc(nthreads, sizeof(PerfCounters));
+    tt_init(nthreads, megabytes);
+    run->elapsed = get_real_time();
+    Thread *threads = createThreadPool(nthreads);
+
+    // Initialize a "go depth <x>" search
+    limits.multiPV        = 1;
+    limits.limitedByDepth = 1;
+    limits.depthLimit     = depth;
+
+    for (int i = 0; i < count; i++) {
+
+        // Perform the search on the position. The positions are unrelated,
+        // so nothing is carried over between them by clearSearchCarry()
+        limits.start = get_real_time();
+        boardFromFEN(&board, fens[i], 0);
+        clearSearchCarry();
+        getBestMove(threads, &board, &limits, &run->bestMoves[i], &run->ponderMoves[i], &run->scores[i]);
+
+        // Stat collection for later printing
+        run->times[i] = get_real_time() - limits.start;
+        run->nodes[i] = nodesSearchedThreadPool(threads);
+        run->totalNodes += run->nodes[i];
+        statsThreadPool(threads, &stats);
+        tt_merge_stats(&run->stats, &stats);
+
+        for (int t = 0; t < nthreads; t++)
+            perf_counters_merge(&run->perf[t], &threads[t].perf);
+
+        // Sum the time and nodes needed to reach each depth
+        for (int d = 1; d <= depth; d++) {
+            run->depthNodes[d] += threads->depthNodes[d];
+            run->depthTimes[d] += threads->depthTimes[d];
+        }
+
+        tt_clear(nthreads); // Reset TT between searches
+    }
+
+    run->elapsed = get_real_time() - run->elapsed;
+
+    // Search statistics are summed over every position, for SEARCHSTATS=1 builds
+    if (USE_SEARCH_STATS && report) search_stats_report(threads);
+
+    deleteThreadPool(threads);
+}
+
+static void benchSummarize(BenchRun *runs, int nruns, int nthreads, int depth, BenchSummary *summary) {
+
+    double nps[BENCH_MAX_RUNS] = {0}, times[BENCH_MAX_RUNS] = {0}, ttds[BENCH_MAX_RUNS] = {0}, unused;
+
+    for (int r = 0; r < nruns; r++) {
+        nps[r]   = 1000.0 * runs[r].totalNodes / (runs[r].elapsed + 1);
+        times[r] = runs[r].elapsed;
+        ttds[r]  = runs[r].depthTimes[depth];
+    }
+
+    summary->nthreads = nthreads;
+    benchMoments(nps, nruns, &summary->npsMean, &summary->npsStddev, &unused);
+    benchMoments(times, nruns, &summary->timeMean, &summary->timeStddev, &summary->timeMin);
+    benchMoments(ttds, nruns, &summary->ttdMean, &unused, &unused);
+
+    // A single threaded search must be reproducible, so flag any drift
+    summary->stable = TRUE;
+    for (int r = 1; r < nruns; r++)
+        summary->stable &= runs[r].totalNodes == runs[0].totalNodes;
+}
+
+static void benchWriteCSV(FILE *fout, BenchRun *runs, BenchSummary *summaries, int nconfigs, int nruns, int count, int depth) {
+
+    // One row per search, leaving any aggregation to the reader
+    fprintf(fout, "threads,run,position,depth,nodes,ms,nps,score,best,ponder\n");
+
+    for (int c = 0; c < nconfigs; c++) {
+        for (int r = 0; r < nruns; r++) {
+
+            BenchRun *run = &runs[c * nruns + r];
+
+            for (int i = 0; i < count; i++) {
+
+                char bestStr[6], ponderStr[6];
+                moveToString(run->bestMoves[i], bestStr, 0);
+                moveToString(run->ponderMoves[i], ponderStr, 0);
+
+                fprintf(fout, "%d,%d,%d,%d,%"PRIu64",%.3f,%"PRIu64",%d,%s,%s\n",
+                    summaries[c].nthreads, r + 1, i + 1, depth, run->nodes[i], run->times[i],
+                    (uint64_t) (1000.0 * run->nodes[i] / (run->times[i] + 1)),
+                    run->scores[i], bestStr, ponderStr);
+            }
+        }
+    }
+}
+
+static void benchWriteJSON(FILE *fout, BenchRun *runs, BenchSummary *summaries, int nconfigs, int nruns, int count, int depth, int megabytes) {
+
+    fprintf(fout, "{\n  \"depth\": %d,\n  \"hash\": %d,\n  \"positions\": %d,\n  \"runs\": %d,\n",
+        depth, megabytes, count, nruns);
+    fprintf(fout, "  \"signature\": %"PRIu64",\n  \"configs\": [\n", runs[0].totalNodes);
+
+    for (int c = 0; c < nconfigs; c++) {
+
+        BenchSummary *s = &summaries[c];
+        BenchRun *first = &runs[c * nruns];
+
+        fprintf(fout, "    {\n      \"threads\": %d,\n      \"stable\": %s,\n",
+            s->nthreads, s->stable ? "true" : "false");
+
+        fprintf(fout, "      \"nodes\": [");
+        for (int r = 0; r < nruns; r++)
+            fprintf(fout, "%s%"PRIu64, r ? ", " : "", runs[c * nruns + r].totalNodes);
+        fprintf(fout, "],\n");
+
+        fprintf(fout, "      \"nps\": { \"mean\": %.0f, \"stddev\": %.0f },\n", s->npsMean, s->npsStddev);
+        fprintf(fout, "      \"ms\": { \"mean\": %.1f, \"stddev\": %.1f, \"min\": %.1f },\n",
+            s->timeMean, s->timeStddev, s->timeMin);
+        fprintf(fout, "      \"ttd_ms\": %.1f,\n      \"speedup\": %.3f,\n", s->ttdMean, s->speedup);
+        fprintf(fout, "      \"ttd_speedup\": %.3f,\n      \"efficiency\": %.3f,\n", s->ttdSpeedup, s->efficiency);
+
+        fprintf(fout, "      \"searches\": [\n");
+
+        for (int i = 0; i < count; i++) {
+
+            double times[BENCH_MAX_RUNS], mean, stddev, min;
+            for (int r = 0; r < nruns; r++)
+                times[r] = runs[c * nruns + r].times[i];
+            benchMoments(times, nruns, &mean, &stddev, &min);
+
+            char bestStr[6];
+            moveToString(first->bestMoves[i], bestStr, 0);
+
+            fprintf(fout, "        { \"position\": %d, \"nodes\": %"PRIu64", \"score\": %d, \"best\": \"%s\", "
+                "\"ms\": { \"mean\": %.3f, \"stddev\": %.3f, \"min\": %.3f } }%s\n",
+                i + 1, first->nodes[i], first->scores[i], bestStr, mean, stddev, min, i + 1 < count ? "," : "");
+        }
+
+        fprintf(fout, "      ]\n    }%s\n", c + 1 < nconfigs ? "," : "");
+    }
+
+    fprintf(fout, "  ]\n}\n");
+}
+
+static void benchReportCounters(const BenchRun *run, int nthreads) {
+
+    // Report each Thread, summed over every position, and then all of them
+
+    char label[32];
+    PerfCounters total = {0};
+
+    for (int t = 0; t < nthreads; t++) {
+        snprintf(label, sizeof(label), "thread %d", t);
+        perf_counters_report(&run->perf[t], label);
+        perf_counters_merge(&total, &run->perf[t]);
+    }
+
+    perf_counters_report(&total, "total");
+}
+
 static void runBenchmark(int argc, char **argv) {
 
     static const char *Benchmarks[] = {
@@ -42,73 +264,144 @@ static void runBenchmark(int argc, char **argv) {
         ""
     };
 
-    Board board;
-    Thread *threads;
-    Limits limits = {0};
-
-    int scores[256];
-    double times[256];
-    uint64_t nodes[256];
-    uint16_t bestMoves[256];
-    uint16_t ponderMoves[256];
-
-    double time;
-    uint64_t totalNodes = 0ull;
+    int count = 0, nconfigs = 0;
+    int configs[BENCH_MAX_CONFIGS];
+    char threadList[256] = "1";
 
     int depth     = argc > 2 ? atoi(argv[2]) : 13;
-    int nthreads  = argc > 3 ? atoi(argv[3]) :  1;
     int megabytes = argc > 4 ? atoi(argv[4]) : 16;
+    int nruns     = argc > 7 ? MAX(1, MIN(BENCH_MAX_RUNS, atoi(argv[7]))) : 1;
+    char *output  = argc > 8 && !strEquals(argv[8], "None") ? argv[8] : NULL;
+
+    // Thread counts may be given as a list, such as 1,2,4,8, for a sweep
+    if (argc > 3) strncpy(threadList, argv[3], sizeof(threadList) - 1);
+    for (char *t = strtok(threadList, ","); t && nconfigs < BENCH_MAX_CONFIGS; t = strtok(NULL, ","))
+        configs[nconfigs++] = MAX(1, atoi(t));
+    if (!nconfigs) configs[nconfigs++] = 1; // An empty list is a single thread
 
-    if (argc > 5) {
+    if (argc > 5 && !strEquals(argv[5], "None")) {
         nnue_init(argv[5]);
         printf("info string set EvalFile to %s\n", argv[5]);
     }
 
-    tt_init(nthreads, megabytes);
-    time = get_real_time();
-    threads = createThreadPool(nthreads);
+    if (argc > 6) {
+        HelperSchedule = strEquals(argv[6], "skip") ? HELPER_SCHEDULE_SKIP
+                       : strEquals(argv[6], "busy") ? HELPER_SCHEDULE_BUSY : HELPER_SCHEDULE_NONE;
+        printf("info string set HelperSchedule to %s\n", argv[6]);
+    }
 
-    // Initialize a "go depth <x>" search
-    limits.multiPV        = 1;
-    limits.limitedByDepth = 1;
-    limits.depthLimit     = depth;
+    while (count < BENCH_MAX_POSITIONS && strcmp(Benchmarks[count], "")) count++;
 
-    for (int i = 0; strcmp(Benchmarks[i], ""); i++) {
+    // Hardware counters never affect the search, so they are always collected
+    PerfCountersEnabled = 1;
 
-        // Perform the search on the position
-        limits.start = get_real_time();
-        boardFromFEN(&board, Benchmarks[i], 0);
-        getBestMove(threads, &board, &limits, &bestMoves[i], &ponderMoves[i], &scores[i]);
+    BenchRun *runs = malloc(sizeof(BenchRun) * nconfigs * nruns);
+    BenchSummary summaries[BENCH_MAX_CONFIGS] = {0};
 
-        // Stat collection for later printing
-        times[i] = get_real_time() - limits.start;
-        nodes[i] = nodesSearchedThreadPool(threads);
+    for (int c = 0; c < nconfigs; c++) {
 
-        tt_clear(nthreads); // Reset TT between searches
+        for (int r = 0; r < nruns; r++)
+            benchSearch(Benchmarks, count, depth, configs[c], megabytes, !c && !r, &runs[c * nruns + r]);
+
+        benchSummarize(&runs[c * nruns], nruns, configs[c], depth, &summaries[c]);
+
+        // Scaling is relative to the first thread count in the sweep
+        summaries[c].speedup    = summaries[c].npsMean / summaries[0].npsMean;
+        summaries[c].ttdSpeedup = summaries[0].ttdMean / MAX(1.0, summaries[c].ttdMean);
+        summaries[c].efficiency = summaries[c].ttdSpeedup * configs[0] / configs[c];
     }
 
+    // The detailed report describes the first run of the first thread count,
+    // which is the deterministic signature when that count is a single thread
+
+    BenchRun *first = &runs[0];
+
     printf("\n===============================================================================\n");
 
-    for (int i = 0; strcmp(Benchmarks[i], ""); i++) {
+    for (int i = 0; i < count; i++) {
 
         // Convert moves to typical UCI notation
         char bestStr[6], ponderStr[6];
-        moveToString(bestMoves[i], bestStr, 0);
-        moveToString(ponderMoves[i], ponderStr, 0);
+        moveToString(first->bestMoves[i], bestStr, 0);
+        moveToString(first->ponderMoves[i], ponderStr, 0);
 
         // Log all collected information for the current position
-        printf("[# %2d] %5d cp  Best:%6s  Ponder:%6s %12d nodes %12d nps\n", i + 1, scores[i],
-            bestStr, ponderStr, (int)nodes[i], (int)(1000.0f * nodes[i] / (times[i] + 1)));
+        printf("[# %2d] %5d cp  Best:%6s  Ponder:%6s %12"PRIu64" nodes %12"PRIu64" nps %8.0f ms\n",
+            i + 1, first->scores[i], bestStr, ponderStr, first->nodes[i],
+            (uint64_t) (1000.0 * first->nodes[i] / (first->times[i] + 1)), first->times[i]);
     }
 
     printf("===============================================================================\n");
 
+    // Report how long it took to reach each depth, for comparing thread scaling
+    for (int d = 1; d <= depth; d++)
+        printf("[D %2d] %12.0f ms %33"PRIu64" nodes\n", d, first->depthTimes[d], first->depthNodes[d]);
+
+    printf("===============================================================================\n");
+
+    // Report the spread across runs, and the scaling across thread counts
+    if (nruns > 1 || nconfigs > 1) {
+
+        for (int c = 0; c < nconfigs; c++) {
+            BenchSummary *s = &summaries[c];
+            printf("[T %2d] %12.0f nps +- %4.1f%% %8.0f ms min %6.2fx nps %6.2fx ttd %5.1f%% eff%s\n",
+                s->nthreads, s->npsMean, 100.0 * s->npsStddev / MAX(1.0, s->npsMean), s->timeMin,
+                s->speedup, s->ttdSpeedup, 100.0 * s->efficiency, s->stable || s->nthreads > 1 ? "" : "  UNSTABLE");
+        }
+
+        printf("===============================================================================\n");
+    }
+
+    if (output != NULL) {
+
+        FILE *fout = fopen(output, "w");
+        int length = strlen(output);
+
+        if (fout == NULL)
+            printf("info string unable to open %s\n", output);
+
+        else {
+            if (length > 5 && strEquals(output + length - 5, ".json"))
+                benchWriteJSON(fout, runs, summaries, nconfigs, nruns, count, depth, megabytes);
+            else benchWriteCSV(fout, runs, summaries, nconfigs, nruns, count, depth);
+            fclose(fout);
+        }
+    }
+
     // Report the overall statistics
-    time = get_real_time() - time;
-    for (int i = 0; strcmp(Benchmarks[i], ""); i++) totalNodes += nodes[i];
-    printf("OVERALL: %47d nodes %12d nps\n", (int)totalNodes, (int)(1000.0f * totalNodes / (time + 1)));
+    printf("info string using %s slider lookups\n", sliderIndexName());
+    uciReportMemory();
+    tt_report_stats(&first->stats);
+    benchReportCounters(first, configs[0]);
+    printf("OVERALL: %47"PRIu64" nodes %12"PRIu64" nps\n",
+        first->totalNodes, (uint64_t) summaries[0].npsMean);
+
+    for (int i = 0; i < nconfigs * nruns; i++)
+        free(runs[i].perf);
+    free(runs);
+}
 
-    deleteThreadPool(threads);
+static void runPerft(int argc, char **argv) {
+
+    Board board;
+    char fen[512] = {0};
+
+    int depth     = argc > 2 ? atoi(argv[2]) :  6;
+    int nthreads  = argc > 3 ? atoi(argv[3]) :  1;
+    int megabytes = argc > 4 ? atoi(argv[4]) : 64;
+
+    // The FEN may be given over several arguments
+    for (int i = 5; i < argc; i++)
+        strncat(fen, argv[i], sizeof(fen) - strlen(fen) - 2), strcat(fen, " ");
+
+    boardFromFEN(&board, argc > 5 ? fen : StartPosition, 0);
+
+    double start = get_real_time();
+    uint64_t nodes = perft(&board, depth, MAX(1, nthreads), MAX(1, megabytes), TRUE);
+    double elapsed = get_real_time() - start;
+
+    printf("\nNodes: %"PRIu64"\nTime:  %dms\nNPS:   %"PRIu64"\n",
+        nodes, (int) elapsed, (uint64_t) (1000.0 * nodes / (elapsed + 1)));
 }
 
 static void runEvalBook(int argc, char **argv) {
@@ -143,16 +436,219 @@ static void runEvalBook(int argc, char **argv) {
     printf("Time %dms\n", (int)(get_real_time() - start));
 }
 
+typedef struct EvalBatch {
+    FILE *fin, *fout;
+    int depth, next;
+    uint64_t sliceSize, positions, nodes;
+    pthread_mutex_t lock;
+} EvalBatch;
+
+static void* eval_batch_worker(void *vbatch) {
+
+    EvalBatch *const batch = (EvalBatch*) vbatch;
+
+    Board board;
+    TimeManager tm = {0};
+    Limits limits = {0};
+    char line[256], bestStr[6], *read;
+
+    // Each searcher is a Thread Pool of its own, without any helpers, and has
+    // a private slice of the Table. Nothing is shared besides the work queue
+    Thread *thread  = createThreadPool(1);
+    thread->ttSlice = __atomic_fetch_add(&batch->next, 1, __ATOMIC_RELAXED) * batch->sliceSize;
+
+    limits.multiPV        = 1;
+    limits.limitedByDepth = 1;
+    limits.depthLimit     = batch->depth;
+    limits.silent         = 1;
+
+    while (1) {
+
+        pthread_mutex_lock(&batch->lock);
+        read = fgets(line, sizeof(line), batch->fin);
+        pthread_mutex_unlock(&batch->lock);
+
+        if (read == NULL) break;
+
+        line[strcspn(line, "\r\n")] = '\0';
+        if (line[0] == '\0') continue;
+
+        // Start each search from scratch, making the results reproducible
+        resetThreadPool(thread); tt_clear_slice(thread);
+        boardFromFEN(&board, line, 0);
+
+        limits.start = get_real_time();
+        tm_init(&limits, &tm);
+        newSearchThreadPool(thread, &board, &limits, &tm);
+        iterativeDeepening(thread);
+
+        // Scores are saved from White's point of view
+        const PVariation *pv = &thread->pvs[thread->completed];
+        const int score = board.turn == WHITE ? pv->score : -pv->score;
+        moveToString(pv->line[0], bestStr, 0);
+
+        pthread_mutex_lock(&batch->lock);
+        fprintf(batch->fout, "%s,%d,%s,%d,%"PRIu64"\n", line, score, bestStr, thread->completed, thread->nodes);
+        batch->positions++, batch->nodes += thread->nodes;
+        pthread_mutex_unlock(&batch->lock);
+    }
+
+    deleteThreadPool(thread);
+    return NULL;
+}
+
+static void runEvalBatch(int argc, char **argv) {
+
+    // Search every FEN in a file, labelling each with a score, best move, depth
+    // and the nodes used. Rather than using all of the Threads on one position
+    // at a time, each worker searches its own positions, avoiding any Lazy SMP
+    // overhead, and Table clears. Each worker is given [hash] MB of the Table
+
+    int slices    = 1;
+    int depth     = argc > 4 ? atoi(argv[4]) : 12;
+    int nworkers  = argc > 5 ? atoi(argv[5]) :  1;
+    int megabytes = argc > 6 ? atoi(argv[6]) :  2;
+
+    EvalBatch batch = { fopen(argv[2], "r"), fopen(argv[3], "w"), depth, 0, 0ull, 0ull, 0ull, PTHREAD_MUTEX_INITIALIZER };
+    pthread_t pthreads[MAX(1, nworkers)];
+    double start = get_real_time();
+
+    if (batch.fin == NULL || batch.fout == NULL) {
+        printf("Unable to open %s or %s\n", argv[2], argv[3]);
+        exit(EXIT_FAILURE);
+    }
+
+    // Table slices must be a power of two, so some may go unused
+    while (slices < nworkers) slices *= 2;
+    tt_init(nworkers, slices * megabytes);
+    batch.sliceSize = tt_partition(slices);
+
+    fprintf(batch.fout, "fen,score,bestmove,depth,nodes\n");
+
+    for (int i = 0; i < nworkers; i++)
+        pthread_create(&pthreads[i], NULL, eval_batch_worker, &batch);
+
+    for (int i = 0; i < nworkers; i++)
+        pthread_join(pthreads[i], NULL);
+
+    tt_partition(1);
+
+    const double elapsed = get_real_time() - start;
+    printf("Searched %"PRIu64" positions in %dms, %d positions/second, %"PRIu64" nps\n",
+        batch.positions, (int) elapsed, (int) (1000.0 * batch.positions / (elapsed + 1)),
+        (uint64_t) (1000.0 * batch.nodes / (elapsed + 1)));
+
+    fclose(batch.fin); fclose(batch.fout);
+}
+
+static void runGenData(int argc, char **argv) {
+
+    // Play self-play games from an EPD book as nndata samples. Each worker
+    // plays its own games, one Thread each, with [hash] MB of the Table.
+    // Moves are searched to [nodes], or to [depth] if it is given instead
+
+    GenDataOptions options = {0};
+    options.games        = argc > 4 ? atoi(argv[4]) : 1000;
+    options.workers      = argc > 5 ? atoi(argv[5]) :    1;
+    options.nodes        = argc > 6 ? atoll(argv[6]) : 5000;
+    options.depth        = argc > 7 ? atoi(argv[7]) :    0;
+    options.random_plies = argc > 8 ? atoi(argv[8]) :    0;
+    options.megabytes    = argc > 9 ? atoi(argv[9]) :    2;
+
+    // Without either limit the searches would never end
+    if (!options.nodes && !options.depth)
+        options.nodes = 5000;
+
+    options.workers = MAX(1, options.workers);
+    generate_data(argv[2], argv[3], &options);
+}
+
+static void runNNEval(const char *fname, const char *fout) {
+
+    // Label every FEN in a file with its static NNUE evaluation, from White's
+    // point of view, interpolated by phase as evaluateBoard() would do it.
+    // Positions are read and scored in large batches, without any searching
+
+    const int BatchSize = 16384;
+
+    char (*lines)[256] = malloc(sizeof(*lines) * BatchSize);
+    Board *boards      = malloc(sizeof(Board) * BatchSize);
+    int *scores        = malloc(sizeof(int) * BatchSize);
+
+    FILE *fin = fopen(fname, "r");
+    FILE *out = fopen(fout, "w");
+    double start = get_real_time();
+    int count, total = 0;
+
+    if (fin == NULL || out == NULL) {
+        printf("Unable to open %s or %s\n", fname, fout);
+        exit(EXIT_FAILURE);
+    }
+
+    do {
+
+        for (count = 0; count < BatchSize && fgets(lines[count], 256, fin) != NULL; count++) {
+            lines[count][strcspn(lines[count], "\r\n")] = '\0';
+            boardFromFEN(&boards[count], lines[count], 0);
+        }
+
+        nnue_evaluate_batch(boards, count, scores);
+
+        for (int i = 0; i < count; i++) {
+
+            const int phase = 4 * popcount(boards[i].pieces[QUEEN])
+                            + 2 * popcount(boards[i].pieces[ROOK ])
+                            + 1 * popcount(boards[i].pieces[KNIGHT] | boards[i].pieces[BISHOP]);
+
+            const int score = boards[i].turn == WHITE ? scores[i] : -scores[i];
+            const int eval  = (ScoreMG(score) * phase + ScoreEG(score) * (24 - phase)) / 24;
+
+            fprintf(out, "%s %d\n", lines[i], eval);
+        }
+
+        total += count;
+
+    } while (count == BatchSize);
+
+    printf("Evaluated %d positions in %dms\n", total, (int)(get_real_time() - start));
+
+    fclose(fin); fclose(out);
+    free(lines); free(boards); free(scores);
+}
+
 void handleCommandLine(int argc, char **argv) {
 
     // Output all the wonderful things we can do from the Command Line
     if (argc > 1 && strEquals(argv[1], "--help")) {
-        printf("\nbench     [depth=13] [threads=1] [hash=16] [NNUE=None]");
-        printf("\n          Run searches on a set of positions to compute a hash\n");
+        printf("\nbench     [depth=13] [threads=1] [hash=16] [NNUE=None] [schedule=none] [runs=1] [output=None]");
+        printf("\n          Run searches on a set of positions to compute a hash. Threads may be a");
+        printf("\n          list such as 1,2,4,8 to measure scaling, and the output may be .json or .csv\n");
+        printf("\nmicrobench [samples=10] [NNUE=None] [hash=16,256,1024]");
+        printf("\n          Time the hot kernels of the engine in isolation, in ns per operation\n");
         printf("\nevalbook  [input-file] [depth=12] [threads=1] [hash=2]");
         printf("\n          Evaluate all positions in a FEN file using various options\n");
-        printf("\nnndata    [input-file] [output-file]");
+        printf("\nevalbatch [input-file] [output-file] [depth=12] [workers=1] [hash=2]");
+        printf("\n          Search FENs in parallel, one per worker, to a CSV of results\n");
+        printf("\ngendata   [epd-file] [output-file] [games=1000] [workers=1] [nodes=5000] [depth=0] [random=0] [hash=2]");
+        printf("\n          Play self-play games in parallel, saving the positions as nndata\n");
+        printf("\nnndata    [input-file] [output-file] [threads=1] [ordered=1] [format=halfkp|chain]");
         printf("\n          Build an nndata from a stripped pgn file\n");
+        printf("\nnnexpand  [input-file] [output-file]");
+        printf("\n          Expand a chained nndata file into HalfKPSamples\n");
+        printf("\nnnshuffle [output-prefix] [shards] [memory-mb] [input-files ...]");
+        printf("\n          Shuffle and deduplicate nndata files into output shards\n");
+        printf("\nnneval    [input-file] [output-file]");
+        printf("\n          Label each FEN in a file with its static NNUE evaluation\n");
+        printf("\nnnquantize [input-file] [output-file]");
+        printf("\n          Convert an NNUE file to use quantized L2 and L3 layers\n");
+        printf("\nnnconvert [input-file] [output-file]");
+        printf("\n          Save an NNUE file pre-transformed for this CPU's kernels\n");
+        printf("\npkconvert [input-file] [output-file]");
+        printf("\n          Convert the text form of the PKNetwork into the header of its weights\n");
+        printf("\nperft     [depth=6] [threads=1] [hash=64] [FEN=startpos]");
+        printf("\n          Count and divide the leaf nodes of the legal move tree\n");
+        printf("\nperftsuite [input-file] [depth=max] [threads=1]");
+        printf("\n          Verify the PERFT counts of every position in an EPD file\n");
         exit(EXIT_SUCCESS);
     }
 
@@ -162,15 +658,86 @@ void handleCommandLine(int argc, char **argv) {
         exit(EXIT_SUCCESS);
     }
 
+    // Time each of the engine's hot kernels in isolation
+    if (argc > 1 && strEquals(argv[1], "microbench")) {
+        if (argc > 3 && !strEquals(argv[3], "None")) nnue_init(argv[3]);
+        microbench(argc > 2 ? atoi(argv[2]) : 10, argc > 4 ? argv[4] : "16,256,1024");
+        exit(EXIT_SUCCESS);
+    }
+
+    // Search all positions in a datafile in parallel, and save the results
+    if (argc > 3 && strEquals(argv[1], "evalbatch")) {
+        runEvalBatch(argc, argv);
+        exit(EXIT_SUCCESS);
+    }
+
     // Evaluate all positions in a datafile to a given depth
     if (argc > 2 && strEquals(argv[1], "evalbook")) {
         runEvalBook(argc, argv);
         exit(EXIT_SUCCESS);
     }
 
-    // Convert a PGN file to an nndata file
+    // Count the leaf nodes of a position, dividing by root move
+    if (argc > 1 && strEquals(argv[1], "perft")) {
+        runPerft(argc, argv);
+        exit(EXIT_SUCCESS);
+    }
+
+    // Verify all PERFT counts in an EPD file, failing on mismatches
+    if (argc > 2 && strEquals(argv[1], "perftsuite")) {
+        int depth    = argc > 3 ? atoi(argv[3]) : MAX_PLY;
+        int nthreads = argc > 4 ? atoi(argv[4]) : 1;
+        exit(perft_suite(argv[2], depth, MAX(1, nthreads)) ? EXIT_FAILURE : EXIT_SUCCESS);
+    }
+
+    // Generate an nndata file by playing self-play games in parallel
+    if (argc > 3 && strEquals(argv[1], "gendata")) {
+        runGenData(argc, argv);
+        exit(EXIT_SUCCESS);
+    }
+
+    // Convert a PGN file to an nndata file, using some number of threads
     if (argc > 3 && strEquals(argv[1], "nndata")) {
-        process_pgn(argv[2], argv[3]);
+        int nthreads = argc > 4 ? atoi(argv[4]) : 1;
+        bool ordered = argc > 5 ? atoi(argv[5]) : 1;
+        bool chained = argc > 6 && strEquals(argv[6], "chain");
+        process_pgn(argv[2], argv[3], MAX(1, nthreads), ordered, chained);
+        exit(EXIT_SUCCESS);
+    }
+
+    // Expand a chained nndata file back into HalfKPSamples
+    if (argc > 3 && strEquals(argv[1], "nnexpand")) {
+        nnchain_expand(argv[2], argv[3]);
+        exit(EXIT_SUCCESS);
+    }
+
+    // Shuffle and deduplicate nndata files into some number of shards
+    if (argc > 5 && strEquals(argv[1], "nnshuffle")) {
+        nnshuffle(argv[2], MAX(1, atoi(argv[3])), MAX(1, atoi(argv[4])), argc - 5, argv + 5);
+        exit(EXIT_SUCCESS);
+    }
+
+    // Label a FEN file with static evaluations from the NNUE
+    if (argc > 3 && strEquals(argv[1], "nneval")) {
+        runNNEval(argv[2], argv[3]);
+        exit(EXIT_SUCCESS);
+    }
+
+    // Convert an NNUE file to use integer L2 and L3 layers
+    if (argc > 3 && strEquals(argv[1], "nnquantize")) {
+        nnue_quantize(argv[2], argv[3]);
+        exit(EXIT_SUCCESS);
+    }
+
+    // Convert an NNUE file to be mapped directly by these kernels
+    if (argc > 3 && strEquals(argv[1], "nnconvert")) {
+        nnue_convert(argv[2], argv[3]);
+        exit(EXIT_SUCCESS);
+    }
+
+    // Convert the text form of the PKNetwork into the header of its weights
+    if (argc > 3 && strEquals(argv[1], "pkconvert")) {
+        convertPKNetwork(argv[2], argv[3]);
         exit(EXIT_SUCCESS);
     }
 
@@ -435,16 +435,39 @@ const int ComplexityAdjustment  = S(   0,-157);
 
 const int Tempo = 20;
 
+/* Lazy Evaluation Terms */
+
+const int LazyMargin = 1000;
+
 #undef S
 
 int evaluateBoard(Thread *thread, Board *board) {
+    bool lazy; return evaluateBoardLazy(thread, board, -MATE, MATE, &lazy);
+}
+
+// Only qsearch() passes a real window, and so only qsearch() can be handed an
+// estimate, flagged by *lazy, which is never stored as a static eval. search()
+// bases its pruning margins on the static eval, so it evaluates in full
+
+int evaluateBoardLazy(Thread *thread, Board *board, int alpha, int beta, bool *lazy) {
 
     int phase, eval, pkeval, factor = SCALE_NORMAL;
 
+    *lazy = false;
+
     // We can recognize positions we just evaluated
     if (thread->states[thread->height-1].move == NULL_MOVE)
         return -thread->states[thread->height-1].eval + 2 * Tempo;
 
+    // Or possibly have evaluated before, elsewhere in the tree
+    if (!TRACE && getCachedEvaluation(thread, board, &eval))
+        return eval;
+
+    // Calculate the game phase based on remaining material (Fruit Method)
+    phase = 4 * popcount(board->pieces[QUEEN ])
+          + 2 * popcount(board->pieces[ROOK  ])
+          + 1 * popcount(board->pieces[KNIGHT]|board->pieces[BISHOP]);
+
     // Use the NNUE unless we are in an extremely unbalanced position
     if (USE_NNUE && abs(ScoreEG(board->psqtmat)) <= 2000) {
         eval = nnue_evaluate(thread, board);
@@ -455,6 +478,20 @@ int evaluateBoard(Thread *thread, Board *board) {
 
         EvalInfo ei;
         initEvalInfo(thread, board, &ei);
+
+        // With a Pawn King entry in hand, the material, PSQT, and Pawn King
+        // terms make a cheap estimate. Far enough outside of the window, the
+        // remaining terms cannot matter, so skip computing any of the attacks
+        if (ei.pkentry != NULL) {
+
+            eval = board->psqtmat + ei.pkeval[WHITE];
+            eval = (ScoreMG(eval) * phase + ScoreEG(eval) * (24 - phase)) / 24;
+            eval = Tempo + (board->turn == WHITE ? eval : -eval);
+
+            if (eval >= beta + LazyMargin || eval <= alpha - LazyMargin)
+                return *lazy = true, eval;
+        }
+
         eval = evaluatePieces(&ei, board);
 
         pkeval = ei.pkeval[WHITE] - ei.pkeval[BLACK];
@@ -473,18 +510,16 @@ int evaluateBoard(Thread *thread, Board *board) {
         if (TRACE) T.factor = factor;
     }
 
-    // Calculate the game phase based on remaining material (Fruit Method)
-    phase = 4 * popcount(board->pieces[QUEEN ])
-          + 2 * popcount(board->pieces[ROOK  ])
-          + 1 * popcount(board->pieces[KNIGHT]|board->pieces[BISHOP]);
-
     // Compute and store an interpolated evaluation from white's POV
     eval = (ScoreMG(eval) * phase
          +  ScoreEG(eval) * (24 - phase) * factor / SCALE_NORMAL) / 24;
 
     // Factor in the Tempo after interpolation and scaling, so that
     // if a null move is made, then we know eval = last_eval + 2 * Tempo
-    return Tempo + (board->turn == WHITE ? eval : -eval);
+    eval = Tempo + (board->turn == WHITE ? eval : -eval);
+
+    if (!TRACE) storeCachedEvaluation(thread, board, eval);
+    return eval;
 }
 
 int evaluatePieces(EvalInfo *ei, Board *board) {
@@ -18,6 +18,7 @@
 
 #pragma once
 
+#include <stdbool.h>
 #include <stdint.h>
 
 #include "types.h"
@@ -138,6 +139,7 @@ struct EvalInfo {
 };
 
 int evaluateBoard(Thread *thread, Board *board);
+int evaluateBoardLazy(Thread *thread, Board *board, int alpha, int beta, bool *lazy);
 int evaluatePieces(EvalInfo *ei, Board *board);
 int evaluatePawns(EvalInfo *ei, Board *board, int colour);
 int evaluateKnights(EvalInfo *ei, Board *board, int colour);
@@ -0,0 +1,231 @@
+/*
+  Ethereal is a UCI chess playing engine authored by Andrew Grant.
+  <https://github.com/AndyGrant/Ethereal>     <andrew@grantnet.us>
+
+  Ethereal is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Ethereal is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <inttypes.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "board.h"
+#include "gendata.h"
+#include "move.h"
+#include "movegen.h"
+#include "pgn.h"
+#include "search.h"
+#include "thread.h"
+#include "timeman.h"
+#include "transposition.h"
+#include "uci.h"
+
+extern int NORMALIZE_EVAL; // Defined by uci.c
+
+typedef struct GenData {
+    char **book;
+    int book_size, next_game, next_slice;
+    uint64_t slice_size, games, samples, nodes;
+    const GenDataOptions *options;
+    FILE *fout;
+    pthread_mutex_t lock;
+} GenData;
+
+static uint64_t gendata_rand(uint64_t *seed) {
+
+    // http://xoshiro.di.unimi.it/splitmix64.c
+
+    uint64_t z = (*seed += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+static void gendata_opening(GenData *data, Board *board, int game) {
+
+    Undo undo;
+    uint16_t moves[MAX_MOVES];
+    uint64_t seed = game;
+
+    // Start from a random line of the book, seeded only by the game index
+    boardFromFEN(board, data->book[gendata_rand(&seed) % data->book_size], 0);
+
+    // Followed by some number of random plies, if there are legal moves
+    for (int i = 0; i < data->options->random_plies; i++) {
+        const int size = genAllLegalMoves(board, moves);
+        if (size == 0) break;
+        applyMove(board, moves[gendata_rand(&seed) % size], &undo);
+    }
+}
+
+static int gendata_play(Thread *thread, Board *board, Limits *limits, HalfKPSample *samples, int *placed, uint64_t *nodes) {
+
+    Undo undo;
+    TimeManager tm = {0};
+    uint16_t moves[MAX_MOVES];
+
+    for (int ply = 0; ply < GENDATA_MAX_PLIES; ply++) {
+
+        // Checkmate or Stalemate, with the result from White's point of view
+        if (!genAllLegalMoves(board, moves))
+            return !board->kingAttackers ? PGN_DRAW
+                 :  board->turn == WHITE ? PGN_LOSS : PGN_WIN;
+
+        // Threefold repetition, the fifty move rule, or insufficient material
+        if (boardIsDrawn(board, 0))
+            return PGN_DRAW;
+
+        limits->start = get_real_time();
+        tm_init(limits, &tm);
+        newSearchThreadPool(thread, board, limits, &tm);
+        iterativeDeepening(thread);
+
+        const PVariation *pv = &thread->pvs[thread->completed];
+        *nodes += thread->nodes;
+
+        // Adjudicate the game as soon as a side has found a forced mate
+        if (abs(pv->score) >= MATE_IN_MAX)
+            return (pv->score > 0) == (board->turn == WHITE) ? PGN_WIN : PGN_LOSS;
+
+        // Evals are saved as they would be reported over UCI, but from White's
+        // point of view, matching the eval comments that are parsed by nndata
+        int eval = NORMALIZE_EVAL ? 100 * pv->score / 186 : pv->score;
+        if (board->turn == BLACK) eval = -eval;
+
+        // The result is unknown until the game ends, so is filled in later
+        if (halfkp_sample_is_quiet(board, pv->line[0], eval))
+            build_halfkp_sample(board, &samples[(*placed)++], PGN_DRAW, eval);
+
+        applyMove(board, pv->line[0], &undo);
+    }
+
+    return PGN_DRAW;
+}
+
+static void* gendata_worker(void *vdata) {
+
+    GenData *const data = (GenData*) vdata;
+
+    Board board;
+    Limits limits = {0};
+    int game, result, placed;
+    uint64_t nodes;
+
+    HalfKPSample *samples = malloc(sizeof(HalfKPSample) * GENDATA_MAX_PLIES);
+
+    // Each worker is a Thread Pool of its own, without any helpers, and has
+    // a private slice of the Table. Nothing is shared besides the game count
+    Thread *thread  = createThreadPool(1);
+    thread->ttSlice = __atomic_fetch_add(&data->next_slice, 1, __ATOMIC_RELAXED) * data->slice_size;
+
+    limits.multiPV        = 1;
+    limits.limitedByDepth = data->options->depth > 0;
+    limits.depthLimit     = data->options->depth;
+    limits.limitedByNodes = data->options->nodes > 0;
+    limits.nodeLimit      = data->options->nodes;
+    limits.silent         = 1;
+
+    while ((game = __atomic_fetch_add(&data->next_game, 1, __ATOMIC_RELAXED)) < data->options->games) {
+
+        // Start each game from scratch, making the results reproducible
+        resetThreadPool(thread); tt_clear_slice(thread);
+        gendata_opening(data, &board, game);
+
+        placed = 0, nodes = 0ull;
+        result = gendata_play(thread, &board, &limits, samples, &placed, &nodes);
+
+        // Samples hold the result from the side to move's point of view
+        for (int i = 0; i < placed; i++)
+            samples[i].result = samples[i].turn == BLACK ? 2 - result : result;
+
+        pthread_mutex_lock(&data->lock);
+        fwrite(samples, sizeof(HalfKPSample), placed, data->fout);
+        data->games++, data->samples += placed, data->nodes += nodes;
+        pthread_mutex_unlock(&data->lock);
+    }
+
+    deleteThreadPool(thread);
+    free(samples);
+    return NULL;
+}
+
+static int gendata_read_book(const char *fbook, char ***book) {
+
+    int size = 0, capacity = 1024;
+    char line[256];
+
+    FILE *fin = fopen(fbook, "r");
+    if (fin == NULL) return 0;
+
+    *book = malloc(sizeof(char*) * capacity);
+
+    while (fgets(line, sizeof(line), fin) != NULL) {
+
+        line[strcspn(line, "\r\n")] = '\0';
+        if (line[0] == '\0') continue;
+
+        if (size == capacity)
+            *book = realloc(*book, sizeof(char*) * (capacity *= 2));
+
+        (*book)[size++] = strdup(line);
+    }
+
+    fclose(fin);
+    return size;
+}
+
+
+void generate_data(const char *fbook, const char *fout, const GenDataOptions *options) {
+
+    int slices = 1;
+    double start = get_real_time();
+    pthread_t pthreads[MAX(1, options->workers)];
+
+    GenData data = {0};
+    data.options = options;
+    data.fout    = fopen(fout, "wb");
+    pthread_mutex_init(&data.lock, NULL);
+
+    if ((data.book_size = gendata_read_book(fbook, &data.book)) == 0 || data.fout == NULL) {
+        printf("Unable to open %s or %s\n", fbook, fout);
+        exit(EXIT_FAILURE);
+    }
+
+    // Table slices must be a power of two, so some may go unused
+    while (slices < options->workers) slices *= 2;
+    tt_init(options->workers, slices * options->megabytes);
+    data.slice_size = tt_partition(slices);
+
+    for (int i = 0; i < options->workers; i++)
+        pthread_create(&pthreads[i], NULL, gendata_worker, &data);
+
+    for (int i = 0; i < options->workers; i++)
+        pthread_join(pthreads[i], NULL);
+
+    tt_partition(1);
+
+    const double elapsed = get_real_time() - start;
+    printf("Played %"PRIu64" games in %dms, %"PRIu64" samples, %.2f games/second, %"PRIu64" nps\n",
+        data.games, (int) elapsed, data.samples, 1000.0 * data.games / (elapsed + 1),
+        (uint64_t) (1000.0 * data.nodes / (elapsed + 1)));
+
+    for (int i = 0; i < data.book_size; i++)
+        free(data.book[i]);
+
+    free(data.book);
+    fclose(data.fout);
+    pthread_mutex_destroy(&data.lock);
+}
@@ -0,0 +1,41 @@
+/*
+  Ethereal is a UCI chess playing engine authored by Andrew Grant.
+  <https://github.com/AndyGrant/Ethereal>     <andrew@grantnet.us>
+
+  Ethereal is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Ethereal is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <stdint.h>
+
+#include "types.h"
+
+/// Self-play data generation. Games are played by several workers at once,
+/// each a single Thread with a private slice of the Table, starting from a
+/// random line of an EPD book and optionally some random plies beyond that.
+/// Each move is searched to a fixed node count or depth, and the quiet
+/// positions are written as HalfKPSamples, exactly as nndata would for PGNs.
+///
+/// The opening of each game is decided only by the index of the game, so a
+/// run is reproducible regardless of the number of workers used.
+
+enum { GENDATA_MAX_PLIES = 400 };
+
+typedef struct GenDataOptions {
+    int games, workers, depth, random_plies, megabytes;
+    uint64_t nodes;
+} GenDataOptions;
+
+void generate_data(const char *fbook, const char *fout, const GenDataOptions *options);
@@ -19,6 +19,11 @@
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
+
+#if defined(USE_AVX2)
+#include <immintrin.h>
+#endif
 
 #include "bitboards.h"
 #include "board.h"
@@ -52,10 +57,11 @@ static int16_t* underlying_capture_history(Thread *thread, uint16_t move) {
 
     const int captured = history_captured_piece(thread, move);
     const int piece    = pieceType(thread->board.squares[MoveFrom(move)]);
+    const uint64_t threats = boardThreats(&thread->board);
 
     // Determine if piece evades and/or enters a threat
-    const bool threat_from = testBit(thread->board.threats, MoveFrom(move));
-    const bool threat_to   = testBit(thread->board.threats, MoveTo(move));
+    const bool threat_from = testBit(threats, MoveFrom(move));
+    const bool threat_to   = testBit(threats, MoveTo(move));
 
     assert(PAWN <= captured && captured <= QUEEN);
     assert(PAWN <= piece && piece <= KING);
@@ -68,7 +74,7 @@ static void underlying_quiet_history(Thread *thread, uint16_t move, int16_t *his
     static int16_t NULL_HISTORY; // Always zero to handle missing CM/FM history
 
     NodeState *const ns    = &thread->states[thread->height];
-    const uint64_t threats = thread->board.threats;
+    const uint64_t threats = boardThreats(&thread->board);
 
     // Extract information from this move
     const int to    = MoveTo(move);
@@ -92,6 +98,38 @@ static void underlying_quiet_history(Thread *thread, uint16_t move, int16_t *his
 }
 
 
+#if defined(USE_AVX2)
+
+/// With AVX2, the quiet moves are scored eight moves at a time. The indices are
+/// built in 32-bit lanes, and each int16 history is gathered as the low half of
+/// a 32-bit load, which remains within the tables, or the Thread which follows.
+/// Any remaining moves, fewer than eight, are scored by the scalar loop
+
+static __m256i avx2_test_bits(__m256i bits_lo, __m256i bits_hi, __m256i sq) {
+
+    // Equivalent to testBit(bits, sq) for each 32-bit lane
+    const __m256i upper = _mm256_cmpgt_epi32(sq, _mm256_set1_epi32(31));
+    const __m256i word  = _mm256_blendv_epi8(bits_lo, bits_hi, upper);
+    const __m256i shift = _mm256_and_si256(sq, _mm256_set1_epi32(31));
+    return _mm256_and_si256(_mm256_srlv_epi32(word, shift), _mm256_set1_epi32(1));
+}
+
+static __m256i avx2_gather_int16(const int16_t *table, __m256i index) {
+
+    // Load 32-bits at each int16 entry, and sign extend the lower half
+    const __m256i words = _mm256_i32gather_epi32((const int*) table, index, 2);
+    return _mm256_srai_epi32(_mm256_slli_epi32(words, 16), 16);
+}
+
+static __m256i avx2_piece_types(const uint8_t *squares, __m256i sq) {
+
+    // Gather squares[sq], and then take the pieceType() of each
+    const __m256i words = _mm256_i32gather_epi32((const int*) squares, sq, 1);
+    return _mm256_srli_epi32(_mm256_and_si256(words, _mm256_set1_epi32(0xFF)), 2);
+}
+
+#endif
+
 void update_history_heuristics(Thread *thread, uint16_t *moves, int length, int depth) {
 
     NodeState *const prev = &thread->states[thread->height-1];
@@ -105,6 +143,30 @@ void update_history_heuristics(Thread *thread, uint16_t *moves, int length, int
     update_quiet_histories(thread, moves, length, depth);
 }
 
+void age_history_heuristics(Thread *thread, int plies) {
+
+    // Between the searches of one game, scale down each history by a quarter
+    // rather than keeping it stale, or clearing it. Killers are indexed by the
+    // height, so they move up by the number of plies played since the last root
+
+    int16_t *tables[] = {
+        (int16_t*) thread->history, (int16_t*) thread->chistory, (int16_t*) thread->continuation
+    };
+
+    const size_t sizes[] = {
+        sizeof(HistoryTable), sizeof(CaptureHistoryTable), sizeof(ContinuationTable)
+    };
+
+    for (int i = 0; i < 3; i++)
+        for (size_t j = 0; j < sizes[i] / sizeof(int16_t); j++)
+            tables[i][j] -= tables[i][j] / 4;
+
+    if (plies > 0 && plies <= MAX_PLY) {
+        memmove(thread->killers, thread->killers[plies], sizeof(thread->killers[0]) * (MAX_PLY + 1 - plies));
+        memset(thread->killers[MAX_PLY + 1 - plies], 0, sizeof(thread->killers[0]) * plies);
+    }
+}
+
 void update_killer_moves(Thread *thread, uint16_t move) {
 
     // Avoid saving the same Killer Move twice
@@ -145,9 +207,21 @@ void get_capture_histories(Thread *thread, uint16_t *moves, int *scores, int sta
 
     static const int MVVAugment[] = { 0, 2400, 2400, 4800, 9600 };
 
-    for (int i = start; i < start + length; i++)
-        scores[i] = 64000 + get_capture_history(thread, moves[i])
-                  + MVVAugment[history_captured_piece(thread, moves[i])];
+    const uint8_t *squares = thread->board.squares;
+    const uint64_t threats = boardThreats(&thread->board);
+
+    for (int i = start; i < start + length; i++) {
+
+        const int from     = MoveFrom(moves[i]);
+        const int to       = MoveTo(moves[i]);
+        const int piece    = pieceType(squares[from]);
+        const int captured = history_captured_piece(thread, moves[i]);
+
+        // As get_capture_history(), with the Queen promotion inflation
+        scores[i] = 64000 + 64000 * (MovePromoPiece(moves[i]) == QUEEN)
+                  + thread->chistory[piece][testBit(threats, from)][testBit(threats, to)][to][captured]
+                  + MVVAugment[captured];
+    }
 }
 
 void update_capture_histories(Thread *thread, uint16_t best, uint16_t *moves, int length, int depth) {
@@ -171,12 +245,90 @@ int get_quiet_history(Thread *thread, uint16_t move, int *cmhist, int *fmhist) {
     return *histories[0] + *histories[1] + *histories[2];
 }
 
-void get_quiet_histories(Thread *thread, uint16_t *moves, int *scores, int start, int length) {
+void prefetch_quiet_histories(Thread *thread) {
+
+    // The CM and FM rows for this node are each a [PIECE_NB][SQUARE_NB] block,
+    // which sit in random places of the per-thread ContinuationTable, and are
+    // almost always cold by the time the quiets are scored. Request both ahead
+    // of time, so that the loads overlap with the search of the noisy moves
+
+    NodeState *const ns = &thread->states[thread->height];
+
+    if ((ns-1)->continuations != NULL)
+        for (int i = 0; i < (int) sizeof((*(ns-1)->continuations)[0]); i += 64)
+            __builtin_prefetch((char*) (*(ns-1)->continuations)[0] + i);
+
+    if ((ns-2)->continuations != NULL)
+        for (int i = 0; i < (int) sizeof((*(ns-2)->continuations)[1]); i += 64)
+            __builtin_prefetch((char*) (*(ns-2)->continuations)[1] + i);
+}
+
+int get_quiet_histories(Thread *thread, uint16_t *moves, int *scores, int start, int length) {
+
+    // Score all of the quiet moves, while finding the index of the first of
+    // the best scores, which saves the Move Picker its first selection scan.
+    // Everything except the final table reads is the same for every move, so
+    // is resolved once up front, and missing CM/FM histories read a zero table
+
+    static const int16_t NULL_CONTINUATION[PIECE_NB + 1][SQUARE_NB]; // Padded for AVX2
+
+    NodeState *const ns    = &thread->states[thread->height];
+    const uint8_t *squares = thread->board.squares;
+    const uint64_t threats = boardThreats(&thread->board);
+
+    const int16_t (*cmhist)[SQUARE_NB] = (ns-1)->continuations == NULL
+                                       ? NULL_CONTINUATION : (*(ns-1)->continuations)[0];
+
+    const int16_t (*fmhist)[SQUARE_NB] = (ns-2)->continuations == NULL
+                                       ? NULL_CONTINUATION : (*(ns-2)->continuations)[1];
+
+    int16_t (*const butterfly)[2][SQUARE_NB][SQUARE_NB] = thread->history[thread->board.turn];
+
+    int i = start, best = start;
+
+#if defined(USE_AVX2)
 
-    int null_hist; // cmhist & fmhist are set, although ignored
+    const __m256i bits_lo = _mm256_set1_epi32((int) (uint32_t) threats);
+    const __m256i bits_hi = _mm256_set1_epi32((int) (uint32_t) (threats >> 32));
+    const __m256i mask    = _mm256_set1_epi32(63);
+
+    for (; i + 8 <= start + length; i += 8) {
+
+        const __m256i move  = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*) &moves[i]));
+        const __m256i from  = _mm256_and_si256(move, mask);
+        const __m256i to    = _mm256_and_si256(_mm256_srli_epi32(move, 6), mask);
+        const __m256i slot  = _mm256_add_epi32(_mm256_slli_epi32(avx2_piece_types(squares, from), 6), to);
+
+        // Index of butterfly[threat_from][threat_to][from][to]
+        __m256i index = _mm256_add_epi32(_mm256_slli_epi32(avx2_test_bits(bits_lo, bits_hi, from), 1),
+                                         avx2_test_bits(bits_lo, bits_hi, to));
+        index = _mm256_add_epi32(_mm256_slli_epi32(index, 12), _mm256_add_epi32(_mm256_slli_epi32(from, 6), to));
+
+        __m256i score = avx2_gather_int16(&cmhist[0][0], slot);
+        score = _mm256_add_epi32(score, avx2_gather_int16(&fmhist[0][0], slot));
+        score = _mm256_add_epi32(score, avx2_gather_int16(&butterfly[0][0][0][0], index));
+
+        _mm256_storeu_si256((__m256i*) &scores[i], score);
+    }
+
+    for (int j = start; j < i; j++)
+        if (scores[j] > scores[best]) best = j;
+
+#endif
+
+    for (; i < start + length; i++) {
+
+        const int from  = MoveFrom(moves[i]);
+        const int to    = MoveTo(moves[i]);
+        const int piece = pieceType(squares[from]);
+
+        scores[i] = cmhist[piece][to] + fmhist[piece][to]
+                  + butterfly[testBit(threats, from)][testBit(threats, to)][from][to];
+
+        if (scores[i] > scores[best]) best = i;
+    }
 
-    for (int i = start; i < start + length; i++)
-        scores[i] = get_quiet_history(thread, moves[i], &null_hist, &null_hist);
+    return best;
 }
 
 void update_quiet_histories(Thread *thread, uint16_t *moves, int length, int depth) {
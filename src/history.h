@@ -25,6 +25,7 @@
 static const int HistoryDivisor = 16384;
 
 void update_history_heuristics(Thread *thread, uint16_t *moves, int length, int depth);
+void age_history_heuristics(Thread *thread, int plies);
 void update_killer_moves(Thread *thread, uint16_t move);
 void get_refutation_moves(Thread *thread, uint16_t *killer1, uint16_t *killer2, uint16_t *counter);
 
@@ -33,5 +34,6 @@ void get_capture_histories(Thread *thread, uint16_t *moves, int *scores, int sta
 void update_capture_histories(Thread *thread, uint16_t best, uint16_t *moves, int length, int depth);
 
 int  get_quiet_history(Thread *thread, uint16_t move, int *cmhist, int *fmhist);
-void get_quiet_histories(Thread *thread, uint16_t *moves, int *scores, int start, int length);
+void prefetch_quiet_histories(Thread *thread);
+int  get_quiet_histories(Thread *thread, uint16_t *moves, int *scores, int start, int length);
 void update_quiet_histories(Thread *thread, uint16_t *moves, int length, int depth);
@@ -28,6 +28,7 @@ int distanceBetween(int sq1, int sq2);
 int kingPawnFileDistance(uint64_t pawns, int ksq);
 int openFileCount(uint64_t pawns);
 uint64_t bitsBetweenMasks(int sq1, int sq2);
+uint64_t lineThroughMasks(int sq1, int sq2);
 uint64_t kingAreaMasks(int colour, int sq);
 uint64_t forwardRanksMasks(int colour, int rank);
 uint64_t forwardFileMasks(int colour, int sq);
@@ -0,0 +1,410 @@
+/*
+  Ethereal is a UCI chess playing engine authored by Andrew Grant.
+  <https://github.com/AndyGrant/Ethereal>     <andrew@grantnet.us>
+
+  Ethereal is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Ethereal is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include <inttypes.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "bitboards.h"
+#include "board.h"
+#include "evaluate.h"
+#include "microbench.h"
+#include "move.h"
+#include "movegen.h"
+#include "network.h"
+#include "search.h"
+#include "thread.h"
+#include "timeman.h"
+#include "transposition.h"
+#include "types.h"
+#include "uci.h"
+#include "zobrist.h"
+
+#include "nnue/accumulator.h"
+#include "nnue/nnue.h"
+#include "nnue/types.h"
+#include "nnue/utils.h"
+
+typedef struct MicroChild {
+    Board board;                 // Position after the move, bound to the Thread
+    int parent, changes;         // Index of the root, and the recorded deltas
+    NNUEDelta deltas[3];         // Accumulator changes made by the move
+} MicroChild;
+
+typedef struct MicroBench {
+    Thread *thread;
+    Board *roots;                // Positions of bench.csv, not bound to a Thread
+    uint16_t (*moves)[MAX_MOVES];
+    int *counts, nroots;
+    MicroChild *children;        // Every legal child of every root
+    NNUEAccumulator *accums;     // Accurate Accumulators for each of the roots
+    int nchildren;
+    uint64_t *keys;              // Random keys for the Transposition Table
+    uint64_t sink;               // Results are folded in, so nothing is elided
+} MicroBench;
+
+typedef uint64_t (*MicroKernel)(MicroBench *mb);
+
+
+static double microbench_ns() {
+
+    // A high resolution clock, since a single pass may only take microseconds
+
+#if defined(_WIN32) || defined(_WIN64)
+    return 1e6 * get_real_time();
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return 1e9 * ts.tv_sec + ts.tv_nsec;
+#endif
+}
+
+static void microbench_setup(MicroBench *mb) {
+
+    static const char *Benchmarks[] = {
+        #include "bench.csv"
+        ""
+    };
+
+    Undo undo[1];
+    Limits limits = {0};
+    TimeManager tm = {0};
+
+    for (mb->nroots = 0; strcmp(Benchmarks[mb->nroots], ""); mb->nroots++);
+
+    mb->roots    = malloc(sizeof(Board) * mb->nroots);
+    mb->moves    = malloc(sizeof(*mb->moves) * mb->nroots);
+    mb->counts   = malloc(sizeof(int) * mb->nroots);
+    mb->accums   = align_malloc(sizeof(NNUEAccumulator) * mb->nroots);
+    mb->children = malloc(sizeof(MicroChild) * mb->nroots * MAX_MOVES);
+    mb->keys     = malloc(sizeof(uint64_t) * MICROBENCH_TT_KEYS);
+    mb->nchildren = 0, mb->sink = 0ull;
+
+    // A single Thread, prepared as if for a search of the first position
+    mb->thread = createThreadPool(1);
+    boardFromFEN(&mb->roots[0], Benchmarks[0], 0);
+    newSearchThreadPool(mb->thread, &mb->roots[0], &limits, &tm);
+
+    for (int i = 0; i < MICROBENCH_TT_KEYS; i++)
+        mb->keys[i] = rand64();
+
+    for (int i = 0; i < mb->nroots; i++) {
+
+        Board *root = &mb->roots[i];
+        NNUEEvaluator *nnue = mb->thread->nnue;
+
+        boardFromFEN(root, Benchmarks[i], 0);
+        mb->counts[i]  = genAllNoisyMoves(root, mb->moves[i]);
+        mb->counts[i] += genAllQuietMoves(root, mb->moves[i] + mb->counts[i]);
+
+        // Keep an accurate Accumulator for the root, to update children from
+        #if USE_NNUE
+            if (nnue->network != NULL) {
+                for (int colour = WHITE; colour <= BLACK; colour++) {
+                    const int ksq = getlsb(root->pieces[KING] & root->colours[colour]);
+                    nnue_refresh_accumulator(nnue, &mb->accums[i], root, colour, relativeSquare(colour, ksq));
+                }
+            }
+        #endif
+
+        // Record the legal children, along with the deltas each move makes
+        for (int j = 0; j < mb->counts[i]; j++) {
+
+            MicroChild *child = &mb->children[mb->nchildren];
+
+            child->board = *root;
+            child->board.thread = mb->thread;
+            nnue->current = &nnue->stack[0];
+
+            applyMove(&child->board, mb->moves[i][j], undo);
+
+            if (!moveWasLegal(&child->board)) {
+                revertMove(&child->board, mb->moves[i][j], undo);
+                continue;
+            }
+
+            child->parent  = i;
+            child->changes = nnue->stack[1].changes;
+            memcpy(child->deltas, nnue->stack[1].deltas, sizeof(child->deltas));
+            mb->nchildren++;
+        }
+    }
+
+    nnue_reset_evaluator(mb->thread->nnue);
+}
+
+static void microbench_cleanup(MicroBench *mb) {
+    deleteThreadPool(mb->thread);
+    free(mb->roots); free(mb->moves); free(mb->counts);
+    align_free(mb->accums); free(mb->children); free(mb->keys);
+}
+
+#if USE_NNUE
+
+static NNUEAccumulator* microbench_child_accum(MicroBench *mb, const MicroChild *child) {
+
+    // Place the root's Accumulator beneath the child's deltas, as if the
+    // search had just made the move, leaving the child to be updated
+
+    NNUEEvaluator *nnue = mb->thread->nnue;
+
+    if (child == &mb->children[0] || child->parent != (child - 1)->parent)
+        memcpy(&nnue->stack[0], &mb->accums[child->parent], sizeof(NNUEAccumulator));
+
+    nnue->current = &nnue->stack[1];
+    nnue->stack[1].changes  = child->changes;
+    nnue->stack[1].accurate[WHITE] = nnue->stack[1].accurate[BLACK] = FALSE;
+    memcpy(nnue->stack[1].deltas, child->deltas, sizeof(child->deltas));
+
+    return &nnue->stack[1];
+}
+
+#endif
+
+
+/// Each kernel performs a single pass over its inputs, returning the number
+/// of operations performed, while folding its results into the sink
+
+static uint64_t kernel_noisy(MicroBench *mb) {
+
+    uint16_t moves[MAX_MOVES];
+
+    for (int i = 0; i < mb->nroots; i++)
+        mb->sink += genAllNoisyMoves(&mb->roots[i], moves) + moves[0];
+
+    return mb->nroots;
+}
+
+static uint64_t kernel_quiet(MicroBench *mb) {
+
+    uint16_t moves[MAX_MOVES];
+
+    for (int i = 0; i < mb->nroots; i++)
+        mb->sink += genAllQuietMoves(&mb->roots[i], moves) + moves[0];
+
+    return mb->nroots;
+}
+
+static uint64_t kernel_make_unmake(MicroBench *mb) {
+
+    Undo undo[1];
+    uint64_t ops = 0ull;
+
+    for (int i = 0; i < mb->nroots; i++) {
+        for (int j = 0; j < mb->counts[i]; j++, ops++) {
+            applyMove(&mb->roots[i], mb->moves[i][j], undo);
+            mb->sink += mb->roots[i].hash;
+            revertMove(&mb->roots[i], mb->moves[i][j], undo);
+        }
+    }
+
+    return ops;
+}
+
+static uint64_t kernel_see(MicroBench *mb) {
+
+    uint64_t ops = 0ull;
+
+    for (int i = 0; i < mb->nroots; i++)
+        for (int j = 0; j < mb->counts[i]; j++, ops++)
+            mb->sink += staticExchangeEvaluation(&mb->roots[i], mb->moves[i][j], 0);
+
+    return ops;
+}
+
+static uint64_t kernel_evaluate(MicroBench *mb) {
+
+    for (int i = 0; i < mb->nchildren; i++) {
+
+        #if USE_NNUE
+            if (mb->thread->nnue->network != NULL)
+                microbench_child_accum(mb, &mb->children[i]);
+        #endif
+
+        mb->sink += evaluateBoard(mb->thread, &mb->children[i].board);
+    }
+
+    return mb->nchildren;
+}
+
+#if USE_NNUE
+
+static uint64_t kernel_nnue_update(MicroBench *mb) {
+
+    uint64_t ops = 0ull;
+
+    for (int i = 0; i < mb->nchildren; i++) {
+
+        Board *board = &mb->children[i].board;
+        NNUEAccumulator *accum = microbench_child_accum(mb, &mb->children[i]);
+
+        // King moves cannot be updated for their own side, as in the search
+        for (int colour = WHITE; colour <= BLACK; colour++) {
+            if (nnue_can_update(accum, board, colour)) {
+                const int ksq = getlsb(board->pieces[KING] & board->colours[colour]);
+                nnue_update_accumulator(mb->thread->nnue, accum, colour, relativeSquare(colour, ksq));
+                mb->sink += accum->values[colour][0], ops++;
+            }
+        }
+    }
+
+    return ops;
+}
+
+static uint64_t kernel_nnue_refresh(MicroBench *mb) {
+
+    NNUEAccumulator *accum = &mb->thread->nnue->stack[1];
+
+    for (int i = 0; i < mb->nchildren; i++) {
+
+        Board *board = &mb->children[i].board;
+
+        for (int colour = WHITE; colour <= BLACK; colour++) {
+            const int ksq = getlsb(board->pieces[KING] & board->colours[colour]);
+            nnue_refresh_accumulator(mb->thread->nnue, accum, board, colour, relativeSquare(colour, ksq));
+            mb->sink += accum->values[colour][0];
+        }
+    }
+
+    return 2 * mb->nchildren;
+}
+
+static uint64_t kernel_nnue_evaluate(MicroBench *mb) {
+
+    for (int i = 0; i < mb->nchildren; i++) {
+        microbench_child_accum(mb, &mb->children[i]);
+        mb->sink += nnue_evaluate(mb->thread, &mb->children[i].board);
+    }
+
+    return mb->nchildren;
+}
+
+#endif
+
+static uint64_t kernel_pknetwork(MicroBench *mb) {
+
+    for (int i = 0; i < mb->nchildren; i++)
+        mb->sink += computePKNetwork(&mb->children[i].board);
+
+    return mb->nchildren;
+}
+
+static uint64_t kernel_tt_store(MicroBench *mb) {
+
+    for (int i = 0; i < MICROBENCH_TT_KEYS; i++)
+        tt_store(mb->thread, mb->keys[i], (uint16_t) i, i & 0x3FF, i & 0x1FF, 1 + (i & 0x1F), 1 + (i & 0x1));
+
+    return MICROBENCH_TT_KEYS;
+}
+
+static uint64_t kernel_tt_probe(MicroBench *mb) {
+
+    uint16_t move; int value, eval, depth, bound;
+
+    for (int i = 0; i < MICROBENCH_TT_KEYS; i++)
+        mb->sink += tt_probe(mb->thread, mb->keys[i], &move, &value, &eval, &depth, &bound);
+
+    return MICROBENCH_TT_KEYS;
+}
+
+
+static void microbench_kernel(MicroBench *mb, const char *name, MicroKernel kernel, int samples) {
+
+    double nsop[samples], mean = 0.0, sq = 0.0, min = 0.0, start;
+    uint64_t ops = 0ull;
+
+    // Size each sample from a single pass, which doubles as the warm-up
+    start = microbench_ns();
+    kernel(mb);
+    const double pass = MAX(1.0, microbench_ns() - start);
+    const int reps = MAX(1, (int) (MICROBENCH_SAMPLE_NS / pass));
+
+    for (int s = 0; s < samples; s++) {
+
+        start = microbench_ns(), ops = 0ull;
+
+        for (int r = 0; r < reps; r++)
+            ops += kernel(mb);
+
+        nsop[s] = (microbench_ns() - start) / MAX(1ull, ops);
+        mean += nsop[s] / samples;
+        min   = s ? MIN(min, nsop[s]) : nsop[s];
+    }
+
+    for (int s = 0; s < samples; s++)
+        sq += (nsop[s] - mean) * (nsop[s] - mean);
+
+    const double stddev = samples > 1 ? sqrt(sq / (samples - 1)) : 0.0;
+
+    printf("%-28s %10.2f ns/op +- %5.2f%% %10.2f ns/op min %12"PRIu64" ops\n",
+        name, mean, 100.0 * stddev / MAX(1e-9, mean), min, ops);
+    fflush(stdout);
+}
+
+void microbench(int samples, const char *hashes) {
+
+    MicroBench mb;
+    char name[64], list[256] = {0};
+
+    samples = MAX(2, samples);
+    microbench_setup(&mb);
+
+    printf("info string %d positions, %d children, %d samples\n", mb.nroots, mb.nchildren, samples);
+    printf("===============================================================================\n");
+
+    microbench_kernel(&mb, "genAllNoisyMoves", kernel_noisy, samples);
+    microbench_kernel(&mb, "genAllQuietMoves", kernel_quiet, samples);
+    microbench_kernel(&mb, "applyMove + revertMove", kernel_make_unmake, samples);
+    microbench_kernel(&mb, "staticExchangeEvaluation", kernel_see, samples);
+    microbench_kernel(&mb, "computePKNetwork", kernel_pknetwork, samples);
+    microbench_kernel(&mb, "evaluateBoard", kernel_evaluate, samples);
+
+    #if USE_NNUE
+        if (mb.thread->nnue->network != NULL) {
+            microbench_kernel(&mb, "nnue_update_accumulator", kernel_nnue_update, samples);
+            microbench_kernel(&mb, "nnue_refresh_accumulator", kernel_nnue_refresh, samples);
+            microbench_kernel(&mb, "nnue_evaluate", kernel_nnue_evaluate, samples);
+        }
+    #endif
+
+    if (mb.thread->nnue->network == NULL)
+        printf("info string no NNUE loaded, skipping the NNUE kernels\n");
+
+    // The Table kernels depend heavily on the size of the Table, relative to
+    // the caches and TLBs, so they are repeated for each requested size
+
+    strncpy(list, hashes, sizeof(list) - 1);
+
+    for (char *t = strtok(list, ","); t != NULL; t = strtok(NULL, ",")) {
+
+        const int megabytes = tt_init(1, MAX(1, atoi(t)));
+
+        snprintf(name, sizeof(name), "tt_store %dMB", megabytes);
+        microbench_kernel(&mb, name, kernel_tt_store, samples);
+
+        snprintf(name, sizeof(name), "tt_probe %dMB", megabytes);
+        microbench_kernel(&mb, name, kernel_tt_probe, samples);
+    }
+
+    printf("===============================================================================\n");
+    printf("info string checksum %016"PRIx64"\n", mb.sink);
+
+    microbench_cleanup(&mb);
+}
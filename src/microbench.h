@@ -0,0 +1,36 @@
+/*
+  Ethereal is a UCI chess playing engine authored by Andrew Grant.
+  <https://github.com/AndyGrant/Ethereal>     <andrew@grantnet.us>
+
+  Ethereal is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Ethereal is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#pragma once
+
+/// Microbenchmarks time the hot kernels of the engine in isolation, so that a
+/// change in NPS can be attributed to the code responsible. Every kernel runs
+/// over the positions of bench.csv, or the children of those positions, with
+/// enough repetitions per sample to dwarf the cost of reading the clock. The
+/// first sample of each kernel is a warm-up and is discarded. The rest report
+/// the mean ns per operation, their relative stddev, and the fastest sample.
+///
+/// Kernels which depend on the NNUE are skipped when no Network is loaded.
+/// The Transposition Table kernels are repeated for each requested Hash size.
+
+enum {
+    MICROBENCH_SAMPLE_NS  = 20000000, // Target length of a single sample
+    MICROBENCH_TT_KEYS    = 1 << 20,  // Random keys stored and probed per pass
+    MICROBENCH_MAX_SIZES  = 16,       // Distinct Hash sizes for the TT kernels
+};
+
+void microbench(int samples, const char *hashes);
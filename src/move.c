@@ -52,7 +52,7 @@ int castleRookTo(int king, int rook) {
 }
 
 
-int apply(Thread *thread, Board *board, uint16_t move) {
+void apply(Thread *thread, Board *board, uint16_t move) {
 
     NodeState *const ns = &thread->states[thread->height];
 
@@ -66,7 +66,7 @@ int apply(Thread *thread, Board *board, uint16_t move) {
 
         // Prefetch the next tt-entry as soon as we have the Key
         applyNullMove(board, &thread->undoStack[thread->height]);
-        tt_prefetch(board->hash);
+        tt_prefetch(thread, board->hash);
     }
 
     else {
@@ -78,34 +78,14 @@ int apply(Thread *thread, Board *board, uint16_t move) {
 
         // Prefetch the next tt-entry as soon as we have the Key
         applyMove(board, move, &thread->undoStack[thread->height]);
-        tt_prefetch(board->hash);
+        tt_prefetch(thread, board->hash);
 
-        // Reject the move if it was illegal
-        if (!moveWasLegal(board))
-            return revertMove(board, move, &thread->undoStack[thread->height]), 0;
+        // The Move Picker only ever returns legal moves
+        assert(moveWasLegal(board));
     }
 
     // Advance the Stack before updating
     thread->height++;
-
-    return 1;
-}
-
-void applyLegal(Thread *thread, Board *board, uint16_t move) {
-
-    NodeState *const ns = &thread->states[thread->height];
-
-    ns->movedPiece    = pieceType(board->squares[MoveFrom(move)]);
-    ns->tactical      = moveIsTactical(board, move);
-    ns->continuations = &thread->continuation[ns->tactical][ns->movedPiece][MoveTo(move)];
-    ns->move          = move;
-
-    // Assumed that this move is legal
-    applyMove(board, move, &thread->undoStack[thread->height]);
-    assert(moveWasLegal(board));
-
-    // Advance the Stack before updating
-    thread->height++;
 }
 
 void applyMove(Board *board, uint16_t move, Undo *undo) {
@@ -116,17 +96,20 @@ void applyMove(Board *board, uint16_t move, Undo *undo) {
     };
 
     // Save information which is hard to recompute
-    undo->hash            = board->hash;
-    undo->pkhash          = board->pkhash;
-    undo->kingAttackers   = board->kingAttackers;
-    undo->threats         = board->threats;
-    undo->castleRooks     = board->castleRooks;
-    undo->epSquare        = board->epSquare;
-    undo->halfMoveCounter = board->halfMoveCounter;
-    undo->psqtmat         = board->psqtmat;
+    undo->hash             = board->hash;
+    undo->pkhash           = board->pkhash;
+    undo->kingAttackers    = board->kingAttackers;
+    undo->pinned           = board->pinned;
+    undo->threats          = board->threats;
+    undo->hasThreats       = board->hasThreats;
+    undo->hasKingAttackers = board->hasKingAttackers;
+    undo->castleRooks      = board->castleRooks;
+    undo->epSquare         = board->epSquare;
+    undo->halfMoveCounter  = board->halfMoveCounter;
+    undo->psqtmat          = board->psqtmat;
 
     // Store hash history for repetition checking
-    board->history[board->numMoves++] = board->hash;
+    board->history[board->numMoves++ & (HISTORY_SIZE - 1)] = board->hash;
     board->fullMoveCounter++;
 
     // Update the hash for before changing the enpass square
@@ -143,11 +126,9 @@ void applyMove(Board *board, uint16_t move, Undo *undo) {
     // No function updates this so we do it here
     board->turn = !board->turn;
 
-    // Need king attackers for move generation
-    board->kingAttackers = attackersToKingSquare(board);
-
-    // Need squares attacked by the opposing player
-    board->threats = allAttackedSquares(board, !board->turn);
+    // King attackers and the squares attacked by the opposing player
+    // are only computed once needed, via boardKingAttackers/boardThreats
+    board->hasThreats = board->hasKingAttackers = 0;
 }
 
 void applyNormalMove(Board *board, uint16_t move, Undo *undo) {
@@ -177,8 +158,8 @@ void applyNormalMove(Board *board, uint16_t move, Undo *undo) {
     board->squares[to]   = fromPiece;
     undo->capturePiece   = toPiece;
 
-    board->castleRooks &= board->castleMasks[from];
-    board->castleRooks &= board->castleMasks[to];
+    board->castleRooks &= ~((1ull << from) | (1ull << to));
+    if (fromType == KING) board->castleRooks &= ~(board->turn == WHITE ? RANK_1 : RANK_8);
     updateCastleZobrist(board, undo->castleRooks, board->castleRooks);
 
     board->psqtmat += PSQT[fromPiece][to]
@@ -239,7 +220,7 @@ void applyCastleMove(Board *board, uint16_t move, Undo *undo) {
     board->squares[to]    = fromPiece;
     board->squares[rTo]   = rFromPiece;
 
-    board->castleRooks &= board->castleMasks[from];
+    board->castleRooks &= ~(board->turn == WHITE ? RANK_1 : RANK_8);
     updateCastleZobrist(board, undo->castleRooks, board->castleRooks);
 
     board->psqtmat += PSQT[fromPiece][to]
@@ -334,7 +315,7 @@ void applyPromotionMove(Board *board, uint16_t move, Undo *undo) {
     board->squares[to]   = promoPiece;
     undo->capturePiece   = toPiece;
 
-    board->castleRooks &= board->castleMasks[to];
+    board->castleRooks &= ~(1ull << to);
     updateCastleZobrist(board, undo->castleRooks, board->castleRooks);
 
     board->psqtmat += PSQT[promoPiece][to]
@@ -361,14 +342,18 @@ void applyPromotionMove(Board *board, uint16_t move, Undo *undo) {
 void applyNullMove(Board *board, Undo *undo) {
 
     // Save information which is hard to recompute
-    undo->hash            = board->hash;
-    undo->threats         = board->threats;
-    undo->epSquare        = board->epSquare;
-    undo->halfMoveCounter = board->halfMoveCounter++;
+    undo->hash             = board->hash;
+    undo->kingAttackers    = board->kingAttackers;
+    undo->pinned           = board->pinned;
+    undo->threats          = board->threats;
+    undo->hasThreats       = board->hasThreats;
+    undo->hasKingAttackers = board->hasKingAttackers;
+    undo->epSquare         = board->epSquare;
+    undo->halfMoveCounter  = board->halfMoveCounter++;
 
     // NULL moves simply swap the turn only
     board->turn = !board->turn;
-    board->history[board->numMoves++] = board->hash;
+    board->history[board->numMoves++ & (HISTORY_SIZE - 1)] = board->hash;
     board->fullMoveCounter++;
 
     // Update the hash for turn and changes to enpass square
@@ -378,7 +363,9 @@ void applyNullMove(Board *board, Undo *undo) {
         board->epSquare = -1;
     }
 
-    board->threats = allAttackedSquares(board, !board->turn);
+    // King attackers, pins, and the squares attacked by the opposing
+    // player all belong to the other side now, and are found once needed
+    board->hasThreats = board->hasKingAttackers = 0;
 }
 
 
@@ -396,14 +383,17 @@ void revertMove(Board *board, uint16_t move, Undo *undo) {
     const int from = MoveFrom(move);
 
     // Revert information which is hard to recompute
-    board->hash            = undo->hash;
-    board->pkhash          = undo->pkhash;
-    board->kingAttackers   = undo->kingAttackers;
-    board->threats         = undo->threats;
-    board->castleRooks     = undo->castleRooks;
-    board->epSquare        = undo->epSquare;
-    board->halfMoveCounter = undo->halfMoveCounter;
-    board->psqtmat         = undo->psqtmat;
+    board->hash             = undo->hash;
+    board->pkhash           = undo->pkhash;
+    board->kingAttackers    = undo->kingAttackers;
+    board->pinned           = undo->pinned;
+    board->threats          = undo->threats;
+    board->hasThreats       = undo->hasThreats;
+    board->hasKingAttackers = undo->hasKingAttackers;
+    board->castleRooks      = undo->castleRooks;
+    board->epSquare         = undo->epSquare;
+    board->halfMoveCounter  = undo->halfMoveCounter;
+    board->psqtmat          = undo->psqtmat;
 
     // Swap turns and update the history index
     board->turn = !board->turn;
@@ -486,10 +476,14 @@ void revertMove(Board *board, uint16_t move, Undo *undo) {
 void revertNullMove(Board *board, Undo *undo) {
 
     // Revert information which is hard to recompute
-    board->hash            = undo->hash;
-    board->threats         = undo->threats;
-    board->epSquare        = undo->epSquare;
-    board->halfMoveCounter = undo->halfMoveCounter;
+    board->hash             = undo->hash;
+    board->kingAttackers    = undo->kingAttackers;
+    board->pinned           = undo->pinned;
+    board->threats          = undo->threats;
+    board->hasThreats       = undo->hasThreats;
+    board->hasKingAttackers = undo->hasKingAttackers;
+    board->epSquare         = undo->epSquare;
+    board->halfMoveCounter  = undo->halfMoveCounter;
 
     // NULL moves simply swap the turn only
     board->turn = !board->turn;
@@ -593,17 +587,8 @@ int moveBestCaseValue(Board *board) {
 }
 
 int moveIsLegal(Board *board, uint16_t move) {
-
-    int legal; Undo undo;
-
-    if (!moveIsPseudoLegal(board, move))
-        return 0;
-
-    applyMove(board, move, &undo);
-    legal = moveWasLegal(board);
-    revertMove(board, move, &undo);
-
-    return legal;
+    return moveIsPseudoLegal(board, move)
+        && pseudoMoveIsLegal(board, move);
 }
 
 int moveIsPseudoLegal(Board *board, uint16_t move) {
@@ -694,7 +679,7 @@ int moveIsPseudoLegal(Board *board, uint16_t move) {
     // player. If one matches, we can then verify the pseudo legality
     // using the same code as from movegen.c
 
-    while (castles && !board->kingAttackers) {
+    while (castles && !boardKingAttackers(board)) {
 
         // Figure out which pieces are moving to which squares
         rook = poplsb(&castles), king = from;
@@ -711,10 +696,8 @@ int moveIsPseudoLegal(Board *board, uint16_t move) {
         if (occupied & mask) return 0;
 
         // Castle is illegal if we move through a checking threat
-        mask = bitsBetweenMasks(king, kingTo);
-        while (mask)
-            if (squareIsAttacked(board, board->turn, poplsb(&mask)))
-                return 0;
+        if (boardThreats(board) & bitsBetweenMasks(king, kingTo))
+            return 0;
 
         return 1; // All requirments are met
     }
@@ -722,6 +705,50 @@ int moveIsPseudoLegal(Board *board, uint16_t move) {
     return 0;
 }
 
+int pseudoMoveIsLegal(Board *board, uint16_t move) {
+
+    // Decide if a pseudo legal move would leave our King in check, without
+    // making the move. Most moves only need the pins and checkers of the
+    // position, while King moves, castles, and enpass consider the occupancy
+    // which results from the move
+
+    const int from = MoveFrom(move), to = MoveTo(move), type = MoveType(move);
+
+    const uint64_t enemy    = board->colours[!board->turn];
+    const uint64_t occupied = board->colours[board->turn] | enemy;
+    const int kingsq        = getlsb(board->colours[board->turn] & board->pieces[KING]);
+
+    uint64_t checkers;
+
+    // The King must not land on an attacked square, having moved out of the way,
+    // or in the case of castling, having also moved the Rook out of the way
+    if (type == CASTLE_MOVE) {
+        const int kingTo = castleKingTo(from, to), rookTo = castleRookTo(from, to);
+        const uint64_t after = (occupied ^ (1ull << from) ^ (1ull << to)) | (1ull << kingTo) | (1ull << rookTo);
+        return !(allAttackersToSquare(board, after, kingTo) & enemy);
+    }
+
+    if (from == kingsq)
+        return !(allAttackersToSquare(board, occupied ^ (1ull << from), to) & enemy);
+
+    // Enpass removes two pieces from the same rank, and may capture the checker
+    if (type == ENPASS_MOVE) {
+        const uint64_t captured = 1ull << (to - 8 + (board->turn << 4));
+        const uint64_t after = (occupied ^ (1ull << from) ^ captured) | (1ull << to);
+        return !(allAttackersToSquare(board, after, kingsq) & enemy & ~captured);
+    }
+
+    // When in check, we must capture the lone checker, or block it
+    if ((checkers = boardKingAttackers(board))) {
+        if (several(checkers)) return 0;
+        if (!testBit(checkers | bitsBetweenMasks(kingsq, getlsb(checkers)), to)) return 0;
+    }
+
+    // Pinned pieces may only move along the line of the pin
+    return !testBit(boardPinned(board), from)
+        ||  testBit(lineThroughMasks(kingsq, from), to);
+}
+
 int moveWasLegal(Board *board) {
 
     // Grab the last player's King's square and verify safety
@@ -40,8 +40,7 @@ enum {
 int castleKingTo(int king, int rook);
 int castleRookTo(int king, int rook);
 
-int apply(Thread *thread, Board *board, uint16_t move);
-void applyLegal(Thread *thread, Board *board, uint16_t move);
+void apply(Thread *thread, Board *board, uint16_t move);
 void applyMove(Board *board, uint16_t move, Undo *undo);
 void applyNormalMove(Board *board, uint16_t move, Undo *undo);
 void applyCastleMove(Board *board, uint16_t move, Undo *undo);
@@ -61,6 +60,7 @@ int moveEstimatedValue(Board *board, uint16_t move);
 int moveBestCaseValue(Board *board);
 int moveIsLegal(Board *board, uint16_t move);
 int moveIsPseudoLegal(Board *board, uint16_t move);
+int pseudoMoveIsLegal(Board *board, uint16_t move);
 int moveWasLegal(Board *board);
 
 void printMove(uint16_t move, int chess960);
@@ -30,14 +30,6 @@
 typedef uint64_t (*JumperFunc)(int);
 typedef uint64_t (*SliderFunc)(int, uint64_t);
 
-uint16_t* buildEnpassMoves(uint16_t *moves, uint64_t attacks, int epsq) {
-
-    while (attacks)
-        *(moves++) = MoveMake(poplsb(&attacks), epsq, ENPASS_MOVE);
-
-    return moves;
-}
-
 uint16_t* buildPawnMoves(uint16_t *moves, uint64_t attacks, int delta) {
 
     while (attacks) {
@@ -89,25 +81,65 @@ uint16_t* buildSliderMoves(SliderFunc F, uint16_t *moves, uint64_t pieces, uint6
     return moves;
 }
 
+uint16_t* buildPinnedSliderMoves(SliderFunc F, uint16_t *moves, uint64_t pieces, uint64_t targets, uint64_t occupied, int king) {
 
-int genAllLegalMoves(Board *board, uint16_t *moves) {
+    while (pieces) {
+        int sq = poplsb(&pieces);
+        moves = buildNormalMoves(moves, F(sq, occupied) & targets & lineThroughMasks(king, sq), sq);
+    }
 
-    Undo undo[1];
-    int size = 0, pseudo = 0;
-    uint16_t pseudoMoves[MAX_MOVES];
+    return moves;
+}
+
+uint16_t* buildSpecialMoves(Board *board, uint16_t *moves, uint16_t move) {
+
+    // Castles and Enpass are rare enough to verify one at a time
+    if (pseudoMoveIsLegal(board, move))
+        *(moves++) = move;
+
+    return moves;
+}
+
+static uint64_t pinnedPawnsFilter(uint64_t targets, uint64_t pinned, int king, int delta) {
+
+    // Drop the targets which would take a pinned Pawn off the line of its pin.
+    // Each target has exactly one origin, found by stepping back along delta
 
-    // Call genAllNoisyMoves() & genAllNoisyMoves()
-    pseudo  = genAllNoisyMoves(board, pseudoMoves);
-    pseudo += genAllQuietMoves(board, pseudoMoves + pseudo);
+    pinned &= delta > 0 ? targets << delta : targets >> -delta;
 
-    // Check each move for legality before copying
-    for (int i = 0; i < pseudo; i++) {
-        applyMove(board, pseudoMoves[i], undo);
-        if (moveWasLegal(board)) moves[size++] = pseudoMoves[i];
-        revertMove(board, pseudoMoves[i], undo);
+    while (pinned) {
+        int sq = poplsb(&pinned);
+        if (!testBit(lineThroughMasks(king, sq), sq - delta))
+            targets ^= 1ull << (sq - delta);
     }
 
-    return size;
+    return targets;
+}
+
+static uint64_t kingLegalTargets(Board *board, int king, uint64_t targets) {
+
+    uint64_t sliders;
+
+    // Avoid the threats when the King has nowhere to go anyway
+    if (!targets) return 0ull;
+    targets &= ~boardThreats(board);
+
+    // Sliders giving check also attack the squares behind the King
+    sliders = board->kingAttackers & ~(board->pieces[PAWN] | board->pieces[KNIGHT]);
+    while (sliders) {
+        int sq = poplsb(&sliders);
+        targets &= ~lineThroughMasks(king, sq) | (1ull << sq);
+    }
+
+    return targets;
+}
+
+
+int genAllLegalMoves(Board *board, uint16_t *moves) {
+
+    // Both generators only produce legal moves
+    int size = genAllNoisyMoves(board, moves);
+    return size + genAllQuietMoves(board, moves + size);
 }
 
 int genAllNoisyMoves(Board *board, uint16_t *moves) {
@@ -118,7 +150,7 @@ int genAllNoisyMoves(Board *board, uint16_t *moves) {
     const int Right   = board->turn == WHITE ? -9 : 9;
     const int Forward = board->turn == WHITE ? -8 : 8;
 
-    uint64_t destinations, pawnEnpass, pawnLeft, pawnRight;
+    uint64_t destinations, blocks, pinned, pawnEnpass, pawnLeft, pawnRight;
     uint64_t pawnPromoForward, pawnPromoLeft, pawnPromoRight;
 
     uint64_t us       = board->colours[board->turn];
@@ -131,38 +163,56 @@ int genAllNoisyMoves(Board *board, uint16_t *moves) {
     uint64_t rooks   = us & (board->pieces[ROOK  ]);
     uint64_t kings   = us & (board->pieces[KING  ]);
 
+    const int king = getlsb(kings);
+
     // Merge together duplicate piece ideas
     bishops |= us & board->pieces[QUEEN];
     rooks   |= us & board->pieces[QUEEN];
 
     // Double checks can only be evaded by moving the King
-    if (several(board->kingAttackers))
-        return buildJumperMoves(&kingAttacks, moves, kings, them) - start;
+    if (several(boardKingAttackers(board)))
+        return buildNormalMoves(moves, kingLegalTargets(board, king, kingAttacks(king) & them), king) - start;
 
-    // When checked, we may only uncheck by capturing the checker
+    // When checked, we may only uncheck by capturing the checker, or by
+    // blocking the checker with a promotion. Pinned pieces stay on their lines
     destinations = board->kingAttackers ? board->kingAttackers : them;
+    blocks       = board->kingAttackers ? bitsBetweenMasks(king, getlsb(board->kingAttackers)) : ~0ull;
+    pinned       = board->pinned;
 
     // Compute bitboards for each type of Pawn movement
     pawnEnpass       = pawnEnpassCaptures(pawns, board->epSquare, board->turn);
-    pawnLeft         = pawnLeftAttacks(pawns, them, board->turn);
-    pawnRight        = pawnRightAttacks(pawns, them, board->turn);
-    pawnPromoForward = pawnAdvance(pawns, occupied, board->turn) & PROMOTION_RANKS;
+    pawnLeft         = pawnLeftAttacks(pawns, destinations, board->turn);
+    pawnRight        = pawnRightAttacks(pawns, destinations, board->turn);
+    pawnPromoForward = pawnAdvance(pawns, occupied, board->turn) & PROMOTION_RANKS & blocks;
     pawnPromoLeft    = pawnLeft & PROMOTION_RANKS; pawnLeft &= ~PROMOTION_RANKS;
     pawnPromoRight   = pawnRight & PROMOTION_RANKS; pawnRight &= ~PROMOTION_RANKS;
 
+    // Pinned Pawns may only capture the pinning piece, or push along a file
+    if (pawns & pinned) {
+        pawnLeft         = pinnedPawnsFilter(pawnLeft, pawns & pinned, king, Left);
+        pawnRight        = pinnedPawnsFilter(pawnRight, pawns & pinned, king, Right);
+        pawnPromoForward = pinnedPawnsFilter(pawnPromoForward, pawns & pinned, king, Forward);
+        pawnPromoLeft    = pinnedPawnsFilter(pawnPromoLeft, pawns & pinned, king, Left);
+        pawnPromoRight   = pinnedPawnsFilter(pawnPromoRight, pawns & pinned, king, Right);
+    }
+
     // Generate moves for all the Pawns, so long as they are noisy
-    moves = buildEnpassMoves(moves, pawnEnpass, board->epSquare);
-    moves = buildPawnMoves(moves, pawnLeft & destinations, Left);
-    moves = buildPawnMoves(moves, pawnRight & destinations, Right);
+    while (pawnEnpass)
+        moves = buildSpecialMoves(board, moves, MoveMake(poplsb(&pawnEnpass), board->epSquare, ENPASS_MOVE));
+    moves = buildPawnMoves(moves, pawnLeft, Left);
+    moves = buildPawnMoves(moves, pawnRight, Right);
     moves = buildPawnPromotions(moves, pawnPromoForward, Forward);
     moves = buildPawnPromotions(moves, pawnPromoLeft, Left);
     moves = buildPawnPromotions(moves, pawnPromoRight, Right);
 
-    // Generate moves for the remainder of the pieces, so long as they are noisy
-    moves = buildJumperMoves(&knightAttacks, moves, knights, destinations);
-    moves = buildSliderMoves(&bishopAttacks, moves, bishops, destinations, occupied);
-    moves = buildSliderMoves(&rookAttacks, moves, rooks, destinations, occupied);
-    moves = buildJumperMoves(&kingAttacks, moves, kings, them);
+    // Generate moves for the remainder of the pieces, so long as they are noisy.
+    // A pinned Knight can never move, and only the King may step out of check
+    moves = buildJumperMoves(&knightAttacks, moves, knights & ~pinned, destinations);
+    moves = buildSliderMoves(&bishopAttacks, moves, bishops & ~pinned, destinations, occupied);
+    moves = buildSliderMoves(&rookAttacks, moves, rooks & ~pinned, destinations, occupied);
+    moves = buildPinnedSliderMoves(&bishopAttacks, moves, bishops & pinned, destinations, occupied, king);
+    moves = buildPinnedSliderMoves(&rookAttacks, moves, rooks & pinned, destinations, occupied, king);
+    moves = buildNormalMoves(moves, kingLegalTargets(board, king, kingAttacks(king) & them), king);
 
     return moves - start;
 }
@@ -174,8 +224,8 @@ int genAllQuietMoves(Board *board, uint16_t *moves) {
     const int Forward = board->turn == WHITE ? -8 : 8;
     const uint64_t Rank3Relative = board->turn == WHITE ? RANK_3 : RANK_6;
 
-    int rook, king, rookTo, kingTo, attacked;
-    uint64_t destinations, pawnForwardOne, pawnForwardTwo, mask;
+    int rook, king, rookTo, kingTo;
+    uint64_t destinations, pinned, pawnForwardOne, pawnForwardTwo, mask;
 
     uint64_t us       = board->colours[board->turn];
     uint64_t occupied = us | board->colours[!board->turn];
@@ -187,40 +237,53 @@ int genAllQuietMoves(Board *board, uint16_t *moves) {
     uint64_t rooks   = us & (board->pieces[ROOK  ]);
     uint64_t kings   = us & (board->pieces[KING  ]);
 
+    king = getlsb(kings);
+
     // Merge together duplicate piece ideas
     bishops |= us & board->pieces[QUEEN];
     rooks   |= us & board->pieces[QUEEN];
 
     // Double checks can only be evaded by moving the King
-    if (several(board->kingAttackers))
-        return buildJumperMoves(&kingAttacks, moves, kings, ~occupied) - start;
+    if (several(boardKingAttackers(board)))
+        return buildNormalMoves(moves, kingLegalTargets(board, king, kingAttacks(king) & ~occupied), king) - start;
 
     // When checked, we must block the checker with non-King pieces
     destinations = !board->kingAttackers ? ~occupied
-                 : bitsBetweenMasks(getlsb(kings), getlsb(board->kingAttackers));
+                 : bitsBetweenMasks(king, getlsb(board->kingAttackers));
+    pinned = board->pinned;
 
     // Compute bitboards for each type of Pawn movement
     pawnForwardOne = pawnAdvance(pawns, occupied, board->turn) & ~PROMOTION_RANKS;
     pawnForwardTwo = pawnAdvance(pawnForwardOne & Rank3Relative, occupied, board->turn);
+    pawnForwardOne &= destinations;
+    pawnForwardTwo &= destinations;
 
-    // Generate moves for all the pawns, so long as they are quiet
-    moves = buildPawnMoves(moves, pawnForwardOne & destinations, Forward);
-    moves = buildPawnMoves(moves, pawnForwardTwo & destinations, Forward * 2);
+    // Pinned Pawns may only push along the file of the pin
+    if (pawns & pinned) {
+        pawnForwardOne = pinnedPawnsFilter(pawnForwardOne, pawns & pinned, king, Forward);
+        pawnForwardTwo = pinnedPawnsFilter(pawnForwardTwo, pawns & pinned, king, Forward * 2);
+    }
 
-    // Generate moves for the remainder of the pieces, so long as they are quiet
-    moves = buildJumperMoves(&knightAttacks, moves, knights, destinations);
-    moves = buildSliderMoves(&bishopAttacks, moves, bishops, destinations, occupied);
-    moves = buildSliderMoves(&rookAttacks, moves, rooks, destinations, occupied);
-    moves = buildJumperMoves(&kingAttacks, moves, kings, ~occupied);
+    // Generate moves for all the pawns, so long as they are quiet
+    moves = buildPawnMoves(moves, pawnForwardOne, Forward);
+    moves = buildPawnMoves(moves, pawnForwardTwo, Forward * 2);
+
+    // Generate moves for the remainder of the pieces, so long as they are quiet.
+    // A pinned Knight can never move, and only the King may step out of check
+    moves = buildJumperMoves(&knightAttacks, moves, knights & ~pinned, destinations);
+    moves = buildSliderMoves(&bishopAttacks, moves, bishops & ~pinned, destinations, occupied);
+    moves = buildSliderMoves(&rookAttacks, moves, rooks & ~pinned, destinations, occupied);
+    moves = buildPinnedSliderMoves(&bishopAttacks, moves, bishops & pinned, destinations, occupied, king);
+    moves = buildPinnedSliderMoves(&rookAttacks, moves, rooks & pinned, destinations, occupied, king);
+    moves = buildNormalMoves(moves, kingLegalTargets(board, king, kingAttacks(king) & ~occupied), king);
 
     // Attempt to generate a castle move for each rook
     while (castles && !board->kingAttackers) {
 
         // Figure out which pieces are moving to which squares
-        rook = poplsb(&castles), king = getlsb(kings);
+        rook = poplsb(&castles);
         rookTo = castleRookTo(king, rook);
         kingTo = castleKingTo(king, rook);
-        attacked = 0;
 
         // Castle is illegal if we would go over a piece
         mask  = bitsBetweenMasks(king, kingTo) | (1ull << kingTo);
@@ -229,15 +292,13 @@ int genAllQuietMoves(Board *board, uint16_t *moves) {
         if (occupied & mask) continue;
 
         // Castle is illegal if we move through a checking threat
-        mask = bitsBetweenMasks(king, kingTo);
-        while (mask)
-            if (squareIsAttacked(board, board->turn, poplsb(&mask)))
-                { attacked = 1; break; }
-        if (attacked) continue;
-
-        // All conditions have been met. Identify which side we are castling to
-        *(moves++) = MoveMake(king, rook, CASTLE_MOVE);
+        if (boardThreats(board) & bitsBetweenMasks(king, kingTo)) continue;
+
+        // All conditions have been met, aside from landing on a safe square
+        moves = buildSpecialMoves(board, moves, MoveMake(king, rook, CASTLE_MOVE));
     }
 
     return moves - start;
 }
+
+
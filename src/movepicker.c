@@ -53,11 +53,14 @@ void init_picker(MovePicker *mp, Thread *thread, uint16_t tt_move) {
     get_refutation_moves(thread, &mp->killer1, &mp->killer2, &mp->counter);
 
     // General housekeeping
-    mp->threshold = 0;
-    mp->type      = NORMAL_PICKER;
+    mp->threshold  = 0;
+    mp->type       = NORMAL_PICKER;
+    mp->quiet_best = -1;
 
     // Skip over the TT-move if it is illegal
-    mp->stage += !moveIsPseudoLegal(&thread->board, tt_move);
+    const bool legal = moveIsLegal(&thread->board, tt_move);
+    thread->ttstats.collisions += tt_move != NONE_MOVE && !legal;
+    mp->stage += !legal;
 }
 
 void init_noisy_picker(MovePicker *mp, Thread *thread, uint16_t tt_move, int threshold) {
@@ -70,13 +73,17 @@ void init_noisy_picker(MovePicker *mp, Thread *thread, uint16_t tt_move, int thr
     mp->killer1 = mp->killer2 = mp->counter = NONE_MOVE;
 
     // General housekeeping
-    mp->threshold = threshold;
-    mp->type      = NOISY_PICKER;
+    mp->threshold  = threshold;
+    mp->type       = NOISY_PICKER;
+    mp->quiet_best = -1;
 
     // Skip over the TT-move unless its a threshold-winning capture
     mp->stage += !moveIsTactical(&thread->board, tt_move)
-              || !moveIsPseudoLegal(&thread->board, tt_move)
+              || !moveIsLegal(&thread->board, tt_move)
               || !staticExchangeEvaluation(&thread->board, tt_move, threshold);
+
+    // A skipped TT-move would fail the same SEE again later, so forget it
+    if (mp->stage != STAGE_TABLE) mp->tt_move = NONE_MOVE;
 }
 
 uint16_t select_next(MovePicker *mp, Thread *thread, int skip_quiets) {
@@ -102,6 +109,10 @@ uint16_t select_next(MovePicker *mp, Thread *thread, int skip_quiets) {
             get_capture_histories(thread, mp->moves, mp->values, 0, mp->noisy_size);
             mp->stage = STAGE_GOOD_NOISY;
 
+            // The table move did not cut, so the quiets are likely to follow
+            if (mp->type == NORMAL_PICKER)
+                prefetch_quiet_histories(thread);
+
             /* fallthrough */
 
         case STAGE_GOOD_NOISY:
@@ -116,6 +127,13 @@ uint16_t select_next(MovePicker *mp, Thread *thread, int skip_quiets) {
                 if (mp->values[best] < 0)
                     break;
 
+                // The Noisy Picker already played the table move, which means
+                // it has already passed this exact SEE in init_noisy_picker()
+                if (mp->type == NOISY_PICKER && mp->moves[best] == mp->tt_move) {
+                    pop_move(&mp->noisy_size, mp->moves, mp->values, best);
+                    continue;
+                }
+
                 // Skip moves which fail to beat our SEE margin. We flag those moves
                 // as failed with the value (-1), and then repeat the selection process
                 if (!staticExchangeEvaluation(board, mp->moves[best], mp->threshold)) {
@@ -150,45 +168,46 @@ uint16_t select_next(MovePicker *mp, Thread *thread, int skip_quiets) {
 
         case STAGE_KILLER_1:
 
-            // Play killer move if not yet played, and pseudo legal
+            // Play killer move if not yet played, and legal
             mp->stage = STAGE_KILLER_2;
             if (   !skip_quiets
                 &&  mp->killer1 != mp->tt_move
-                &&  moveIsPseudoLegal(board, mp->killer1))
+                &&  moveIsLegal(board, mp->killer1))
                 return mp->killer1;
 
             /* fallthrough */
 
         case STAGE_KILLER_2:
 
-            // Play killer move if not yet played, and pseudo legal
+            // Play killer move if not yet played, and legal
             mp->stage = STAGE_COUNTER_MOVE;
             if (   !skip_quiets
                 &&  mp->killer2 != mp->tt_move
-                &&  moveIsPseudoLegal(board, mp->killer2))
+                &&  moveIsLegal(board, mp->killer2))
                 return mp->killer2;
 
             /* fallthrough */
 
         case STAGE_COUNTER_MOVE:
 
-            // Play counter move if not yet played, and pseudo legal
+            // Play counter move if not yet played, and legal
             mp->stage = STAGE_GENERATE_QUIET;
             if (   !skip_quiets
                 &&  mp->counter != mp->tt_move
                 &&  mp->counter != mp->killer1
                 &&  mp->counter != mp->killer2
-                &&  moveIsPseudoLegal(board, mp->counter))
+                &&  moveIsLegal(board, mp->counter))
                 return mp->counter;
 
             /* fallthrough */
 
         case STAGE_GENERATE_QUIET:
 
-            // Generate and evaluate all quiet moves when not skipping them
+            // Generate and evaluate all quiet moves when not skipping them. The
+            // scoring also finds the best quiet, since often only one is played
             if (!skip_quiets) {
                 mp->quiet_size = genAllQuietMoves(board, mp->moves + mp->split);
-                get_quiet_histories(thread, mp->moves, mp->values, mp->split, mp->quiet_size);
+                mp->quiet_best = get_quiet_histories(thread, mp->moves, mp->values, mp->split, mp->quiet_size);
             }
 
             mp->stage = STAGE_QUIET;
@@ -201,8 +220,10 @@ uint16_t select_next(MovePicker *mp, Thread *thread, int skip_quiets) {
             while (!skip_quiets && mp->quiet_size) {
 
                 // Select next best quiet and reduce the effective move list size
-                best = best_index(mp, mp->split, mp->split + mp->quiet_size) - mp->split;
+                best = mp->quiet_best != -1 ? mp->quiet_best - mp->split
+                     : best_index(mp, mp->split, mp->split + mp->quiet_size) - mp->split;
                 best_move = pop_move(&mp->quiet_size, mp->moves + mp->split, mp->values + mp->split, best);
+                mp->quiet_best = -1;
 
                 // Don't play a move more than once
                 if (   best_move == mp->tt_move || best_move == mp->killer1
@@ -32,7 +32,7 @@ enum {
 };
 
 struct MovePicker {
-    int split, noisy_size, quiet_size;
+    int split, noisy_size, quiet_size, quiet_best;
     int stage, type, threshold;
     int values[MAX_MOVES];
     uint16_t moves[MAX_MOVES];
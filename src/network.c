@@ -29,11 +29,8 @@
 #include "thread.h"
 #include "types.h"
 
-PKNetwork PKNN;
-
-static char *PKWeights[] = {
-    #include "weights/pknet_224x32x2.net"
-    ""
+static const PKNetwork PKNN = {
+    #include "weights/pknet_224x32x2.h"
 };
 
 static int computePKNetworkIndex(int colour, int piece, int sq) {
@@ -42,32 +39,6 @@ static int computePKNetworkIndex(int colour, int piece, int sq) {
          + sq - 8 * (piece == PAWN);
 }
 
-
-void initPKNetwork() {
-
-    for (int i = 0; i < PKNETWORK_LAYER1; i++) {
-
-        char weights[strlen(PKWeights[i]) + 1];
-        strcpy(weights, PKWeights[i]);
-        strtok(weights, " ");
-
-        for (int j = 0; j < PKNETWORK_INPUTS; j++)
-            PKNN.inputWeights[j][i] = atof(strtok(NULL, " "));
-        PKNN.inputBiases[i] = atof(strtok(NULL, " "));
-    }
-
-    for (int i = 0; i < PKNETWORK_OUTPUTS; i++) {
-
-        char weights[strlen(PKWeights[i + PKNETWORK_LAYER1]) + 1];
-        strcpy(weights, PKWeights[i + PKNETWORK_LAYER1]);
-        strtok(weights, " ");
-
-        for (int j = 0; j < PKNETWORK_LAYER1; j++)
-            PKNN.layer1Weights[i][j] = atof(strtok(NULL, " "));
-        PKNN.layer1Biases[i] = atof(strtok(NULL, " "));
-    }
-}
-
 int computePKNetwork(Board *board) {
 
     uint64_t pawns = board->pieces[PAWN];
@@ -106,15 +77,102 @@ int computePKNetwork(Board *board) {
 
     // Layer 2: Trivially compute the Output layer. Apply a ReLU here.
     // We do not apply a ReLU in Layer 1, since we already know that all
-    // of the Inputs in Layer 1 are going to be zeros or ones
+    // of the Inputs in Layer 1 are going to be zeros or ones. The ReLU is
+    // applied up front, so that neither loop needs to branch, while each
+    // Output still sums over the Neurons in the same (exact) order
+
+    for (int i = 0; i < PKNETWORK_LAYER1; i++)
+        layer1Neurons[i] = layer1Neurons[i] >= 0.0 ? layer1Neurons[i] : 0.0;
 
-    for (int i = 0; i < PKNETWORK_OUTPUTS; i++) {
+    for (int i = 0; i < PKNETWORK_OUTPUTS; i++)
         outputNeurons[i] = PKNN.layer1Biases[i];
-        for (int j = 0; j < PKNETWORK_LAYER1; j++)
-            if (layer1Neurons[j] >= 0.0)
-                outputNeurons[i] += layer1Neurons[j] * PKNN.layer1Weights[i][j];
-    }
+
+    for (int j = 0; j < PKNETWORK_LAYER1; j++)
+        for (int i = 0; i < PKNETWORK_OUTPUTS; i++)
+            outputNeurons[i] += layer1Neurons[j] * PKNN.layer1Weights[i][j];
 
     assert(PKNETWORK_OUTPUTS == PHASE_NB);
     return MakeScore((int) outputNeurons[MG], (int) outputNeurons[EG]);
 }
+
+static void convertPKNetworkRow(FILE *fout, const char *indent, const float *values, int length) {
+
+    // Four hexadecimal floats per line, which keep every bit of each value
+    for (int i = 0; i < length; i++)
+        fprintf(fout, "%s%a%s", i % 4 ? " " : indent, values[i],
+            i == length - 1 ? "\n" : i % 4 == 3 ? ",\n" : ",");
+}
+
+void convertPKNetwork(const char *fname, const char *oname) {
+
+    /// Convert the text form of the PKNetwork, which has one line per Neuron of
+    /// "<inputs> <weights ...> <bias>", wrapped as C strings, into the header of
+    /// hexadecimal floats which network.c includes. Values are parsed with atof,
+    /// exactly as when the Network used to be loaded from the text at start-up
+
+    FILE *fin = fopen(fname, "r"), *fout = fopen(oname, "w");
+    PKNetwork *network = calloc(1, sizeof(PKNetwork));
+    char line[1 << 14], *ptr;
+    int i, j, rows = 0;
+
+    if (fin == NULL || fout == NULL) {
+        printf("Unable to open %s or %s\n", fname, oname);
+        exit(EXIT_FAILURE);
+    }
+
+    while (fgets(line, sizeof(line), fin) && rows < PKNETWORK_LAYER1 + PKNETWORK_OUTPUTS) {
+
+        const bool layer1 = rows < PKNETWORK_LAYER1;
+        const int inputs  = layer1 ? PKNETWORK_INPUTS : PKNETWORK_LAYER1;
+
+        if (line[0] != '"' || strtol(line + 1, &ptr, 10) != inputs) {
+            printf("Line %d of %s does not describe a %d input Neuron\n", rows + 1, fname, inputs);
+            exit(EXIT_FAILURE);
+        }
+
+        for (j = 0; j < inputs; j++) {
+            if (layer1) network->inputWeights[j][rows] = atof(ptr);
+            else network->layer1Weights[rows - PKNETWORK_LAYER1][j] = atof(ptr);
+            ptr = strchr(ptr + 1, ' ');
+        }
+
+        if (layer1) network->inputBiases[rows] = atof(ptr);
+        else network->layer1Biases[rows - PKNETWORK_LAYER1] = atof(ptr);
+        rows++;
+    }
+
+    if (rows != PKNETWORK_LAYER1 + PKNETWORK_OUTPUTS) {
+        printf("Found %d of the %d Neurons in %s\n", rows, PKNETWORK_LAYER1 + PKNETWORK_OUTPUTS, fname);
+        exit(EXIT_FAILURE);
+    }
+
+    fprintf(fout, "// Weights of the [%dx%d, %dx%d] PKNetwork, as hexadecimal floats laid out\n",
+        PKNETWORK_INPUTS, PKNETWORK_LAYER1, PKNETWORK_LAYER1, PKNETWORK_OUTPUTS);
+    fprintf(fout, "// exactly as the PKNetwork struct. The Input Weights are already transposed.\n");
+    fprintf(fout, "// Generated from the text form of the Network, by running\n");
+    fprintf(fout, "//     ./Ethereal pkconvert %s %s\n\n", fname, oname);
+
+    fprintf(fout, ".inputWeights = {\n");
+    for (i = 0; i < PKNETWORK_INPUTS; i++) {
+        fprintf(fout, "    {\n");
+        convertPKNetworkRow(fout, "        ", network->inputWeights[i], PKNETWORK_LAYER1);
+        fprintf(fout, "    },\n");
+    }
+
+    fprintf(fout, "},\n\n.inputBiases = {\n");
+    convertPKNetworkRow(fout, "    ", network->inputBiases, PKNETWORK_LAYER1);
+
+    fprintf(fout, "},\n\n.layer1Weights = {\n");
+    for (i = 0; i < PKNETWORK_OUTPUTS; i++) {
+        fprintf(fout, "    {\n");
+        convertPKNetworkRow(fout, "        ", network->layer1Weights[i], PKNETWORK_LAYER1);
+        fprintf(fout, "    },\n");
+    }
+
+    fprintf(fout, "},\n\n.layer1Biases = {\n");
+    convertPKNetworkRow(fout, "    ", network->layer1Biases, PKNETWORK_OUTPUTS);
+    fprintf(fout, "},\n");
+
+    fclose(fin); fclose(fout);
+    free(network);
+}
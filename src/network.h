@@ -45,5 +45,5 @@ typedef struct PKNetwork {
 
 } PKNetwork;
 
-void initPKNetwork();
-int computePKNetwork(Board *board);
\ No newline at end of file
+int computePKNetwork(Board *board);
+void convertPKNetwork(const char *fname, const char *oname);
\ No newline at end of file
@@ -0,0 +1,224 @@
+/*
+  Ethereal is a UCI chess playing engine authored by Andrew Grant.
+  <https://github.com/AndyGrant/Ethereal>     <andrew@grantnet.us>
+
+  Ethereal is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Ethereal is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "board.h"
+#include "move.h"
+#include "nnchain.h"
+#include "pgn.h"
+#include "timeman.h"
+
+static void nnchain_reserve(NNChainBuffer *chain, size_t bytes) {
+
+    if (chain->size + bytes <= chain->capacity)
+        return;
+
+    chain->capacity = MAX(2 * chain->capacity, chain->size + bytes);
+    chain->data     = realloc(chain->data, chain->capacity);
+}
+
+static void nnchain_put_varint(NNChainBuffer *chain, uint32_t value) {
+
+    // Seven bits per byte, with the high bit flagging that more will follow
+    for (; value >= 0x80; value >>= 7)
+        chain->data[chain->size++] = (uint8_t) (value | 0x80);
+
+    chain->data[chain->size++] = (uint8_t) value;
+}
+
+void nnchain_begin(NNChainBuffer *chain, const char *fen, int result) {
+
+    const size_t length = strlen(fen) + 1;
+
+    nnchain_reserve(chain, length + 1);
+    chain->data[chain->size++] = (uint8_t) result;
+    memcpy(chain->data + chain->size, fen, length);
+    chain->size += length;
+
+    chain->last_eval = 0;
+}
+
+void nnchain_push(NNChainBuffer *chain, uint16_t move, bool sampled, int eval) {
+
+    // Two bytes for the move, and at most five for the eval difference
+    nnchain_reserve(chain, 7);
+    chain->data[chain->size++] = (uint8_t) (move >> 0);
+    chain->data[chain->size++] = (uint8_t) (move >> 8);
+
+    if (!sampled) {
+        chain->data[chain->size++] = 0;
+        return;
+    }
+
+    const int32_t delta  = eval - chain->last_eval;
+    const uint32_t zigzag = ((uint32_t) delta << 1) ^ (uint32_t) (delta >> 31);
+
+    nnchain_put_varint(chain, (zigzag << 1) | 1);
+    chain->last_eval = eval;
+}
+
+void nnchain_end(NNChainBuffer *chain) {
+    nnchain_reserve(chain, 2);
+    chain->data[chain->size++] = 0;
+    chain->data[chain->size++] = 0;
+}
+
+
+static bool nnchain_refill(NNChainReader *reader) {
+    reader->index = 0;
+    reader->size  = fread(reader->buffer, 1, NNCHAIN_BUFFER_SIZE, reader->fin);
+    return reader->size != 0;
+}
+
+static int nnchain_byte(NNChainReader *reader) {
+
+    if (reader->index == reader->size && !nnchain_refill(reader))
+        return EOF;
+
+    return reader->buffer[reader->index++];
+}
+
+static bool nnchain_varint(NNChainReader *reader, uint32_t *value) {
+
+    int byte, shift = 0;
+
+    *value = 0;
+
+    do {
+        if ((byte = nnchain_byte(reader)) == EOF)
+            return false;
+        *value |= (uint32_t) (byte & 0x7F) << shift;
+        shift  += 7;
+    } while (byte & 0x80);
+
+    return true;
+}
+
+NNChainReader* nnchain_open(const char *fname) {
+
+    char magic[8];
+    NNChainReader *reader = malloc(sizeof(NNChainReader));
+
+    reader->index = reader->size = 0;
+    reader->truncated = false;
+
+    if ((reader->fin = fopen(fname, "rb")) == NULL) {
+        free(reader);
+        return NULL;
+    }
+
+    if (   fread(magic, 1, sizeof(magic), reader->fin) != sizeof(magic)
+        || memcmp(magic, NNCHAIN_MAGIC, sizeof(magic))) {
+        nnchain_close(reader);
+        return NULL;
+    }
+
+    return reader;
+}
+
+int nnchain_read_game(NNChainReader *reader, Board *board, HalfKPSample *samples) {
+
+    /// Decode the next game into HalfKPSamples, returning how many there are,
+    /// or -1 once there are no more games. The Board is used to replay moves.
+    /// A game cut short by the end of the file, or one holding an illegal move,
+    /// also returns -1, after flagging the reader as truncated
+
+    Undo undo;
+    char fen[256];
+    uint16_t move;
+    uint32_t token;
+    int result, byte, low, high, length = 0, placed = 0, eval = 0;
+
+    if ((result = nnchain_byte(reader)) == EOF)
+        return -1;
+
+    while ((byte = nnchain_byte(reader)) != EOF && byte != '\0')
+        if (length < (int) sizeof(fen) - 1) fen[length++] = byte;
+
+    if (byte == EOF)
+        return reader->truncated = true, -1;
+
+    fen[length] = '\0';
+    boardFromFEN(board, fen, 0);
+
+    while (1) {
+
+        if ((low = nnchain_byte(reader)) == EOF || (high = nnchain_byte(reader)) == EOF)
+            return reader->truncated = true, -1;
+
+        if ((move = (uint16_t) (low | (high << 8))) == NONE_MOVE)
+            break;
+
+        // The low bit flags a sample, with a zigzag encoded eval difference
+        if (!nnchain_varint(reader, &token) || !moveIsLegal(board, move))
+            return reader->truncated = true, -1;
+
+        if ((token & 1) && placed < PGN_MAX_SAMPLES) {
+            const uint32_t zigzag = token >> 1;
+            eval += (int32_t) (zigzag >> 1) ^ -(int32_t) (zigzag & 1);
+            build_halfkp_sample(board, &samples[placed++], result, eval);
+        }
+
+        applyMove(board, move, &undo);
+    }
+
+    return placed;
+}
+
+void nnchain_close(NNChainReader *reader) {
+    fclose(reader->fin);
+    free(reader);
+}
+
+
+void nnchain_expand(const char *fin, const char *fout) {
+
+    Board board;
+    int placed;
+    uint64_t games = 0, total = 0;
+    double start = get_real_time();
+
+    NNChainReader *reader = nnchain_open(fin);
+    FILE *bindata = fopen(fout, "wb");
+    HalfKPSample *samples = malloc(sizeof(HalfKPSample) * PGN_MAX_SAMPLES);
+
+    if (reader == NULL || bindata == NULL) {
+        printf("Unable to open %s or %s\n", fin, fout);
+        exit(EXIT_FAILURE);
+    }
+
+    while ((placed = nnchain_read_game(reader, &board, samples)) >= 0) {
+        fwrite(samples, sizeof(HalfKPSample), placed, bindata);
+        games++, total += placed;
+    }
+
+    printf("Expanded %"PRIu64" games in %dms, %"PRIu64" samples\n",
+        games, (int) (get_real_time() - start), total);
+
+    if (reader->truncated)
+        printf("Stopped at game %"PRIu64", as %s is truncated or corrupt\n", games + 1, fin);
+
+    nnchain_close(reader);
+    fclose(bindata);
+    free(samples);
+}
@@ -0,0 +1,64 @@
+/*
+  Ethereal is a UCI chess playing engine authored by Andrew Grant.
+  <https://github.com/AndyGrant/Ethereal>     <andrew@grantnet.us>
+
+  Ethereal is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Ethereal is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "pgn.h"
+#include "types.h"
+
+/// A compact alternative to streams of HalfKPSamples, chaining together the
+/// positions of each game. A game is stored as its result, from White's view,
+/// and the FEN of its first position, followed by every move played. Moves
+/// are two bytes each, and are followed by a varint which is zero unless the
+/// position before the move is a sample. Samples store the zigzag encoded
+/// difference from the previous sample's eval, shifted up, with the low bit
+/// set. A NONE_MOVE ends the game. Files begin with NNCHAIN_MAGIC.
+///
+/// Decoding replays each game on a Board, and rebuilds the same HalfKPSamples
+/// that would have been written directly. A game has at most PGN_MAX_SAMPLES.
+
+#define NNCHAIN_MAGIC "EthChain"
+
+enum { NNCHAIN_BUFFER_SIZE = 1 << 20 };
+
+typedef struct NNChainBuffer {
+    uint8_t *data;
+    size_t size, capacity;
+    int last_eval;
+} NNChainBuffer;
+
+typedef struct NNChainReader {
+    FILE *fin;
+    bool truncated; // Set when a game ends early, or holds an illegal move
+    size_t index, size;
+    uint8_t buffer[NNCHAIN_BUFFER_SIZE];
+} NNChainReader;
+
+void nnchain_begin(NNChainBuffer *chain, const char *fen, int result);
+void nnchain_push(NNChainBuffer *chain, uint16_t move, bool sampled, int eval);
+void nnchain_end(NNChainBuffer *chain);
+
+NNChainReader* nnchain_open(const char *fname);
+int nnchain_read_game(NNChainReader *reader, Board *board, HalfKPSample *samples);
+void nnchain_close(NNChainReader *reader);
+
+void nnchain_expand(const char *fin, const char *fout);
@@ -0,0 +1,220 @@
+/*
+  Ethereal is a UCI chess playing engine authored by Andrew Grant.
+  <https://github.com/AndyGrant/Ethereal>     <andrew@grantnet.us>
+
+  Ethereal is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Ethereal is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bitboards.h"
+#include "nnshuffle.h"
+#include "pgn.h"
+#include "timeman.h"
+
+static uint64_t nnshuffle_mix(uint64_t z) {
+
+    // http://xoshiro.di.unimi.it/splitmix64.c
+
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+static uint64_t nnshuffle_rand(uint64_t *seed) {
+    return nnshuffle_mix(*seed += 0x9E3779B97F4A7C15ull);
+}
+
+static uint64_t nnshuffle_hash(const HalfKPSample *sample) {
+
+    /// Hash only the position, ignoring the eval and result. Older files may
+    /// hold stale bytes after the last of the packed pieces, so those are
+    /// masked away. A hash of zero marks an empty slot, so is never returned
+
+    uint64_t packed[2] = {0};
+    const int used = (1 + popcount(sample->occupied)) / 2;
+    memcpy(packed, sample->packed, MIN(used, (int) sizeof(sample->packed)));
+
+    uint64_t hash = nnshuffle_mix(sample->occupied + 0x9E3779B97F4A7C15ull);
+    hash = nnshuffle_mix(hash ^ packed[0]);
+    hash = nnshuffle_mix(hash ^ packed[1]);
+    hash = nnshuffle_mix(hash ^ (sample->turn << 16 | sample->wking << 8 | sample->bking));
+
+    return hash | !hash;
+}
+
+static int nnshuffle_unique(HalfKPSample *samples, int count) {
+
+    // Compact the first of each position to the front, using an open
+    // addressed set of hashes, sized to at least twice the sample count
+
+    uint64_t size = 1;
+    while (size < 2ull * count) size *= 2;
+
+    uint64_t *table = calloc(size, sizeof(uint64_t));
+    int unique = 0;
+
+    for (int i = 0; i < count; i++) {
+
+        const uint64_t hash = nnshuffle_hash(&samples[i]);
+        uint64_t slot = hash & (size - 1);
+
+        while (table[slot] && table[slot] != hash)
+            slot = (slot + 1) & (size - 1);
+
+        if (!table[slot]) {
+            table[slot] = hash;
+            samples[unique++] = samples[i];
+        }
+    }
+
+    free(table);
+    return unique;
+}
+
+static void nnshuffle_record(NNShuffleStats *stats, const HalfKPSample *sample) {
+
+    const int bin = (MAX(-2000, MIN(2000, sample->eval)) + 2050) / 100;
+
+    stats->samples++;
+    stats->results[MIN(2, sample->result)]++;
+    stats->evals[MIN(NNSHUFFLE_EVAL_BINS - 1, bin)]++;
+    stats->pieces[popcount(sample->occupied) + 2]++;
+}
+
+static void nnshuffle_report(const NNShuffleStats *stats, double elapsed) {
+
+    const double total = MAX(1, stats->samples);
+
+    printf("Read %"PRIu64" samples, wrote %"PRIu64" unique samples in %dms\n",
+        stats->inputs, stats->samples, (int) elapsed);
+
+    printf("Results: L %.2f%% D %.2f%% W %.2f%% (side to move)\n",
+        100.0 * stats->results[0] / total, 100.0 * stats->results[1] / total,
+        100.0 * stats->results[2] / total);
+
+    printf("Evals:\n");
+    for (int i = 0; i < NNSHUFFLE_EVAL_BINS; i++)
+        if (stats->evals[i])
+            printf("  %+5d cp %12"PRIu64" %6.2f%%\n", 100 * i - 2000,
+                stats->evals[i], 100.0 * stats->evals[i] / total);
+
+    printf("Pieces:\n");
+    for (int i = 0; i <= 32; i++)
+        if (stats->pieces[i])
+            printf("  %5d    %12"PRIu64" %6.2f%%\n", i,
+                stats->pieces[i], 100.0 * stats->pieces[i] / total);
+}
+
+
+void nnshuffle(const char *prefix, int nshards, int megabytes, int ninputs, char **inputs) {
+
+    char fname[512];
+    uint64_t total = 0, dealt = 0;
+    double start = get_real_time();
+    NNShuffleStats stats = {0};
+
+    size_t sizes[ninputs];
+    HalfKPSample *mapped[ninputs];
+    FILE *shards[nshards], *parts[NNSHUFFLE_MAX_PARTITIONS];
+
+    for (int i = 0; i < ninputs; i++) {
+
+        if ((mapped[i] = nndata_map_file(inputs[i], &sizes[i])) == NULL) {
+            printf("Unable to open %s\n", inputs[i]);
+            exit(EXIT_FAILURE);
+        }
+
+        if (sizes[i] % sizeof(HalfKPSample))
+            printf("info string %s has a partial sample, which is ignored\n", inputs[i]);
+
+        total += sizes[i] / sizeof(HalfKPSample);
+    }
+
+    // Enough partitions that each will fit in the budget, along with its set
+    const uint64_t budget = (uint64_t) megabytes << 20;
+    const int nparts = MAX(1, MIN(NNSHUFFLE_MAX_PARTITIONS,
+        (int) ((total * NNSHUFFLE_BYTES_PER + budget - 1) / budget)));
+
+    if ((uint64_t) nparts * budget < total * NNSHUFFLE_BYTES_PER)
+        printf("info string exceeding %dMB, by using %d partitions\n", megabytes, nparts);
+
+    for (int i = 0; i < nparts; i++)
+        if ((parts[i] = tmpfile()) == NULL) {
+            printf("Unable to create a temporary partition\n");
+            exit(EXIT_FAILURE);
+        }
+
+    for (int i = 0; i < nshards; i++) {
+        snprintf(fname, sizeof(fname), "%s.%d", prefix, i);
+        if ((shards[i] = fopen(fname, "wb")) == NULL) {
+            printf("Unable to open %s\n", fname);
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    // Pass one: stream each input, splitting the samples by position
+    for (int i = 0; i < ninputs; i++) {
+
+        for (size_t j = 0; j < sizes[i] / sizeof(HalfKPSample); j++) {
+            const uint64_t hash = nnshuffle_hash(&mapped[i][j]);
+            fwrite(&mapped[i][j], sizeof(HalfKPSample), 1, parts[(hash >> 32) % nparts]);
+        }
+
+        nndata_unmap_file(mapped[i], sizes[i]);
+    }
+
+    stats.inputs = total;
+
+    // Pass two: deduplicate and shuffle each partition, and deal out its
+    // samples to the shards in turn, keeping the shards within one sample
+
+    for (int i = 0; i < nparts; i++) {
+
+        const int count = ftell(parts[i]) / sizeof(HalfKPSample);
+        HalfKPSample *samples = malloc(sizeof(HalfKPSample) * MAX(1, count));
+        uint64_t seed = i;
+
+        rewind(parts[i]);
+        if (fread(samples, sizeof(HalfKPSample), count, parts[i]) != (size_t) count) {
+            printf("Unable to read back a temporary partition\n");
+            exit(EXIT_FAILURE);
+        }
+
+        fclose(parts[i]);
+
+        const int unique = nnshuffle_unique(samples, count);
+
+        for (int j = unique - 1; j > 0; j--) {
+            const int k = nnshuffle_rand(&seed) % (j + 1);
+            const HalfKPSample swap = samples[j];
+            samples[j] = samples[k], samples[k] = swap;
+        }
+
+        for (int j = 0; j < unique; j++) {
+            nnshuffle_record(&stats, &samples[j]);
+            fwrite(&samples[j], sizeof(HalfKPSample), 1, shards[dealt++ % nshards]);
+        }
+
+        free(samples);
+    }
+
+    for (int i = 0; i < nshards; i++)
+        fclose(shards[i]);
+
+    nnshuffle_report(&stats, get_real_time() - start);
+}
@@ -0,0 +1,45 @@
+/*
+  Ethereal is a UCI chess playing engine authored by Andrew Grant.
+  <https://github.com/AndyGrant/Ethereal>     <andrew@grantnet.us>
+
+  Ethereal is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Ethereal is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <stdint.h>
+
+#include "types.h"
+
+/// Shuffle and deduplicate any number of nndata files, within a fixed memory
+/// budget, into some number of output shards. Samples are first partitioned
+/// by a hash of their position, to temporary files, such that all duplicates
+/// share a partition, and such that each partition is a random subset of the
+/// data. Each partition is then loaded alone, deduplicated, shuffled, and
+/// dealt out across the shards in turn. The first of any duplicates is kept.
+
+enum {
+    NNSHUFFLE_MAX_PARTITIONS = 512,
+    NNSHUFFLE_EVAL_BINS      =  41, // 100cp each, centred on zero
+    NNSHUFFLE_BYTES_PER      =  48, // A sample, plus its hash set slot
+};
+
+typedef struct NNShuffleStats {
+    uint64_t inputs, samples;
+    uint64_t results[3];
+    uint64_t evals[NNSHUFFLE_EVAL_BINS];
+    uint64_t pieces[33];
+} NNShuffleStats;
+
+void nnshuffle(const char *prefix, int nshards, int megabytes, int ninputs, char **inputs);
@@ -18,11 +18,11 @@
 /*                                                                            */
 /******************************************************************************/
 
-#include <immintrin.h>
 #include <stdio.h>
 #include <string.h>
 
 #include "accumulator.h"
+#include "dispatch.h"
 #include "nnue.h"
 #include "types.h"
 
@@ -30,6 +30,8 @@
 #include "../thread.h"
 #include "../types.h"
 
+#define NNUE_CHAIN_PLIES 8
+
 
 static int sq64_to_sq32(int sq) {
     static const int Mirror[] = { 3, 2, 1, 0, 0, 1, 2, 3 };
@@ -69,73 +71,77 @@ int nnue_can_update(NNUEAccumulator *accum, Board *board, int colour) {
     return FALSE;
 }
 
-void nnue_update_accumulator(NNUEAccumulator *accum, Board *board, int colour, int relksq) {
+void nnue_update_accumulator(NNUEEvaluator *nnue, NNUEAccumulator *accum, int colour, int relksq) {
 
-    int add = 0, remove = 0;
-    int add_list[3], remove_list[3];
-    vepi16 *inputs, *outputs, *weights, registers[NUM_REGS];
+    // Walk back to the nearest accurate Accumulator, and collect the changes
+    // of every ply since. Those are then applied in a single pass, storing
+    // each ply along the way, since the siblings of a node often reuse them.
+    // Very long chains are handled in segments, to keep the lists small
 
-    // Recurse and update all out of our date parents
-    if (!(accum-1)->accurate[colour])
-        nnue_update_accumulator((accum-1), board, colour, relksq);
+    int adds[3 * NNUE_CHAIN_PLIES], nadds[NNUE_CHAIN_PLIES];
+    int removes[3 * NNUE_CHAIN_PLIES], nremoves[NNUE_CHAIN_PLIES];
+    int16_t *outputs[NNUE_CHAIN_PLIES];
 
-    // Determine the features that have changed, by looping through them
-    for (NNUEDelta *x = &accum->deltas[0]; x < &accum->deltas[0] + accum->changes; x++) {
+    NNUEAccumulator *source = accum - 1;
 
-        // HalfKP does not concern with KxK relations
-        if (pieceType(x->piece) == KING)
-            continue;
+    while (!source->accurate[colour])
+        source = source - 1;
 
-        // Moving or placing a Piece to a Square
-        if (x->to != SQUARE_NB)
-            add_list[add++] = nnue_index(x->piece, relksq, colour, x->to);
+    while (source != accum) {
 
-        // Moving or deleting a Piece from a Square
-        if (x->from != SQUARE_NB)
-            remove_list[remove++] = nnue_index(x->piece, relksq, colour, x->from);
-    }
+        int plies = 0, add = 0, remove = 0;
 
-    for (int offset = 0; offset < KPSIZE; offset += NUM_REGS * vepi16_cnt) {
+        for (NNUEAccumulator *ply = source + 1; ply <= accum && plies < NNUE_CHAIN_PLIES; ply++, plies++) {
 
-        outputs = (vepi16*) &(accum-0)->values[colour][offset];
-        inputs  = (vepi16*) &(accum-1)->values[colour][offset];
+            nadds[plies] = nremoves[plies] = 0;
 
-        for (int i = 0; i < NUM_REGS; i++)
-            registers[i] = inputs[i];
+            // Determine the features that have changed, by looping through them
+            for (NNUEDelta *x = &ply->deltas[0]; x < &ply->deltas[0] + ply->changes; x++) {
 
-        for (int i = 0; i < add; i++) {
+                // HalfKP does not concern with KxK relations
+                if (pieceType(x->piece) == KING)
+                    continue;
 
-            weights = (vepi16*) &in_weights[add_list[i] * KPSIZE + offset];
+                // Moving or placing a Piece to a Square
+                if (x->to != SQUARE_NB)
+                    adds[add++] = nnue_index(x->piece, relksq, colour, x->to), nadds[plies]++;
 
-            for (int j = 0; j < NUM_REGS; j++)
-                registers[j] = vepi16_add(registers[j], weights[j]);
-        }
+                // Moving or deleting a Piece from a Square
+                if (x->from != SQUARE_NB)
+                    removes[remove++] = nnue_index(x->piece, relksq, colour, x->from), nremoves[plies]++;
+            }
 
-        for (int i = 0; i < remove; i++) {
+            outputs[plies] = ply->values[colour];
+            ply->accurate[colour] = TRUE;
+        }
 
-            weights = (vepi16*) &in_weights[remove_list[i] * KPSIZE + offset];
+        if (plies == 1)
+            nnue_kernels->accumulate(nnue->network, outputs[0], source->values[colour],
+                                     adds, add, removes, remove);
 
-            for (int j = 0; j < NUM_REGS; j++)
-                registers[j] = vepi16_sub(registers[j], weights[j]);
-        }
+        else
+            nnue_kernels->accumulate_chain(nnue->network, outputs, source->values[colour],
+                                           adds, nadds, removes, nremoves, plies);
 
-        for (int i = 0; i < NUM_REGS; i++)
-            outputs[i] = registers[i];
+        source += plies;
     }
-
-    accum->accurate[colour] = TRUE;
-    return;
 }
 
 void nnue_refresh_accumulator(NNUEEvaluator *nnue, NNUEAccumulator *accum, Board *board, int colour, int relsq) {
 
-    vepi16 *outputs, *weights, registers[NUM_REGS];
     const int ksq = getlsb(board->pieces[KING] & board->colours[colour]);
     NNUEAccumulatorTableEntry *entry = &nnue->table[ksq];
 
     int set_indexes[32], set_count = 0;
     int unset_indexes[32], unset_count = 0;
 
+    // Build the entry from the biases, the first time it is used
+    if (!testBit(nnue->seeded[colour], ksq)) {
+        memset(entry->occupancy[colour], 0, sizeof(entry->occupancy[colour]));
+        memcpy(entry->accumulator.values[colour], nnue->network->in_biases, sizeof(int16_t) * KPSIZE);
+        setBit(&nnue->seeded[colour], ksq);
+    }
+
     for (int c = WHITE; c <= BLACK; c++) {
 
         for (int pt = PAWN; pt <= QUEEN; pt++) {
@@ -154,32 +160,8 @@ void nnue_refresh_accumulator(NNUEEvaluator *nnue, NNUEAccumulator *accum, Board
         }
     }
 
-    for (int offset = 0; offset < KPSIZE; offset += NUM_REGS * vepi16_cnt) {
-
-        outputs = (vepi16*) &entry->accumulator.values[colour][offset];
-
-        for (int i = 0; i < NUM_REGS; i++)
-            registers[i] = outputs[i];
-
-        for (int i = 0; i < set_count; i++) {
-
-            weights = (vepi16*) &in_weights[set_indexes[i] * KPSIZE + offset];
-
-            for (int j = 0; j < NUM_REGS; j++)
-                registers[j] = vepi16_add(registers[j], weights[j]);
-        }
-
-        for (int i = 0; i < unset_count; i++) {
-
-            weights = (vepi16*) &in_weights[unset_indexes[i] * KPSIZE + offset];
-
-            for (int j = 0; j < NUM_REGS; j++)
-                registers[j] = vepi16_sub(registers[j], weights[j]);
-        }
-
-        for (int i = 0; i < NUM_REGS; i++)
-            outputs[i] = registers[i];
-    }
+    nnue_kernels->accumulate(nnue->network, entry->accumulator.values[colour], entry->accumulator.values[colour],
+                             set_indexes, set_count, unset_indexes, unset_count);
 
     memcpy(accum->values[colour], entry->accumulator.values[colour], sizeof(int16_t) * KPSIZE);
     accum->accurate[colour] = TRUE;
@@ -27,22 +27,36 @@
 #include "../thread.h"
 #include "../types.h"
 
-extern ALIGN64 int16_t in_weights[INSIZE * KPSIZE];
-extern ALIGN64 int16_t in_biases[KPSIZE];
+const NNUENetwork* nnue_replica(int node);
+int nnue_generation();
 
 INLINE NNUEEvaluator* nnue_create_evaluator() {
-    return align_malloc(sizeof(NNUEEvaluator));
+
+    // Only the bookkeeping is initialized. The Accumulator stack is set up as
+    // it is pushed, and the Finny table as it is used, so the pages are only
+    // touched by the owning thread, and only as deep as the search ever goes
+
+    NNUEEvaluator *ptr = align_malloc(sizeof(NNUEEvaluator));
+
+    ptr->seeded[WHITE] = ptr->seeded[BLACK] = 0ull;
+    ptr->network = NULL; ptr->node = -1; ptr->generation = 0;
+    ptr->current = &ptr->stack[0];
+
+    return ptr;
 }
 
 INLINE void nnue_reset_evaluator(NNUEEvaluator* ptr) {
 
     #if USE_NNUE
 
-        // Reset the Finny table Accumulators
-        for (size_t i = 0; i < SQUARE_NB; i++) {
-            memset(ptr->table[i].occupancy, 0, sizeof(ptr->table[i].occupancy));
-            memcpy(ptr->table[i].accumulator.values[WHITE], in_biases, sizeof(int16_t) * KPSIZE);
-            memcpy(ptr->table[i].accumulator.values[BLACK], in_biases, sizeof(int16_t) * KPSIZE);
+        // The Network may have been reloaded since the last search
+        ptr->network = nnue_replica(ptr->node);
+
+        // Finny entries remain exact for the occupancy they recorded, and
+        // are kept between searches, unless the weights have since changed
+        if (ptr->generation != nnue_generation()) {
+            ptr->generation = nnue_generation();
+            ptr->seeded[WHITE] = ptr->seeded[BLACK] = 0ull;
         }
 
         // Reset the base of the Accumulator stack
@@ -53,6 +67,18 @@ INLINE void nnue_reset_evaluator(NNUEEvaluator* ptr) {
     #endif
 }
 
+INLINE void nnue_bind_evaluator(NNUEEvaluator* ptr, int node) {
+
+    // Record the NUMA node that the owning thread is bound to, if any,
+    // so that it will use the replica of the Network local to that node
+
+    ptr->node = node;
+
+    #if USE_NNUE
+        ptr->network = nnue_replica(node);
+    #endif
+}
+
 INLINE void nnue_delete_evaluator(NNUEEvaluator* ptr) {
     align_free(ptr);
 }
@@ -88,5 +114,5 @@ INLINE void nnue_remove_piece(Board *board, int piece, int sq) {
 }
 
 int nnue_can_update(NNUEAccumulator *accum, Board *board, int colour);
-void nnue_update_accumulator(NNUEAccumulator *accum, Board *board, int colour, int relksq);
+void nnue_update_accumulator(NNUEEvaluator *nnue, NNUEAccumulator *accum, int colour, int relksq);
 void nnue_refresh_accumulator(NNUEEvaluator *nnue, NNUEAccumulator *accum, Board *board, int colour, int relksq);
@@ -40,10 +40,13 @@
 #define vepi16_packu _mm256_packus_epi16
 #define vepi16_maubs _mm256_maddubs_epi16
 
-#define vepi32_add  _mm256_add_epi32
-#define vepi32_max  _mm256_max_epi32
-#define vepi32_hadd _mm256_hadd_epi32
-#define vepi32_zero _mm256_setzero_si256
+#define vepi32_add   _mm256_add_epi32
+#define vepi32_max   _mm256_max_epi32
+#define vepi32_hadd  _mm256_hadd_epi32
+#define vepi32_zero  _mm256_setzero_si256
+#define vepi32_set1  _mm256_set1_epi32
+#define vepi32_srai  _mm256_srai_epi32
+#define vepi32_packs _mm256_packs_epi32
 
 #define vps32_add  _mm256_add_ps
 #define vps32_mul  _mm256_mul_ps
@@ -0,0 +1,54 @@
+/******************************************************************************/
+/*                                                                            */
+/*    Ethereal is a UCI chess playing engine authored by Andrew Grant.        */
+/*    <https://github.com/AndyGrant/Ethereal>     <andrew@grantnet.us>        */
+/*                                                                            */
+/*    Ethereal is free software: you can redistribute it and/or modify        */
+/*    it under the terms of the GNU General Public License as published by    */
+/*    the Free Software Foundation, either version 3 of the License, or       */
+/*    (at your option) any later version.                                     */
+/*                                                                            */
+/*    Ethereal is distributed in the hope that it will be useful,             */
+/*    but WITHOUT ANY WARRANTY; without even the implied warranty of          */
+/*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           */
+/*    GNU General Public License for more details.                            */
+/*                                                                            */
+/*    You should have received a copy of the GNU General Public License       */
+/*    along with this program.  If not, see <http://www.gnu.org/licenses/>    */
+/*                                                                            */
+/******************************************************************************/
+
+#pragma once
+
+#include <arm_neon.h>
+
+// AArch64 has no equivalent to maddubs, so halfkp_relu_quant_affine_relu()
+// has a NEON specific implementation, and only the accumulator updates and
+// the floating point layers are expressed using the generic primitives
+
+#define vepi8  int8x16_t
+#define vepi16 int16x8_t
+#define vepi32 int32x4_t
+#define vps32  float32x4_t
+
+#define vepi8_cnt  16
+#define vepi16_cnt 8
+#define vepi32_cnt 4
+#define vps32_cnt  4
+
+#define vepi16_add   vaddq_s16
+#define vepi16_sub   vsubq_s16
+#define vepi16_max   vmaxq_s16
+#define vepi16_zero() vdupq_n_s16(0)
+
+#define vepi32_add  vaddq_s32
+#define vepi32_max  vmaxq_s32
+#define vepi32_zero() vdupq_n_s32(0)
+
+#define vps32_add  vaddq_f32
+#define vps32_mul  vmulq_f32
+#define vps32_max  vmaxq_f32
+#define vps32_hadd vpaddq_f32
+#define vps32_zero() vdupq_n_f32(0.0f)
+
+#define vps32_fma(A, B, C) vfmaq_f32(C, A, B)
@@ -40,10 +40,13 @@
 #define vepi16_packu _mm_packus_epi16
 #define vepi16_maubs _mm_maddubs_epi16
 
-#define vepi32_add  _mm_add_epi32
-#define vepi32_max  (void)
-#define vepi32_hadd _mm_hadd_epi32
-#define vepi32_zero _mm_setzero_si128
+#define vepi32_add   _mm_add_epi32
+#define vepi32_max   (void)
+#define vepi32_hadd  _mm_hadd_epi32
+#define vepi32_zero  _mm_setzero_si128
+#define vepi32_set1  _mm_set1_epi32
+#define vepi32_srai  _mm_srai_epi32
+#define vepi32_packs _mm_packs_epi32
 
 #define vps32_add  _mm_add_ps
 #define vps32_mul  _mm_mul_ps
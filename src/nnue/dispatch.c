@@ -0,0 +1,76 @@
+/******************************************************************************/
+/*                                                                            */
+/*    Ethereal is a UCI chess playing engine authored by Andrew Grant.        */
+/*    <https://github.com/AndyGrant/Ethereal>     <andrew@grantnet.us>        */
+/*                                                                            */
+/*    Ethereal is free software: you can redistribute it and/or modify        */
+/*    it under the terms of the GNU General Public License as published by    */
+/*    the Free Software Foundation, either version 3 of the License, or       */
+/*    (at your option) any later version.                                     */
+/*                                                                            */
+/*    Ethereal is distributed in the hope that it will be useful,             */
+/*    but WITHOUT ANY WARRANTY; without even the implied warranty of          */
+/*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           */
+/*    GNU General Public License for more details.                            */
+/*                                                                            */
+/*    You should have received a copy of the GNU General Public License       */
+/*    along with this program.  If not, see <http://www.gnu.org/licenses/>    */
+/*                                                                            */
+/******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "dispatch.h"
+
+const NNUEKernels *nnue_kernels;
+
+void nnue_select_kernels() {
+
+    #if defined(USE_DISPATCH)
+
+    // Pick the widest set of kernels that both the CPU and the OS support.
+    // __builtin_cpu_supports() performs the cpuid and xgetbv checks for us
+
+    __builtin_cpu_init();
+
+    if (   __builtin_cpu_supports("avx512vnni")
+        && __builtin_cpu_supports("avx512bw")
+        && __builtin_cpu_supports("avx512f"))
+        nnue_kernels = &NNUEKernelsVNNI;
+
+    else if (   __builtin_cpu_supports("avx512bw")
+             && __builtin_cpu_supports("avx512f"))
+        nnue_kernels = &NNUEKernelsAVX512;
+
+    else if (   __builtin_cpu_supports("avx2")
+             && __builtin_cpu_supports("fma"))
+        nnue_kernels = &NNUEKernelsAVX2;
+
+    else if (__builtin_cpu_supports("avx"))
+        nnue_kernels = &NNUEKernelsAVX;
+
+    else if (__builtin_cpu_supports("ssse3"))
+        nnue_kernels = &NNUEKernelsSSSE3;
+
+    else {
+        printf("info string Error: NNUE requires at least SSSE3\n");
+        fflush(stdout); exit(EXIT_FAILURE);
+    }
+
+    #elif NNUE_COMPILE_VNNI
+    nnue_kernels = &NNUEKernelsVNNI;
+    #elif NNUE_COMPILE_AVX512
+    nnue_kernels = &NNUEKernelsAVX512;
+    #elif NNUE_COMPILE_AVX2
+    nnue_kernels = &NNUEKernelsAVX2;
+    #elif NNUE_COMPILE_AVX
+    nnue_kernels = &NNUEKernelsAVX;
+    #elif NNUE_COMPILE_SSSE3
+    nnue_kernels = &NNUEKernelsSSSE3;
+    #elif NNUE_COMPILE_NEON
+    nnue_kernels = &NNUEKernelsNEON;
+    #endif
+
+    nnue_kernels->init();
+}
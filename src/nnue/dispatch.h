@@ -0,0 +1,73 @@
+/******************************************************************************/
+/*                                                                            */
+/*    Ethereal is a UCI chess playing engine authored by Andrew Grant.        */
+/*    <https://github.com/AndyGrant/Ethereal>     <andrew@grantnet.us>        */
+/*                                                                            */
+/*    Ethereal is free software: you can redistribute it and/or modify        */
+/*    it under the terms of the GNU General Public License as published by    */
+/*    the Free Software Foundation, either version 3 of the License, or       */
+/*    (at your option) any later version.                                     */
+/*                                                                            */
+/*    Ethereal is distributed in the hope that it will be useful,             */
+/*    but WITHOUT ANY WARRANTY; without even the implied warranty of          */
+/*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           */
+/*    GNU General Public License for more details.                            */
+/*                                                                            */
+/*    You should have received a copy of the GNU General Public License       */
+/*    along with this program.  If not, see <http://www.gnu.org/licenses/>    */
+/*                                                                            */
+/******************************************************************************/
+
+#pragma once
+
+#include "../types.h"
+
+// This header is included before the instruction set of each kernel is
+// chosen, so it may not include types.h, which depends on that choice
+
+typedef struct NNUENetwork NNUENetwork;
+
+typedef struct NNUEKernels {
+    const char *name, *layout;
+    void  (*init)();
+    void  (*shuffle)(NNUENetwork *net);
+    void  (*accumulate)(const NNUENetwork *net, int16_t *outputs, const int16_t *inputs, const int *adds, int nadds, const int *removes, int nremoves);
+    void  (*accumulate_chain)(const NNUENetwork *net, int16_t *const *outputs, const int16_t *inputs, const int *adds, const int *nadds, const int *removes, const int *nremoves, int plies);
+    float (*evaluate)(const NNUENetwork *net, int16_t *us_accum, int16_t *opp_accum);
+    int   (*quant_evaluate)(const NNUENetwork *net, int16_t *us_accum, int16_t *opp_accum);
+} NNUEKernels;
+
+// Dispatched builds compile every x86 kernel, selecting one at runtime
+// based on cpuid. Otherwise, only the kernels for the compiled instruction set are
+// built, which follows the same order of preference as archs/ in types.h
+
+#if defined(USE_DISPATCH)
+    #define NNUE_COMPILE_VNNI   1
+    #define NNUE_COMPILE_AVX512 1
+    #define NNUE_COMPILE_AVX2   1
+    #define NNUE_COMPILE_AVX    1
+    #define NNUE_COMPILE_SSSE3  1
+#elif defined(USE_VNNI)
+    #define NNUE_COMPILE_VNNI   1
+#elif defined(USE_AVX512)
+    #define NNUE_COMPILE_AVX512 1
+#elif defined(USE_AVX2)
+    #define NNUE_COMPILE_AVX2   1
+#elif defined(USE_AVX)
+    #define NNUE_COMPILE_AVX    1
+#elif defined(USE_SSSE3)
+    #define NNUE_COMPILE_SSSE3  1
+#elif defined(USE_NEON)
+    #define NNUE_COMPILE_NEON   1
+#endif
+
+extern const NNUEKernels NNUEKernelsVNNI;
+extern const NNUEKernels NNUEKernelsAVX512;
+extern const NNUEKernels NNUEKernelsAVX2;
+extern const NNUEKernels NNUEKernelsAVX;
+extern const NNUEKernels NNUEKernelsSSSE3;
+extern const NNUEKernels NNUEKernelsNEON;
+
+extern const NNUEKernels *nnue_kernels;
+
+void nnue_select_kernels();
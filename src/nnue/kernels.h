@@ -0,0 +1,817 @@
+/******************************************************************************/
+/*                                                                            */
+/*    Ethereal is a UCI chess playing engine authored by Andrew Grant.        */
+/*    <https://github.com/AndyGrant/Ethereal>     <andrew@grantnet.us>        */
+/*                                                                            */
+/*    Ethereal is free software: you can redistribute it and/or modify        */
+/*    it under the terms of the GNU General Public License as published by    */
+/*    the Free Software Foundation, either version 3 of the License, or       */
+/*    (at your option) any later version.                                     */
+/*                                                                            */
+/*    Ethereal is distributed in the hope that it will be useful,             */
+/*    but WITHOUT ANY WARRANTY; without even the implied warranty of          */
+/*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           */
+/*    GNU General Public License for more details.                            */
+/*                                                                            */
+/*    You should have received a copy of the GNU General Public License       */
+/*    along with this program.  If not, see <http://www.gnu.org/licenses/>    */
+/*                                                                            */
+/******************************************************************************/
+
+// Kernel template, compiled once for each instruction set by a kernels_*.c
+// file. The including file selects the instruction set by defining the
+// matching USE_* flags, and names the resulting table with NNUE_KERNELS
+// and NNUE_KERNELS_NAME. For dispatched builds NNUE_TARGET also provides
+// the target attributes, so that only these functions require them.
+// As such, this header is intentionally not guarded by #pragma once
+
+#if defined(USE_NEON)
+#include <arm_neon.h>
+#else
+#include <immintrin.h>
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "dispatch.h"
+#include "types.h"
+
+#include "../types.h"
+
+#if defined(USE_AVX512)
+    #define NUM_REGS 12
+#else
+    #define NUM_REGS 16
+#endif
+
+#define NNUE_PRAGMA_(x) _Pragma(#x)
+#define NNUE_PRAGMA(x)  NNUE_PRAGMA_(x)
+
+#if defined(NNUE_TARGET) && defined(__clang__)
+    NNUE_PRAGMA(clang attribute push(__attribute__((target(NNUE_TARGET))), apply_to = function))
+#elif defined(NNUE_TARGET)
+    NNUE_PRAGMA(GCC target(NNUE_TARGET))
+#endif
+
+#if defined(USE_NEON)
+    #define NNUE_LAYOUT "neon"
+#elif defined(USE_AVX512)
+    #define NNUE_LAYOUT "avx512"
+#elif defined(USE_AVX2)
+    #define NNUE_LAYOUT "avx2"
+#else
+    #define NNUE_LAYOUT "ssse3"
+#endif
+
+#if !defined(USE_NEON) && !defined(USE_AVX512)
+static ALIGN64 uint16_t nnz_table[256][8];
+#endif
+
+static void init_kernels() {
+
+    #if !defined(USE_NEON) && !defined(USE_AVX512)
+
+    // List the set bits, for each possible byte, for use in nnz_append()
+
+    for (int i = 0; i < 256; i++)
+        for (int j = 0, k = 0; j < 8; j++)
+            if (i & (1 << j)) nnz_table[i][k++] = j;
+
+    #endif
+}
+
+static void shuffle_input_layer(NNUENetwork *net) {
+
+    #if defined(USE_AVX512)
+
+    // Within each pair of adjacent 512-bit chunks of 2-byte values, the
+    // packus in halfkp_relu() takes 128-bit lanes alternately from the
+    // first and second chunk. The 64 values are stored as eight groups of
+    // eight, with natural group (2 * L + H) placed into lane L of chunk H,
+    // so that the packed bytes come out in their natural order. This is
+    // done to both the weights and the biases, as with the AVX2 version.
+
+    int16_t groups[64];
+
+    for (int i = 0; i < INSIZE * KPSIZE + KPSIZE; i += 64) {
+
+        int16_t *values = i < KPSIZE ? &net->in_biases[i] : &net->in_weights[i - KPSIZE];
+
+        for (int g = 0; g < 8; g++)
+            memcpy(&groups[((g % 2) * 4 + g / 2) * 8], &values[g * 8], sizeof(int16_t) * 8);
+
+        memcpy(values, groups, sizeof(groups));
+    }
+
+    #elif defined(USE_AVX2)
+
+    __m256i *wgt = (__m256i *) net->in_weights;
+    __m256i *bia = (__m256i *) net->in_biases;
+
+    // Interleave adjacent 256-bit chunks of 2-byte values. During
+    // halfkp_relu() adjacent chunks are split, with the A-half of
+    // chunk 1 swapping with A-half of chunk 2. This is done to both
+    // the weights and the biases, to avoid unshuffling them later.
+
+    for (int i = 0; i < KPSIZE / vepi16_cnt; i += 2) {
+
+        __m128i half1 = _mm256_extracti128_si256(bia[i+0], 1);
+        __m128i half2 = _mm256_extracti128_si256(bia[i+1], 0);
+
+        bia[i+0] = _mm256_inserti128_si256(bia[i+0], half2, 1);
+        bia[i+1] = _mm256_inserti128_si256(bia[i+1], half1, 0);
+    }
+
+    for (int i = 0; i < INSIZE * KPSIZE / vepi16_cnt; i += 2) {
+
+        __m128i half1 = _mm256_extracti128_si256(wgt[i+0], 1);
+        __m128i half2 = _mm256_extracti128_si256(wgt[i+1], 0);
+
+        wgt[i+0] = _mm256_inserti128_si256(wgt[i+0], half2, 1);
+        wgt[i+1] = _mm256_inserti128_si256(wgt[i+1], half1, 0);
+    }
+
+    #else
+
+    (void) net;
+
+    #endif
+}
+
+#if !defined(USE_NEON) && !defined(USE_AVX512)
+
+static void shuffle_l1_layer(NNUENetwork *net) {
+
+    // The sparse L1 applies each non-zero 4-byte block of inputs to all 8
+    // neurons at once. As such, L1 is stored as one column of 4 weights
+    // for each of the neurons, for each of the blocks, in that order
+
+    int8_t *cpy = malloc(sizeof(int8_t) * L1SIZE * L2SIZE);
+
+    for (int i = 0; i < L2SIZE; i++)
+        for (int j = 0; j < L1SIZE; j++)
+            cpy[(j / 4) * L2SIZE * 4 + i * 4 + j % 4] = net->l1_weights[i * L1SIZE + j];
+
+    memcpy(net->l1_weights, cpy, sizeof(int8_t) * L1SIZE * L2SIZE);
+    free(cpy);
+}
+
+#endif
+
+static void shuffle_quant_layers(NNUENetwork *net) {
+
+    #if !defined(USE_NEON) && vepi32_cnt > 4
+
+    // The packs in quant_affine_relu() operate within each 128-bit lane,
+    // taking four values from the first chunk, and then four from the
+    // second. The outputs of L2 are only ever summed by L3, so the
+    // weights of L3 are placed in that same order, to avoid unpacking
+
+    int16_t cpy[L3SIZE];
+
+    for (int i = 0; i < L3SIZE; i++) {
+        const int chunk = i / vepi16_cnt, lane = (i % vepi16_cnt) / 8, half = (i % 8) / 4;
+        cpy[i] = net->l3_qweights[(chunk * 2 + half) * vepi32_cnt + lane * 4 + i % 4];
+    }
+
+    memcpy(net->l3_qweights, cpy, sizeof(cpy));
+
+    #else
+
+    (void) net;
+
+    #endif
+}
+
+static void shuffle_weights(NNUENetwork *net) {
+
+    // Called once the weights have been loaded, and L1 and L2 transposed
+
+    shuffle_input_layer(net);
+    shuffle_quant_layers(net);
+
+    #if !defined(USE_NEON) && !defined(USE_AVX512)
+    shuffle_l1_layer(net);
+    #endif
+}
+
+INLINE void accumulate_plies(const NNUENetwork *net, int16_t *const *outputs, const int16_t *inputs, const int *adds, const int *nadds, const int *removes, const int *nremoves, int plies) {
+
+    // KPSIZE must be a multiple of NUM_REGS * vepi16_cnt. Each block of
+    // the accumulator is kept in registers while every change is applied.
+    // The changes of each ply follow those of the last, with the running
+    // block being stored into that ply's output along the way
+
+    vepi16 registers[NUM_REGS];
+
+    for (int offset = 0; offset < KPSIZE; offset += NUM_REGS * vepi16_cnt) {
+
+        const vepi16 *inp = (const vepi16*) &inputs[offset];
+        const int *add = adds, *remove = removes;
+
+        for (int i = 0; i < NUM_REGS; i++)
+            registers[i] = inp[i];
+
+        for (int ply = 0; ply < plies; ply++) {
+
+            vepi16 *out = (vepi16*) &outputs[ply][offset];
+
+            for (int i = 0; i < nadds[ply]; i++) {
+
+                const vepi16 *weights = (const vepi16*) &net->in_weights[*add++ * KPSIZE + offset];
+
+                for (int j = 0; j < NUM_REGS; j++)
+                    registers[j] = vepi16_add(registers[j], weights[j]);
+            }
+
+            for (int i = 0; i < nremoves[ply]; i++) {
+
+                const vepi16 *weights = (const vepi16*) &net->in_weights[*remove++ * KPSIZE + offset];
+
+                for (int j = 0; j < NUM_REGS; j++)
+                    registers[j] = vepi16_sub(registers[j], weights[j]);
+            }
+
+            for (int i = 0; i < NUM_REGS; i++)
+                out[i] = registers[i];
+        }
+    }
+}
+
+static void accumulate(const NNUENetwork *net, int16_t *outputs, const int16_t *inputs, const int *adds, int nadds, const int *removes, int nremoves) {
+    accumulate_plies(net, &outputs, inputs, adds, &nadds, removes, &nremoves, 1);
+}
+
+static void accumulate_chain(const NNUENetwork *net, int16_t *const *outputs, const int16_t *inputs, const int *adds, const int *nadds, const int *removes, const int *nremoves, int plies) {
+    accumulate_plies(net, outputs, inputs, adds, nadds, removes, nremoves, plies);
+}
+
+#if defined(USE_NEON)
+
+INLINE void halfkp_relu_quant_affine_relu(const int8_t *weights, const int32_t *biases, int16_t *us_accum, int16_t *opp_accum, int32_t *outputs) {
+
+    assert(L1SIZE % 16 == 0);
+    assert(L1SIZE == KPSIZE * 2);
+
+    // Apply the clipped ReLU to both halves once, leaving the results as
+    // 2-byte values. Each int8 weight is then widened, and the products
+    // are accumulated as int32s, in place of the maddubs used by x86
+
+    ALIGN64 int16_t inputs[L1SIZE];
+
+    const int16x8_t zero = vdupq_n_s16(0);
+    const int16x8_t ceil = vdupq_n_s16(255);
+
+    for (int i = 0; i < KPSIZE; i += vepi16_cnt) {
+        int16x8_t us  = vshrq_n_s16(vld1q_s16(&us_accum [i]), SHIFT_L0);
+        int16x8_t opp = vshrq_n_s16(vld1q_s16(&opp_accum[i]), SHIFT_L0);
+        vst1q_s16(&inputs[i         ], vminq_s16(ceil, vmaxq_s16(zero, us )));
+        vst1q_s16(&inputs[i + KPSIZE], vminq_s16(ceil, vmaxq_s16(zero, opp)));
+    }
+
+    for (int i = 0; i < L2SIZE; i++) {
+
+        const int8_t *wgt = &weights[i * L1SIZE];
+
+        int32x4_t acc0 = vdupq_n_s32(0);
+        int32x4_t acc1 = vdupq_n_s32(0);
+
+        for (int j = 0; j < L1SIZE; j += vepi8_cnt) {
+
+            int8x16_t wgt8  = vld1q_s8(&wgt[j]);
+            int16x8_t wgtlo = vmovl_s8(vget_low_s8(wgt8));
+            int16x8_t wgthi = vmovl_high_s8(wgt8);
+
+            int16x8_t inplo = vld1q_s16(&inputs[j + 0]);
+            int16x8_t inphi = vld1q_s16(&inputs[j + 8]);
+
+            acc0 = vmlal_s16(acc0, vget_low_s16(inplo), vget_low_s16(wgtlo));
+            acc1 = vmlal_high_s16(acc1, inplo, wgtlo);
+            acc0 = vmlal_s16(acc0, vget_low_s16(inphi), vget_low_s16(wgthi));
+            acc1 = vmlal_high_s16(acc1, inphi, wgthi);
+        }
+
+        outputs[i] = MAX(0, vaddvq_s32(vaddq_s32(acc0, acc1)) + biases[i]);
+    }
+}
+
+#else
+
+INLINE vepi8 vepi16_relu_packu(vepi16 in0, vepi16 in1) {
+    vepi16 shiftA = vepi16_srai(in0, SHIFT_L0);
+    vepi16 shiftB = vepi16_srai(in1, SHIFT_L0);
+    return vepi16_packu(shiftA, shiftB);
+}
+
+#if defined(USE_AVX512)
+
+// With 512-bit registers, and VNNI in particular, the dense L1 is only a few
+// hundred instructions, which is cheaper than finding the non-zero blocks
+// unless the inputs are very sparse. Everything else uses the sparse L1
+
+INLINE void relu_maddubs_x4(vepi32 *acc, const vepi16 *inp, const vepi8 *wgt, int i, int j, int k) {
+
+    static const int InChunks = L1SIZE / vepi8_cnt;
+
+    #if defined(USE_VNNI)
+
+    // VPDPBUSD fuses the u8 x i8 multiplies and the int32 accumulation,
+    // which also avoids the saturation of the int16 intermediate sums
+
+    *acc = vepi32_dpbusd(*acc, vepi16_relu_packu(inp[0], inp[1]), wgt[InChunks * (i * 8 + k) + j + 0]);
+    *acc = vepi32_dpbusd(*acc, vepi16_relu_packu(inp[2], inp[3]), wgt[InChunks * (i * 8 + k) + j + 1]);
+    *acc = vepi32_dpbusd(*acc, vepi16_relu_packu(inp[4], inp[5]), wgt[InChunks * (i * 8 + k) + j + 2]);
+    *acc = vepi32_dpbusd(*acc, vepi16_relu_packu(inp[6], inp[7]), wgt[InChunks * (i * 8 + k) + j + 3]);
+
+    #else
+
+    vepi16 sum0 = vepi16_maubs(vepi16_relu_packu(inp[0], inp[1]), wgt[InChunks * (i * 8 + k) + j + 0]);
+    vepi16 sum1 = vepi16_maubs(vepi16_relu_packu(inp[2], inp[3]), wgt[InChunks * (i * 8 + k) + j + 1]);
+    vepi16 sum2 = vepi16_maubs(vepi16_relu_packu(inp[4], inp[5]), wgt[InChunks * (i * 8 + k) + j + 2]);
+    vepi16 sum3 = vepi16_maubs(vepi16_relu_packu(inp[6], inp[7]), wgt[InChunks * (i * 8 + k) + j + 3]);
+
+    vepi16 sumX = vepi16_add(sum0, vepi16_add(sum1, vepi16_add(sum2, sum3)));
+    *acc = vepi32_add(*acc, vepi16_madd(vepi16_one, sumX));
+
+    #endif
+}
+
+INLINE __m256i m512_fold_epi32(__m512i acc) {
+    return _mm256_add_epi32(_mm512_castsi512_si256(acc), _mm512_extracti64x4_epi64(acc, 1));
+}
+
+INLINE void halfkp_relu_quant_affine_relu(const int8_t *weights, const int32_t *biases, int16_t *us_accum, int16_t *opp_accum, int32_t *outputs) {
+
+    assert(L1SIZE % 64 == 0 && L2SIZE % 8 == 0);
+    assert(L1SIZE == KPSIZE * 2);
+
+    const int InChunks  = KPSIZE / vepi8_cnt;
+    const int OutChunks = L2SIZE / 8;
+
+    const __m256i zero = _mm256_setzero_si256();
+
+    const vepi8   *us  = (vepi8   *) us_accum;
+    const vepi8   *opp = (vepi8   *) opp_accum;
+    const vepi8   *wgt = (vepi8   *) weights;
+    const __m256i *bia = (__m256i *) biases;
+    __m256i *const out = (__m256i *) outputs;
+
+    for (int i = 0; i < OutChunks; i++) {
+
+        vepi32 acc0 = vepi32_zero();
+        vepi32 acc1 = vepi32_zero();
+        vepi32 acc2 = vepi32_zero();
+        vepi32 acc3 = vepi32_zero();
+        vepi32 acc4 = vepi32_zero();
+        vepi32 acc5 = vepi32_zero();
+        vepi32 acc6 = vepi32_zero();
+        vepi32 acc7 = vepi32_zero();
+
+        for (int j = 0; j < InChunks; j += 4) {
+            relu_maddubs_x4(&acc0, &us [j * 2], wgt, i, j, 0);
+            relu_maddubs_x4(&acc1, &us [j * 2], wgt, i, j, 1);
+            relu_maddubs_x4(&acc2, &us [j * 2], wgt, i, j, 2);
+            relu_maddubs_x4(&acc3, &us [j * 2], wgt, i, j, 3);
+            relu_maddubs_x4(&acc4, &us [j * 2], wgt, i, j, 4);
+            relu_maddubs_x4(&acc5, &us [j * 2], wgt, i, j, 5);
+            relu_maddubs_x4(&acc6, &us [j * 2], wgt, i, j, 6);
+            relu_maddubs_x4(&acc7, &us [j * 2], wgt, i, j, 7);
+
+            relu_maddubs_x4(&acc0, &opp[j * 2], wgt + InChunks, i, j, 0);
+            relu_maddubs_x4(&acc1, &opp[j * 2], wgt + InChunks, i, j, 1);
+            relu_maddubs_x4(&acc2, &opp[j * 2], wgt + InChunks, i, j, 2);
+            relu_maddubs_x4(&acc3, &opp[j * 2], wgt + InChunks, i, j, 3);
+            relu_maddubs_x4(&acc4, &opp[j * 2], wgt + InChunks, i, j, 4);
+            relu_maddubs_x4(&acc5, &opp[j * 2], wgt + InChunks, i, j, 5);
+            relu_maddubs_x4(&acc6, &opp[j * 2], wgt + InChunks, i, j, 6);
+            relu_maddubs_x4(&acc7, &opp[j * 2], wgt + InChunks, i, j, 7);
+        }
+
+        // Fold each 512-bit accumulator down to 256-bits, and then
+        // finish with 256-bit biases and outputs, since L2SIZE cannot
+        // fill a 512-bit vector
+
+        __m256i sum0 = _mm256_hadd_epi32(m512_fold_epi32(acc0), m512_fold_epi32(acc1));
+        __m256i sum2 = _mm256_hadd_epi32(m512_fold_epi32(acc2), m512_fold_epi32(acc3));
+        __m256i sum4 = _mm256_hadd_epi32(m512_fold_epi32(acc4), m512_fold_epi32(acc5));
+        __m256i sum6 = _mm256_hadd_epi32(m512_fold_epi32(acc6), m512_fold_epi32(acc7));
+
+        sum0 = _mm256_hadd_epi32(sum0, sum2);
+        sum4 = _mm256_hadd_epi32(sum4, sum6);
+
+        __m128i sumabcd1 = _mm256_extracti128_si256(sum0, 0);
+        __m128i sumabcd2 = _mm256_extracti128_si256(sum0, 1);
+        __m128i sumefgh1 = _mm256_extracti128_si256(sum4, 0);
+        __m128i sumefgh2 = _mm256_extracti128_si256(sum4, 1);
+
+        sumabcd1 = _mm_add_epi32(sumabcd1, sumabcd2);
+        sumefgh1 = _mm_add_epi32(sumefgh1, sumefgh2);
+
+        sum0 = _mm256_inserti128_si256(_mm256_castsi128_si256(sumabcd1), sumefgh1, 1);
+        sum0 = _mm256_add_epi32(sum0, bia[i]);
+        sum0 = _mm256_max_epi32(sum0, zero);
+        out[i] = sum0;
+    }
+}
+
+#else
+
+INLINE unsigned nnz_mask(vepi8 chunk) {
+
+    // One bit for each 4-byte block of the chunk which is not all zeros
+
+    #if defined(USE_AVX2)
+    return ~_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(chunk, _mm256_setzero_si256()))) & 0xFF;
+    #else
+    return ~_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(chunk, _mm_setzero_si128()))) & 0xF;
+    #endif
+}
+
+INLINE int nnz_append(uint16_t *nnz, int count, unsigned mask, int base) {
+
+    // Expand the mask eight bits at a time, by adding the base block to a
+    // precomputed list of set bit positions. All eight are written, but
+    // only as many as there were set bits are kept, by advancing count
+
+    for (int i = 0; i < vepi32_cnt; i += 8) {
+
+        const unsigned bits = (mask >> i) & 0xFF;
+        const __m128i offset = _mm_set1_epi16(base + i);
+        const __m128i blocks = _mm_load_si128((__m128i *) nnz_table[bits]);
+
+        _mm_storeu_si128((__m128i *) &nnz[count], _mm_add_epi16(offset, blocks));
+        count += __builtin_popcount(bits);
+    }
+
+    return count;
+}
+
+#if defined(USE_AVX2)
+
+INLINE __m256i l1_block(__m256i acc, int32_t block, __m256i weights) {
+
+    // Broadcast the four inputs, and apply them to the eight neurons,
+    // whose weights for this block are stored as 8 contiguous int32s
+
+    const __m256i inputs = _mm256_set1_epi32(block);
+    return _mm256_add_epi32(acc, _mm256_madd_epi16(_mm256_maddubs_epi16(inputs, weights), _mm256_set1_epi16(1)));
+}
+
+#endif
+
+INLINE void halfkp_relu_quant_affine_relu(const int8_t *weights, const int32_t *biases, int16_t *us_accum, int16_t *opp_accum, int32_t *outputs) {
+
+    assert(L1SIZE == KPSIZE * 2 && L2SIZE == 8);
+
+    // Apply the clipped ReLU, and pack both halves into bytes, while noting
+    // each 4-byte block which is not entirely zeros. Only the weights of
+    // those blocks are then applied to the 8 neurons. nnz_append() writes
+    // eight entries at a time, and may overrun the final count by up to 7
+
+    ALIGN64 int32_t  inputs[L1SIZE / 4];
+    ALIGN64 uint16_t nnz[L1SIZE / 4 + 8];
+
+    const int Chunks = KPSIZE / vepi8_cnt;
+
+    const vepi16 *us  = (vepi16 *) us_accum;
+    const vepi16 *opp = (vepi16 *) opp_accum;
+    vepi8 *const packed = (vepi8 *) inputs;
+
+    int count = 0;
+
+    for (int i = 0; i < Chunks; i++) {
+        packed[i] = vepi16_relu_packu(us[i * 2 + 0], us[i * 2 + 1]);
+        count = nnz_append(nnz, count, nnz_mask(packed[i]), i * vepi32_cnt);
+    }
+
+    for (int i = Chunks; i < 2 * Chunks; i++) {
+        packed[i] = vepi16_relu_packu(opp[i * 2 - Chunks * 2], opp[i * 2 - Chunks * 2 + 1]);
+        count = nnz_append(nnz, count, nnz_mask(packed[i]), i * vepi32_cnt);
+    }
+
+    #if defined(USE_AVX2)
+
+    const __m256i *wgt = (__m256i *) weights;
+
+    __m256i acc0 = _mm256_setzero_si256();
+    __m256i acc1 = _mm256_setzero_si256();
+    __m256i acc2 = _mm256_setzero_si256();
+    __m256i acc3 = _mm256_setzero_si256();
+
+    // Four independent accumulators, to hide the latency of each block
+
+    int i = 0;
+
+    for (; i + 3 < count; i += 4) {
+        acc0 = l1_block(acc0, inputs[nnz[i + 0]], wgt[nnz[i + 0]]);
+        acc1 = l1_block(acc1, inputs[nnz[i + 1]], wgt[nnz[i + 1]]);
+        acc2 = l1_block(acc2, inputs[nnz[i + 2]], wgt[nnz[i + 2]]);
+        acc3 = l1_block(acc3, inputs[nnz[i + 3]], wgt[nnz[i + 3]]);
+    }
+
+    for (; i < count; i++)
+        acc0 = l1_block(acc0, inputs[nnz[i]], wgt[nnz[i]]);
+
+    acc0 = _mm256_add_epi32(_mm256_add_epi32(acc0, acc1), _mm256_add_epi32(acc2, acc3));
+    acc0 = _mm256_add_epi32(acc0, _mm256_load_si256((__m256i *) biases));
+    acc0 = _mm256_max_epi32(acc0, _mm256_setzero_si256());
+    _mm256_store_si256((__m256i *) outputs, acc0);
+
+    #else
+
+    // Without AVX2 the 8 neurons are split across two 128-bit halves
+
+    const __m128i *wgt = (__m128i *) weights;
+    const __m128i  one = _mm_set1_epi16(1);
+
+    __m128i acclo = _mm_setzero_si128();
+    __m128i acchi = _mm_setzero_si128();
+
+    for (int i = 0; i < count; i++) {
+        const __m128i block = _mm_set1_epi32(inputs[nnz[i]]);
+        acclo = _mm_add_epi32(acclo, _mm_madd_epi16(_mm_maddubs_epi16(block, wgt[nnz[i] * 2 + 0]), one));
+        acchi = _mm_add_epi32(acchi, _mm_madd_epi16(_mm_maddubs_epi16(block, wgt[nnz[i] * 2 + 1]), one));
+    }
+
+    acclo = _mm_add_epi32(acclo, _mm_load_si128((__m128i *) biases + 0));
+    acchi = _mm_add_epi32(acchi, _mm_load_si128((__m128i *) biases + 1));
+
+    // SSSE3 has no _mm_max_epi32(), so the ReLU masks away negative values
+
+    acclo = _mm_and_si128(acclo, _mm_cmpgt_epi32(acclo, _mm_setzero_si128()));
+    acchi = _mm_and_si128(acchi, _mm_cmpgt_epi32(acchi, _mm_setzero_si128()));
+
+    _mm_store_si128((__m128i *) outputs + 0, acclo);
+    _mm_store_si128((__m128i *) outputs + 1, acchi);
+
+    #endif
+}
+
+#endif
+
+#endif
+
+INLINE void float_affine_relu(const float *weights, const float *biases, float *inputs, float *outputs) {
+
+    assert(L2SIZE % 8 == 0 && L3SIZE % 8 == 0);
+
+    const int InChunks  = L2SIZE / vps32_cnt;
+    const int OutChunks = L3SIZE / 8;
+
+    const vps32 zero = vps32_zero();
+
+    const vps32 *inp = (vps32 *) inputs;
+    const vps32 *bia = (vps32 *) biases;
+    const vps32 *wgt = (vps32 *) weights;
+    vps32 *const out = (vps32 *) outputs;
+
+    for (int i = 0; i < OutChunks; i++) {
+
+        vps32 acc0 = vps32_mul(wgt[InChunks * (i * 8 + 0) + 0], inp[0]);
+        vps32 acc1 = vps32_mul(wgt[InChunks * (i * 8 + 1) + 0], inp[0]);
+        vps32 acc2 = vps32_mul(wgt[InChunks * (i * 8 + 2) + 0], inp[0]);
+        vps32 acc3 = vps32_mul(wgt[InChunks * (i * 8 + 3) + 0], inp[0]);
+        vps32 acc4 = vps32_mul(wgt[InChunks * (i * 8 + 4) + 0], inp[0]);
+        vps32 acc5 = vps32_mul(wgt[InChunks * (i * 8 + 5) + 0], inp[0]);
+        vps32 acc6 = vps32_mul(wgt[InChunks * (i * 8 + 6) + 0], inp[0]);
+        vps32 acc7 = vps32_mul(wgt[InChunks * (i * 8 + 7) + 0], inp[0]);
+
+        for (int j = 1; j < InChunks; j++) {
+            acc0 = vps32_fma(wgt[InChunks * (i * 8 + 0) + j], inp[j], acc0);
+            acc1 = vps32_fma(wgt[InChunks * (i * 8 + 1) + j], inp[j], acc1);
+            acc2 = vps32_fma(wgt[InChunks * (i * 8 + 2) + j], inp[j], acc2);
+            acc3 = vps32_fma(wgt[InChunks * (i * 8 + 3) + j], inp[j], acc3);
+            acc4 = vps32_fma(wgt[InChunks * (i * 8 + 4) + j], inp[j], acc4);
+            acc5 = vps32_fma(wgt[InChunks * (i * 8 + 5) + j], inp[j], acc5);
+            acc6 = vps32_fma(wgt[InChunks * (i * 8 + 6) + j], inp[j], acc6);
+            acc7 = vps32_fma(wgt[InChunks * (i * 8 + 7) + j], inp[j], acc7);
+        }
+
+        acc0 = vps32_hadd(acc0, acc1);
+        acc2 = vps32_hadd(acc2, acc3);
+        acc4 = vps32_hadd(acc4, acc5);
+        acc6 = vps32_hadd(acc6, acc7);
+
+        acc0 = vps32_hadd(acc0, acc2);
+        acc4 = vps32_hadd(acc4, acc6);
+
+        #if defined(USE_AVX2) || defined(USE_AVX)
+
+        __m128 sumabcd1 = _mm256_extractf128_ps(acc0, 0);
+        __m128 sumabcd2 = _mm256_extractf128_ps(acc0, 1);
+        __m128 sumefgh1 = _mm256_extractf128_ps(acc4, 0);
+        __m128 sumefgh2 = _mm256_extractf128_ps(acc4, 1);
+
+        sumabcd1 = _mm_add_ps(sumabcd1, sumabcd2);
+        sumefgh1 = _mm_add_ps(sumefgh1, sumefgh2);
+
+        acc0 = _mm256_insertf128_ps(_mm256_castps128_ps256(sumabcd1), sumefgh1, 1);
+        out[i] = _mm256_max_ps(zero, _mm256_add_ps(bia[i], acc0));
+
+        #elif defined(USE_SSSE3) || defined(USE_NEON)
+
+        out[i * 2 + 0] = vps32_max(zero, vps32_add(bia[i * 2 + 0], acc0));
+        out[i * 2 + 1] = vps32_max(zero, vps32_add(bia[i * 2 + 1], acc4));
+
+        #endif
+    }
+}
+
+INLINE void output_transform(const float *weights, const float *biases, float *inputs, float *outputs) {
+
+    assert(L3SIZE % 8 == 0);
+
+    const int InChunks = L3SIZE / vps32_cnt;
+
+    const vps32 *inp  = (vps32 *) inputs;
+    const vps32 *wgt  = (vps32 *) weights;
+
+    vps32 acc = vps32_mul(wgt[0], inp[0]);
+    for (int i = 1; i < InChunks; i++)
+        acc = vps32_fma(wgt[i], inp[i], acc);
+
+    #if defined(USE_NEON)
+
+    *outputs = vaddvq_f32(acc) + *biases;
+
+    #else
+
+    #if defined(USE_AVX) || defined(USE_AVX2)
+
+    const __m128 hiQuad  = _mm256_extractf128_ps(acc, 1);
+    const __m128 loQuad  = _mm256_castps256_ps128(acc);
+    const __m128 sumQuad = _mm_add_ps(loQuad, hiQuad);
+
+    #elif defined(USE_SSSE3)
+
+    const __m128 sumQuad = acc;
+
+    #endif
+
+    const __m128 hiDual  = _mm_movehl_ps(sumQuad, sumQuad);
+    const __m128 sumDual = _mm_add_ps(sumQuad, hiDual);
+
+    const __m128 hi      = _mm_shuffle_ps(sumDual, sumDual, 0x1);
+    const __m128 sum     = _mm_add_ss(sumDual, hi);
+
+    *outputs = (_mm_cvtss_f32(sum) + *biases);
+
+    #endif
+}
+
+#if defined(USE_NEON)
+
+INLINE void quant_affine_relu(const int16_t *weights, const int32_t *biases, int32_t *inputs, int16_t *outputs) {
+
+    assert(L2SIZE == 8 && L3SIZE % 4 == 0);
+
+    // Saturate the inputs to 16-bits. The weights for each pair of inputs
+    // are interleaved for all of the outputs, which vld2 will undo, four
+    // outputs at a time, for use with the scalar multiply-accumulates
+
+    int16_t narrow[L2SIZE];
+    vst1q_s16(narrow, vcombine_s16(vqmovn_s32(vld1q_s32(&inputs[0])), vqmovn_s32(vld1q_s32(&inputs[4]))));
+
+    for (int i = 0; i < L3SIZE; i += 4) {
+
+        int32x4_t acc = vld1q_s32(&biases[i]);
+
+        for (int j = 0; j < L2SIZE; j += 2) {
+            const int16x4x2_t wgt = vld2_s16(&weights[j * L3SIZE + i * 2]);
+            acc = vmlal_n_s16(acc, wgt.val[0], narrow[j + 0]);
+            acc = vmlal_n_s16(acc, wgt.val[1], narrow[j + 1]);
+        }
+
+        vst1_s16(&outputs[i], vmax_s16(vdup_n_s16(0), vqmovn_s32(vshrq_n_s32(acc, QSHIFT_L2))));
+    }
+}
+
+INLINE int quant_output_transform(const int16_t *weights, const int32_t *biases, int16_t *inputs) {
+
+    assert(L3SIZE % 4 == 0);
+
+    int32x4_t acc = vdupq_n_s32(0);
+    for (int i = 0; i < L3SIZE; i += 4)
+        acc = vmlal_s16(acc, vld1_s16(&weights[i]), vld1_s16(&inputs[i]));
+
+    return (vaddvq_s32(acc) + *biases) >> QSHIFT_L3;
+}
+
+#else
+
+INLINE void quant_affine_relu(const int16_t *weights, const int32_t *biases, int32_t *inputs, int16_t *outputs) {
+
+    assert(L2SIZE % 2 == 0 && L3SIZE % (vepi32_cnt * 2) == 0);
+
+    // Saturate the inputs to 16-bits, and broadcast each adjacent pair.
+    // The weights for each pair of inputs are interleaved, for all of the
+    // outputs, so that a single madd applies both inputs of the pair
+
+    const int OutChunks = L3SIZE / vepi32_cnt;
+
+    int16_t narrow[L2SIZE];
+    int32_t pairs[L2SIZE / 2];
+
+    for (int i = 0; i < L2SIZE; i++)
+        narrow[i] = MIN(inputs[i], INT16_MAX);
+
+    memcpy(pairs, narrow, sizeof(narrow));
+
+    const vepi16 *wgt = (vepi16 *) weights;
+    const vepi32 *bia = (vepi32 *) biases;
+    vepi16 *const out = (vepi16 *) outputs;
+
+    vepi32 acc[L3SIZE / vepi32_cnt];
+
+    for (int i = 0; i < OutChunks; i++)
+        acc[i] = bia[i];
+
+    for (int j = 0; j < L2SIZE / 2; j++) {
+
+        const vepi32 pair = vepi32_set1(pairs[j]);
+
+        for (int i = 0; i < OutChunks; i++)
+            acc[i] = vepi32_add(acc[i], vepi16_madd(pair, wgt[j * OutChunks + i]));
+    }
+
+    // Descale, and then saturate to 16-bits, before applying the ReLU
+
+    for (int i = 0; i < OutChunks; i += 2) {
+        vepi16 packed = vepi32_packs(vepi32_srai(acc[i], QSHIFT_L2), vepi32_srai(acc[i + 1], QSHIFT_L2));
+        out[i / 2] = vepi16_max(packed, vepi16_zero());
+    }
+}
+
+INLINE int quant_output_transform(const int16_t *weights, const int32_t *biases, int16_t *inputs) {
+
+    assert(L3SIZE % vepi16_cnt == 0);
+
+    const int InChunks = L3SIZE / vepi16_cnt;
+
+    const vepi16 *inp = (vepi16 *) inputs;
+    const vepi16 *wgt = (vepi16 *) weights;
+
+    vepi32 acc = vepi16_madd(wgt[0], inp[0]);
+    for (int i = 1; i < InChunks; i++)
+        acc = vepi32_add(acc, vepi16_madd(wgt[i], inp[i]));
+
+    #if defined(USE_AVX512)
+
+    const int sum = _mm512_reduce_add_epi32(acc);
+
+    #else
+
+    #if defined(USE_AVX2)
+    __m128i sumQuad = _mm_add_epi32(_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1));
+    #else
+    __m128i sumQuad = acc;
+    #endif
+
+    sumQuad = _mm_add_epi32(sumQuad, _mm_shuffle_epi32(sumQuad, 0x4E));
+    sumQuad = _mm_add_epi32(sumQuad, _mm_shuffle_epi32(sumQuad, 0xB1));
+
+    const int sum = _mm_cvtsi128_si32(sumQuad);
+
+    #endif
+
+    return (sum + *biases) >> QSHIFT_L3;
+}
+
+#endif
+
+static float evaluate(const NNUENetwork *net, int16_t *us_accum, int16_t *opp_accum) {
+
+    ALIGN64 int32_t outL1[L2SIZE];
+    ALIGN64 float   outN1[L1SIZE];
+    ALIGN64 float   outN2[L1SIZE];
+
+    halfkp_relu_quant_affine_relu(net->l1_weights, net->l1_biases, us_accum, opp_accum, outL1);
+
+    for (int i = 0; i < L2SIZE; i++)
+        outN1[i] = (float) outL1[i];
+
+    float_affine_relu(net->l2_weights, net->l2_biases, outN1, outN2);
+    output_transform (net->l3_weights, net->l3_biases, outN2, outN1);
+
+    return outN1[0];
+}
+
+static int quant_evaluate(const NNUENetwork *net, int16_t *us_accum, int16_t *opp_accum) {
+
+    ALIGN64 int32_t outN1[L2SIZE];
+    ALIGN64 int16_t outN2[L3SIZE];
+
+    halfkp_relu_quant_affine_relu(net->l1_weights, net->l1_biases, us_accum, opp_accum, outN1);
+    quant_affine_relu(net->l2_qweights, net->l2_qbiases, outN1, outN2);
+
+    return quant_output_transform(net->l3_qweights, net->l3_qbiases, outN2);
+}
+
+const NNUEKernels NNUE_KERNELS = {
+    NNUE_KERNELS_NAME, NNUE_LAYOUT, init_kernels, shuffle_weights, accumulate, accumulate_chain, evaluate, quant_evaluate
+};
+
+#if defined(NNUE_TARGET) && defined(__clang__)
+    #pragma clang attribute pop
+#endif
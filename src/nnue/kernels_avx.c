@@ -0,0 +1,36 @@
+/******************************************************************************/
+/*                                                                            */
+/*    Ethereal is a UCI chess playing engine authored by Andrew Grant.        */
+/*    <https://github.com/AndyGrant/Ethereal>     <andrew@grantnet.us>        */
+/*                                                                            */
+/*    Ethereal is free software: you can redistribute it and/or modify        */
+/*    it under the terms of the GNU General Public License as published by    */
+/*    the Free Software Foundation, either version 3 of the License, or       */
+/*    (at your option) any later version.                                     */
+/*                                                                            */
+/*    Ethereal is distributed in the hope that it will be useful,             */
+/*    but WITHOUT ANY WARRANTY; without even the implied warranty of          */
+/*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           */
+/*    GNU General Public License for more details.                            */
+/*                                                                            */
+/*    You should have received a copy of the GNU General Public License       */
+/*    along with this program.  If not, see <http://www.gnu.org/licenses/>    */
+/*                                                                            */
+/******************************************************************************/
+
+#include "dispatch.h"
+
+#if NNUE_COMPILE_AVX
+
+#if defined(USE_DISPATCH)
+    #define USE_SSSE3
+    #define USE_AVX
+    #define NNUE_TARGET "avx,sse4.1"
+#endif
+
+#define NNUE_KERNELS      NNUEKernelsAVX
+#define NNUE_KERNELS_NAME "avx"
+
+#include "kernels.h"
+
+#endif
@@ -0,0 +1,37 @@
+/******************************************************************************/
+/*                                                                            */
+/*    Ethereal is a UCI chess playing engine authored by Andrew Grant.        */
+/*    <https://github.com/AndyGrant/Ethereal>     <andrew@grantnet.us>        */
+/*                                                                            */
+/*    Ethereal is free software: you can redistribute it and/or modify        */
+/*    it under the terms of the GNU General Public License as published by    */
+/*    the Free Software Foundation, either version 3 of the License, or       */
+/*    (at your option) any later version.                                     */
+/*                                                                            */
+/*    Ethereal is distributed in the hope that it will be useful,             */
+/*    but WITHOUT ANY WARRANTY; without even the implied warranty of          */
+/*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           */
+/*    GNU General Public License for more details.                            */
+/*                                                                            */
+/*    You should have received a copy of the GNU General Public License       */
+/*    along with this program.  If not, see <http://www.gnu.org/licenses/>    */
+/*                                                                            */
+/******************************************************************************/
+
+#include "dispatch.h"
+
+#if NNUE_COMPILE_AVX2
+
+#if defined(USE_DISPATCH)
+    #define USE_SSSE3
+    #define USE_AVX
+    #define USE_AVX2
+    #define NNUE_TARGET "avx2,fma"
+#endif
+
+#define NNUE_KERNELS      NNUEKernelsAVX2
+#define NNUE_KERNELS_NAME "avx2"
+
+#include "kernels.h"
+
+#endif
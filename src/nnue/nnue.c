@@ -18,14 +18,29 @@
 /*                                                                            */
 /******************************************************************************/
 
-#include <immintrin.h>
 #include <math.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <stdalign.h>
 
+#if defined(_WIN32) || defined(_WIN64)
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+#if defined(__linux__) && !defined(__ANDROID__)
+    #include <linux/mempolicy.h>
+    #include <linux/mman.h>
+    #include <sys/syscall.h>
+#endif
+
 #include "accumulator.h"
+#include "dispatch.h"
 #include "nnue.h"
 #include "types.h"
 #include "utils.h"
@@ -34,40 +49,157 @@
 #include "../board.h"
 #include "../evaluate.h"
 #include "../thread.h"
+#include "../windows.h"
 
 #include "../incbin/incbin.h"
 
-#define SHIFT_L0 6
-#define SHIFT_L1 5
-
 #ifdef EVALFILE
 const char *NNUEDefault = EVALFILE;
 INCBIN(IncWeights, EVALFILE);
 #endif
 
-ALIGN64 int16_t in_weights[INSIZE * KPSIZE ];
-ALIGN64 int8_t  l1_weights[L1SIZE * L2SIZE ];
-ALIGN64 float   l2_weights[L2SIZE * L3SIZE ];
-ALIGN64 float   l3_weights[L3SIZE * OUTSIZE];
+#define NNUE_MAX_REPLICAS 64
+
+enum { NNUE_PAGES_DEFAULT, NNUE_PAGES_TRANSPARENT, NNUE_PAGES_HUGETLB };
+
+static const NNUENetwork *nnue_network; // Network currently in use, if any
+static NNUENetwork *NNUEOwned;          // Allocated when the Network was built here
+static int NNUEOwnedPages;              // Kind of pages backing NNUEOwned
+static void *NNUEMapped;                // Mapped when the Network was transformed
+static size_t NNUEMappedSize;
+static int NNUEGeneration = 1;          // Bumped whenever the weights change
+
+static int NNUEReplicate;           // Set by the NNUEReplicas UCI option
+static int NNUEReplicaCount;        // Zero unless replicated across NUMA nodes
+static int NNUEReplicaNodes[NNUE_MAX_REPLICAS];
+static int NNUEReplicaPages[NNUE_MAX_REPLICAS];
+static NNUENetwork *NNUEReplicas[NNUE_MAX_REPLICAS];
+
+#if defined(_WIN32) || defined(_WIN64)
+
+static void* map_file(const char *fname, size_t *size) {
+
+    void *data = NULL;
+    HANDLE mapping  = NULL;
+    LARGE_INTEGER bytes;
+
+    HANDLE file = CreateFileA(fname, GENERIC_READ, FILE_SHARE_READ, NULL,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+
+    if (file == INVALID_HANDLE_VALUE)
+        return NULL;
+
+    if (   GetFileSizeEx(file, &bytes) && bytes.QuadPart > 0
+        && (mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL)) != NULL)
+        data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+
+    if (mapping != NULL) CloseHandle(mapping);
+    CloseHandle(file);
+
+    *size = data != NULL ? (size_t) bytes.QuadPart : 0;
+    return data;
+}
+
+static void unmap_file(void *data, size_t size) {
+    (void) size; UnmapViewOfFile(data);
+}
+
+#else
+
+static void* map_file(const char *fname, size_t *size) {
 
-ALIGN64 int16_t in_biases[KPSIZE ];
-ALIGN64 int32_t l1_biases[L2SIZE ];
-ALIGN64 float   l2_biases[L3SIZE ];
-ALIGN64 float   l3_biases[OUTSIZE];
+    struct stat st;
+    void *data = MAP_FAILED;
+    int fd = open(fname, O_RDONLY);
 
-static int NNUE_LOADED = 0;
+    if (fd == -1)
+        return NULL;
+
+    if (!fstat(fd, &st) && st.st_size > 0)
+        data = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+
+    close(fd);
+
+    *size = data != MAP_FAILED ? (size_t) st.st_size : 0;
+    return data != MAP_FAILED ? data : NULL;
+}
+
+static void unmap_file(void *data, size_t size) {
+    munmap(data, size);
+}
+
+#endif
+
+#if defined(__linux__) && !defined(__ANDROID__)
+
+static size_t huge_size() {
+    const size_t MB = 1ull << 20;
+    return (sizeof(NNUENetwork) + 2 * MB - 1) / (2 * MB) * (2 * MB);
+}
+
+static NNUENetwork* alloc_network(int *pages) {
+
+    // Updates to the Accumulators read rows scattered across the input
+    // weights, so back the Network with 2MB pages to spare the TLB. As with
+    // the Transposition Table, try for explicitly reserved Huge Pages first
+
+    const size_t size = huge_size();
+    const int flags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | (21 << MAP_HUGE_SHIFT);
+    void *mem = mmap(NULL, size, PROT_READ | PROT_WRITE, flags, -1, 0);
+
+    if (mem != MAP_FAILED)
+        return *pages = NNUE_PAGES_HUGETLB, mem;
+
+    if ((mem = aligned_alloc(2 << 20, size)) != NULL)
+        madvise(mem, size, MADV_HUGEPAGE);
+
+    return *pages = NNUE_PAGES_TRANSPARENT, mem;
+}
+
+static void free_network(NNUENetwork *net, int pages) {
+    if (pages == NNUE_PAGES_HUGETLB) munmap(net, huge_size());
+    else free(net);
+}
 
-static void scale_weights() {
+static void place_network(NNUENetwork *net, int node) {
+
+    // Move every page of the Network onto the given node. Pages which
+    // have not been touched yet will be allocated there in the first place
+
+    const unsigned long maxnode = 8 * sizeof(unsigned long) * 16;
+    unsigned long mask[16] = {0};
+
+    mask[node / 64] |= 1ul << (node % 64);
+    syscall(SYS_mbind, net, huge_size(), MPOL_BIND, mask, maxnode, MPOL_MF_MOVE);
+}
+
+#else
+
+static NNUENetwork* alloc_network(int *pages) {
+    return *pages = NNUE_PAGES_DEFAULT, align_malloc(sizeof(NNUENetwork));
+}
+
+static void free_network(NNUENetwork *net, int pages) {
+    (void) pages; align_free(net);
+}
+
+static void place_network(NNUENetwork *net, int node) {
+    (void) net; (void) node;
+}
+
+#endif
+
+static void scale_weights(NNUENetwork *net) {
 
     // Delayed dequantization of the results of L1 forces an upshift in
     // biases of L2 and L3 to compensate. This saves SRAI calls, as well as
     // increases the precision of each layer, with no clear downsides.
 
     for (int i = 0; i < L3SIZE; i++)
-        l2_biases[i] *= (1 << SHIFT_L1);
+        net->l2_biases[i] *= (1 << SHIFT_L1);
 
     for (int i = 0; i < OUTSIZE; i++)
-        l3_biases[i] *= (1 << SHIFT_L1);
+        net->l3_biases[i] *= (1 << SHIFT_L1);
 }
 
 static void quant_transpose(int8_t *matrix, int rows, int cols) {
@@ -100,37 +232,19 @@ static void float_transpose(float *matrix, int rows, int cols) {
     free(cpy);
 }
 
-static void shuffle_input_layer() {
-
-    #if defined(USE_AVX2)
-
-    __m256i *wgt = (__m256i *) in_weights;
-    __m256i *bia = (__m256i *) in_biases;
-
-    // Interleave adjacent 256-bit chunks of 2-byte values. During
-    // halfkp_relu() adjacent chunks are split, with the A-half of
-    // chunk 1 swapping with A-half of chunk 2. This is done to both
-    // the weights and the biases, to avoid unshuffling them later.
-
-    for (int i = 0; i < KPSIZE / vepi16_cnt; i += 2) {
-
-        __m128i half1 = _mm256_extracti128_si256(bia[i+0], 1);
-        __m128i half2 = _mm256_extracti128_si256(bia[i+1], 0);
-
-        bia[i+0] = _mm256_inserti128_si256(bia[i+0], half2, 1);
-        bia[i+1] = _mm256_inserti128_si256(bia[i+1], half1, 0);
-    }
+static void quant_interleave(int16_t *matrix, int rows, int cols) {
 
-    for (int i = 0; i < INSIZE * KPSIZE / vepi16_cnt; i += 2) {
+    // Interleave the weights of each pair of rows, one column at a time,
+    // so that a single madd can apply both of a pair of inputs at once
 
-        __m128i half1 = _mm256_extracti128_si256(wgt[i+0], 1);
-        __m128i half2 = _mm256_extracti128_si256(wgt[i+1], 0);
+    int16_t *cpy = malloc(sizeof(int16_t) * rows * cols);
 
-        wgt[i+0] = _mm256_inserti128_si256(wgt[i+0], half2, 1);
-        wgt[i+1] = _mm256_inserti128_si256(wgt[i+1], half1, 0);
-    }
+    for (int i = 0; i < rows; i++)
+        for (int j = 0; j < cols; j++)
+            cpy[(i / 2) * cols * 2 + j * 2 + i % 2] = matrix[i * cols + j];
 
-    #endif
+    memcpy(matrix, cpy, sizeof(int16_t) * rows * cols);
+    free(cpy);
 }
 
 static void abort_nnue(const char *reason) {
@@ -138,313 +252,354 @@ static void abort_nnue(const char *reason) {
     fflush(stdout); exit(EXIT_FAILURE);
 }
 
-INLINE vepi8 vepi16_relu_packu(vepi16 in0, vepi16 in1) {
-    vepi16 shiftA = vepi16_srai(in0, SHIFT_L0);
-    vepi16 shiftB = vepi16_srai(in1, SHIFT_L0);
-    return vepi16_packu(shiftA, shiftB);
-}
+static size_t network_size(uint32_t flags) {
 
-INLINE void relu_maddubs_x4(vepi32 *acc, const vepi16 *inp, const vepi8 *wgt, int i, int j, int k) {
+    // Size of a Network, following the NNUEHeader if there is one. The
+    // input layer and L1 are the same, with L2 and L3 depending on flags
 
-    static const int InChunks = L1SIZE / vepi8_cnt;
+    size_t size = sizeof(int16_t) * (KPSIZE + INSIZE * KPSIZE)
+                + sizeof(int32_t) * L2SIZE + sizeof(int8_t) * L1SIZE * L2SIZE;
 
-    vepi16 sum0 = vepi16_maubs(vepi16_relu_packu(inp[0], inp[1]), wgt[InChunks * (i * 8 + k) + j + 0]);
-    vepi16 sum1 = vepi16_maubs(vepi16_relu_packu(inp[2], inp[3]), wgt[InChunks * (i * 8 + k) + j + 1]);
-    vepi16 sum2 = vepi16_maubs(vepi16_relu_packu(inp[4], inp[5]), wgt[InChunks * (i * 8 + k) + j + 2]);
-    vepi16 sum3 = vepi16_maubs(vepi16_relu_packu(inp[6], inp[7]), wgt[InChunks * (i * 8 + k) + j + 3]);
+    if (flags & NNUE_FLAG_QUANTIZED)
+        return size + sizeof(int32_t) * (L3SIZE + OUTSIZE)
+                    + sizeof(int16_t) * (L2SIZE * L3SIZE + L3SIZE * OUTSIZE);
 
-    vepi16 sumX = vepi16_add(sum0, vepi16_add(sum1, vepi16_add(sum2, sum3)));
-    *acc = vepi32_add(*acc, vepi16_madd(vepi16_one, sumX));
+    return size + sizeof(float) * (L3SIZE + L2SIZE * L3SIZE + OUTSIZE + L3SIZE * OUTSIZE);
 }
 
-INLINE void halfkp_relu_quant_affine_relu(int8_t *weights, int32_t *biases, int16_t *us_accum, int16_t *opp_accum, float *outputs) {
-
-    assert(L1SIZE % 64 == 0 && L2SIZE % 8 == 0);
-    assert(L1SIZE == KPSIZE * 2);
-
-    const int InChunks  = KPSIZE / vepi8_cnt;
-    const int OutChunks = L2SIZE / 8;
-
-    #if defined(USE_AVX2) || defined(USE_AVX)
-    const vepi32 zero = vepi32_zero();
-    #elif defined(USE_SSSE3)
-    const vps32  zero = vps32_zero();
-    #endif
+static const char* read_layer(void *layer, const char *data, size_t size) {
+    memcpy(layer, data, size);
+    return data + size;
+}
 
-    const vepi8  *us  = (vepi8  *) us_accum;
-    const vepi8  *opp = (vepi8  *) opp_accum;
-    const vepi8  *wgt = (vepi8  *) weights;
-    const vepi32 *bia = (vepi32 *) biases;
-    vps32 *const out  = (vps32  *) outputs;
-
-    for (int i = 0; i < OutChunks; i++) {
-
-        vepi32 acc0 = vepi32_zero();
-        vepi32 acc1 = vepi32_zero();
-        vepi32 acc2 = vepi32_zero();
-        vepi32 acc3 = vepi32_zero();
-        vepi32 acc4 = vepi32_zero();
-        vepi32 acc5 = vepi32_zero();
-        vepi32 acc6 = vepi32_zero();
-        vepi32 acc7 = vepi32_zero();
-
-        for (int j = 0; j < InChunks; j += 4) {
-            relu_maddubs_x4(&acc0, &us [j * 2], wgt, i, j, 0);
-            relu_maddubs_x4(&acc1, &us [j * 2], wgt, i, j, 1);
-            relu_maddubs_x4(&acc2, &us [j * 2], wgt, i, j, 2);
-            relu_maddubs_x4(&acc3, &us [j * 2], wgt, i, j, 3);
-            relu_maddubs_x4(&acc4, &us [j * 2], wgt, i, j, 4);
-            relu_maddubs_x4(&acc5, &us [j * 2], wgt, i, j, 5);
-            relu_maddubs_x4(&acc6, &us [j * 2], wgt, i, j, 6);
-            relu_maddubs_x4(&acc7, &us [j * 2], wgt, i, j, 7);
-
-            relu_maddubs_x4(&acc0, &opp[j * 2], wgt + InChunks, i, j, 0);
-            relu_maddubs_x4(&acc1, &opp[j * 2], wgt + InChunks, i, j, 1);
-            relu_maddubs_x4(&acc2, &opp[j * 2], wgt + InChunks, i, j, 2);
-            relu_maddubs_x4(&acc3, &opp[j * 2], wgt + InChunks, i, j, 3);
-            relu_maddubs_x4(&acc4, &opp[j * 2], wgt + InChunks, i, j, 4);
-            relu_maddubs_x4(&acc5, &opp[j * 2], wgt + InChunks, i, j, 5);
-            relu_maddubs_x4(&acc6, &opp[j * 2], wgt + InChunks, i, j, 6);
-            relu_maddubs_x4(&acc7, &opp[j * 2], wgt + InChunks, i, j, 7);
-        }
+static void release_replicas() {
 
-        acc0 = vepi32_hadd(acc0, acc1);
-        acc2 = vepi32_hadd(acc2, acc3);
-        acc0 = vepi32_hadd(acc0, acc2);
-        acc4 = vepi32_hadd(acc4, acc5);
-        acc6 = vepi32_hadd(acc6, acc7);
-        acc4 = vepi32_hadd(acc4, acc6);
+    for (int i = 0; i < NNUEReplicaCount; i++)
+        free_network(NNUEReplicas[i], NNUEReplicaPages[i]);
 
-        #if defined(USE_AVX2)
+    NNUEReplicaCount = 0;
+}
 
-        __m128i sumabcd1 = _mm256_extracti128_si256(acc0, 0);
-        __m128i sumabcd2 = _mm256_extracti128_si256(acc0, 1);
-        __m128i sumefgh1 = _mm256_extracti128_si256(acc4, 0);
-        __m128i sumefgh2 = _mm256_extracti128_si256(acc4, 1);
+static void build_replicas() {
 
-        sumabcd1 = _mm_add_epi32(sumabcd1, sumabcd2);
-        sumefgh1 = _mm_add_epi32(sumefgh1, sumefgh2);
+    // With more than one NUMA node, and when requested, give each node its
+    // own copy of the Network. The copies are placed before being touched,
+    // and Threads pick the one local to them via nnue_bind_evaluator()
 
-        acc0 = _mm256_inserti128_si256(_mm256_castsi128_si256(sumabcd1), sumefgh1, 1);
-        acc0 = _mm256_add_epi32(acc0, bia[i]);
-        acc0 = _mm256_max_epi32(acc0, zero);
-        out[i] = _mm256_cvtepi32_ps(acc0);
+    int nodes[NNUE_MAX_REPLICAS];
+    const int count = getMemoryNodes(nodes, NNUE_MAX_REPLICAS);
 
-        #elif defined (USE_AVX)
+    release_replicas();
 
-        __m128 ps0 = _mm_cvtepi32_ps(vepi32_max(zero, vepi32_add(bia[i * 2 + 0], acc0)));
-        __m128 ps1 = _mm_cvtepi32_ps(vepi32_max(zero, vepi32_add(bia[i * 2 + 1], acc4)));
+    if (!NNUEReplicate || nnue_network == NULL || count <= 1)
+        return;
 
-        out[i] = _mm256_insertf128_ps(out[i], ps0, 0);
-        out[i] = _mm256_insertf128_ps(out[i], ps1, 1);
+    for (int i = 0; i < count; i++) {
 
-        #elif defined (USE_SSSE3)
+        NNUENetwork *replica = alloc_network(&NNUEReplicaPages[i]);
+        if (replica == NULL) break;
 
-        out[i * 2 + 0] = vps32_max(zero, _mm_cvtepi32_ps(vepi32_add(bia[i * 2 + 0], acc0)));
-        out[i * 2 + 1] = vps32_max(zero, _mm_cvtepi32_ps(vepi32_add(bia[i * 2 + 1], acc4)));
+        place_network(replica, nodes[i]);
+        memcpy(replica, nnue_network, sizeof(NNUENetwork));
 
-        #endif
+        NNUEReplicas[i]     = replica;
+        NNUEReplicaNodes[i] = nodes[i];
+        NNUEReplicaCount    = i + 1;
     }
 }
 
-INLINE void float_affine_relu(float *weights, float *biases, float *inputs, float *outputs) {
-
-    assert(L2SIZE % 8 == 0 && L3SIZE % 8 == 0);
+static void release_network() {
 
-    const int InChunks  = L2SIZE / vps32_cnt;
-    const int OutChunks = L3SIZE / 8;
+    // Only called between searches, when no Thread may be using the Network
 
-    const vps32 zero = vps32_zero();
+    release_replicas();
 
-    const vps32 *inp = (vps32 *) inputs;
-    const vps32 *bia = (vps32 *) biases;
-    const vps32 *wgt = (vps32 *) weights;
-    vps32 *const out = (vps32 *) outputs;
+    if (NNUEMapped != NULL)
+        unmap_file(NNUEMapped, NNUEMappedSize);
 
-    for (int i = 0; i < OutChunks; i++) {
+    if (NNUEOwned != NULL)
+        free_network(NNUEOwned, NNUEOwnedPages);
 
-        vps32 acc0 = vps32_mul(wgt[InChunks * (i * 8 + 0) + 0], inp[0]);
-        vps32 acc1 = vps32_mul(wgt[InChunks * (i * 8 + 1) + 0], inp[0]);
-        vps32 acc2 = vps32_mul(wgt[InChunks * (i * 8 + 2) + 0], inp[0]);
-        vps32 acc3 = vps32_mul(wgt[InChunks * (i * 8 + 3) + 0], inp[0]);
-        vps32 acc4 = vps32_mul(wgt[InChunks * (i * 8 + 4) + 0], inp[0]);
-        vps32 acc5 = vps32_mul(wgt[InChunks * (i * 8 + 5) + 0], inp[0]);
-        vps32 acc6 = vps32_mul(wgt[InChunks * (i * 8 + 6) + 0], inp[0]);
-        vps32 acc7 = vps32_mul(wgt[InChunks * (i * 8 + 7) + 0], inp[0]);
+    nnue_network = NULL; NNUEOwned  = NULL;
+    NNUEMapped   = NULL; NNUEMappedSize = 0;
 
-        for (int j = 1; j < InChunks; j++) {
-            acc0 = vps32_fma(wgt[InChunks * (i * 8 + 0) + j], inp[j], acc0);
-            acc1 = vps32_fma(wgt[InChunks * (i * 8 + 1) + j], inp[j], acc1);
-            acc2 = vps32_fma(wgt[InChunks * (i * 8 + 2) + j], inp[j], acc2);
-            acc3 = vps32_fma(wgt[InChunks * (i * 8 + 3) + j], inp[j], acc3);
-            acc4 = vps32_fma(wgt[InChunks * (i * 8 + 4) + j], inp[j], acc4);
-            acc5 = vps32_fma(wgt[InChunks * (i * 8 + 5) + j], inp[j], acc5);
-            acc6 = vps32_fma(wgt[InChunks * (i * 8 + 6) + j], inp[j], acc6);
-            acc7 = vps32_fma(wgt[InChunks * (i * 8 + 7) + j], inp[j], acc7);
-        }
-
-        acc0 = vps32_hadd(acc0, acc1);
-        acc2 = vps32_hadd(acc2, acc3);
-        acc4 = vps32_hadd(acc4, acc5);
-        acc6 = vps32_hadd(acc6, acc7);
+    NNUEGeneration++;
+}
 
-        acc0 = vps32_hadd(acc0, acc2);
-        acc4 = vps32_hadd(acc4, acc6);
+static const NNUENetwork* transformed_network(const char *data, size_t size) {
 
-        #if defined(USE_AVX2) || defined(USE_AVX)
+    // Transformed Networks are used in place, but only when they were
+    // prepared for the very same layout that the selected kernels expect
 
-        __m128 sumabcd1 = _mm256_extractf128_ps(acc0, 0);
-        __m128 sumabcd2 = _mm256_extractf128_ps(acc0, 1);
-        __m128 sumefgh1 = _mm256_extractf128_ps(acc4, 0);
-        __m128 sumefgh2 = _mm256_extractf128_ps(acc4, 1);
+    NNUETransformedHeader header;
 
-        sumabcd1 = _mm_add_ps(sumabcd1, sumabcd2);
-        sumefgh1 = _mm_add_ps(sumefgh1, sumefgh2);
+    if (size < sizeof(header))
+        return NULL;
 
-        acc0 = _mm256_insertf128_ps(_mm256_castps128_ps256(sumabcd1), sumefgh1, 1);
-        out[i] = _mm256_max_ps(zero, _mm256_add_ps(bia[i], acc0));
+    memcpy(&header, data, sizeof(header));
 
-        #elif defined(USE_SSSE3)
+    if (   header.header.magic != NNUE_MAGIC
+        || !(header.header.flags & NNUE_FLAG_TRANSFORMED))
+        return NULL;
 
-        out[i * 2 + 0] = vps32_max(zero, vps32_add(bia[i * 2 + 0], acc0));
-        out[i * 2 + 1] = vps32_max(zero, vps32_add(bia[i * 2 + 1], acc4));
+    if (   header.version != NNUE_TRANSFORMED_VERSION
+        || size != sizeof(header) + sizeof(NNUENetwork))
+        abort_nnue("Unable to read NNUE File");
 
-        #endif
+    if (strncmp(header.layout, nnue_kernels->layout, sizeof(header.layout))) {
+        printf("info string NNUE File was transformed for %.16s, not %s\n", header.layout, nnue_kernels->layout);
+        fflush(stdout); exit(EXIT_FAILURE);
     }
+
+    return (const NNUENetwork*) (data + sizeof(header));
 }
 
-INLINE void output_transform(float *weights, float *biases, float *inputs, float *outputs) {
+static NNUENetwork* load_network(const char *data, size_t size, int *pages) {
 
-    assert(L3SIZE % 8 == 0);
+    // If the datasize does not match the compiled NNUE configuration, and
+    // the flags of the NNUEHeader if there is one, abort. Afterwords, scale
+    // or interleave weights for speed optimizations, and transpose L1 and L2
 
-    const int InChunks = L3SIZE / vps32_cnt;
+    NNUEHeader header = { 0 };
+    NNUENetwork *net;
 
-    const vps32 *inp  = (vps32 *) inputs;
-    const vps32 *wgt  = (vps32 *) weights;
+    if (size >= sizeof(NNUEHeader))
+        memcpy(&header, data, sizeof(NNUEHeader));
 
-    vps32 acc = vps32_mul(wgt[0], inp[0]);
-    for (int i = 1; i < InChunks; i++)
-        acc = vps32_fma(wgt[i], inp[i], acc);
+    if (header.magic == NNUE_MAGIC)
+        data += sizeof(NNUEHeader), size -= sizeof(NNUEHeader);
+    else header.flags = 0;
 
-    #if defined(USE_AVX) || defined(USE_AVX2)
+    if (size != network_size(header.flags))
+        abort_nnue("Unable to read NNUE File");
 
-    const __m128 hiQuad  = _mm256_extractf128_ps(acc, 1);
-    const __m128 loQuad  = _mm256_castps256_ps128(acc);
-    const __m128 sumQuad = _mm_add_ps(loQuad, hiQuad);
+    if ((net = alloc_network(pages)) == NULL)
+        abort_nnue("Unable to allocate NNUE Network");
 
-    #elif defined(USE_SSSE3)
+    memset(net, 0, sizeof(NNUENetwork));
+    net->quantized = !!(header.flags & NNUE_FLAG_QUANTIZED);
 
-    const __m128 sumQuad = acc;
+    data = read_layer(net->in_biases,  data, sizeof(net->in_biases ));
+    data = read_layer(net->in_weights, data, sizeof(net->in_weights));
+    data = read_layer(net->l1_biases,  data, sizeof(net->l1_biases ));
+    data = read_layer(net->l1_weights, data, sizeof(net->l1_weights));
 
-    #endif
+    if (net->quantized) {
+        data = read_layer(net->l2_qbiases,  data, sizeof(net->l2_qbiases ));
+        data = read_layer(net->l2_qweights, data, sizeof(net->l2_qweights));
+        data = read_layer(net->l3_qbiases,  data, sizeof(net->l3_qbiases ));
+        data = read_layer(net->l3_qweights, data, sizeof(net->l3_qweights));
+        quant_interleave(net->l2_qweights, L2SIZE, L3SIZE);
+    }
 
-    const __m128 hiDual  = _mm_movehl_ps(sumQuad, sumQuad);
-    const __m128 sumDual = _mm_add_ps(sumQuad, hiDual);
+    else {
+        data = read_layer(net->l2_biases,  data, sizeof(net->l2_biases ));
+        data = read_layer(net->l2_weights, data, sizeof(net->l2_weights));
+        data = read_layer(net->l3_biases,  data, sizeof(net->l3_biases ));
+        data = read_layer(net->l3_weights, data, sizeof(net->l3_weights));
+        scale_weights(net);
+        float_transpose(net->l2_weights, L2SIZE, L3SIZE);
+    }
 
-    const __m128 hi      = _mm_shuffle_ps(sumDual, sumDual, 0x1);
-    const __m128 sum     = _mm_add_ss(sumDual, hi);
+    quant_transpose(net->l1_weights, L1SIZE, L2SIZE);
+    nnue_kernels->shuffle(net);
 
-    *outputs = (_mm_cvtss_f32(sum) + *biases);
+    return net;
 }
 
 
 void nnue_init(const char* fname) {
 
-    // Reads an NNUE file specificed by a User. If the datasize does not match
-    // the compiled NNUE configuration, abort. Afterwords, scale some weights
-    // for speed optimizations, and transpose the weights in L1 and L2
+    // Reads an NNUE file specificed by a User. Transformed Networks are
+    // mapped and used in place, sharing the page cache with any other
+    // processes using the same file. Everything else is built in memory
 
-    FILE *fin = fopen(fname, "rb");
+    size_t size;
+    void *data = map_file(fname, &size);
 
-    if (   fread(in_biases, sizeof(int16_t), KPSIZE, fin) != (size_t) KPSIZE
-        || fread(in_weights, sizeof(int16_t), INSIZE * KPSIZE, fin) != (size_t) INSIZE * KPSIZE)
+    if (data == NULL)
         abort_nnue("Unable to read NNUE File");
 
-    if (   fread(l1_biases, sizeof(int32_t), L2SIZE, fin) != (size_t) L2SIZE
-        || fread(l1_weights, sizeof(int8_t), L1SIZE * L2SIZE, fin) != (size_t) L1SIZE * L2SIZE)
-        abort_nnue("Unable to read NNUE File");
+    const NNUENetwork *mapped = transformed_network(data, size);
 
-    if (   fread(l2_biases, sizeof(float), L3SIZE, fin) != (size_t) L3SIZE
-        || fread(l2_weights, sizeof(float), L2SIZE * L3SIZE, fin) != (size_t) L2SIZE * L3SIZE)
-        abort_nnue("Unable to read NNUE File");
+    release_network();
 
-    if (   fread(l3_biases, sizeof(float), OUTSIZE, fin) != (size_t) OUTSIZE
-        || fread(l3_weights, sizeof(float), L3SIZE * OUTSIZE, fin) != (size_t) L3SIZE * OUTSIZE)
-        abort_nnue("Unable to read NNUE File");
+    if (mapped != NULL) {
+        NNUEMapped     = data;
+        NNUEMappedSize = size;
+        nnue_network   = mapped;
+    }
 
-    scale_weights();
-    shuffle_input_layer();
-    quant_transpose(l1_weights, L1SIZE, L2SIZE);
-    float_transpose(l2_weights, L2SIZE, L3SIZE);
-    fclose(fin);
+    else {
+        nnue_network = NNUEOwned = load_network(data, size, &NNUEOwnedPages);
+        unmap_file(data, size);
+    }
 
-    NNUE_LOADED = 1;
+    build_replicas();
 }
 
 void nnue_incbin_init() {
 
     // Inits from an NNUE file compiled into the binary. Assume the compiled
-    // data is correct for the given NNUE config. Afterwords, scale some
-    // weights for speed optimizations, and transpose the weights in L1 and L2
+    // data is correct for the given NNUE config, although it is still checked.
+    // Transformed Networks are used in place, if they were aligned when linked
+
+    nnue_select_kernels();
 
     #ifdef EVALFILE
 
-    int8_t *data8; int16_t *data16; int32_t *data32; float *dataf;
+    const NNUENetwork *embedded = transformed_network((const char*) gIncWeightsData, gIncWeightsSize);
 
-    // Input layer uses 16-bit Biases and Weights
+    if (embedded != NULL && (uintptr_t) embedded % 64 == 0)
+        nnue_network = embedded;
 
-    data16 = (int16_t*) gIncWeightsData;
-    for (int i = 0; i < KPSIZE; i++)
-        in_biases[i] = *(data16++);
+    else if (embedded != NULL) {
+        if ((NNUEOwned = alloc_network(&NNUEOwnedPages)) == NULL)
+            abort_nnue("Unable to allocate NNUE Network");
+        nnue_network = memcpy(NNUEOwned, embedded, sizeof(NNUENetwork));
+    }
 
-    for (int i = 0; i < INSIZE * KPSIZE; i++)
-        in_weights[i] = *(data16++);
+    else nnue_network = NNUEOwned = load_network((const char*) gIncWeightsData, gIncWeightsSize, &NNUEOwnedPages);
 
-    // Layer one uses 32-bit Biases and 8-bit Weights
+    #endif
+}
+
+void nnue_quantize(const char *fin, const char *fout) {
+
+    // Convert an NNUE file with floating point L2 and L3 layers to use
+    // NNUE_FLAG_QUANTIZED, using the scaling described in nnue/types.h
+
+    size_t size, mapped;
+    char *data = map_file(fin, &mapped);
+    const char *net = data;
 
-    data32 = (int32_t*) data16;
-    for (int i = 0; i < L2SIZE; i++)
-        l1_biases[i] = *(data32++);
+    float l2b[L3SIZE], l2w[L2SIZE * L3SIZE], l3b[OUTSIZE], l3w[L3SIZE * OUTSIZE];
+    int32_t q2b[L3SIZE], q3b[OUTSIZE];
+    int16_t q2w[L2SIZE * L3SIZE], q3w[L3SIZE * OUTSIZE];
 
-    data8 = (int8_t*) data32;
-    for (int i = 0; i < L1SIZE * L2SIZE; i++)
-        l1_weights[i] = *(data8++);
+    size = mapped;
 
-    // Layer two and uses Floating Point Biases and Weights
+    if (data != NULL && size >= sizeof(NNUEHeader) && ((NNUEHeader *) data)->magic == NNUE_MAGIC)
+        net += sizeof(NNUEHeader), size -= sizeof(NNUEHeader);
+
+    if (data == NULL || size != network_size(0))
+        abort_nnue("Unable to read NNUE File");
+
+    // The input layer and L1 are unchanged by quantization
+    const size_t shared = network_size(0) - sizeof(l2b) - sizeof(l2w) - sizeof(l3b) - sizeof(l3w);
+
+    const char *layers = net + shared;
+    layers = read_layer(l2b, layers, sizeof(l2b));
+    layers = read_layer(l2w, layers, sizeof(l2w));
+    layers = read_layer(l3b, layers, sizeof(l3b));
+    layers = read_layer(l3w, layers, sizeof(l3w));
 
-    dataf = (float*) data8;
     for (int i = 0; i < L3SIZE; i++)
-        l2_biases[i] = *(dataf++);
+        q2b[i] = (int32_t) lround(l2b[i] * (1 << SHIFT_L1) * (1 << QSHIFT_L2));
 
     for (int i = 0; i < L2SIZE * L3SIZE; i++)
-        l2_weights[i] = *(dataf++);
-
-    // Layer three and uses Floating Point Biases and Weights
+        q2w[i] = (int16_t) MAX(INT16_MIN, MIN(INT16_MAX, lround(l2w[i] * (1 << QSHIFT_L2))));
 
     for (int i = 0; i < OUTSIZE; i++)
-        l3_biases[i] = *(dataf++);
+        q3b[i] = (int32_t) lround(l3b[i] * (1 << SHIFT_L1) * (1 << QSHIFT_L3));
 
     for (int i = 0; i < L3SIZE * OUTSIZE; i++)
-        l3_weights[i] = *(dataf++);
+        q3w[i] = (int16_t) MAX(INT16_MIN, MIN(INT16_MAX, lround(l3w[i] * (1 << QSHIFT_L3))));
+
+    NNUEHeader header = { NNUE_MAGIC, NNUE_FLAG_QUANTIZED };
+    FILE *out = fopen(fout, "wb");
+
+    if (   out == NULL
+        || fwrite(&header, sizeof(header), 1, out) != 1
+        || fwrite(net, 1, shared, out) != shared
+        || fwrite(q2b, sizeof(q2b), 1, out) != 1
+        || fwrite(q2w, sizeof(q2w), 1, out) != 1
+        || fwrite(q3b, sizeof(q3b), 1, out) != 1
+        || fwrite(q3w, sizeof(q3w), 1, out) != 1)
+        abort_nnue("Unable to write NNUE File");
+
+    fclose(out);
+    unmap_file(data, mapped);
+}
 
-    scale_weights();
-    shuffle_input_layer();
-    quant_transpose(l1_weights, L1SIZE, L2SIZE);
-    float_transpose(l2_weights, L2SIZE, L3SIZE);
+void nnue_convert(const char *fin, const char *fout) {
 
-    NNUE_LOADED = 1;
+    // Build the Network exactly as it would be for the selected kernels,
+    // and then save that image, so that later loads need only map it
 
-    #endif
+    nnue_init(fin);
+
+    NNUETransformedHeader header = { { NNUE_MAGIC, NNUE_FLAG_TRANSFORMED }, NNUE_TRANSFORMED_VERSION, {0}, {0} };
+    strncpy(header.layout, nnue_kernels->layout, sizeof(header.layout) - 1);
+
+    if (nnue_network->quantized)
+        header.header.flags |= NNUE_FLAG_QUANTIZED;
+
+    FILE *out = fopen(fout, "wb");
+
+    if (   out == NULL
+        || fwrite(&header, sizeof(header), 1, out) != 1
+        || fwrite(nnue_network, sizeof(NNUENetwork), 1, out) != 1)
+        abort_nnue("Unable to write NNUE File");
+
+    fclose(out);
+    printf("info string transformed %s for %s NNUE kernels\n", fin, nnue_kernels->layout);
 }
 
-int nnue_evaluate(Thread *thread, Board *board) {
+void nnue_set_replicas(int enabled) {
+
+    NNUEReplicate = enabled;
+    build_replicas();
+
+    if (NNUEReplicaCount)
+        printf("info string NNUE replicated across %d NUMA nodes\n", NNUEReplicaCount);
+}
+
+const NNUENetwork* nnue_replica(int node) {
+
+    for (int i = 0; i < NNUEReplicaCount; i++)
+        if (NNUEReplicaNodes[i] == node)
+            return NNUEReplicas[i];
+
+    return nnue_network;
+}
+
+int nnue_generation() {
+    return NNUEGeneration;
+}
+
+const char* nnue_kernels_name() {
+    return nnue_kernels->name;
+}
+
+static int nnue_forward(const NNUENetwork *net, NNUEAccumulator *accum, int turn) {
 
     int mg_eval, eg_eval;
+
+    // Feed-forward the entire evaluation function
+    const int output = net->quantized
+        ? nnue_kernels->quant_evaluate(net, accum->values[turn], accum->values[!turn])
+        : (int) nnue_kernels->evaluate(net, accum->values[turn], accum->values[!turn]);
+
+    // Perform the dequantization step and upscale the Midgame
+    mg_eval = 140 * (output >> SHIFT_L1) / 100;
+    eg_eval = 100 * (output >> SHIFT_L1) / 100;
+
+    // Cap the NNUE evaluation within [-2000, 2000]
+    mg_eval = MAX(-2000, MIN(2000, mg_eval));
+    eg_eval = MAX(-2000, MIN(2000, eg_eval));
+    return MakeScore(mg_eval, eg_eval);
+}
+
+int nnue_evaluate(Thread *thread, Board *board) {
+
     const uint64_t white = board->colours[WHITE];
     const uint64_t black = board->colours[BLACK];
     const uint64_t kings = board->pieces[KING];
 
-    if (!NNUE_LOADED)
+    const NNUENetwork *net = thread->nnue->network;
+
+    if (net == NULL)
         abort_nnue("NNUE File was not provided");
 
     // For optimizations, auto-flag KvK as drawn
@@ -456,14 +611,11 @@ int nnue_evaluate(Thread *thread, Board *board) {
 
     NNUEAccumulator *accum = thread->nnue->current;
 
-    ALIGN64 float   outN1[L1SIZE];
-    ALIGN64 float   outN2[L1SIZE];
-
     if (!accum->accurate[WHITE]) {
 
         // Possible to recurse and incrementally update each
         if (nnue_can_update(accum, board, WHITE))
-            nnue_update_accumulator(accum, board, WHITE, wrelksq);
+            nnue_update_accumulator(thread->nnue, accum, WHITE, wrelksq);
 
         // History is missing, we must refresh completely
         else
@@ -474,24 +626,72 @@ int nnue_evaluate(Thread *thread, Board *board) {
 
         // Possible to recurse and incrementally update each
         if (nnue_can_update(accum, board, BLACK))
-            nnue_update_accumulator(accum, board, BLACK, brelksq);
+            nnue_update_accumulator(thread->nnue, accum, BLACK, brelksq);
 
         // History is missing, we must refresh completely
         else
             nnue_refresh_accumulator(thread->nnue, accum, board, BLACK, brelksq);
     }
 
-    // Feed-forward the entire evaluation function
-    halfkp_relu_quant_affine_relu(l1_weights, l1_biases, accum->values[board->turn], accum->values[!board->turn], outN1);
-    float_affine_relu(l2_weights, l2_biases, outN1, outN2);
-    output_transform (l3_weights, l3_biases, outN2, outN1);
+    return nnue_forward(net, accum, board->turn);
+}
 
-    // Perform the dequantization step and upscale the Midgame
-    mg_eval = 140 * ((int)(outN1[0]) >> SHIFT_L1) / 100;
-    eg_eval = 100 * ((int)(outN1[0]) >> SHIFT_L1) / 100;
+void nnue_evaluate_batch(Board *boards, int count, int *scores) {
 
-    // Cap the NNUE evaluation within [-2000, 2000]
-    mg_eval = MAX(-2000, MIN(2000, mg_eval));
-    eg_eval = MAX(-2000, MIN(2000, eg_eval));
-    return MakeScore(mg_eval, eg_eval);
+    // Static evaluations of many unrelated positions, as for labelling data.
+    // There is no search, and so no history to update from. Instead, every
+    // Accumulator is refreshed from the Finny table, visiting the positions
+    // grouped by their King squares, so that each refresh starts from the last
+    // position which shared those Kings. Within a group the given order is kept,
+    // which leaves consecutive positions of the same game next to each other
+
+    int *order  = malloc(sizeof(int) * count);
+    int *starts = calloc(SQUARE_NB * SQUARE_NB + 1, sizeof(int));
+    NNUEEvaluator *nnue = nnue_create_evaluator();
+
+    nnue_bind_evaluator(nnue, -1);
+    nnue_reset_evaluator(nnue);
+
+    if (nnue->network == NULL)
+        abort_nnue("NNUE File was not provided");
+
+    for (int i = 0; i < count; i++) {
+        const uint64_t kings = boards[i].pieces[KING];
+        starts[1 + SQUARE_NB * getlsb(boards[i].colours[WHITE] & kings)
+                 + getlsb(boards[i].colours[BLACK] & kings)]++;
+    }
+
+    for (int i = 0; i < SQUARE_NB * SQUARE_NB; i++)
+        starts[i+1] += starts[i];
+
+    for (int i = 0; i < count; i++) {
+        const uint64_t kings = boards[i].pieces[KING];
+        order[starts[SQUARE_NB * getlsb(boards[i].colours[WHITE] & kings)
+                   + getlsb(boards[i].colours[BLACK] & kings)]++] = i;
+    }
+
+    for (int i = 0; i < count; i++) {
+
+        Board *board = &boards[order[i]];
+        NNUEAccumulator *accum = &nnue->stack[0];
+
+        const uint64_t white = board->colours[WHITE];
+        const uint64_t black = board->colours[BLACK];
+        const uint64_t kings = board->pieces[KING];
+
+        // For optimizations, auto-flag KvK as drawn
+        if (kings == (white | black)) {
+            scores[order[i]] = 0;
+            continue;
+        }
+
+        nnue_refresh_accumulator(nnue, accum, board, WHITE, relativeSquare(WHITE, getlsb(white & kings)));
+        nnue_refresh_accumulator(nnue, accum, board, BLACK, relativeSquare(BLACK, getlsb(black & kings)));
+
+        scores[order[i]] = nnue_forward(nnue->network, accum, board->turn);
+    }
+
+    nnue_delete_evaluator(nnue);
+    free(starts);
+    free(order);
 }
@@ -26,7 +26,12 @@
 
 void nnue_init(const char* fname);
 void nnue_incbin_init();
+void nnue_quantize(const char *fin, const char *fout);
+void nnue_convert(const char *fin, const char *fout);
+void nnue_set_replicas(int enabled);
+const char* nnue_kernels_name();
 int nnue_evaluate(Thread *thread, Board *board);
+void nnue_evaluate_batch(Board *boards, int count, int *scores);
 
 #else
 
@@ -38,8 +43,29 @@ INLINE void nnue_incbin_init() {
     (void) 0;
 };
 
+INLINE void nnue_quantize(const char *fin, const char *fout) {
+    (void) fin; (void) fout; printf("info string Error: NNUE is disabled for this binary\n");
+}
+
+INLINE void nnue_convert(const char *fin, const char *fout) {
+    (void) fin; (void) fout; printf("info string Error: NNUE is disabled for this binary\n");
+}
+
+INLINE void nnue_set_replicas(int enabled) {
+    (void) enabled;
+}
+
+INLINE const char* nnue_kernels_name() {
+    return "none";
+}
+
 INLINE int nnue_evaluate(Thread *thread, Board * board) {
     (void) thread; (void) board; return 0;
 }
 
+INLINE void nnue_evaluate_batch(Board *boards, int count, int *scores) {
+    (void) boards; (void) count; (void) scores;
+    printf("info string Error: NNUE is disabled for this binary\n");
+}
+
 #endif
@@ -24,12 +24,16 @@
 
 #include "../types.h"
 
-#if defined(USE_AVX2)
+#if defined(USE_AVX512)
+    #include "archs/avx512.h"
+#elif defined(USE_AVX2)
     #include "archs/avx2.h"
 #elif defined(USE_AVX)
     #include "archs/avx.h"
 #elif defined(USE_SSSE3)
     #include "archs/ssse3.h"
+#elif defined(USE_NEON)
+    #include "archs/neon.h"
 #endif
 
 #define INSIZE  20480
@@ -39,7 +43,59 @@
 #define L3SIZE  32
 #define OUTSIZE 1
 
-#define NUM_REGS 16
+#define SHIFT_L0 6
+#define SHIFT_L1 5
+
+// Networks may start with an NNUEHeader, identified by NNUE_MAGIC. Those
+// without one are the original format, with floating point L2 and L3 layers.
+// When NNUE_FLAG_QUANTIZED is set, L2 and L3 instead use 16-bit weights scaled
+// by 2^QSHIFT_L2 and 2^QSHIFT_L3, and 32-bit biases which already include
+// both that and the 2^SHIFT_L1 scaling that scale_weights() would apply.
+// When NNUE_FLAG_TRANSFORMED is set, the file is an NNUETransformedHeader
+// followed by an image of the NNUENetwork, fully prepared for the kernels
+// which are named by the layout, such that it can be mapped into memory
+
+#define NNUE_MAGIC            0x45554E4E
+#define NNUE_FLAG_QUANTIZED   0x00000001
+#define NNUE_FLAG_TRANSFORMED 0x00000002
+
+#define NNUE_TRANSFORMED_VERSION 1
+
+#define QSHIFT_L2 10
+#define QSHIFT_L3 10
+
+typedef struct NNUEHeader {
+    uint32_t magic, flags;
+} NNUEHeader;
+
+typedef struct NNUETransformedHeader {
+    NNUEHeader header;
+    uint32_t version;
+    char layout[16];
+    uint8_t reserved[36];
+} NNUETransformedHeader;
+
+typedef struct NNUENetwork {
+
+    ALIGN64 int16_t in_weights[INSIZE * KPSIZE ];
+    ALIGN64 int8_t  l1_weights[L1SIZE * L2SIZE ];
+    ALIGN64 float   l2_weights[L2SIZE * L3SIZE ];
+    ALIGN64 float   l3_weights[L3SIZE * OUTSIZE];
+
+    ALIGN64 int16_t in_biases[KPSIZE ];
+    ALIGN64 int32_t l1_biases[L2SIZE ];
+    ALIGN64 float   l2_biases[L3SIZE ];
+    ALIGN64 float   l3_biases[OUTSIZE];
+
+    ALIGN64 int16_t l2_qweights[L2SIZE * L3SIZE ];
+    ALIGN64 int16_t l3_qweights[L3SIZE * OUTSIZE];
+
+    ALIGN64 int32_t l2_qbiases[L3SIZE ];
+    ALIGN64 int32_t l3_qbiases[OUTSIZE];
+
+    int32_t quantized;
+
+} NNUENetwork;
 
 typedef struct NNUEDelta {
     int piece, from, to;
@@ -60,4 +116,8 @@ typedef struct NNUEEvaluator {
     NNUEAccumulator stack[MAX_PLY + 4];         // Each ply of search
     NNUEAccumulator *current;                   // Pointer of the current stack location
     NNUEAccumulatorTableEntry table[SQUARE_NB]; // Finny table with Accumulators for each square
+    uint64_t seeded[COLOUR_NB];                 // Finny entries which have been built for this Network
+    const NNUENetwork *network;                 // Weights to use, possibly a NUMA local replica
+    int node;                                   // NUMA node of the owning thread, or -1
+    int generation;                             // Version of the weights the Finny table was built with
 } NNUEEvaluator;
@@ -0,0 +1,181 @@
+/*
+  Ethereal is a UCI chess playing engine authored by Andrew Grant.
+  <https://github.com/AndyGrant/Ethereal>     <andrew@grantnet.us>
+
+  Ethereal is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Ethereal is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#if defined(__linux__)
+    #include <linux/perf_event.h>
+    #include <sys/ioctl.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif
+
+#include "perfcounters.h"
+#include "thread.h"
+
+int PerfCountersEnabled = 0; // Set by UCI options
+
+#if defined(__linux__)
+
+static const struct { uint32_t type; uint64_t config; } PerfEvents[PERF_NB] = {
+    { PERF_TYPE_SOFTWARE, PERF_COUNT_SW_TASK_CLOCK        },
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES        },
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS      },
+    { PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D
+                        | PERF_COUNT_HW_CACHE_OP_READ        <<  8
+                        | PERF_COUNT_HW_CACHE_RESULT_MISS    << 16 },
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES      },
+    { PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_DTLB
+                        | PERF_COUNT_HW_CACHE_OP_READ        <<  8
+                        | PERF_COUNT_HW_CACHE_RESULT_MISS    << 16 },
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_INSTRUCTIONS },
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES     },
+};
+
+void perf_counters_start(PerfCounters *perf) {
+
+    // Open every event for the calling thread alone, on any CPU. The events are
+    // not grouped, so that the kernel may schedule each as a counter frees up
+
+    memset(perf, 0, sizeof(PerfCounters));
+
+    if (!PerfCountersEnabled)
+        return;
+
+    for (int i = 0; i < PERF_NB; i++) {
+
+        struct perf_event_attr attr;
+        memset(&attr, 0, sizeof(attr));
+
+        attr.size           = sizeof(attr);
+        attr.type           = PerfEvents[i].type;
+        attr.config         = PerfEvents[i].config;
+        attr.disabled       = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv     = 1;
+        attr.read_format    = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+        perf->fds[i] = syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+    }
+
+    for (int i = 0; i < PERF_NB; i++)
+        if (perf->fds[i] >= 0) ioctl(perf->fds[i], PERF_EVENT_IOC_RESET, 0);
+
+    for (int i = 0; i < PERF_NB; i++)
+        if (perf->fds[i] >= 0) ioctl(perf->fds[i], PERF_EVENT_IOC_ENABLE, 0);
+}
+
+void perf_counters_stop(PerfCounters *perf) {
+
+    // Value, time enabled, and time running, as requested by the read_format
+    uint64_t values[3];
+
+    if (!PerfCountersEnabled)
+        return;
+
+    for (int i = 0; i < PERF_NB; i++)
+        if (perf->fds[i] >= 0) ioctl(perf->fds[i], PERF_EVENT_IOC_DISABLE, 0);
+
+    for (int i = 0; i < PERF_NB; i++) {
+
+        if (perf->fds[i] < 0)
+            continue;
+
+        // Scale multiplexed events up to the whole of the time they were enabled
+        if (read(perf->fds[i], values, sizeof(values)) == sizeof(values) && values[2] > 0) {
+            perf->counts[i] = values[2] < values[1] ? (uint64_t) ((double) values[0] * values[1] / values[2]) : values[0];
+            perf->valid |= 1u << i;
+        }
+
+        close(perf->fds[i]);
+    }
+}
+
+#else
+
+void perf_counters_start(PerfCounters *perf) { memset(perf, 0, sizeof(PerfCounters)); }
+void perf_counters_stop(PerfCounters *perf) { (void) perf; }
+
+#endif
+
+void perf_counters_merge(PerfCounters *perf, const PerfCounters *other) {
+
+    // An event is only valid in a total if it was valid for every part
+    perf->valid = perf->merged++ ? perf->valid & other->valid : other->valid;
+
+    for (int i = 0; i < PERF_NB; i++)
+        perf->counts[i] += other->counts[i];
+}
+
+static void perf_counters_ratio(const char *name, const char *format, bool valid, double num, double den) {
+
+    // Derived values are only shown when all of their inputs were counted
+    if (!valid || den <= 0.0) { printf(" %s n/a", name); return; }
+
+    printf(" %s ", name);
+    printf(format, num / den);
+}
+
+void perf_counters_report(const PerfCounters *perf, const char *label) {
+
+    /// Report IPC, misses per thousand instructions, and the branch miss rate
+
+    const uint64_t *counts = perf->counts;
+    const bool instructions = perf->valid & (1u << PERF_INSTRUCTIONS);
+
+    if (!(perf->valid & (1u << PERF_TASK_CLOCK))) {
+        printf("info string perf %s unavailable\n", label);
+        return;
+    }
+
+    printf("info string perf %s cpu %.0f ms", label, counts[PERF_TASK_CLOCK] / 1e6);
+
+    perf_counters_ratio("ipc", "%.2f", instructions && (perf->valid & (1u << PERF_CYCLES)),
+        counts[PERF_INSTRUCTIONS], counts[PERF_CYCLES]);
+
+    perf_counters_ratio("l1d-mpki", "%.3f", instructions && (perf->valid & (1u << PERF_L1D_MISSES)),
+        counts[PERF_L1D_MISSES], counts[PERF_INSTRUCTIONS] / 1000.0);
+
+    perf_counters_ratio("llc-mpki", "%.3f", instructions && (perf->valid & (1u << PERF_LLC_MISSES)),
+        counts[PERF_LLC_MISSES], counts[PERF_INSTRUCTIONS] / 1000.0);
+
+    perf_counters_ratio("dtlb-mpki", "%.3f", instructions && (perf->valid & (1u << PERF_DTLB_MISSES)),
+        counts[PERF_DTLB_MISSES], counts[PERF_INSTRUCTIONS] / 1000.0);
+
+    perf_counters_ratio("branch-miss", "%.2f%%", (perf->valid & (1u << PERF_BRANCHES)) && (perf->valid & (1u << PERF_BRANCH_MISSES)),
+        100.0 * counts[PERF_BRANCH_MISSES], counts[PERF_BRANCHES]);
+
+    printf("\n");
+}
+
+void perf_counters_report_threads(Thread *threads) {
+
+    // Report each Thread of the pool, and then the pool as a whole
+
+    char label[32];
+    PerfCounters total = {0};
+
+    for (int i = 0; i < threads->nthreads; i++) {
+        snprintf(label, sizeof(label), "thread %d", i);
+        perf_counters_report(&threads[i].perf, label);
+        perf_counters_merge(&total, &threads[i].perf);
+    }
+
+    perf_counters_report(&total, "total");
+}
@@ -0,0 +1,57 @@
+/*
+  Ethereal is a UCI chess playing engine authored by Andrew Grant.
+  <https://github.com/AndyGrant/Ethereal>     <andrew@grantnet.us>
+
+  Ethereal is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Ethereal is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "types.h"
+
+/// Hardware performance counters, read through perf_event_open() on Linux, so
+/// that no external profiler is needed. Each Thread opens its own counters as
+/// its search begins, and reads them as it ends, counting only its own work in
+/// user space. Events the CPU or kernel refuse, such as within most virtual
+/// machines, are marked unavailable, and are reported as such. Counters which
+/// the kernel had to multiplex are scaled up by the fraction of time they ran.
+///
+/// Other platforms compile the same interface, with every event unavailable.
+
+enum {
+    PERF_TASK_CLOCK,   // Nanoseconds on the CPU, which is always available
+    PERF_CYCLES,
+    PERF_INSTRUCTIONS,
+    PERF_L1D_MISSES,   // L1 data cache read misses
+    PERF_LLC_MISSES,   // Last level cache misses
+    PERF_DTLB_MISSES,  // Data TLB read misses
+    PERF_BRANCHES,
+    PERF_BRANCH_MISSES,
+    PERF_NB
+};
+
+struct PerfCounters {
+    int fds[PERF_NB];
+    uint64_t counts[PERF_NB];
+    uint32_t valid;   // Bitmask of the events which were counted
+    int merged;       // Number of sets of counters summed into a total
+};
+
+void perf_counters_start(PerfCounters *perf);
+void perf_counters_stop(PerfCounters *perf);
+void perf_counters_merge(PerfCounters *perf, const PerfCounters *other);
+void perf_counters_report(const PerfCounters *perf, const char *label);
+void perf_counters_report_threads(Thread *threads);
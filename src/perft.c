@@ -0,0 +1,263 @@
+/*
+  Ethereal is a UCI chess playing engine authored by Andrew Grant.
+  <https://github.com/AndyGrant/Ethereal>     <andrew@grantnet.us>
+
+  Ethereal is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Ethereal is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <inttypes.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "board.h"
+#include "move.h"
+#include "movegen.h"
+#include "perft.h"
+#include "timeman.h"
+#include "types.h"
+
+static PerftEntry *PerftTable; // Cached counts remain exact across searches
+static uint64_t PerftMask;      // Entries in the PerftTable minus one
+static int PerftMegabytes;      // Size of the current PerftTable
+
+typedef struct PerftWorker {
+    Board *board;
+    PerftEntry *table;
+    uint64_t mask;
+    uint16_t *moves;
+    uint64_t *counts;
+    int depth, size, *next;
+} PerftWorker;
+
+static uint64_t perft_search(Board *board, PerftEntry *table, uint64_t mask, int depth) {
+
+    Undo undo[1];
+    int size;
+    uint64_t found = 0ull;
+    uint16_t moves[MAX_MOVES];
+
+    // Bulk count the final ply
+    if (depth == 1)
+        return genAllLegalMoves(board, moves);
+
+    // Verify the key against the data, to discard torn Entries
+    PerftEntry entry = table[board->hash & mask];
+    if (   (entry.key ^ entry.data) == board->hash
+        && (int) (entry.data & 0xFF) == depth)
+        return entry.data >> 8;
+
+    // Recurse on all moves, which are generated legal
+    for (size = genAllLegalMoves(board, moves) - 1; size >= 0; size--) {
+        applyMove(board, moves[size], undo);
+        found += perft_search(board, table, mask, depth-1);
+        revertMove(board, moves[size], undo);
+    }
+
+    // Always replace, as deeper Entries are only ever reached once
+    entry.data = (found << 8) | (uint64_t) depth;
+    entry.key  = board->hash ^ entry.data;
+    table[board->hash & mask] = entry;
+
+    return found;
+}
+
+static void* perft_worker(void *vworker) {
+
+    PerftWorker *const worker = (PerftWorker*) vworker;
+
+    Undo undo[1];
+    Board board = *worker->board;
+
+    // Grab root moves until none remain, counting each subtree
+    for (int i; (i = __atomic_fetch_add(worker->next, 1, __ATOMIC_RELAXED)) < worker->size; ) {
+        applyMove(&board, worker->moves[i], undo);
+        worker->counts[i] = worker->depth == 1 ? 1ull
+                          : perft_search(&board, worker->table, worker->mask, worker->depth - 1);
+        revertMove(&board, worker->moves[i], undo);
+    }
+
+    return NULL;
+}
+
+void perft_init(int megabytes) {
+
+    // Counts are a pure function of the position and depth, so the table
+    // is kept between calls, and only reallocated when changing size
+
+    uint64_t entries = 1ull;
+
+    if (megabytes == PerftMegabytes)
+        return;
+
+    // Largest power of two number of Entries within the given megabytes
+    while (2 * entries * sizeof(PerftEntry) <= (uint64_t) megabytes << 20) entries *= 2;
+
+    free(PerftTable);
+    PerftTable     = calloc(entries, sizeof(PerftEntry));
+    PerftMask      = entries - 1;
+    PerftMegabytes = megabytes;
+}
+
+uint64_t perft(Board *board, int depth, int nthreads, int megabytes, bool divide) {
+
+    uint16_t moves[MAX_MOVES];
+    uint64_t counts[MAX_MOVES], found = 0ull;
+    int next = 0, size;
+
+    if (depth <= 0) return 1ull;
+
+    perft_init(megabytes);
+
+    pthread_t pthreads[nthreads];
+    PerftWorker workers[nthreads];
+
+    // Workers each own a copy of the Board, and share everything else
+    size = genAllLegalMoves(board, moves);
+    for (int i = 0; i < nthreads; i++)
+        workers[i] = (PerftWorker) { board, PerftTable, PerftMask, moves, counts, depth, size, &next };
+
+    // Reuse the current thread for the first worker
+    for (int i = 1; i < nthreads; i++)
+        pthread_create(&pthreads[i], NULL, &perft_worker, &workers[i]);
+    perft_worker(&workers[0]);
+
+    for (int i = 1; i < nthreads; i++)
+        pthread_join(pthreads[i], NULL);
+
+    // Report the count for each root move in the order generated
+    for (int i = 0; i < size; i++) {
+
+        if (divide) {
+            char moveStr[6];
+            moveToString(moves[i], moveStr, board->chess960);
+            printf("%s: %"PRIu64"\n", moveStr, counts[i]);
+        }
+
+        found += counts[i];
+    }
+
+    return found;
+}
+
+typedef struct PerftSuite {
+    char (*lines)[512];
+    int count, depth, next, failures, checked;
+    uint64_t nodes;
+    pthread_mutex_t lock;
+} PerftSuite;
+
+static void* perft_suite_worker(void *vsuite) {
+
+    PerftSuite *const suite = (PerftSuite*) vsuite;
+
+    Board board;
+    char fen[512], *ptr;
+    int index, depth, fails, checked;
+    uint64_t expected, found, nodes;
+    double start, elapsed;
+
+    while ((index = __atomic_fetch_add(&suite->next, 1, __ATOMIC_RELAXED)) < suite->count) {
+
+        // Lines are of the form "<fen> ;D1 <nodes> ;D2 <nodes> ..."
+        strcpy(fen, suite->lines[index]);
+        if ((ptr = strchr(fen, ';')) == NULL) continue;
+        while (ptr > fen && ptr[-1] == ' ') ptr--;
+        *ptr = '\0';
+
+        // Shredder-FEN castling rights are only parsed in Chess960 mode, which
+        // is also a superset of the standard castling rules for our purposes
+        boardFromFEN(&board, fen, 1);
+
+        start = get_real_time(), fails = checked = 0, nodes = 0ull;
+
+        for (ptr = strchr(suite->lines[index], ';'); ptr != NULL; ptr = strchr(ptr + 1, ';')) {
+
+            if (   sscanf(ptr, ";D%d %"SCNu64, &depth, &expected) != 2
+                || depth > suite->depth)
+                break;
+
+            found = perft(&board, depth, 1, PERFT_SUITE_MB, FALSE);
+            checked++, nodes += found;
+
+            if (found != expected) {
+                pthread_mutex_lock(&suite->lock);
+                printf("[# %4d] FAIL D%d expected %"PRIu64" found %"PRIu64" %s\n",
+                    index + 1, depth, expected, found, fen);
+                pthread_mutex_unlock(&suite->lock);
+                fails++;
+            }
+        }
+
+        elapsed = get_real_time() - start;
+
+        pthread_mutex_lock(&suite->lock);
+        printf("[# %4d] %s %2d depths %14"PRIu64" nodes %12"PRIu64" nps %s\n",
+            index + 1, fails ? "FAIL" : "PASS", checked, nodes,
+            (uint64_t) (1000.0 * nodes / (elapsed + 1)), fen);
+        suite->failures += fails, suite->checked += checked, suite->nodes += nodes;
+        fflush(stdout);
+        pthread_mutex_unlock(&suite->lock);
+    }
+
+    return NULL;
+}
+
+int perft_suite(const char *fname, int depth, int nthreads) {
+
+    /// Verify every PERFT count in an EPD file, such as perft/standard.epd or
+    /// perft/fischer.epd, up to the given depth. Positions are spread across
+    /// threads, sharing the PerftTable. Returns the number of mismatches found
+
+    char line[512];
+    double start = get_real_time();
+    FILE *fin = fopen(fname, "r");
+    PerftSuite suite = { NULL, 0, depth, 0, 0, 0, 0ull, PTHREAD_MUTEX_INITIALIZER };
+    pthread_t pthreads[nthreads];
+
+    if (fin == NULL) {
+        printf("Unable to open %s\n", fname);
+        return 1;
+    }
+
+    // Load the entire suite up front, so workers need not share the file
+    for (int size = 0; fgets(line, sizeof(line), fin); ) {
+        if (strchr(line, ';') == NULL) continue;
+        if (suite.count == size)
+            suite.lines = realloc(suite.lines, (size = 2 * size + 64) * sizeof(*suite.lines));
+        strcpy(suite.lines[suite.count++], line);
+    }
+
+    fclose(fin);
+
+    // Threads all share the same table, so it must exist before they start
+    perft_init(PERFT_SUITE_MB);
+
+    for (int i = 1; i < nthreads; i++)
+        pthread_create(&pthreads[i], NULL, &perft_suite_worker, &suite);
+    perft_suite_worker(&suite);
+
+    for (int i = 1; i < nthreads; i++)
+        pthread_join(pthreads[i], NULL);
+
+    const double elapsed = get_real_time() - start;
+
+    printf("\nPositions: %d\nChecked:   %d\nFailures:  %d\nNodes:     %"PRIu64"\nTime:      %dms\nNPS:       %"PRIu64"\n",
+        suite.count, suite.checked, suite.failures, suite.nodes,
+        (int) elapsed, (uint64_t) (1000.0 * suite.nodes / (elapsed + 1)));
+
+    free(suite.lines);
+    return suite.failures;
+}
@@ -0,0 +1,44 @@
+/*
+  Ethereal is a UCI chess playing engine authored by Andrew Grant.
+  <https://github.com/AndyGrant/Ethereal>     <andrew@grantnet.us>
+
+  Ethereal is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Ethereal is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "types.h"
+
+/// PERFT counts the leaf nodes of the legal move tree to a fixed depth, in
+/// order to validate move generation. Leaves are bulk counted, by taking the
+/// size of the legal move list one ply early, and interior nodes are cached
+/// in a small lockless table, shared between threads, keyed by hash and depth.
+/// The moves at the root are split among the threads as a simple work queue.
+///
+/// perft() may be called concurrently from several threads, so long as each
+/// call requests the same table size, for example after calling perft_init().
+
+enum { PERFT_SUITE_MB = 256 };
+
+typedef struct PerftEntry {
+    uint64_t key;  // Zobrist hash XORed with data
+    uint64_t data; // Node count << 8 | depth
+} PerftEntry;
+
+void perft_init(int megabytes);
+uint64_t perft(Board *board, int depth, int nthreads, int megabytes, bool divide);
+int perft_suite(const char *fname, int depth, int nthreads);
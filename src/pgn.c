@@ -17,29 +17,30 @@
 */
 
 #include <ctype.h>
+#include <inttypes.h>
 #include <math.h>
+#include <pthread.h>
 #include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
+#if defined(_WIN32) || defined(_WIN64)
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
 #include "attacks.h"
 #include "bitboards.h"
 #include "board.h"
 #include "move.h"
+#include "nnchain.h"
 #include "pgn.h"
-
-/// Ethereal's NNUE Data Format
-
-typedef struct HalfKPSample {
-    uint64_t occupied;   // 8-byte occupancy bitboard ( No Kings )
-    int16_t  eval;       // 2-byte int for the target evaluation
-    uint8_t  result;     // 1-byte int for result. { L=0, D=1, W=2 }
-    uint8_t  turn;       // 1-byte int for the side-to-move flag
-    uint8_t  wking;      // 1-byte int for the White King Square
-    uint8_t  bking;      // 1-byte int for the Black King Square
-    uint8_t  packed[15]; // 1-byte int per two non-King pieces
-} HalfKPSample;
+#include "timeman.h"
 
 static void pack_bitboard(uint8_t *packed, Board *board, uint64_t pieces) {
 
@@ -61,7 +62,7 @@ static void pack_bitboard(uint8_t *packed, Board *board, uint64_t pieces) {
     #undef pack_pieces
 }
 
-static void build_halfkp_sample(Board *board, HalfKPSample *sample, unsigned result, int16_t eval) {
+void build_halfkp_sample(Board *board, HalfKPSample *sample, unsigned result, int16_t eval) {
 
     const uint64_t white  = board->colours[WHITE];
     const uint64_t black  = board->colours[BLACK];
@@ -73,9 +74,21 @@ static void build_halfkp_sample(Board *board, HalfKPSample *sample, unsigned res
     sample->turn     = board->turn;
     sample->wking    = getlsb(white & board->pieces[KING]);
     sample->bking    = getlsb(black & board->pieces[KING]);
+
+    // Unused trailing bytes are zeroed, so that equal positions pack equally
+    memset(sample->packed, 0, sizeof(sample->packed));
     pack_bitboard(sample->packed, board, sample->occupied);
 }
 
+bool halfkp_sample_is_quiet(Board *board, uint16_t move, int eval) {
+
+    // Samples are only taken for non-mate scores within [-2000, 2000] cp,
+    // when not in check, and when the move played is not a tactical one
+    return abs(eval) <= 2000
+        && !boardKingAttackers(board)
+        && !moveIsTactical(board, move);
+}
+
 
 static bool san_is_file(char chr) {
     return 'a' <= chr && chr <= 'h';
@@ -285,10 +298,27 @@ static int pgn_read_until_space(char *buffer, int index) {
     return index;
 }
 
+static bool pgn_read_line(PGNChunk *chunk, PGNData *data) {
 
-static bool pgn_read_headers(FILE *pgn, PGNData *data) {
+    // Copy the next line, including its newline, as fgets() would have done
+    const char *eol = memchr(chunk->ptr, '\n', chunk->end - chunk->ptr);
+    size_t length   = (eol != NULL ? eol + 1 : chunk->end) - chunk->ptr;
 
-    if (fgets(data->buffer, 65536, pgn) == NULL)
+    if (length == 0)
+        return false;
+
+    length = MIN(length, sizeof(data->buffer) - 1);
+    memcpy(data->buffer, chunk->ptr, length);
+    data->buffer[length] = '\0';
+    chunk->ptr += length;
+
+    return true;
+}
+
+
+static bool pgn_read_headers(PGNChunk *chunk, PGNData *data) {
+
+    if (!pgn_read_line(chunk, data))
         return false;
 
     if (strstr(data->buffer, "[White \"Ethereal") == data->buffer)
@@ -317,15 +347,23 @@ static bool pgn_read_headers(FILE *pgn, PGNData *data) {
     return data->buffer[0] == '[';
 }
 
-static void pgn_read_moves(FILE *pgn, FILE *bindata, PGNData *data, HalfKPSample *samples, Board *board) {
+static int pgn_read_moves(PGNChunk *chunk, PGNData *data, HalfKPSample *samples, NNChainBuffer *chain, Board *board) {
 
     Undo undo;
     double feval;
     uint16_t move;
+    bool sampled;
     int eval, placed = 0, index = 0;
 
-    if (fgets(data->buffer, 65536, pgn) == NULL)
-        return;
+    if (!pgn_read_line(chunk, data))
+        return 0;
+
+    // Games without a known result are never saved, so need not be parsed
+    if (data->result == PGN_UNKNOWN_RESULT)
+        return 0;
+
+    if (chain != NULL)
+        nnchain_begin(chain, data->startpos, data->result);
 
     while (1) {
 
@@ -346,22 +384,30 @@ static void pgn_read_moves(FILE *pgn, FILE *bindata, PGNData *data, HalfKPSample
         if (board->turn == BLACK) eval = -eval;
 
         // Use the sample if it is quiet and within [-2000, 2000] cp
-        if (    abs(eval) <= 2000
-            && !board->kingAttackers
-            && !moveIsTactical(board, move)
-            && (board->turn == WHITE ? data->is_white : data->is_black))
-            build_halfkp_sample(board, &samples[placed++], data->result, eval);
+        sampled =  halfkp_sample_is_quiet(board, move, eval)
+               && (board->turn == WHITE ? data->is_white : data->is_black);
+
+        // Chained games keep every move, flagging those which are samples
+        if (chain != NULL)
+            nnchain_push(chain, move, sampled, eval);
+
+        else if (sampled)
+            build_halfkp_sample(board, &samples[placed], data->result, eval);
+
+        placed += sampled;
 
         // Skip head to the end of this comment to prepare for the next Move
         index = pgn_read_until_space(data->buffer, index+1); data->plies++;
         applyMove(board, move, &undo);
     }
 
-    if (data->result != PGN_UNKNOWN_RESULT)
-        fwrite(samples, sizeof(HalfKPSample), placed, bindata);
+    if (chain != NULL)
+        nnchain_end(chain);
+
+    return placed;
 }
 
-static bool process_next_pgn(FILE *pgn, FILE *bindata, PGNData *data, HalfKPSample *samples, Board *board) {
+static bool process_next_pgn(PGNChunk *chunk, PGNData *data, HalfKPSample *samples, NNChainBuffer *chain, int *placed, Board *board) {
 
     // Make sure to cleanup previous PGNs
     if (data->startpos != NULL)
@@ -375,7 +421,7 @@ static bool process_next_pgn(FILE *pgn, FILE *bindata, PGNData *data, HalfKPSamp
     data->plies    = 0;
 
     // Read Result & Fen and skip to Moves
-    while (pgn_read_headers(pgn, data));
+    while (pgn_read_headers(chunk, data));
 
     // Process until we don't get a Result header
     if (data->result == PGN_NO_RESULT)
@@ -389,24 +435,187 @@ static bool process_next_pgn(FILE *pgn, FILE *bindata, PGNData *data, HalfKPSamp
         data->is_white = data->is_black = true;
 
     // Read Result & Fen and skip to Moves
-    pgn_read_moves(pgn, bindata, data, samples, board);
+    *placed += pgn_read_moves(chunk, data, samples != NULL ? samples + *placed : NULL, chain, board);
 
     // Skip the trailing Newline of each PGN
-    if (fgets(data->buffer, 65536, pgn) == NULL)
-        return false;
+    return pgn_read_line(chunk, data);
+}
 
-    return true;
+
+#if defined(_WIN32) || defined(_WIN64)
+
+void* nndata_map_file(const char *fname, size_t *size) {
+
+    void *data = NULL;
+    HANDLE mapping  = NULL;
+    LARGE_INTEGER bytes;
+
+    HANDLE file = CreateFileA(fname, GENERIC_READ, FILE_SHARE_READ, NULL,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+
+    if (file == INVALID_HANDLE_VALUE)
+        return NULL;
+
+    if (   GetFileSizeEx(file, &bytes) && bytes.QuadPart > 0
+        && (mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL)) != NULL)
+        data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+
+    if (mapping != NULL) CloseHandle(mapping);
+    CloseHandle(file);
+
+    *size = data != NULL ? (size_t) bytes.QuadPart : 0;
+    return data;
 }
 
+void nndata_unmap_file(void *data, size_t size) {
+    (void) size; UnmapViewOfFile(data);
+}
 
-void process_pgn(const char *fin, const char *fout) {
+#else
 
-    FILE *pgn = fopen(fin, "r");
-    FILE *bindata = fopen(fout, "wb");
-    PGNData *data = calloc(1, sizeof(PGNData));
-    HalfKPSample *samples = calloc(1024, sizeof(HalfKPSample));
+void* nndata_map_file(const char *fname, size_t *size) {
+
+    struct stat st;
+    void *data = MAP_FAILED;
+    int fd = open(fname, O_RDONLY);
+
+    if (fd == -1)
+        return NULL;
+
+    if (!fstat(fd, &st) && st.st_size > 0)
+        data = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+
+    close(fd);
+
+    // The file is read through once, so the kernel may read ahead freely
+    if (data != MAP_FAILED)
+        madvise(data, st.st_size, MADV_SEQUENTIAL);
+
+    *size = data != MAP_FAILED ? (size_t) st.st_size : 0;
+    return data != MAP_FAILED ? data : NULL;
+}
+
+void nndata_unmap_file(void *data, size_t size) {
+    munmap(data, size);
+}
+
+#endif
+
+static const char* pgn_chunk_end(const char *start, const char *end) {
+
+    // Chunks run for PGN_CHUNK_SIZE bytes, and then until the start of the
+    // next game. Each game begins with a header line after a blank line,
+    // which may end with either "\n" or "\r\n"
+
+    if (end - start <= PGN_CHUNK_SIZE)
+        return end;
+
+    for (const char *ptr = start + PGN_CHUNK_SIZE; ptr + 2 < end; ptr++) {
+        const char *next = ptr + 1 + (ptr[1] == '\r');
+        if (ptr[0] == '\n' && next + 1 < end && next[0] == '\n' && next[1] == '[')
+            return next + 1;
+    }
+
+    return end;
+}
+
+static void* pgn_worker(void *vbatch) {
+
+    PGNBatch *const batch = (PGNBatch*) vbatch;
 
     Board board;
-    while (process_next_pgn(pgn, bindata, data, samples, &board));
-    fclose(pgn); fclose(bindata); free(data); free(samples);
+    PGNChunk chunk;
+    int index, placed, games, capacity = PGN_MAX_SAMPLES;
+
+    PGNData *data = calloc(1, sizeof(PGNData));
+    // Chained games are encoded directly, and never build any HalfKPSamples
+    NNChainBuffer chain = {0}, *chained = batch->chained ? &chain : NULL;
+    HalfKPSample *samples = batch->chained ? NULL : malloc(sizeof(HalfKPSample) * capacity);
+
+    while (1) {
+
+        // Claim the next chunk of games, along with its place in the output
+        pthread_mutex_lock(&batch->lock);
+        chunk.ptr = batch->next;
+        chunk.end = batch->next = pgn_chunk_end(batch->next, batch->end);
+        index = batch->chunks++;
+        pthread_mutex_unlock(&batch->lock);
+
+        if (chunk.ptr == chunk.end) break;
+
+        for (placed = games = chain.size = 0; chunk.ptr < chunk.end; games++) {
+
+            // Leave room for the longest of games before starting each one
+            if (samples != NULL && capacity - placed < PGN_MAX_SAMPLES)
+                samples = realloc(samples, sizeof(HalfKPSample) * (capacity *= 2));
+
+            if (!process_next_pgn(&chunk, data, samples, chained, &placed, &board))
+                break;
+        }
+
+        // Ordered output has each chunk wait for those before it to be written
+        pthread_mutex_lock(&batch->lock);
+        while (batch->ordered && batch->written != index)
+            pthread_cond_wait(&batch->turn, &batch->lock);
+
+        if (batch->chained)
+            fwrite(chain.data, 1, chain.size, batch->bindata);
+        else fwrite(samples, sizeof(HalfKPSample), placed, batch->bindata);
+
+        batch->games += games, batch->samples += placed, batch->written++;
+
+        pthread_cond_broadcast(&batch->turn);
+        pthread_mutex_unlock(&batch->lock);
+    }
+
+    free(data->startpos);
+    free(data); free(samples); free(chain.data);
+    return NULL;
+}
+
+
+void process_pgn(const char *fin, const char *fout, int nthreads, bool ordered, bool chained) {
+
+    // The PGN is mapped into memory, and split into chunks of whole games.
+    // Threads parse chunks as a work queue, writing out all of a chunk's
+    // samples at once. Ordered output matches what one Thread would write.
+    // Samples are either HalfKPSamples, or chained together by game
+
+    size_t size = 0;
+    pthread_t pthreads[nthreads];
+    double start = get_real_time();
+
+    PGNBatch batch = {0};
+    batch.data    = nndata_map_file(fin, &size);
+    batch.bindata = fopen(fout, "wb");
+    batch.ordered = ordered;
+    batch.chained = chained;
+
+    if (batch.data == NULL || batch.bindata == NULL) {
+        printf("Unable to open %s or %s\n", fin, fout);
+        exit(EXIT_FAILURE);
+    }
+
+    if (chained)
+        fwrite(NNCHAIN_MAGIC, 1, strlen(NNCHAIN_MAGIC), batch.bindata);
+
+    batch.next = batch.data;
+    batch.end  = batch.data + size;
+    pthread_mutex_init(&batch.lock, NULL);
+    pthread_cond_init(&batch.turn, NULL);
+
+    for (int i = 0; i < nthreads; i++)
+        pthread_create(&pthreads[i], NULL, pgn_worker, &batch);
+
+    for (int i = 0; i < nthreads; i++)
+        pthread_join(pthreads[i], NULL);
+
+    const double elapsed = get_real_time() - start;
+    printf("Processed %"PRIu64" games in %dms, %"PRIu64" samples, %d MB/second\n",
+        batch.games, (int) elapsed, batch.samples, (int) (1000.0 * size / (1 << 20) / (elapsed + 1)));
+
+    pthread_mutex_destroy(&batch.lock);
+    pthread_cond_destroy(&batch.turn);
+    nndata_unmap_file((void*) batch.data, size);
+    fclose(batch.bindata);
 }
@@ -18,12 +18,33 @@
 
 #pragma once
 
+#include <pthread.h>
 #include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
 
 #include "types.h"
 
+/// Ethereal's NNUE Data Format
+
+typedef struct HalfKPSample {
+    uint64_t occupied;   // 8-byte occupancy bitboard ( No Kings )
+    int16_t  eval;       // 2-byte int for the target evaluation
+    uint8_t  result;     // 1-byte int for result. { L=0, D=1, W=2 }
+    uint8_t  turn;       // 1-byte int for the side-to-move flag
+    uint8_t  wking;      // 1-byte int for the White King Square
+    uint8_t  bking;      // 1-byte int for the Black King Square
+    uint8_t  packed[15]; // 1-byte int per two non-King pieces
+} HalfKPSample;
+
 enum { PGN_LOSS, PGN_DRAW, PGN_WIN, PGN_NO_RESULT, PGN_UNKNOWN_RESULT };
 
+/// PGNs are converted in chunks of PGN_CHUNK_SIZE bytes, always holding whole
+/// games, by a pool of Threads. The largest number of samples from one game
+/// is assumed to be PGN_MAX_SAMPLES, as a game is a single line of the PGN
+
+enum { PGN_CHUNK_SIZE = 16 << 20, PGN_MAX_SAMPLES = 1024 };
+
 typedef struct PGNData {
     char *startpos;
     bool is_white, is_black;
@@ -31,4 +52,24 @@ typedef struct PGNData {
     char buffer[65536];
 } PGNData;
 
-void process_pgn(const char *fin, const char *fout);
+typedef struct PGNChunk {
+    const char *ptr, *end;
+} PGNChunk;
+
+typedef struct PGNBatch {
+    const char *data, *next, *end;
+    FILE *bindata;
+    bool ordered, chained;
+    int chunks, written;
+    uint64_t games, samples;
+    pthread_mutex_t lock;
+    pthread_cond_t turn;
+} PGNBatch;
+
+void build_halfkp_sample(Board *board, HalfKPSample *sample, unsigned result, int16_t eval);
+bool halfkp_sample_is_quiet(Board *board, uint16_t move, int eval);
+
+void* nndata_map_file(const char *fname, size_t *size);
+void nndata_unmap_file(void *data, size_t size);
+
+void process_pgn(const char *fin, const char *fout, int nthreads, bool ordered, bool chained);
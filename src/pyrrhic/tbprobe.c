@@ -253,6 +253,7 @@ static void unmap_file(void *data, map_t mapping)
 
 int TB_MaxCardinality = 0, TB_MaxCardinalityDTM = 0;
 int TB_LARGEST = 0;
+int TB_LAZY_OPENS = 0;
 
 static const char *tbSuffix[] = { ".rtbw", ".rtbm", ".rtbz" };
 static uint32_t tbMagic[] = { 0x5d23e871, 0x88ac504b, 0xa50c66d7 };
@@ -286,6 +287,7 @@ struct EncInfo {
 
 struct BaseEntry {
   uint64_t key;
+  char name[16];
   uint8_t *data[3];
   map_t mapping[3];
 #ifdef __cplusplus
@@ -542,6 +544,7 @@ static void init_tb(char *str)
                                   : &pieceEntry[tbNumPiece++].be;
   be->hasPawns = hasPawns;
   be->key = key;
+  snprintf(be->name, sizeof(be->name), "%s", str);
   be->symmetric = key == key2;
   be->num = 0;
   for (int i = 0; i < 16; i++)
@@ -619,6 +622,7 @@ bool tb_init(const char *path)
   }
 
   TB_LARGEST = 0;
+  TB_LAZY_OPENS = 0;
 
   // if pathString is set, we need to clean up first.
   if (pathString) {
@@ -791,6 +795,52 @@ void tb_free(void)
   free(pawnEntry);
 }
 
+static bool init_table(struct BaseEntry *be, const char *str, int type);
+
+static bool preload_table(struct BaseEntry *be, int type, tb_preload_func func, void *arg)
+{
+  // Same double-checked locking as probe_table(), against concurrent probes
+  if (!atomic_load_explicit(&be->ready[type], memory_order_acquire)) {
+    LOCK(tbMutex);
+    if (!atomic_load_explicit(&be->ready[type], memory_order_relaxed)) {
+      if (!init_table(be, be->name, type)) {
+        UNLOCK(tbMutex);
+        return true;
+      }
+      atomic_store_explicit(&be->ready[type], true, memory_order_release);
+    }
+    UNLOCK(tbMutex);
+  }
+
+#ifndef _WIN32
+  return func(be->data[type], (size_t)be->mapping[type], arg);
+#else
+  return func(be->data[type], 0, arg);
+#endif
+}
+
+int tb_preload(unsigned wdl, unsigned dtz, tb_preload_func func, void *arg)
+{
+  int count = 0;
+  const int types[] = { WDL, DTZ };
+
+  for (int t = 0; t < 2; t++) {
+    const int type = types[t];
+    const unsigned limit = type == WDL ? wdl : dtz;
+    for (int i = 0; i < tbNumPiece + tbNumPawn; i++) {
+      struct BaseEntry *be = i < tbNumPiece ? &pieceEntry[i].be
+                                            : &pawnEntry[i - tbNumPiece].be;
+      if (be->num > limit || (type == DTZ && !be->hasDtz))
+        continue;
+      if (!preload_table(be, type, func, arg))
+        return count;
+      count += atomic_load_explicit(&be->ready[type], memory_order_relaxed);
+    }
+  }
+
+  return count;
+}
+
 static const int8_t OffDiag[] = {
   0,-1,-1,-1,-1,-1,-1,-1,
   1, 0,-1,-1,-1,-1,-1,-1,
@@ -1545,6 +1595,7 @@ int probe_table(const PyrrhicPosition *pos, int s, int *success, const int type)
         return 0;
       }
       atomic_store_explicit(&be->ready[type], true, memory_order_release);
+      TB_LAZY_OPENS++;
     }
     UNLOCK(tbMutex);
   }
@@ -118,6 +118,25 @@ bool tb_init(const char *_path);
  */
 void tb_free(void);
 
+/*
+ * Map tables ahead of their first probe, rather than lazily on demand.
+ *
+ * PARAMETERS:
+ * - wdl, dtz:
+ *   The largest number of pieces for which WDL and DTZ tables are mapped.
+ * - func:
+ *   Called with each mapped table, its size in bytes (zero where unknown),
+ *   and arg. Returning false stops the preload early.
+ *
+ * RETURN:
+ * - The number of tables handed to func.  Tables opened lazily by probes are
+ *   counted in TB_LAZY_OPENS, so callers may judge how often probes stalled.
+ */
+typedef bool (*tb_preload_func)(const void *data, size_t size, void *arg);
+int tb_preload(unsigned wdl, unsigned dtz, tb_preload_func func, void *arg);
+
+extern int TB_LAZY_OPENS;
+
 /*
  * Probe the Win-Draw-Loss (WDL) table.
  *
@@ -19,7 +19,6 @@
 #include <assert.h>
 #include <inttypes.h>
 #include <math.h>
-#include <pthread.h>
 #include <setjmp.h>
 #include <stdbool.h>
 #include <stdio.h>
@@ -30,6 +29,7 @@
 #include "attacks.h"
 #include "bitboards.h"
 #include "board.h"
+#include "cluster.h"
 #include "evaluate.h"
 #include "pyrrhic/tbprobe.h"
 #include "history.h"
@@ -37,6 +37,7 @@
 #include "movegen.h"
 #include "movepicker.h"
 #include "search.h"
+#include "searchstats.h"
 #include "syzygy.h"
 #include "thread.h"
 #include "timeman.h"
@@ -45,6 +46,8 @@
 #include "uci.h"
 #include "windows.h"
 
+#include "nnue/accumulator.h"
+
 int LMRTable[64][64];
 int LateMovePruningCounts[2][11];
 
@@ -52,8 +55,113 @@ volatile int ABORT_SIGNAL; // Global ABORT flag for threads
 volatile int IS_PONDERING; // Global PONDER flag for threads
 volatile int ANALYSISMODE; // Whether to make some changes for Analysis
 
+int HelperSchedule = HELPER_SCHEDULE_NONE; // Set by UCI options
+static int DepthSearchers[MAX_PLY]; // Threads currently on each depth
+
+extern int PerfCountersEnabled; // Defined by perfcounters.c
+
+int ParallelMultiPV = 0; // Set by UCI options
+static pthread_mutex_t RootLinesLock = PTHREAD_MUTEX_INITIALIZER;
+static PVariation RootLines[MAX_MOVES]; // Best known line for each root move,
+static int RootDepths[MAX_MOVES];       // and the depth it was found with, sorted
+static int RootLineCount;               // by depth then score, shared by all Threads
+
+int CarrySearch = 0; // Set by UCI options
+int CarryDepth  = 0; // Set by UCI options
+
+typedef struct SearchCarry {
+    bool valid;
+    Board board;   // Root of a search, along with
+    PVariation pv; // the line reported, and the depth
+    int depth;     // that line was completed to
+} SearchCarry;
+
+static SearchCarry Carry[2]; // The last two searches, most recent first
+static bool CarryAge;        // Histories are aged, and killers shifted,
+static int CarryShift;       // by the plies played since the last root
+static int StartDepth = 1;   // First iteration of each Thread, when carried deeper
+static uint16_t CarryMove;   // Stands in at the root, when the Table has no move
+static PVariation CarryLine; // Carried line of play, starting from the new root
+
+static int search_root(Thread *thread, PVariation *pv, int alpha, int beta, int depth, bool cutnode);
+static int search_pv(Thread *thread, PVariation *pv, int alpha, int beta, int depth, bool cutnode);
+static int search_nonpv(Thread *thread, PVariation *pv, int alpha, int beta, int depth, bool cutnode);
+
+
+static int parallel_multipv(Thread *thread) {
+
+    // Threads are split into groups, one per MultiPV line, given enough Threads
+    return ParallelMultiPV
+        && thread->limits->multiPV > 1
+        && thread->nthreads >= thread->limits->multiPV;
+}
+
+static int first_line(Thread *thread) {
+
+    // Each Thread searches all lines, or just the one line given to its group
+    return parallel_multipv(thread) ? thread->index % thread->limits->multiPV : 0;
+}
+
+static void share_root_line(Thread *thread, PVariation *pv) {
+
+    /// A Thread has finished an iteration for its line in a parallel MultiPV
+    /// search. Replace the entry for the line's root move, unless it is from
+    /// a deeper search, and then re-insert it such that the lines stay sorted.
+    /// Deeper lines come first, so that a line which no group is refreshing
+    /// anymore sinks, rather than keeping a stale score at the top forever
+
+    int i;
+
+    pthread_mutex_lock(&RootLinesLock);
+
+    for (i = 0; i < RootLineCount; i++)
+        if (RootLines[i].line[0] == pv->line[0])
+            break;
+
+    if (i == RootLineCount || RootDepths[i] <= thread->depth) {
+
+        // Remove the old entry, if there was one, by shifting up the rest
+        if (i < RootLineCount) {
+            const int after = --RootLineCount - i;
+            memmove(&RootLines[i],  &RootLines[i+1],  sizeof(PVariation) * after);
+            memmove(&RootDepths[i], &RootDepths[i+1], sizeof(int) * after);
+        }
+
+        // Shift down any worse lines to make room for the new entry
+        for (i = RootLineCount++; i > 0; i--) {
+
+            if (    RootDepths[i-1] > thread->depth
+                || (RootDepths[i-1] == thread->depth && RootLines[i-1].score >= pv->score))
+                break;
+
+            RootLines[i]  = RootLines[i-1];
+            RootDepths[i] = RootDepths[i-1];
+        }
+
+        RootLines[i]  = *pv;
+        RootDepths[i] = thread->depth;
+    }
+
+    pthread_mutex_unlock(&RootLinesLock);
+}
+
+static void fetch_better_lines(Thread *thread) {
+
+    /// Before searching line N of a parallel MultiPV search, gather the root
+    /// moves of the N best lines known so far. moveExaminedByMultiPV() will
+    /// then exclude them at the root, exactly as in a serial MultiPV search
+
+    pthread_mutex_lock(&RootLinesLock);
+
+    for (int i = 0; i < thread->multiPV; i++)
+        thread->bestMoves[i] = i < RootLineCount ? RootLines[i].line[0] : NONE_MOVE;
+
+    pthread_mutex_unlock(&RootLinesLock);
+}
+
+
 
-static void select_from_threads(Thread *threads, uint16_t *best, uint16_t *ponder, int *score) {
+static void select_from_threads(Thread *threads, const Board *board, uint16_t *best, uint16_t *ponder, int *score) {
 
     /// A thread is better than another if any are true:
     /// [1] The thread has an equal depth and greater score.
@@ -62,6 +170,14 @@ static void select_from_threads(Thread *threads, uint16_t *best, uint16_t *ponde
 
     Thread *best_thread = &threads[0];
 
+    // Parallel MultiPV searches have already merged every Thread's lines
+    if (parallel_multipv(threads) && RootLineCount) {
+        *best   = RootLines[0].line[0];
+        *ponder = RootLines[0].length < 2 ? NONE_MOVE : RootLines[0].line[1];
+        *score  = RootLines[0].score;
+        return;
+    }
+
     for (int i = 1; i < threads->nthreads; i++) {
 
         const int best_depth = best_thread->completed;
@@ -88,6 +204,13 @@ static void select_from_threads(Thread *threads, uint16_t *best, uint16_t *ponde
     if (best_thread->pvs[best_thread->completed].length < 2)
         *ponder = NONE_MOVE;
 
+    // Peers of a cluster may have searched the same root even deeper
+    int depth = best_thread->completed;
+    if (threads->limits->multiPV == 1 && cluster_select(threads, board, &depth, score, best, ponder)) {
+        printf("info string cluster peer bestmove at depth %d\n", depth);
+        return;
+    }
+
     // Report via UCI when our best thread is not the main thread
     if (best_thread != &threads[0]) {
         const int best_depth = best_thread->completed;
@@ -102,7 +225,7 @@ static void update_best_line(Thread *thread, PVariation *pv) {
     /// this Thread's line of best play for the newly completed depth.
     /// We store seperately the lines that we explore in multipv searches
 
-    if (  !thread->multiPV
+    if (   thread->multiPV == first_line(thread)
         || pv->score > thread->pvs[thread->completed].score) {
 
         thread->completed = thread->depth;
@@ -118,35 +241,214 @@ static void revert_best_line(Thread *thread) {
     /// to remove any fail-highs that we may have originally marked as best
     /// lines, since we now believe the line to much worse than before
 
-    if (!thread->multiPV)
+    if (thread->multiPV == first_line(thread))
         thread->completed = thread->depth - 1;
 }
 
+static int skip_this_depth(Thread *thread) {
+
+    /// Helpers may skip over some iterations, in order to spread out the
+    /// depths being searched, rather than relying on TT races alone. Either
+    /// each helper follows a fixed pattern based on its index, or helpers
+    /// avoid any depth that at least half of the Thread Pool is already on
+
+    static const int SkipSize[]  = { 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4 };
+    static const int SkipPhase[] = { 0, 1, 0, 1, 2, 3, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 6, 7 };
+
+    const int index = (thread->index - 1) % 20;
+
+    // The main thread, and the first iteration, are never skipped
+    if (thread->index == 0 || thread->depth == 1)
+        return 0;
+
+    if (HelperSchedule == HELPER_SCHEDULE_SKIP)
+        return ((thread->depth + SkipPhase[index]) / SkipSize[index]) % 2;
+
+    if (HelperSchedule == HELPER_SCHEDULE_BUSY)
+        return __atomic_load_n(&DepthSearchers[thread->depth], __ATOMIC_RELAXED) >= thread->nthreads / 2;
+
+    return 0;
+}
+
 static void report_multipv_lines(Thread *thread) {
 
     /// We've just finished a depth during a MultiPV search. Now we will
     /// once again report the lines, but this time ordering them based on
     /// their scores. It is possible, although generally unusual, for a
     /// move searched later to have a better score than an earlier move.
+    /// Parallel MultiPV searches instead report the shared lines, in their
+    /// existing order, which may be missing a few early on in the search
+
+    int lines = thread->limits->multiPV;
+
+    if (parallel_multipv(thread)) {
+        pthread_mutex_lock(&RootLinesLock);
+        lines = MIN(lines, RootLineCount);
+        memcpy(thread->mpvs, RootLines, sizeof(PVariation) * lines);
+        pthread_mutex_unlock(&RootLinesLock);
+    }
+
+    else {
 
-    for (int i = 0; i < thread->limits->multiPV; i++) {
+        for (int i = 0; i < lines; i++) {
 
-        for (int j = i + 1; j < thread->limits->multiPV; j++) {
+            for (int j = i + 1; j < lines; j++) {
 
-            if (thread->mpvs[j].score > thread->mpvs[i].score) {
-                PVariation localpv;
-                memcpy(&localpv,         &thread->mpvs[i], sizeof(PVariation));
-                memcpy(&thread->mpvs[i], &thread->mpvs[j], sizeof(PVariation));
-                memcpy(&thread->mpvs[j], &localpv        , sizeof(PVariation));
+                if (thread->mpvs[j].score > thread->mpvs[i].score) {
+                    PVariation localpv;
+                    memcpy(&localpv,         &thread->mpvs[i], sizeof(PVariation));
+                    memcpy(&thread->mpvs[i], &thread->mpvs[j], sizeof(PVariation));
+                    memcpy(&thread->mpvs[j], &localpv        , sizeof(PVariation));
+                }
             }
         }
     }
 
-    for (thread->multiPV = 0; thread->multiPV < thread->limits->multiPV; thread->multiPV++)
+    for (thread->multiPV = 0; thread->multiPV < lines; thread->multiPV++)
         uciReport(thread->threads, &thread->mpvs[thread->multiPV], -MATE, MATE);
 }
 
 
+static int carry_distance(const Board *from, uint64_t target) {
+
+    // Plies from one root to another, when at most two apart, otherwise -1.
+    // The search is over our own copy, so it may be left as it is when found
+
+    Board board;
+    Undo undo[2];
+    uint16_t moves[MAX_MOVES], replies[MAX_MOVES];
+
+    if (from->hash == target)
+        return 0;
+
+    memcpy(&board, from, sizeof(Board));
+    board.thread = NULL;
+
+    for (int i = 0, size = genAllLegalMoves(&board, moves); i < size; i++) {
+
+        applyMove(&board, moves[i], &undo[0]);
+
+        if (board.hash == target)
+            return 1;
+
+        for (int j = 0, count = genAllLegalMoves(&board, replies); j < count; j++) {
+            applyMove(&board, replies[j], &undo[1]);
+            if (board.hash == target) return 2;
+            revertMove(&board, replies[j], &undo[1]);
+        }
+
+        revertMove(&board, moves[i], &undo[0]);
+    }
+
+    return -1;
+}
+
+static bool carry_followed(const Board *board, int plies) {
+
+    // Does the last line of play lead from its root to this one
+
+    Board copy;
+    Undo undo[1];
+
+    if (Carry[0].pv.length <= plies)
+        return false;
+
+    memcpy(&copy, &Carry[0].board, sizeof(Board));
+    copy.thread = NULL;
+
+    for (int i = 0; i < plies; i++)
+        applyMove(&copy, Carry[0].pv.line[i], undo);
+
+    return copy.hash == board->hash;
+}
+
+static void carry_prepare(Thread *threads, const Board *board, const Limits *limits) {
+
+    /// Consider everything which may be carried over from the last searches of
+    /// this game, which we find by their roots being within two plies of this
+    /// one. Checking the last two roots covers a ponder miss, where the ponder
+    /// search was of a sibling of this root. Histories are aged, and killers
+    /// moved by the plies played, unless this root was just searched. Root move
+    /// ordering, and optionally the start depth, come from the last line of play
+    /// when this root is on it
+
+    int plies = -1, last;
+
+    CarryAge = false, CarryShift = 0, StartDepth = 1, CarryMove = NONE_MOVE;
+
+    for (last = 0; CarrySearch && last < 2; last++)
+        if (Carry[last].valid && (plies = carry_distance(&Carry[last].board, board->hash)) != -1)
+            break;
+
+    if (plies == -1)
+        return;
+
+    CarryAge   = last > 0 || plies > 0;
+    CarryShift = last == 0 ? plies : 0;
+
+    if (   last != 0 || !carry_followed(board, plies)
+        || !moveIsInRootMoves(threads, Carry[0].pv.line[plies]))
+        return;
+
+    // An odd number of plies leaves the other side to move
+    CarryLine.length = Carry[0].pv.length - plies;
+    CarryLine.score  = plies % 2 ? -Carry[0].pv.score : Carry[0].pv.score;
+    memcpy(CarryLine.line, Carry[0].pv.line + plies, sizeof(uint16_t) * CarryLine.length);
+    CarryMove = CarryLine.line[0];
+
+    // Optionally resume a few plies below the depth already reached
+    if (CarryDepth && limits->multiPV == 1 && !limits->limitedByMoves) {
+        StartDepth = MAX(1, Carry[0].depth - plies - CarryDepth);
+        if (limits->limitedByDepth) StartDepth = MIN(StartDepth, limits->depthLimit);
+    }
+}
+
+static void carry_thread(Thread *thread) {
+
+    // A search of another root of this game leaves stale histories behind
+    if (CarryAge) age_history_heuristics(thread, CarryShift);
+
+    // When skipping iterations, each skipped iteration "found" the carried line
+    if (StartDepth > 1) {
+
+        for (int depth = 0; depth < StartDepth; depth++) {
+            memcpy(&thread->pvs[depth], &CarryLine, sizeof(PVariation));
+            thread->depthNodes[depth] = 0, thread->depthTimes[depth] = 0.0;
+        }
+
+        thread->completed = StartDepth - 1;
+    }
+}
+
+static void carry_save(Thread *threads, const Board *board, uint16_t best, uint16_t ponder, int score) {
+
+    // Keep the main thread's line, unless the best move came from elsewhere
+
+    const PVariation *pv = &threads->pvs[threads->completed];
+
+    memcpy(&Carry[1], &Carry[0], sizeof(Carry[0]));
+    memcpy(&Carry[0].board, board, sizeof(Board));
+    Carry[0].board.thread = NULL;
+    Carry[0].depth = threads->completed;
+    Carry[0].valid = best != NONE_MOVE;
+
+    if (pv->length && pv->line[0] == best)
+        memcpy(&Carry[0].pv, pv, sizeof(PVariation));
+
+    else {
+        Carry[0].pv.length  = 1 + (ponder != NONE_MOVE);
+        Carry[0].pv.line[0] = best, Carry[0].pv.line[1] = ponder;
+    }
+
+    Carry[0].pv.score = score;
+}
+
+void clearSearchCarry() {
+
+    // Each game, and each position of the benchmark, starts afresh
+    Carry[0].valid = Carry[1].valid = false;
+}
+
 void initSearch() {
 
     // Init Late Move Reductions Table
@@ -171,8 +473,19 @@ void *start_search_threads(void *arguments) {
     char str[6];
     uint16_t best = NONE_MOVE, ponder = NONE_MOVE;
 
+    TTStats stats;
+
     // Execute search, setting best and ponder moves
     getBestMove(threads, board, limits, &best, &ponder, &score);
+    uciFlushReports(); // Send the final PV, if held back by ReportInterval
+
+    // Report how the Table, PK tables and Tablebases fared during the search
+    statsThreadPool(threads, &stats);
+    tt_report_stats(&stats);
+    tablebasesReport();
+    cluster_report_stats();
+    if (PerfCountersEnabled) perf_counters_report_threads(threads);
+    if (USE_SEARCH_STATS) search_stats_report(threads), search_stats_clear(threads);
 
     // UCI spec does not want reports until out of pondering
     while (IS_PONDERING);
@@ -190,38 +503,47 @@ void *start_search_threads(void *arguments) {
     // Make sure this all gets reported
     printf("\n"); fflush(stdout);
 
+    // Measure the time between the end of the search and the flush
+    tm_overhead_sample(limits, get_real_time());
+
     return NULL;
 }
 
 void getBestMove(Thread *threads, Board *board, Limits *limits, uint16_t *best, uint16_t *ponder, int *score) {
 
-    pthread_t pthreads[threads->nthreads];
     TimeManager tm = {0}; tm_init(limits, &tm);
 
     // Minor house keeping for starting a search
     tt_update(); // Table has an age component
+    tablebasesApplyCache(); // Any SyzygyCache size set since the last search
     ABORT_SIGNAL = 0; // Otherwise Threads will exit
     newSearchThreadPool(threads, board, limits, &tm);
+    cluster_new_search(board->hash); // Accept peers' Entries and statuses
+    memset(DepthSearchers, 0, sizeof(DepthSearchers));
+    RootLineCount = 0;
 
     // Allow Syzygy to refine the move list for optimal results
     if (!limits->limitedByMoves && limits->multiPV == 1)
         tablebasesProbeDTZ(board, limits);
 
-    // Create a new thread for each of the helpers and reuse the current
-    // thread for the main thread, which avoids some overhead and saves
-    // us from having the current thread eating CPU time while waiting
-    for (int i = 1; i < threads->nthreads; i++)
-        pthread_create(&pthreads[i], NULL, &iterativeDeepening, &threads[i]);
+    // Carry over what we can from the last search of this game
+    carry_prepare(threads, board, limits);
+
+    // Wake each of the parked helpers and reuse the current thread
+    // for the main thread, which avoids some overhead and saves us
+    // from having the current thread eating CPU time while waiting
+    startSearchThreadPool(threads);
     iterativeDeepening((void*) &threads[0]);
 
     // When the main thread exits it should signal for the helpers to
-    // shutdown. Wait until all helpers have finished before moving on
+    // shutdown. Wait until all helpers have parked before moving on
     ABORT_SIGNAL = 1;
-    for (int i = 1; i < threads->nthreads; i++)
-        pthread_join(pthreads[i], NULL);
+    waitSearchThreadPool(threads);
 
-    // Pick the best of our completed threads
-    select_from_threads(threads, best, ponder, score);
+    // Pick the best of our completed threads, or of our peers
+    select_from_threads(threads, board, best, ponder, score);
+    cluster_end_search();
+    carry_save(threads, board, *best, *ponder, *score);
 }
 
 void* iterativeDeepening(void *vthread) {
@@ -231,12 +553,20 @@ void* iterativeDeepening(void *vthread) {
     Limits *const limits  = thread->limits;
     const int mainThread  = thread->index == 0;
 
-    // Bind when we expect to deal with NUMA
-    if (thread->nthreads > 8)
-        bindThisThread(thread->index);
+    // Bind when we expect to deal with NUMA, and otherwise undo the binding
+    // of a larger Pool. Helpers were (un)bound when creating the Thread Pool
+    if (mainThread)
+        nnue_bind_evaluator(thread->nnue, thread->nthreads > 8
+            ? bindThisThread(thread->index) : unbindThisThread());
+
+    // Count the work of this Thread alone, when requested
+    perf_counters_start(&thread->perf);
+
+    // Age the histories, and seed any skipped iterations
+    carry_thread(thread);
 
     // Perform iterative deepening until exit conditions
-    for (thread->depth = 1; thread->depth < MAX_PLY; thread->depth++) {
+    for (thread->depth = StartDepth; thread->depth < MAX_PLY; thread->depth++) {
 
         // If we abort to here, we stop searching
         #if defined(_WIN32) || defined(_WIN64)
@@ -245,13 +575,40 @@ void* iterativeDeepening(void *vthread) {
         if (setjmp(thread->jbuffer)) break;
         #endif
 
-        // Perform a search for the current depth for each requested line of play
-        for (thread->multiPV = 0; thread->multiPV < limits->multiPV; thread->multiPV++)
+        // Helpers skipping an iteration keep their last line in its place,
+        // since a later fail low will revert to the previous depth's line
+        if (skip_this_depth(thread)) {
+            memcpy(&thread->pvs[thread->depth], &thread->pvs[thread->completed], sizeof(PVariation));
+            continue;
+        }
+
+        // Perform a search for the current depth for each requested line of play,
+        // unless this Thread's group has been given just one line of a MultiPV search.
+        // Both are found after the setjmp(), so that no longjmp() may clobber them
+        const int parallel = parallel_multipv(thread);
+        const int lines    = parallel ? first_line(thread) + 1 : limits->multiPV;
+
+        __atomic_fetch_add(&DepthSearchers[thread->depth], 1, __ATOMIC_RELAXED);
+        for (thread->multiPV = first_line(thread); thread->multiPV < lines; thread->multiPV++) {
+            if (parallel) fetch_better_lines(thread);
             aspirationWindow(thread);
+            if (parallel) share_root_line(thread, &thread->mpvs[thread->multiPV]);
+        }
+        __atomic_fetch_sub(&DepthSearchers[thread->depth], 1, __ATOMIC_RELAXED);
+
+        // Send out any deep Entries still held back for a cluster's peers
+        cluster_flush(thread);
 
         // Helper threads need not worry about time and search info updates
         if (!mainThread) continue;
 
+        // Track nodes and time to depth, for the benchmark's scaling report
+        thread->depthNodes[thread->depth] = nodesSearchedThreadPool(thread->threads);
+        thread->depthTimes[thread->depth] = elapsed_time(tm);
+
+        // Let any peers of a cluster know how far we have come
+        cluster_report(thread);
+
         // We delay reporting during MultiPV searches
         if (limits->multiPV > 1) report_multipv_lines(thread);
 
@@ -268,6 +625,11 @@ void* iterativeDeepening(void *vthread) {
             break;
     }
 
+    // Mark when the search ended, for measuring lag in reporting the result
+    if (mainThread) limits->stopped = get_real_time();
+
+    cluster_flush(thread);
+    perf_counters_stop(&thread->perf);
     return NULL;
 }
 
@@ -276,7 +638,7 @@ void aspirationWindow(Thread *thread) {
     PVariation pv;
     int depth  = thread->depth;
     int alpha  = -MATE, beta = MATE, delta = WindowSize;
-    int report = !thread->index && thread->limits->multiPV == 1;
+    int report = !thread->index && thread->limits->multiPV == 1 && !thread->limits->silent;
 
     // After a few depths use a previous result to form the window
     if (thread->depth >= WindowDepth) {
@@ -287,7 +649,7 @@ void aspirationWindow(Thread *thread) {
     while (1) {
 
         // Perform a search and consider reporting results
-        pv.score = search(thread, &pv, alpha, beta, MAX(1, depth), FALSE);
+        pv.score = search_root(thread, &pv, alpha, beta, MAX(1, depth), FALSE);
         if (   (report && pv.score > alpha && pv.score < beta)
             || (report && elapsed_time(thread->tm) >= WindowTimerMS))
             uciReport(thread->threads, &pv, alpha, beta);
@@ -299,6 +661,9 @@ void aspirationWindow(Thread *thread) {
             return;
         }
 
+        // Count the re-search which is about to be made
+        SEARCH_STAT_RESEARCH(thread, pv.score >= beta);
+
         // Search failed low, adjust window and reset depth
         if (pv.score <= alpha) {
             beta  = (alpha + beta) / 2;
@@ -319,14 +684,25 @@ void aspirationWindow(Thread *thread) {
     }
 }
 
+/// The search is specialized, at compile time, for the kind of node being
+/// searched. search_node() holds the one body, forced inline into a variant
+/// for the root, for PV nodes, and for non-PV nodes, so that the compiler may
+/// drop every branch which cannot be taken. Null window searches are known to
+/// be non-PV nodes, and go straight to that variant, which is the hot path
+
 int search(Thread *thread, PVariation *pv, int alpha, int beta, int depth, bool cutnode) {
 
+    // Derive the kind of node exactly as the body once did, at runtime
+    return thread->height == 0 ? search_root (thread, pv, alpha, beta, depth, cutnode)
+         : alpha != beta - 1   ? search_pv   (thread, pv, alpha, beta, depth, cutnode)
+         :                       search_nonpv(thread, pv, alpha, beta, depth, cutnode);
+}
+
+INLINE int search_node(Thread *thread, PVariation *pv, int alpha, int beta, int depth, bool cutnode, const int PvNode, const int RootNode) {
+
     Board *const board   = &thread->board;
     NodeState *const ns  = &thread->states[thread->height];
 
-    const int PvNode     = (alpha != beta - 1);
-    const int RootNode   = (thread->height == 0);
-
     unsigned tbresult;
     int hist = 0, cmhist = 0, fmhist = 0;
     int movesSeen = 0, quietsPlayed = 0, capturesPlayed = 0, played = 0;
@@ -341,7 +717,7 @@ int search(Thread *thread, PVariation *pv, int alpha, int beta, int depth, bool
 
     // Step 1. Quiescence Search. Perform a search using mostly tactical
     // moves to reach a more stable position for use as a static evaluation
-    if (depth <= 0 && !board->kingAttackers)
+    if (depth <= 0 && !boardKingAttackers(board))
         return qsearch(thread, pv, alpha, beta);
 
     // Ensure a fresh PV
@@ -353,6 +729,7 @@ int search(Thread *thread, PVariation *pv, int alpha, int beta, int depth, bool
     // Updates for UCI reporting
     thread->seldepth = RootNode ? 0 : MAX(thread->seldepth, thread->height);
     thread->nodes++;
+    SEARCH_STAT(thread, depth, SS_NODES);
 
     // Step 2. Abort Check. Exit the search if signaled by main thread or the
     // UCI thread, or if the search time has expired outside pondering mode
@@ -368,9 +745,16 @@ int search(Thread *thread, PVariation *pv, int alpha, int beta, int depth, bool
         // material. Add variance to the draw score, to avoid blindness to 3-fold lines
         if (boardIsDrawn(board, thread->height)) return 1 - (thread->nodes & 2);
 
+        // Upcoming Repetition. When we could repeat a position with a reversible
+        // move, we can claim at least a draw, which may be enough for a cutoff
+        if (alpha < 0 && boardHasGameCycle(board, thread->height)) {
+            oldAlpha = alpha = 1 - (thread->nodes & 2);
+            if (alpha >= beta) return alpha;
+        }
+
         // Check to see if we have exceeded the maxiumum search draft
         if (thread->height >= MAX_PLY)
-            return board->kingAttackers ? 0 : evaluateBoard(thread, board);
+            return boardKingAttackers(board) ? 0 : evaluateBoard(thread, board);
 
         // Mate Distance Pruning. Check to see if this line is so
         // good, or so bad, that being mated in the ply, or  mating in
@@ -385,7 +769,7 @@ int search(Thread *thread, PVariation *pv, int alpha, int beta, int depth, bool
         goto search_init_goto;
 
     // Step 4. Probe the Transposition Table, adjust the value, and consider cutoffs
-    if ((ttHit = tt_probe(board->hash, thread->height, &ttMove, &ttValue, &ttEval, &ttDepth, &ttBound))) {
+    if ((ttHit = tt_probe(thread, board->hash, &ttMove, &ttValue, &ttEval, &ttDepth, &ttBound))) {
 
         // Only cut with a greater depth search, and do not return
         // when in a PvNode, unless we would otherwise hit a qsearch
@@ -397,7 +781,7 @@ int search(Thread *thread, PVariation *pv, int alpha, int beta, int depth, bool
             if (    ttBound == BOUND_EXACT
                 || (ttBound == BOUND_LOWER && ttValue >= beta)
                 || (ttBound == BOUND_UPPER && ttValue <= alpha))
-                return ttValue;
+                return SEARCH_STAT(thread, depth, SS_TT_CUTOFFS), ttValue;
         }
 
         // An entry coming from one depth lower than we would accept for a cutoff will
@@ -407,9 +791,13 @@ int search(Thread *thread, PVariation *pv, int alpha, int beta, int depth, bool
             && (ttBound & BOUND_UPPER)
             && (cutnode || ttValue <= alpha)
             &&  ttValue + TTResearchMargin <= alpha)
-            return alpha;
+            return SEARCH_STAT(thread, depth, SS_TT_CUTOFFS), alpha;
     }
 
+    // The root may still use the best move carried over from the last search
+    if (RootNode && ttMove == NONE_MOVE)
+        ttMove = CarryMove;
+
     // Step 5. Probe the Syzygy Tablebases. tablebasesProbeWDL() handles all of
     // the conditions about the board, the existance of tables, the probe depth,
     // as well as to not probe at the Root. The return is defined by the Pyrrhic API
@@ -433,7 +821,7 @@ int search(Thread *thread, PVariation *pv, int alpha, int beta, int depth, bool
             || (tbBound == BOUND_LOWER && value >= beta)
             || (tbBound == BOUND_UPPER && value <= alpha)) {
 
-            tt_store(board->hash, thread->height, NONE_MOVE, value, VALUE_NONE, depth, tbBound);
+            tt_store(thread, board->hash, NONE_MOVE, value, VALUE_NONE, depth, tbBound);
             return value;
         }
 
@@ -450,7 +838,7 @@ int search(Thread *thread, PVariation *pv, int alpha, int beta, int depth, bool
     search_init_goto:
 
     // We can grab in check based on the already computed king attackers bitboard
-    inCheck = !!board->kingAttackers;
+    inCheck = !!boardKingAttackers(board);
 
     // Save a history of the static evaluations when not checked
     eval = ns->eval = inCheck ? VALUE_NONE
@@ -475,7 +863,7 @@ int search(Thread *thread, PVariation *pv, int alpha, int beta, int depth, bool
 
     // Toss the static evaluation into the TT if we won't overwrite something
     if (!ttHit && !inCheck && !ns->excluded)
-        tt_store(board->hash, thread->height, NONE_MOVE, VALUE_NONE, eval, 0, BOUND_NONE);
+        tt_store(thread, board->hash, NONE_MOVE, VALUE_NONE, eval, 0, BOUND_NONE);
 
     // ------------------------------------------------------------------------
     // All elo estimates as of Ethereal 11.80, @ 12s+0.12 @ 1.275mnps
@@ -489,7 +877,7 @@ int search(Thread *thread, PVariation *pv, int alpha, int beta, int depth, bool
         && !ns->excluded
         &&  depth <= BetaPruningDepth
         &&  eval - BetaMargin * MAX(0, (depth - improving)) >= beta)
-        return eval;
+        return SEARCH_STAT(thread, depth, SS_BETA_PRUNED), eval;
 
     // Step 8 (~3 elo). Alpha Pruning for main search loop. The idea is
     // that for low depths if eval is so bad that even a large static
@@ -499,7 +887,7 @@ int search(Thread *thread, PVariation *pv, int alpha, int beta, int depth, bool
         && !ns->excluded
         &&  depth <= AlphaPruningDepth
         &&  eval + AlphaMargin <= alpha)
-        return eval;
+        return SEARCH_STAT(thread, depth, SS_ALPHA_PRUNED), eval;
 
     // Step 9 (~93 elo). Null Move Pruning. If our position is so strong
     // that giving our opponent a double move still allows us to maintain
@@ -518,12 +906,14 @@ int search(Thread *thread, PVariation *pv, int alpha, int beta, int depth, bool
         R = 4 + depth / 5 + MIN(3, (eval - beta) / 191) + (ns-1)->tactical;
 
         apply(thread, board, NULL_MOVE);
-        value = -search(thread, &lpv, -beta, -beta+1, depth-R, !cutnode);
+        value = -search_nonpv(thread, &lpv, -beta, -beta+1, depth-R, !cutnode);
         revert(thread, board, NULL_MOVE);
 
+        SEARCH_STAT(thread, depth, SS_NULL_TRIED);
+
         // Don't return unproven TB-Wins or Mates
         if (value >= beta)
-            return (value > TBWIN_IN_MAX) ? beta : value;
+            return SEARCH_STAT(thread, depth, SS_NULL_CUTOFFS), (value > TBWIN_IN_MAX) ? beta : value;
     }
 
     // Step 10 (~9 elo). Probcut Pruning. If we have a good capture that causes a
@@ -540,27 +930,28 @@ int search(Thread *thread, PVariation *pv, int alpha, int beta, int depth, bool
         init_noisy_picker(&ns->mp, thread, ttMove, rBeta - eval);
         while ((move = select_next(&ns->mp, thread, 1)) != NONE_MOVE) {
 
-            // Apply move, skip if move is illegal
-            if (apply(thread, board, move)) {
+            // Apply move, which is known to be legal
+            apply(thread, board, move);
 
-                // For high depths, verify the move first with a qsearch
-                if (depth >= 2 * ProbCutDepth)
-                    value = -qsearch(thread, &lpv, -rBeta, -rBeta+1);
+            // For high depths, verify the move first with a qsearch
+            if (depth >= 2 * ProbCutDepth)
+                value = -qsearch(thread, &lpv, -rBeta, -rBeta+1);
 
-                // For low depths, or after the above, verify with a reduced search
-                if (depth < 2 * ProbCutDepth || value >= rBeta)
-                    value = -search(thread, &lpv, -rBeta, -rBeta+1, depth-4, !cutnode);
+            // For low depths, or after the above, verify with a reduced search
+            if (depth < 2 * ProbCutDepth || value >= rBeta)
+                value = -search_nonpv(thread, &lpv, -rBeta, -rBeta+1, depth-4, !cutnode);
 
-                // Revert the board state
-                revert(thread, board, move);
+            // Revert the board state
+            revert(thread, board, move);
 
-                // Store an entry if we don't have a better one already
-                if (value >= rBeta && (!ttHit || ttDepth < depth - 3))
-                    tt_store(board->hash, thread->height, move, value, eval, depth-3, BOUND_LOWER);
+            SEARCH_STAT(thread, depth, SS_PROBCUT_TRIED);
 
-                // Probcut failed high verifying the cutoff
-                if (value >= rBeta) return value;
-            }
+            // Store an entry if we don't have a better one already
+            if (value >= rBeta && (!ttHit || ttDepth < depth - 3))
+                tt_store(thread, board->hash, move, value, eval, depth-3, BOUND_LOWER);
+
+            // Probcut failed high verifying the cutoff
+            if (value >= rBeta) return SEARCH_STAT(thread, depth, SS_PROBCUT_CUTOFFS), value;
         }
     }
 
@@ -597,8 +988,10 @@ int search(Thread *thread, PVariation *pv, int alpha, int beta, int depth, bool
         // anything from this move, we can skip all the remaining quiets
         if (   best > -TBWIN_IN_MAX
             && depth <= LateMovePruningDepth
-            && movesSeen >= LateMovePruningCounts[improving][depth])
+            && movesSeen >= LateMovePruningCounts[improving][depth]) {
+            if (!skipQuiets) SEARCH_STAT(thread, depth, SS_LMP_SKIPS);
             skipQuiets = 1;
+        }
 
         // Step 14 (~175 elo). Quiet Move Pruning. Prune any quiet move that meets one
         // of the criteria below, only after proving a non mated line exists
@@ -613,23 +1006,29 @@ int search(Thread *thread, PVariation *pv, int alpha, int beta, int depth, bool
             if (   !inCheck
                 &&  eval + fmpMargin <= alpha
                 &&  lmrDepth <= FutilityPruningDepth
-                &&  hist < FutilityPruningHistoryLimit[improving])
+                &&  hist < FutilityPruningHistoryLimit[improving]) {
+                if (!skipQuiets) SEARCH_STAT(thread, depth, SS_FUTILITY_SKIPS);
                 skipQuiets = 1;
+            }
 
             // Step 14B (~2.5 elo). Futility Pruning. If our score is not only far
             // below alpha but still far below alpha after adding the Futility Margin,
             // we can somewhat safely skip all quiet moves after this one
             if (   !inCheck
                 &&  lmrDepth <= FutilityPruningDepth
-                &&  eval + fmpMargin + FutilityMarginNoHistory <= alpha)
+                &&  eval + fmpMargin + FutilityMarginNoHistory <= alpha) {
+                if (!skipQuiets) SEARCH_STAT(thread, depth, SS_FUTILITY_SKIPS);
                 skipQuiets = 1;
+            }
 
             // Step 14C (~10 elo). Continuation Pruning. Moves with poor counter
             // or follow-up move history are pruned near the leaf nodes of the search
             if (   ns->mp.stage > STAGE_COUNTER_MOVE
                 && lmrDepth <= ContinuationPruningDepth[improving]
-                && MIN(cmhist, fmhist) < ContinuationPruningHistoryLimit[improving])
+                && MIN(cmhist, fmhist) < ContinuationPruningHistoryLimit[improving]) {
+                SEARCH_STAT(thread, depth, SS_CONTINUATION);
                 continue;
+            }
         }
 
         // Step 15 (~42 elo). Static Exchange Evaluation Pruning. Prune moves which fail
@@ -638,12 +1037,13 @@ int search(Thread *thread, PVariation *pv, int alpha, int beta, int depth, bool
         if (    best > -TBWIN_IN_MAX
             &&  depth <= SEEPruningDepth
             &&  ns->mp.stage > STAGE_GOOD_NOISY
-            && !staticExchangeEvaluation(board, move, seeMargin[isQuiet] - hist / 128))
+            && !staticExchangeEvaluation(board, move, seeMargin[isQuiet] - hist / 128)) {
+            SEARCH_STAT(thread, depth, SS_SEE_PRUNED);
             continue;
+        }
 
-        // Apply move, skip if move is illegal
-        if (!apply(thread, board, move))
-            continue;
+        // Apply move, which is known to be legal
+        apply(thread, board, move);
 
         played += 1;
         if (isQuiet) quietsTried[quietsPlayed++] = move;
@@ -652,7 +1052,8 @@ int search(Thread *thread, PVariation *pv, int alpha, int beta, int depth, bool
         // The UCI spec allows us to output information about the current move
         // that we are going to search. We only do this from the main thread,
         // and we wait a few seconds in order to avoid floiding the output
-        if (RootNode && !thread->index && elapsed_time(thread->tm) > CurrmoveTimerMS)
+        if (   RootNode && !thread->index && !thread->limits->silent
+            && elapsed_time(thread->tm) > CurrmoveTimerMS)
             uciReportCurrentMove(board, move, played + thread->multiPV, thread->depth);
 
         // Identify moves which are candidate singular moves
@@ -670,6 +1071,10 @@ int search(Thread *thread, PVariation *pv, int alpha, int beta, int depth, bool
         newDepth = depth + (!RootNode ? extension : 0);
         if (extension > 1) ns->dextensions++;
 
+        // Track how candidate singular moves resolved, by the extension given
+        if (singular)
+            SEARCH_STAT(thread, depth, ns->mp.stage == STAGE_DONE ? SS_SE_MULTICUT : SS_SE_NONE + extension);
+
         // Step 17. MultiCut. Sometimes candidate Singular moves are shown to be non-Singular.
         // If this happens, and the rBeta used is greater than beta, then we have multiple moves
         // which appear to beat beta at a reduced depth. singularity() sets the stage to STAGE_DONE
@@ -710,14 +1115,14 @@ int search(Thread *thread, PVariation *pv, int alpha, int beta, int depth, bool
                 R = 3 - (hist / 4952);
 
                 // Reduce for moves that give check
-                R -= !!board->kingAttackers;
+                R -= !!boardKingAttackers(board);
             }
 
             // Don't extend or drop into QS
             R = MIN(depth - 1, MAX(R, 1));
 
             // Perform reduced depth search on a Null Window
-            value = -search(thread, &lpv, -alpha-1, -alpha, newDepth-R, true);
+            value = -search_nonpv(thread, &lpv, -alpha-1, -alpha, newDepth-R, true);
 
             if (value > alpha && R > 1) {
 
@@ -727,7 +1132,7 @@ int search(Thread *thread, PVariation *pv, int alpha, int beta, int depth, bool
                 newDepth -= value < best + newDepth;
 
                 if (newDepth - 1 > lmrDepth)
-                    value = -search(thread, &lpv, -alpha-1, -alpha, newDepth-1, !cutnode);
+                    value = -search_nonpv(thread, &lpv, -alpha-1, -alpha, newDepth-1, !cutnode);
 
                 doFullSearch = false;
             }
@@ -740,7 +1145,7 @@ int search(Thread *thread, PVariation *pv, int alpha, int beta, int depth, bool
 
         // Full depth search on a null window
         if (doFullSearch)
-            value = -search(thread, &lpv, -alpha-1, -alpha, newDepth-1, !cutnode);
+            value = -search_nonpv(thread, &lpv, -alpha-1, -alpha, newDepth-1, !cutnode);
 
         // Full depth search on a full window for some PvNodes
         if (PvNode && (played == 1 || value > alpha))
@@ -772,7 +1177,12 @@ int search(Thread *thread, PVariation *pv, int alpha, int beta, int depth, bool
                 memcpy(pv->line + 1, lpv.line, sizeof(uint16_t) * lpv.length);
 
                 // Search failed high
-                if (alpha >= beta) break;
+                if (alpha >= beta) {
+                    SEARCH_STAT(thread, depth, SS_CUTOFFS);
+                    SEARCH_STAT_ADD(thread, depth, SS_FIRST_CUTOFFS, played == 1);
+                    SEARCH_STAT_ADD(thread, depth, SS_CUTOFF_INDEX, played);
+                    break;
+                }
             }
         }
     }
@@ -803,12 +1213,24 @@ int search(Thread *thread, PVariation *pv, int alpha, int beta, int depth, bool
         ttBound  = best >= beta    ? BOUND_LOWER
                  : best > oldAlpha ? BOUND_EXACT : BOUND_UPPER;
         bestMove = ttBound == BOUND_UPPER ? NONE_MOVE : bestMove;
-        tt_store(board->hash, thread->height, bestMove, best, eval, depth, ttBound);
+        tt_store(thread, board->hash, bestMove, best, eval, depth, ttBound);
     }
 
     return best;
 }
 
+static int search_root(Thread *thread, PVariation *pv, int alpha, int beta, int depth, bool cutnode) {
+    return search_node(thread, pv, alpha, beta, depth, cutnode, alpha != beta - 1, TRUE);
+}
+
+static int search_pv(Thread *thread, PVariation *pv, int alpha, int beta, int depth, bool cutnode) {
+    return search_node(thread, pv, alpha, beta, depth, cutnode, TRUE, FALSE);
+}
+
+static int search_nonpv(Thread *thread, PVariation *pv, int alpha, int beta, int depth, bool cutnode) {
+    return search_node(thread, pv, alpha, beta, depth, cutnode, FALSE, FALSE);
+}
+
 int qsearch(Thread *thread, PVariation *pv, int alpha, int beta) {
 
     Board *const board  = &thread->board;
@@ -817,6 +1239,7 @@ int qsearch(Thread *thread, PVariation *pv, int alpha, int beta) {
     int eval, value, best, oldAlpha = alpha;
     int ttHit, ttValue = 0, ttEval = VALUE_NONE, ttDepth = 0, ttBound = 0;
     uint16_t move, ttMove = NONE_MOVE, bestMove = NONE_MOVE;
+    bool lazy = false;
     PVariation lpv;
 
     // Ensure a fresh PV
@@ -825,6 +1248,7 @@ int qsearch(Thread *thread, PVariation *pv, int alpha, int beta) {
     // Updates for UCI reporting
     thread->seldepth = MAX(thread->seldepth, thread->height);
     thread->nodes++;
+    SEARCH_STAT(thread, 0, SS_QNODES);
 
     // Step 1. Abort Check. Exit the search if signaled by main thread or the
     // UCI thread, or if the search time has expired outside pondering mode
@@ -836,28 +1260,35 @@ int qsearch(Thread *thread, PVariation *pv, int alpha, int beta) {
     // material. Add variance to the draw score, to avoid blindness to 3-fold lines
     if (boardIsDrawn(board, thread->height)) return 1 - (thread->nodes & 2);
 
+    // Upcoming Repetition. As in search(), a reversible move may secure a draw
+    if (alpha < 0 && boardHasGameCycle(board, thread->height)) {
+        oldAlpha = alpha = 1 - (thread->nodes & 2);
+        if (alpha >= beta) return alpha;
+    }
+
     // Step 3. Max Draft Cutoff. If we are at the maximum search draft,
     // then end the search here with a static eval of the current board
     if (thread->height >= MAX_PLY)
         return evaluateBoard(thread, board);
 
     // Step 4. Probe the Transposition Table, adjust the value, and consider cutoffs
-    if ((ttHit = tt_probe(board->hash, thread->height, &ttMove, &ttValue, &ttEval, &ttDepth, &ttBound))) {
+    if ((ttHit = tt_probe(thread, board->hash, &ttMove, &ttValue, &ttEval, &ttDepth, &ttBound))) {
 
         // Table is exact or produces a cutoff
         if (    ttBound == BOUND_EXACT
             || (ttBound == BOUND_LOWER && ttValue >= beta)
             || (ttBound == BOUND_UPPER && ttValue <= alpha))
-            return ttValue;
+            return SEARCH_STAT(thread, 0, SS_TT_CUTOFFS), ttValue;
     }
 
-    // Save a history of the static evaluations
+    // Save a history of the static evaluations. Far outside of the window, the
+    // evaluation may only be an estimate, which is then kept out of the TT
     eval = ns->eval = ttEval != VALUE_NONE
-                    ? ttEval : evaluateBoard(thread, board);
+                    ? ttEval : evaluateBoardLazy(thread, board, alpha, beta, &lazy);
 
     // Toss the static evaluation into the TT if we won't overwrite something
-    if (!ttHit && !board->kingAttackers)
-        tt_store(board->hash, thread->height, NONE_MOVE, VALUE_NONE, eval, 0, BOUND_NONE);
+    if (!ttHit && !lazy && !boardKingAttackers(board))
+        tt_store(thread, board->hash, NONE_MOVE, VALUE_NONE, eval, 0, BOUND_NONE);
 
     // Step 5. Eval Pruning. If a static evaluation of the board will
     // exceed beta, then we can stop the search here. Also, if the static
@@ -882,8 +1313,8 @@ int qsearch(Thread *thread, PVariation *pv, int alpha, int beta) {
         int pessimism = moveEstimatedValue(board, move)
                       - SEEPieceValues[pieceType(board->squares[MoveFrom(move)])];
 
-        // Search the next ply if the move is legal
-        if (!apply(thread, board, move)) continue;
+        // Search the next ply, the move being legal
+        apply(thread, board, move);
 
         // Short-circuit QS and assume a stand-pat matches the SEE
         if (eval + pessimism > beta && abs(eval + pessimism) < MATE / 2) {
@@ -921,7 +1352,7 @@ int qsearch(Thread *thread, PVariation *pv, int alpha, int beta) {
     // Step 8. Store results of search into the Transposition Table.
     ttBound = best >= beta    ? BOUND_LOWER
             : best > oldAlpha ? BOUND_EXACT : BOUND_UPPER;
-    tt_store(board->hash, thread->height, bestMove, best, eval, 0, ttBound);
+    tt_store(thread, board->hash, bestMove, best, lazy ? VALUE_NONE : eval, 0, ttBound);
 
     return best;
 }
@@ -1032,7 +1463,7 @@ int singularity(Thread *thread, uint16_t ttMove, int ttValue, int depth, int PvN
 
     // Search on a null rBeta window, excluding the tt-move
     ns->excluded = ttMove;
-    value = search(thread, &lpv, rBeta-1, rBeta, (depth - 1) / 2, cutnode);
+    value = search_nonpv(thread, &lpv, rBeta-1, rBeta, (depth - 1) / 2, cutnode);
     ns->excluded = NONE_MOVE;
 
     // We reused the Move Picker, so make sure we cleanup
@@ -1043,7 +1474,7 @@ int singularity(Thread *thread, uint16_t ttMove, int ttValue, int depth, int PvN
         ns->mp.stage = STAGE_DONE;
 
     // Reapply the table move we took off
-    else applyLegal(thread, board, ttMove);
+    else apply(thread, board, ttMove);
 
     bool double_extend = !PvNode
                       &&  value < rBeta - 16
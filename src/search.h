@@ -28,9 +28,16 @@ struct PVariation {
     uint16_t line[MAX_PLY];
 };
 
+enum {
+    HELPER_SCHEDULE_NONE,
+    HELPER_SCHEDULE_SKIP,
+    HELPER_SCHEDULE_BUSY,
+};
+
 void initSearch();
 void *start_search_threads(void *arguments);
 void getBestMove(Thread *threads, Board *board, Limits *limits, uint16_t *best, uint16_t *ponder, int *score);
+void clearSearchCarry();
 void* iterativeDeepening(void *vthread);
 void aspirationWindow(Thread *thread);
 int search(Thread *thread, PVariation *pv, int alpha, int beta, int depth, bool cutnode);
@@ -0,0 +1,110 @@
+/*
+  Ethereal is a UCI chess playing engine authored by Andrew Grant.
+  <https://github.com/AndyGrant/Ethereal>     <andrew@grantnet.us>
+
+  Ethereal is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Ethereal is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "searchstats.h"
+#include "thread.h"
+#include "types.h"
+
+#if USE_SEARCH_STATS
+
+static double ratio(uint64_t numerator, uint64_t denominator) {
+    return denominator ? (double) numerator / denominator : 0.0;
+}
+
+void search_stats_clear(Thread *threads) {
+    for (int i = 0; i < threads->nthreads; i++)
+        memset(&threads[i].sstats, 0, sizeof(SearchStats));
+}
+
+void search_stats_report(Thread *threads) {
+
+    /// Report each Thread on a single line, followed by one line per depth for
+    /// the Thread Pool as a whole, and then the aspiration window re-searches
+
+    SearchStats total = {0};
+    uint64_t nodes = 0, qnodes = 0, cutoffs = 0, first = 0;
+
+    for (int i = 0; i < threads->nthreads; i++) {
+
+        const SearchStats *ss = &threads[i].sstats;
+        uint64_t tnodes = 0, tqnodes = 0, tcutoffs = 0, tfirst = 0;
+
+        for (int d = 0; d < SEARCH_STATS_DEPTHS; d++) {
+
+            for (int s = 0; s < SS_NB; s++)
+                total.draft[d][s] += ss->draft[d][s];
+
+            tnodes   += ss->draft[d][SS_NODES] + ss->draft[d][SS_QNODES];
+            tqnodes  += ss->draft[d][SS_QNODES];
+            tcutoffs += ss->draft[d][SS_CUTOFFS];
+            tfirst   += ss->draft[d][SS_FIRST_CUTOFFS];
+        }
+
+        for (int d = 0; d < MAX_PLY; d++) {
+            total.researches[d][0] += ss->researches[d][0];
+            total.researches[d][1] += ss->researches[d][1];
+        }
+
+        printf("info string stats thread %d nodes %"PRIu64" qsearch %.1f%% first-cutoff %.1f%%\n",
+            i, tnodes, 100.0 * ratio(tqnodes, tnodes), 100.0 * ratio(tfirst, tcutoffs));
+
+        nodes += tnodes, qnodes += tqnodes;
+        cutoffs += tcutoffs, first += tfirst;
+    }
+
+    printf("info string stats total nodes %"PRIu64" qsearch %.1f%% first-cutoff %.1f%%\n",
+        nodes, 100.0 * ratio(qnodes, nodes), 100.0 * ratio(first, cutoffs));
+
+    printf("info string stats depth %12s %8s %6s %5s %10s %9s %9s %9s %7s %9s %7s %9s %9s %9s %9s %7s %7s %7s %7s %7s\n",
+        "nodes", "cutoffs", "first", "index", "tt-cuts", "beta", "alpha", "null", "null%", "probcut", "pc%",
+        "lmp", "futility", "cont", "see", "se-neg", "se-none", "se-one", "se-two", "se-mc");
+
+    for (int d = 0; d < SEARCH_STATS_DEPTHS; d++) {
+
+        const uint64_t *x = total.draft[d];
+
+        if (!x[SS_NODES] && !x[SS_QNODES])
+            continue;
+
+        printf("info string stats %s%2d%s %12"PRIu64" %8"PRIu64" %5.1f%% %5.2f %10"PRIu64" %9"PRIu64" %9"PRIu64
+               " %9"PRIu64" %6.1f%% %9"PRIu64" %6.1f%% %9"PRIu64" %9"PRIu64" %9"PRIu64" %9"PRIu64
+               " %7"PRIu64" %7"PRIu64" %7"PRIu64" %7"PRIu64" %7"PRIu64"\n",
+            d ? "depth " : "qs    ", d, d == SEARCH_STATS_DEPTHS - 1 ? "+" : " ",
+            x[SS_NODES] + x[SS_QNODES], x[SS_CUTOFFS], 100.0 * ratio(x[SS_FIRST_CUTOFFS], x[SS_CUTOFFS]),
+            ratio(x[SS_CUTOFF_INDEX], x[SS_CUTOFFS]), x[SS_TT_CUTOFFS], x[SS_BETA_PRUNED], x[SS_ALPHA_PRUNED],
+            x[SS_NULL_TRIED], 100.0 * ratio(x[SS_NULL_CUTOFFS], x[SS_NULL_TRIED]),
+            x[SS_PROBCUT_TRIED], 100.0 * ratio(x[SS_PROBCUT_CUTOFFS], x[SS_PROBCUT_TRIED]),
+            x[SS_LMP_SKIPS], x[SS_FUTILITY_SKIPS], x[SS_CONTINUATION], x[SS_SEE_PRUNED],
+            x[SS_SE_NEGATIVE], x[SS_SE_NONE], x[SS_SE_SINGLE], x[SS_SE_DOUBLE], x[SS_SE_MULTICUT]);
+    }
+
+    for (int d = 0; d < MAX_PLY; d++)
+        if (total.researches[d][0] || total.researches[d][1])
+            printf("info string stats aspiration depth %d fail-low %"PRIu64" fail-high %"PRIu64"\n",
+                d, total.researches[d][0], total.researches[d][1]);
+}
+
+#else
+
+void search_stats_clear(Thread *threads) { (void) threads; }
+void search_stats_report(Thread *threads) { (void) threads; }
+
+#endif
@@ -0,0 +1,81 @@
+/*
+  Ethereal is a UCI chess playing engine authored by Andrew Grant.
+  <https://github.com/AndyGrant/Ethereal>     <andrew@grantnet.us>
+
+  Ethereal is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Ethereal is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#pragma once
+
+#include <stdint.h>
+
+#include "types.h"
+
+/// Search statistics count, for each Thread and each remaining depth, how the
+/// nodes of the tree were spent: which moves produced cutoffs, which pruning
+/// methods fired, and how candidate singular moves resolved. Aspiration window
+/// re-searches are counted by iteration instead. Every counter is compiled out
+/// unless built with SEARCHSTATS=1, which defines USE_SEARCH_STATS. A Thread's
+/// counters accumulate until search_stats_clear(), so that bench may sum over
+/// all of its positions, while each "go" reports and then clears its own.
+
+#if !defined(USE_SEARCH_STATS)
+    #define USE_SEARCH_STATS 0
+#endif
+
+enum { SEARCH_STATS_DEPTHS = 32 }; // Deeper nodes are counted with the last
+
+enum {
+    SS_NODES,           // Nodes of search()
+    SS_QNODES,          // Nodes of qsearch(), which are all counted at depth zero
+    SS_CUTOFFS,         // Nodes which failed high after searching a move
+    SS_FIRST_CUTOFFS,   //   ... of which did so on the first move
+    SS_CUTOFF_INDEX,    //   ... summing the number of moves played to get there
+    SS_TT_CUTOFFS,      // Returns from a Table entry
+    SS_BETA_PRUNED,     // Reverse Futility Pruning
+    SS_ALPHA_PRUNED,    // Alpha Pruning
+    SS_NULL_TRIED,      // Null Move searches
+    SS_NULL_CUTOFFS,    //   ... which failed high
+    SS_PROBCUT_TRIED,   // ProbCut verification searches
+    SS_PROBCUT_CUTOFFS, //   ... which failed high
+    SS_LMP_SKIPS,       // Nodes which stopped trying quiets by move count
+    SS_FUTILITY_SKIPS,  // Nodes which stopped trying quiets by Futility Pruning
+    SS_CONTINUATION,    // Quiets pruned by their continuation histories
+    SS_SEE_PRUNED,      // Moves pruned by Static Exchange Evaluation
+    SS_SE_NEGATIVE,     // Outcomes of singularity(), by the extension given
+    SS_SE_NONE,
+    SS_SE_SINGLE,
+    SS_SE_DOUBLE,
+    SS_SE_MULTICUT,     // singularity() cut the node off entirely
+    SS_NB
+};
+
+typedef struct SearchStats {
+    uint64_t draft[SEARCH_STATS_DEPTHS][SS_NB];
+    uint64_t researches[MAX_PLY][2]; // Aspiration fail lows and fail highs
+} SearchStats;
+
+#if USE_SEARCH_STATS
+    #define SEARCH_STAT_ADD(thread, depth, stat, count) \
+        ((thread)->sstats.draft[MAX(0, MIN((depth), SEARCH_STATS_DEPTHS - 1))][(stat)] += (count))
+    #define SEARCH_STAT_RESEARCH(thread, high) \
+        ((thread)->sstats.researches[(thread)->depth][(high)]++)
+#else
+    #define SEARCH_STAT_ADD(thread, depth, stat, count) ((void) 0)
+    #define SEARCH_STAT_RESEARCH(thread, high) ((void) 0)
+#endif
+
+#define SEARCH_STAT(thread, depth, stat) SEARCH_STAT_ADD(thread, depth, stat, 1)
+
+void search_stats_clear(Thread *threads);
+void search_stats_report(Thread *threads);
@@ -17,21 +17,42 @@
 */
 
 #include <assert.h>
+#include <inttypes.h>
+#include <pthread.h>
+#include <stdbool.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+
+#if !defined(_WIN32) && !defined(_WIN64)
+    #include <sys/mman.h>
+    #include <sys/resource.h>
+    #include <unistd.h>
+#endif
 
 #include "bitboards.h"
 #include "board.h"
 #include "move.h"
 #include "movegen.h"
 #include "pyrrhic/tbprobe.h"
+#include "syzygy.h"
+#include "thread.h"
+#include "timeman.h"
+#include "transposition.h"
 #include "types.h"
 #include "uci.h"
 
 unsigned TB_PROBE_DEPTH; // Set by UCI options
 extern int TB_LARGEST;   // Set by Pyrrhic in tb_init()
 
+static uint64_t *WDLCache;    // Shared WDL results, in front of Pyrrhic
+static uint64_t WDLCacheMask; // Slots in the WDLCache, minus one
+static int WDLCacheMB = SYZYGY_CACHE_DEFAULT;
+static bool WDLCachePending;  // Set when a new size waits for the next search
+
+static SyzygyPreload Preload; // Set by UCI options, see tablebasesSetPreload()
+
 static uint16_t convertPyrrhicMove(Board *board, unsigned result) {
 
     // Extract Pyrhic's move representation
@@ -55,6 +76,157 @@ static void removeBadWDL(Board *board, Limits *limits, unsigned result, unsigned
 }
 
 
+static bool preloadTable(const void *data, size_t size, void *arg) {
+
+    SyzygyPreload *preload = arg;
+
+#if !defined(_WIN32) && !defined(_WIN64)
+
+    // Locking both faults in and pins the table. Otherwise, or if the lock
+    // is refused by RLIMIT_MEMLOCK, ask for read-ahead and then touch each
+    // page ourselves, so that the faults are taken here and not in a search
+
+    const size_t page = (size_t) sysconf(_SC_PAGESIZE);
+    volatile uint8_t sink = 0;
+
+    if (size && preload->lock && mlock(data, size) == 0)
+        preload->locked += size;
+
+    else if (size) {
+        madvise((void*) data, size, MADV_WILLNEED);
+        for (size_t i = 0; i < size && !__atomic_load_n(&preload->stop, __ATOMIC_RELAXED); i += page)
+            sink += ((const volatile uint8_t*) data)[i];
+    }
+
+    (void) sink;
+
+#endif
+
+    preload->bytes += size;
+    return !__atomic_load_n(&preload->stop, __ATOMIC_RELAXED);
+}
+
+static void* preloadTablebases(void *arg) {
+
+    SyzygyPreload *preload = arg;
+    const double start = get_real_time();
+    long majors = 0, minors = 0;
+
+#if !defined(_WIN32) && !defined(_WIN64)
+    struct rusage before, after;
+    getrusage(RUSAGE_SELF, &before);
+#endif
+
+    const int tables = tb_preload(preload->wdl, preload->dtz, preloadTable, preload);
+
+#if !defined(_WIN32) && !defined(_WIN64)
+    getrusage(RUSAGE_SELF, &after);
+    majors = after.ru_majflt - before.ru_majflt;
+    minors = after.ru_minflt - before.ru_minflt;
+#endif
+
+    printf("info string syzygy preloaded %d tables, %"PRIu64"MB (%"PRIu64"MB locked) in %dms, "
+           "%ld major and %ld minor faults%s\n", tables, preload->bytes >> 20, preload->locked >> 20,
+           (int) (get_real_time() - start), majors, minors,
+           __atomic_load_n(&preload->stop, __ATOMIC_RELAXED) ? ", stopped early" : "");
+    fflush(stdout);
+
+    return NULL;
+}
+
+static void stopPreload() {
+
+    // Tables may not be unmapped by tb_init() while still being touched
+
+    if (!Preload.running)
+        return;
+
+    __atomic_store_n(&Preload.stop, true, __ATOMIC_RELAXED);
+    pthread_join(Preload.thread, NULL);
+    Preload.running = false;
+}
+
+static void startPreload() {
+
+    stopPreload();
+
+    Preload.stop  = false;
+    Preload.bytes = Preload.locked = 0;
+
+    if (TB_LARGEST && (Preload.wdl || Preload.dtz))
+        Preload.running = !pthread_create(&Preload.thread, NULL, &preloadTablebases, &Preload);
+}
+
+static void resizeWDLCache(int megabytes) {
+
+    // Use the largest power of two number of slots that fits. The size is
+    // kept even without any Tablebases, to be applied once they are found
+
+    const uint64_t MB = 1ull << 20;
+    uint64_t slots = 1;
+
+    free(WDLCache);
+    WDLCache = NULL, WDLCacheMask = 0;
+    WDLCacheMB = megabytes, WDLCachePending = false;
+
+    if (TB_LARGEST == 0 || megabytes <= 0)
+        return;
+
+    while (2 * slots * sizeof(uint64_t) <= megabytes * MB)
+        slots *= 2;
+
+    if ((WDLCache = calloc(slots, sizeof(uint64_t))) != NULL)
+        WDLCacheMask = slots - 1;
+}
+
+void tablebasesInit(char *path) {
+
+    // Results from one set of Tablebases remain true for any other set, but
+    // the WDLCache is only worth its memory while there are Tablebases at all
+
+    stopPreload();
+    tb_init(path);
+    resizeWDLCache(WDLCacheMB);
+    startPreload();
+}
+
+void tablebasesSetPreload(char *str) {
+
+    // Accepts any of "wdl=<pieces>", "dtz=<pieces>", and "lock", separated by
+    // spaces. So "wdl=6 dtz=5" reads the 5-man tables fully, and 6-man WDL
+
+    char *wdl = strstr(str, "wdl="), *dtz = strstr(str, "dtz=");
+
+    Preload.wdl  = wdl ? (unsigned) atoi(wdl + strlen("wdl=")) : 0;
+    Preload.dtz  = dtz ? (unsigned) atoi(dtz + strlen("dtz=")) : 0;
+    Preload.lock = strstr(str, "lock") != NULL;
+
+    startPreload();
+}
+
+void tablebasesReport() {
+
+    // Tables opened by a probe mid-search are the stalls that preloading avoids
+    if (TB_LARGEST)
+        printf("info string syzygy lazy opens %d\n", TB_LAZY_OPENS);
+}
+
+void tablebasesSetCache(int megabytes) {
+
+    // Threads may still be probing the WDLCache, as UCI only promises that a
+    // search has been told to stop. The new size is applied once none are
+
+    WDLCacheMB = megabytes;
+    WDLCachePending = true;
+}
+
+void tablebasesApplyCache() {
+
+    // Called as each search begins, before any helper Threads are woken
+    if (WDLCachePending)
+        resizeWDLCache(WDLCacheMB);
+}
+
 void tablebasesProbeDTZ(Board *board, Limits *limits) {
 
     unsigned results[MAX_MOVES];
@@ -117,11 +289,25 @@ unsigned tablebasesProbeWDL(Board *board, int depth, int height) {
         return TB_RESULT_FAILED;
 
 
+    // Check the WDLCache before decompressing anything. Each slot packs the
+    // upper bits of the hash beside the result plus one, so that a single
+    // atomic load or store is always a whole entry, and zero is an empty slot
+
+    uint64_t *slot = WDLCache ? &WDLCache[board->hash & WDLCacheMask] : NULL;
+    uint64_t packed = slot ? __atomic_load_n(slot, __ATOMIC_RELAXED) : 0ull;
+
+    board->thread->ttstats.tbprobes++;
+
+    if (packed && (packed & ~7ull) == (board->hash & ~7ull)) {
+        board->thread->ttstats.tbcached++;
+        return (unsigned) (packed & 7ull) - 1;
+    }
+
     // Tap into Pyrrhic's API. Pyrrhic takes the board representation, followed
     // by the enpass square (0 if none set), and the turn. Pyrrhic defines WHITE
     // as 1, and BLACK as 0, which is the opposite of how Ethereal defines them
 
-    return tb_probe_wdl(
+    unsigned result = tb_probe_wdl(
         board->colours[WHITE], board->colours[BLACK],
         board->pieces[KING  ], board->pieces[QUEEN ],
         board->pieces[ROOK  ], board->pieces[BISHOP],
@@ -129,4 +315,9 @@ unsigned tablebasesProbeWDL(Board *board, int depth, int height) {
         board->epSquare == -1 ? 0 : board->epSquare,
         board->turn == WHITE ? 1 : 0
     );
+
+    if (slot && result != TB_RESULT_FAILED)
+        __atomic_store_n(slot, (board->hash & ~7ull) | (result + 1), __ATOMIC_RELAXED);
+
+    return result;
 }
@@ -18,9 +18,28 @@
 
 #pragma once
 
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+
 #include "types.h"
 
-#include <stdint.h>
+enum {
+    SYZYGY_CACHE_DEFAULT = 16, // Megabytes shared by all Threads
+    SYZYGY_CACHE_MAX     = 65536,
+};
+
+typedef struct SyzygyPreload {
+    pthread_t thread;
+    bool running, stop, lock;
+    unsigned wdl, dtz;
+    uint64_t bytes, locked;
+} SyzygyPreload;
 
-int tablebasesProbeDTZ(Board *board, Limits *limits);
+void tablebasesInit(char *path);
+void tablebasesSetCache(int megabytes);
+void tablebasesApplyCache();
+void tablebasesSetPreload(char *str);
+void tablebasesReport();
+void tablebasesProbeDTZ(Board *board, Limits *limits);
 unsigned tablebasesProbeWDL(Board *board, int depth, int height);
@@ -16,6 +16,7 @@
   along with this program.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <pthread.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -25,42 +26,228 @@
 #include "thread.h"
 #include "transposition.h"
 #include "types.h"
+#include "uci.h"
+#include "windows.h"
 
 #include "nnue/types.h"
 #include "nnue/accumulator.h"
 #include "nnue/utils.h"
 
-Thread* createThreadPool(int nthreads) {
+static void init_thread(Thread *threads, int index, int nthreads, int node) {
+
+    Thread *const thread = &threads[index];
+
+    // Touch the entire Thread before anything else does, so that
+    // the OS places the pages local to whichever thread calls this
+    memset(thread, 0, sizeof(Thread));
+
+    // Offset the Node Stack to allow looking backwards
+    thread->states = &(thread->nodeStates[STACK_OFFSET]);
+
+    // NULL out the entire continuation history
+    for (int j = 0; j < STACK_SIZE; j++)
+        thread->nodeStates[j].continuations = NULL;
+
+    // Threads will know of each other
+    thread->index    = index;
+    thread->threads  = threads;
+    thread->nthreads = nthreads;
+
+    // Accumulator stack and table require alignment
+    thread->nnue = nnue_create_evaluator();
+    nnue_bind_evaluator(thread->nnue, node);
+
+    // Sized by the PKCache and EvalCache options
+    initPKCache(thread);
+    initEvalCache(thread);
+
+    // Most searches have a single line, so only allocate for more when needed
+    thread->mpvs = &thread->mpv;
+}
+
+static void* worker_idle_loop(void *vworker) {
+
+    SearchWorker *const worker = (SearchWorker*) vworker;
+
+    // Helpers spend their lives parked on the condition variable. When woken
+    // they either (re)initialize the Thread they own, or run a full search on
+    // it. Initialization happens here, after binding, in order to keep all
+    // of the per-thread tables on the same NUMA node as the helper itself
+
+    while (1) {
+
+        pthread_mutex_lock(&worker->mutex);
+
+        while (worker->state == WORKER_IDLE)
+            pthread_cond_wait(&worker->cond, &worker->mutex);
+
+        const int state = worker->state;
+        pthread_mutex_unlock(&worker->mutex);
+
+        if (state == WORKER_EXIT)
+            break;
+
+        if (state == WORKER_INIT) {
+            const int node = worker->nthreads > 8 ? bindThisThread(worker->index) : unbindThisThread();
+            init_thread(worker->threads, worker->index, worker->nthreads, node);
+        }
+
+        if (state == WORKER_SEARCH)
+            iterativeDeepening(&worker->threads[worker->index]);
+
+        pthread_mutex_lock(&worker->mutex);
+        worker->state = WORKER_IDLE;
+        pthread_cond_broadcast(&worker->cond);
+        pthread_mutex_unlock(&worker->mutex);
+    }
+
+    return NULL;
+}
+
+static void signal_worker(SearchWorker *worker, int state) {
+
+    pthread_mutex_lock(&worker->mutex);
+    worker->state = state;
+    pthread_cond_broadcast(&worker->cond);
+    pthread_mutex_unlock(&worker->mutex);
+}
+
+static void wait_for_worker(SearchWorker *worker) {
+
+    pthread_mutex_lock(&worker->mutex);
+    while (worker->state != WORKER_IDLE)
+        pthread_cond_wait(&worker->cond, &worker->mutex);
+    pthread_mutex_unlock(&worker->mutex);
+}
+
+static void assign_worker(SearchWorker *worker, Thread *threads, int nthreads) {
+
+    // Hand the worker a new (uninitialized) Thread to own. The
+    // worker is parked, so the fields can be written without a lock
+
+    worker->threads  = threads;
+    worker->nthreads = nthreads;
+
+    signal_worker(worker, WORKER_INIT);
+}
+
+static SearchWorker* create_worker(Thread *threads, int index, int nthreads) {
+
+    SearchWorker *worker = calloc(1, sizeof(SearchWorker));
+
+    pthread_mutex_init(&worker->mutex, NULL);
+    pthread_cond_init(&worker->cond, NULL);
+
+    worker->index = index;
+    worker->state = WORKER_IDLE;
+    pthread_create(&worker->pthread, NULL, &worker_idle_loop, worker);
+
+    assign_worker(worker, threads, nthreads);
+    return worker;
+}
+
+static void delete_worker(SearchWorker *worker) {
 
-    Thread *threads = calloc(nthreads, sizeof(Thread));
+    signal_worker(worker, WORKER_EXIT);
 
-    for (int i = 0; i < nthreads; i++) {
+    pthread_join(worker->pthread, NULL);
+    pthread_cond_destroy(&worker->cond);
+    pthread_mutex_destroy(&worker->mutex);
+    free(worker);
+}
+
+static void free_thread_pool(Thread *threads) {
+
+    for (int i = 0; i < threads->nthreads; i++) {
+        nnue_delete_evaluator(threads[i].nnue);
+        freePKCache(&threads[i]);
+        freeEvalCache(&threads[i]);
+        if (threads[i].mpvs != &threads[i].mpv) free(threads[i].mpvs);
+    }
+
+    align_free(threads);
+}
+
+Thread* createThreadPool(int nthreads) {
+
+    // Memory is not touched here, leaving each helper to initialize
+    // its own Thread. The main thread is driven by the caller, while
+    // every helper gets a long-lived pthread which waits between searches
 
-        // Offset the Node Stack to allow looking backwards
-        threads[i].states = &(threads[i].nodeStates[STACK_OFFSET]);
+    Thread *threads = align_malloc(sizeof(Thread) * nthreads);
+    SearchWorker *workers[nthreads];
 
-        // NULL out the entire continuation history
-        for (int j = 0; j < STACK_SIZE; j++)
-            threads[i].nodeStates[j].continuations = NULL;
+    for (int i = 1; i < nthreads; i++)
+        workers[i] = create_worker(threads, i, nthreads);
 
-        // Threads will know of each other
-        threads[i].index    = i;
-        threads[i].threads  = threads;
-        threads[i].nthreads = nthreads;
+    init_thread(threads, 0, nthreads, -1);
 
-        // Accumulator stack and table require alignment
-        threads[i].nnue     = nnue_create_evaluator();
+    for (int i = 1; i < nthreads; i++) {
+        wait_for_worker(workers[i]);
+        threads[i].worker = workers[i];
     }
 
     return threads;
 }
 
+Thread* resizeThreadPool(Thread *threads, int nthreads) {
+
+    // Build a fresh Thread Pool, but keep the existing helper pthreads
+    // alive by rebinding them to their new Thread. Only the difference
+    // between the old and new sizes results in pthreads being created
+    // or joined. The old Threads are only freed once nothing points to them
+
+    Thread *resized = align_malloc(sizeof(Thread) * nthreads);
+    SearchWorker *workers[MAX(nthreads, threads->nthreads)];
+
+    for (int i = 1; i < MAX(nthreads, threads->nthreads); i++) {
+
+        if (i < nthreads && i < threads->nthreads)
+            assign_worker(workers[i] = threads[i].worker, resized, nthreads);
+
+        else if (i < nthreads)
+            workers[i] = create_worker(resized, i, nthreads);
+
+        else
+            delete_worker(threads[i].worker);
+    }
+
+    init_thread(resized, 0, nthreads, -1);
+
+    for (int i = 1; i < nthreads; i++) {
+        wait_for_worker(workers[i]);
+        resized[i].worker = workers[i];
+    }
+
+    free_thread_pool(threads);
+
+    return resized;
+}
+
 void deleteThreadPool(Thread *threads) {
 
-    for (int i = 0; i < threads->nthreads; i++)
-        nnue_delete_evaluator(threads[i].nnue);
+    for (int i = 1; i < threads->nthreads; i++)
+        delete_worker(threads[i].worker);
 
-    free(threads);
+    free_thread_pool(threads);
+}
+
+void startSearchThreadPool(Thread *threads) {
+
+    // Wake each of the parked helpers. newSearchThreadPool() must have
+    // been called beforehand, so that each Thread has a valid search setup
+
+    for (int i = 1; i < threads->nthreads; i++)
+        signal_worker(threads[i].worker, WORKER_SEARCH);
+}
+
+void waitSearchThreadPool(Thread *threads) {
+
+    // Block until each of the helpers has returned to being parked. It is
+    // assumed that ABORT_SIGNAL has been raised, or the helpers may not stop
+
+    for (int i = 1; i < threads->nthreads; i++)
+        wait_for_worker(threads[i].worker);
 }
 
 void resetThreadPool(Thread *threads) {
@@ -71,7 +258,8 @@ void resetThreadPool(Thread *threads) {
 
     for (int i = 0; i < threads->nthreads; i++) {
 
-        memset(&threads[i].pktable, 0, sizeof(PKTable));
+        clearPKCache(&threads[i]);
+        clearEvalCache(&threads[i]);
 
         memset(&threads[i].killers, 0, sizeof(KillerTable));
         memset(&threads[i].cmtable, 0, sizeof(CounterMoveTable));
@@ -96,10 +284,17 @@ void newSearchThreadPool(Thread *threads, Board *board, Limits *limits, TimeMana
         threads[i].height = 0;
         threads[i].nodes  = 0ull;
         threads[i].tbhits = 0ull;
+        threads[i].nodeQuota = 0ull;
+        memset(&threads[i].ttstats, 0, sizeof(TTStats));
+        memset(threads[i].depthNodes, 0, sizeof(threads[i].depthNodes));
+        memset(threads[i].depthTimes, 0, sizeof(threads[i].depthTimes));
 
         memcpy(&threads[i].board, board, sizeof(Board));
         threads[i].board.thread = &threads[i];
 
+        if (limits->multiPV > 1 && threads[i].mpvs == &threads[i].mpv)
+            threads[i].mpvs = calloc(MAX_MOVES, sizeof(PVariation));
+
         memset(threads[i].nodeStates, 0, sizeof(NodeState) * STACK_SIZE);
         nnue_reset_evaluator(threads[i].nnue);
     }
@@ -130,3 +325,14 @@ uint64_t tbhitsThreadPool(Thread *threads) {
 
     return tbhits;
 }
+
+void statsThreadPool(Thread *threads, TTStats *stats) {
+
+    // Sum up the Table counters across each Thread. These are kept
+    // per Thread for the same reason as the node and tbhit counters
+
+    memset(stats, 0, sizeof(TTStats));
+
+    for (int i = 0; i < threads->nthreads; i++)
+        tt_merge_stats(stats, &threads->threads[i].ttstats);
+}
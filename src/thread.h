@@ -18,14 +18,18 @@
 
 #pragma once
 
+#include <pthread.h>
 #include <setjmp.h>
 #include <stdbool.h>
 #include <stdint.h>
 
 #include "board.h"
+#include "cluster.h"
 #include "movepicker.h"
 #include "network.h"
+#include "perfcounters.h"
 #include "search.h"
+#include "searchstats.h"
 #include "transposition.h"
 #include "types.h"
 
@@ -50,26 +54,56 @@ struct NodeState {
     int16_t (*continuations)[CONT_NB][PIECE_NB][SQUARE_NB];
 };
 
+enum {
+    WORKER_IDLE, WORKER_INIT, WORKER_SEARCH, WORKER_EXIT
+};
+
+typedef struct SearchWorker {
+
+    // Helper threads are created once alongside the Thread Pool, and then
+    // park on the condition variable between searches. Only the main thread
+    // is tied to the UCI "go" command; helpers simply wait to be woken up
+
+    pthread_t pthread;
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+    Thread *threads;
+    int index, nthreads, state;
+
+} SearchWorker;
+
 struct Thread {
 
     Board board;
     Limits *limits;
     TimeManager *tm;
     PVariation pvs[MAX_PLY];
-    PVariation mpvs[MAX_MOVES];
+    PVariation *mpvs, mpv; // The lines of a MultiPV search, allocated on first use
 
     int multiPV;
     uint16_t bestMoves[MAX_MOVES];
 
-    uint64_t nodes, tbhits;
+    uint64_t nodes, tbhits, ttSlice;
+    uint64_t nodeQuota; // Nodes claimed from the budget of a "go nodes" search
+    ALIGN64 TTStats ttstats;
+    PerfCounters perf; // Hardware counters for this Thread's last search
+    ClusterBatch cluster; // Deep Entries waiting to be sent to any peers
+
+#if USE_SEARCH_STATS
+    SearchStats sstats; // Counted only in SEARCHSTATS=1 builds
+#endif
     int depth, seldepth, height, completed;
+    uint64_t depthNodes[MAX_PLY];
+    double depthTimes[MAX_PLY];
 
     NNUEEvaluator *nnue;
 
     Undo undoStack[STACK_SIZE];
     NodeState *states, nodeStates[STACK_SIZE];
 
-    ALIGN64 PKTable pktable;
+    PKEntry *pktable;
+    uint64_t pkmask;
+    uint64_t *evtable, evmask;
     ALIGN64 KillerTable killers;
     ALIGN64 CounterMoveTable cmtable;
     ALIGN64 HistoryTable history;
@@ -78,15 +112,21 @@ struct Thread {
 
     int index, nthreads;
     Thread *threads;
+    SearchWorker *worker;
     jmp_buf jbuffer;
 };
 
 
 Thread* createThreadPool(int nthreads);
+Thread* resizeThreadPool(Thread *threads, int nthreads);
 void deleteThreadPool(Thread *threads);
 
+void startSearchThreadPool(Thread *threads);
+void waitSearchThreadPool(Thread *threads);
+
 void resetThreadPool(Thread *threads);
 void newSearchThreadPool(Thread *threads, Board *board, Limits *limits, TimeManager *tm);
 
 uint64_t nodesSearchedThreadPool(Thread *threads);
 uint64_t tbhitsThreadPool(Thread *threads);
+void statsThreadPool(Thread *threads, TTStats *stats);
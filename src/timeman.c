@@ -18,6 +18,10 @@
 /*                                                                            */
 /******************************************************************************/
 
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
 #include "search.h"
 #include "thread.h"
 #include "timeman.h"
@@ -25,6 +29,10 @@
 #include "uci.h"
 
 int MoveOverhead = 300; // Set by UCI options
+int MoveOverheadAuto = 0; // Set by UCI options
+int TimeLog = 0;        // Set by UCI options
+
+static OverheadModel Overhead; // Measured lag, for MoveOverheadAuto
 
 double get_real_time() {
 #if defined(_WIN32) || defined(_WIN64)
@@ -50,26 +58,32 @@ void tm_init(const Limits *limits, TimeManager *tm) {
 
     tm->pv_stability = 0; // Clear our stability time usage heuristic
     tm->start_time = limits->start; // Save off the start time of the search
-    memset(tm->nodes, 0, sizeof(uint16_t) * 0x10000); // Clear Node counters
+    memset(tm->nodes, 0, sizeof(tm->nodes)); // Clear Node counters
+    tm->branching = tm->predicted = 0.0; // No iterations to model yet
+    tm->claimed = 0; // No nodes handed out of limits->nodeLimit yet
+
+    // Prefer the measured overhead, once there has been a full move to measure
+    const double overhead = MoveOverheadAuto && Overhead.samples
+                          ? Overhead.overhead : MoveOverhead;
 
     // Allocate time if Ethereal is handling the clock
     if (limits->limitedBySelf) {
 
         // Playing using X / Y + Z time control
         if (limits->mtg >= 0) {
-            tm->ideal_usage =  1.80 * (limits->time - MoveOverhead) / (limits->mtg +  5) + limits->inc;
-            tm->max_usage   = 10.00 * (limits->time - MoveOverhead) / (limits->mtg + 10) + limits->inc;
+            tm->ideal_usage =  1.80 * (limits->time - overhead) / (limits->mtg +  5) + limits->inc;
+            tm->max_usage   = 10.00 * (limits->time - overhead) / (limits->mtg + 10) + limits->inc;
         }
 
         // Playing using X + Y time controls
         else {
-            tm->ideal_usage =  2.50 * ((limits->time - MoveOverhead) + 25 * limits->inc) / 50;
-            tm->max_usage   = 10.00 * ((limits->time - MoveOverhead) + 25 * limits->inc) / 50;
+            tm->ideal_usage =  2.50 * ((limits->time - overhead) + 25 * limits->inc) / 50;
+            tm->max_usage   = 10.00 * ((limits->time - overhead) + 25 * limits->inc) / 50;
         }
 
         // Cap time allocations using the move overhead
-        tm->ideal_usage = MIN(tm->ideal_usage, limits->time - MoveOverhead);
-        tm->max_usage   = MIN(tm->max_usage,   limits->time - MoveOverhead);
+        tm->ideal_usage = MIN(tm->ideal_usage, limits->time - overhead);
+        tm->max_usage   = MIN(tm->max_usage,   limits->time - overhead);
     }
 
     // Interface told us to search for a predefined duration
@@ -79,8 +93,36 @@ void tm_init(const Limits *limits, TimeManager *tm) {
     }
 }
 
+static void tm_predict(const Thread *thread, TimeManager *tm) {
+
+    /// Estimate the effective branching factor from the growth in total nodes
+    /// over the last three iterations. Single iterations are too noisy, given
+    /// fail lows and odd-even effects. The next iteration should then cost the
+    /// time so far, scaled by the growth we expect beyond the current total.
+    /// Iterations carried from an earlier search have no counts, so the model
+    /// waits until three iterations have actually been searched
+
+    const int depth = thread->completed;
+    const double elapsed = thread->depthTimes[depth];
+
+    if (depth < 4 || !thread->depthNodes[depth-3]) return;
+
+    if (TimeLog)
+        printf("info string timeman depth %d actual %dms predicted %dms branching %.2f\n",
+            depth, (int) (elapsed - thread->depthTimes[depth-1]), (int) tm->predicted, tm->branching);
+
+    const double growth = (double) thread->depthNodes[depth]
+                        / MAX(1.0, (double) thread->depthNodes[depth-3]);
+
+    tm->branching = MAX(1.0, MIN(10.0, pow(growth, 1.0 / 3.0)));
+    tm->predicted = (tm->branching - 1.0) * elapsed;
+}
+
 void tm_update(const Thread *thread, const Limits *limits, TimeManager *tm) {
 
+    // Model the cost of the next iteration, even when not managing the clock
+    tm_predict(thread, tm);
+
     // Don't update our Time Managment plans at very low depths
     if (!limits->limitedBySelf || thread->completed < 4)
         return;
@@ -109,22 +151,104 @@ bool tm_finished(const Thread *thread, const TimeManager *tm) {
     const double non_best_pct = 1.0 - ((double) best_nodes / thread->nodes);
     const double nodes_factor = MAX(0.50, 2 * non_best_pct + 0.4);
 
+    // Don't start an iteration which is not expected to finish before max_usage,
+    // since tm_stop_early() would only abort it, and discard all of its work
+    if (elapsed_time(tm) + tm->predicted > tm->max_usage)
+        return TRUE;
+
     return elapsed_time(tm) > tm->ideal_usage * pv_factor * score_factor * nodes_factor;
 }
 
-bool tm_stop_early(const Thread *thread) {
+static bool tm_claim_nodes(Thread *thread) {
+
+    /// Take another share of the node budget. Shares shrink as the budget
+    /// runs out, so that the Threads all run dry within a few nodes of each
+    /// other, and the budget is never exceeded. With one Thread, this is
+    /// exactly the old rule of stopping once nodes reaches the limit
+
+    TimeManager *const tm = thread->tm;
+    const uint64_t limit   = thread->limits->nodeLimit;
+    const uint64_t claimed = __atomic_load_n(&tm->claimed, __ATOMIC_RELAXED);
+
+    if (claimed >= limit)
+        return FALSE;
+
+    const uint64_t share = MAX(1ull, MIN(NODE_BUDGET_SHARE, (limit - claimed) / (4ull * thread->nthreads)));
+    const uint64_t taken = __atomic_fetch_add(&tm->claimed, share, __ATOMIC_RELAXED);
+
+    if (taken >= limit)
+        return FALSE;
+
+    thread->nodeQuota += MIN(share, limit - taken);
+    return TRUE;
+}
+
+bool tm_stop_early(Thread *thread) {
 
     /// Quit early IFF we've surpassed our max time or nodes, and have
-    /// finished at least a depth 1 search to ensure we have a best move
+    /// finished at least a depth 1 search to ensure we have a best move.
+    /// Node limits are a single budget, which the Threads claim from
 
     const Limits *limits = thread->limits;
 
     if (limits->limitedByNodes)
-        return thread->depth > 1
-            && thread->nodes >= limits->nodeLimit / thread->nthreads;
+        return thread->nodes >= thread->nodeQuota
+            && !tm_claim_nodes(thread)
+            &&  thread->depth > 1;
 
     return  thread->depth > 1
         && (thread->nodes & 1023) == 1023
         && (limits->limitedBySelf || limits->limitedByTime)
         &&  elapsed_time(thread->tm) >= thread->tm->max_usage;
 }
+
+void tm_overhead_sample(const Limits *limits, double flushed) {
+
+    /// Called once bestmove has been flushed. The lag within Ethereal is from
+    /// the main Thread leaving the search, through joining the other Threads
+    /// and reporting, until the flush. The clock used is kept, to compare with
+    /// what the interface reports at that colour's next go
+
+    const int colour = Overhead.colour;
+
+    Overhead.pending[colour] = limits->limitedBySelf && !Overhead.ponder;
+
+    if (!Overhead.pending[colour])
+        return;
+
+    Overhead.lag          = flushed - limits->stopped;
+    Overhead.used[colour] = flushed - limits->start;
+    Overhead.peak         = MAX(0.95 * Overhead.peak, Overhead.lag + MAX(0.0, Overhead.drift));
+}
+
+void tm_overhead_update(const Limits *limits, int colour, int ponder) {
+
+    /// Compare the time taken off our clock by the interface, with the time
+    /// that we measured between go and bestmove. Any excess was spent outside
+    /// of Ethereal. Only compare clocks within the same time control period.
+    /// The overhead then covers twice the recent peak lag, with the peak
+    /// decaying slowly, so that a single slow move is not the final word
+
+    const double budget  = Overhead.clock[colour] + Overhead.inc[colour];
+    const double charged = budget - limits->time;
+
+    if (    Overhead.pending[colour] && limits->limitedBySelf
+        &&  Overhead.mtg[colour] != 1.0 && charged >= 0.0 && charged <= budget) {
+
+        Overhead.drift    = charged - Overhead.used[colour];
+        Overhead.peak     = MAX(Overhead.peak, Overhead.lag + MAX(0.0, Overhead.drift));
+        Overhead.overhead = MAX(10.0, MIN(10000.0, 2.0 * Overhead.peak + 10.0));
+        Overhead.samples++;
+
+        if (MoveOverheadAuto)
+            printf("info string MoveOverhead %dms lag %dms drift %dms peak %dms\n",
+                (int) Overhead.overhead, (int) Overhead.lag, (int) Overhead.drift, (int) Overhead.peak);
+    }
+
+    Overhead.pending[colour] = 0;
+    Overhead.colour          = colour;
+    Overhead.ponder          = ponder;
+    Overhead.clock[colour]   = limits->time;
+    Overhead.inc[colour]     = limits->inc;
+    Overhead.mtg[colour]     = limits->mtg;
+}
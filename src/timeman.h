@@ -31,15 +31,30 @@
 
 #include "types.h"
 
+enum {
+    NODE_BUDGET_SHARE = 1024, // Most nodes claimed at once, see tm_claim_nodes()
+};
+
 struct TimeManager {
     int pv_stability;
     double start_time, ideal_usage, max_usage;
+    double branching, predicted; // Model of the next iteration's cost
+    uint64_t claimed; // Nodes handed out from limits->nodeLimit, to all Threads
     uint64_t nodes[0x10000];
 };
 
+typedef struct OverheadModel {
+    int samples, colour, ponder, pending[COLOUR_NB];
+    double lag, drift, peak, overhead;
+    double used[COLOUR_NB], clock[COLOUR_NB], inc[COLOUR_NB], mtg[COLOUR_NB];
+} OverheadModel;
+
 double get_real_time();
 double elapsed_time(const TimeManager *tm);
 void tm_init(const Limits *limits, TimeManager *tm);
 void tm_update(const Thread *thread, const Limits *limits, TimeManager *tm);
 bool tm_finished(const Thread *thread, const TimeManager *tm);
-bool tm_stop_early(const Thread *thread);
+bool tm_stop_early(Thread *thread);
+
+void tm_overhead_sample(const Limits *limits, double flushed);
+void tm_overhead_update(const Limits *limits, int colour, int ponder);
@@ -18,16 +18,43 @@
 /*                                                                            */
 /******************************************************************************/
 
+#include <inttypes.h>
 #include <pthread.h>
+#include <stdio.h>
+
+#if defined(__linux__) && !defined(__ANDROID__)
+    #include <fcntl.h>
+    #include <linux/mempolicy.h>
+    #include <linux/mman.h>
+    #include <sys/stat.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif
 
 #include "board.h"
+#include "cluster.h"
 #include "evaluate.h"
 #include "thread.h"
 #include "transposition.h"
 #include "types.h"
+#include "windows.h"
 #include "zobrist.h"
 
+#include "nnue/utils.h"
+
 TTable Table; // Global Transposition Table
+extern int ClusterDepth;   // Defined by cluster.c
+extern int ClusterSharing; // Defined by cluster.c
+static int TTNumaPolicy = TT_NUMA_NONE;
+static uint64_t TTPageSize; // Non-zero when using MAP_HUGETLB
+static bool TTFileMapped;    // Set when mapped in via tt_load()
+static TTFileHeader *TTShared; // Set when attached via HashShared
+static uint32_t TTSharedSeen;  // Shared generation as of our last search
+static char TTSharedName[256];
+
+static const char *TTNumaNames[] = { "none", "interleave", "bind" };
+
+static void tt_clear_sections(int nthreads);
 
 /// Mate and Tablebase scores need to be adjusted relative to the Root
 /// when going into the Table and when coming out of the Table. Otherwise,
@@ -46,22 +73,314 @@ static int tt_value_to(int value, int height) {
 }
 
 
+/// Explicit NUMA placement of the Table. Policies must be applied after
+/// allocating but before the first touch, which is done during tt_clear()
+
+static void tt_numa_place(uint64_t size) {
+
+#if defined(__linux__) && !defined(__ANDROID__)
+
+    const uint64_t MB = 1ull << 20;
+    const unsigned long maxnode = 8 * sizeof(unsigned long) * 16;
+
+    int nodes[256], count = getMemoryNodes(nodes, 256);
+    unsigned long mask[16];
+
+    if (TTNumaPolicy == TT_NUMA_NONE || count <= 1)
+        return;
+
+    // Spread each page of the Table across every node in turn
+    if (TTNumaPolicy == TT_NUMA_INTERLEAVE) {
+        memset(mask, 0, sizeof(mask));
+        for (int i = 0; i < count; i++)
+            mask[nodes[i] / 64] |= 1ul << (nodes[i] % 64);
+        syscall(SYS_mbind, Table.buckets, size, MPOL_INTERLEAVE, mask, maxnode, 0);
+    }
+
+    // Split the Table into evenly sized, 2MB aligned, slices per node
+    if (TTNumaPolicy == TT_NUMA_BIND) {
+        for (int i = 0; i < count; i++) {
+            const uint64_t begin = (size / (2 * MB)) * (i + 0) / count * 2 * MB;
+            const uint64_t end   = (size / (2 * MB)) * (i + 1) / count * 2 * MB;
+            memset(mask, 0, sizeof(mask));
+            mask[nodes[i] / 64] |= 1ul << (nodes[i] % 64);
+            syscall(SYS_mbind, (char*) Table.buckets + begin, end - begin, MPOL_BIND, mask, maxnode, 0);
+        }
+    }
+
+#else
+    (void) size;
+#endif
+}
+
+void tt_report_placement() {
+
+    /// Sample pages throughout the Table to report on which NUMA nodes they
+    /// actually reside. This verifies the result of the TTNuma option, as
+    /// the kernel may silently fall back when a node is short on memory
+
+#if defined(__linux__) && !defined(__ANDROID__)
+
+    const uint64_t size = (Table.hashMask + 1) * sizeof(TTBucket);
+    int counts[256] = {0}, samples = 0, node;
+
+    for (int i = 0; i < 1024; i++) {
+        char *addr = (char*) Table.buckets + size / 1024 * i;
+        if (   !syscall(SYS_get_mempolicy, &node, NULL, 0, addr, MPOL_F_NODE | MPOL_F_ADDR)
+            && node >= 0 && node < 256)
+            counts[node]++, samples++;
+    }
+
+    if (!samples) {
+        printf("info string TTNuma %s placement unknown\n", TTNumaNames[TTNumaPolicy]);
+        return;
+    }
+
+    printf("info string TTNuma %s placement", TTNumaNames[TTNumaPolicy]);
+    for (int i = 0; i < 256; i++)
+        if (counts[i]) printf(" node%d %.1f%%", i, 100.0 * counts[i] / samples);
+    printf("\n");
+
+#else
+    printf("info string TTNuma %s placement unknown\n", TTNumaNames[TTNumaPolicy]);
+#endif
+}
+
+
+/// Entries are read and written by every Thread without any locking. Rather than
+/// storing the key directly, it is XORed with a fold of the rest of the Entry. An
+/// Entry torn by concurrent writes will then fail to verify, and be treated as a
+/// miss, instead of returning data from mismatched positions. The age is excluded,
+/// as tt_probe() refreshes it in place without rewriting the rest of the Entry
+
+static uint16_t tt_entry_check(const TTEntry *entry) {
+    return (uint16_t) (entry->move ^ (uint16_t) entry->value ^ (uint16_t) entry->eval
+         ^ ((uint16_t) (uint8_t) entry->depth << 8) ^ (entry->generation & TT_MASK_BOUND));
+}
+
+static uint16_t tt_entry_key(const TTEntry *entry) {
+    return entry->hash16 ^ tt_entry_check(entry);
+}
+
+/// The key is the upper bits of the Zobrist Hash. The 16 bits of each Entry are
+/// extended, for 64-byte Buckets, by TT_KEY_EXTEND more bits from the Bucket's
+/// spare word. A torn write between the two fails to match, like any other
+
+static uint32_t tt_hash_key(uint64_t hash) {
+#if defined(USE_TT_BUCKET64)
+    return (uint32_t) (hash >> (48 - TT_KEY_EXTEND));
+#else
+    return (uint32_t) (hash >> 48);
+#endif
+}
+
+static uint32_t tt_slot_key(const TTBucket *bucket, const TTEntry *entry, int slot) {
+#if defined(USE_TT_BUCKET64)
+    const uint32_t extend = bucket->extended >> (slot * TT_KEY_EXTEND);
+    return ((uint32_t) tt_entry_key(entry) << TT_KEY_EXTEND) | (extend & ((1u << TT_KEY_EXTEND) - 1));
+#else
+    (void) bucket; (void) slot;
+    return tt_entry_key(entry);
+#endif
+}
+
+static void tt_write_key(TTBucket *bucket, TTEntry *entry, int slot, uint32_t key) {
+#if defined(USE_TT_BUCKET64)
+    const uint32_t mask = ((1u << TT_KEY_EXTEND) - 1) << (slot * TT_KEY_EXTEND);
+    entry->hash16    = (uint16_t) (key >> TT_KEY_EXTEND) ^ tt_entry_check(entry);
+    bucket->extended = (bucket->extended & ~mask) | ((key << (slot * TT_KEY_EXTEND)) & mask);
+#else
+    (void) bucket; (void) slot;
+    entry->hash16    = (uint16_t) key ^ tt_entry_check(entry);
+#endif
+}
+
+
 /// Trivial helper functions to Transposition Table handleing
 
-void tt_update() { Table.generation += TT_MASK_BOUND + 1; }
-void tt_prefetch(uint64_t hash) { __builtin_prefetch(&Table.buckets[hash & Table.hashMask]); }
+void tt_update() {
+
+    // Shared Tables keep a single generation for all attached processes. Every
+    // process searches each move, but only the first to start advances it, as
+    // the others find it has moved on since their last search and adopt it
+
+    if (TTShared != NULL) {
+        uint32_t seen = TTSharedSeen;
+        if (__atomic_compare_exchange_n(&TTShared->generation, &seen, seen + TT_MASK_BOUND + 1,
+                                        FALSE, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+            seen += TT_MASK_BOUND + 1;
+        Table.generation = (uint8_t) (TTSharedSeen = seen);
+    }
+
+    else Table.generation += TT_MASK_BOUND + 1;
+}
+
+static TTBucket* tt_bucket(const Thread *thread, uint64_t hash) {
+
+    // Threads normally share the entire Table, and so have a ttSlice of zero.
+    // After tt_partition(), each Thread may be given a private slice instead
+    return &Table.buckets[(hash & Table.sliceMask) + thread->ttSlice];
+}
+
+void tt_prefetch(const Thread *thread, uint64_t hash) { __builtin_prefetch(tt_bucket(thread, hash)); }
+
+
+#if defined(__linux__) && !defined(__ANDROID__)
+
+static void* tt_alloc_hugetlb(uint64_t size) {
+
+    // Explicit Huge Pages must be reserved by the system administrator, via
+    // /proc/sys/vm/nr_hugepages or similar, but are then guaranteed. Attempt
+    // 1GB pages when the Table is large enough, before trying for 2MB pages
+
+    const uint64_t GB = 1ull << 30, MB = 1ull << 20;
+    const int flags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB;
+    void *mem;
+
+    if (size % GB == 0) {
+        mem = mmap(NULL, size, PROT_READ | PROT_WRITE, flags | (30 << MAP_HUGE_SHIFT), -1, 0);
+        if (mem != MAP_FAILED) return TTPageSize = GB, mem;
+    }
+
+    if (size % (2 * MB) == 0) {
+        mem = mmap(NULL, size, PROT_READ | PROT_WRITE, flags | (21 << MAP_HUGE_SHIFT), -1, 0);
+        if (mem != MAP_FAILED) return TTPageSize = 2 * MB, mem;
+    }
+
+    return NULL;
+}
+
+static uint64_t tt_thp_kilobytes() {
+
+    // Find the mapping of the Table in /proc/self/smaps, and report
+    // the amount of it which is actually backed by Transparent Huge Pages
+
+    char line[256];
+    uint64_t start, end, kilobytes = 0;
+    int inside = 0;
+    FILE *fin = fopen("/proc/self/smaps", "r");
 
+    if (fin == NULL) return 0;
+
+    while (fgets(line, sizeof(line), fin)) {
+
+        if (sscanf(line, "%"SCNx64"-%"SCNx64, &start, &end) == 2 && strchr(line, '-') < strchr(line, ' '))
+            inside = (uint64_t) Table.buckets < end
+                  && (uint64_t) Table.buckets + (Table.hashMask + 1) * sizeof(TTBucket) > start;
+
+        else if (inside && sscanf(line, "AnonHugePages: %"SCNu64, &start) == 1)
+            kilobytes += start;
+    }
+
+    fclose(fin);
+    return kilobytes;
+}
+
+static void* tt_alloc_shared(uint64_t size, bool *created) {
+
+    // Attach to the POSIX shared memory segment named by HashShared, or create
+    // it if no other process has done so. The segment holds a TTFileHeader, so
+    // that attaching processes may verify they agree on the size and layout.
+    // A segment still being set up by its creator is waited on for a while
+
+    const int tries = 100, wait = 10000; // Up to a second, in microseconds
+    const uint64_t total = TT_FILE_HEADER + size;
+    TTFileHeader *mem;
+    struct stat st = {0};
+    int fd, i;
+
+    if ((fd = shm_open(TTSharedName, O_RDWR | O_CREAT | O_EXCL, 0600)) != -1) {
+
+        if (ftruncate(fd, total) == -1) {
+            printf("info string unable to size shared Hash %s\n", TTSharedName);
+            return close(fd), shm_unlink(TTSharedName), NULL;
+        }
+
+        *created = TRUE;
+    }
+
+    else if ((fd = shm_open(TTSharedName, O_RDWR, 0600)) != -1) {
+
+        for (i = 0; !fstat(fd, &st) && !st.st_size && i < tries; i++)
+            usleep(wait);
+
+        if ((uint64_t) st.st_size != total) {
+            printf("info string shared Hash %s is %"PRIu64"MB, not %"PRIu64"MB\n", TTSharedName,
+                (uint64_t) MAX(0, (int64_t) st.st_size - TT_FILE_HEADER) >> 20, size >> 20);
+            return close(fd), NULL;
+        }
+
+        *created = FALSE;
+    }
+
+    else return printf("info string unable to open shared Hash %s\n", TTSharedName), NULL;
+
+    mem = mmap(NULL, total, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+
+    if (mem == MAP_FAILED)
+        return NULL;
+
+    // The creator fills in the header, and then publishes the magic last
+    if (*created) {
+        mem->bucketBytes = TT_BUCKET_BYTES;
+        mem->hashMask    = size / sizeof(TTBucket) - 1;
+        mem->generation  = 0;
+        __atomic_store_n(&mem->magic, TT_FILE_MAGIC, __ATOMIC_RELEASE);
+    }
+
+    else {
+
+        for (i = 0; __atomic_load_n(&mem->magic, __ATOMIC_ACQUIRE) != TT_FILE_MAGIC && i < tries; i++)
+            usleep(wait);
+
+        if (mem->magic != TT_FILE_MAGIC) {
+            printf("info string shared Hash %s was never made ready by its creator\n", TTSharedName);
+            return munmap(mem, total), NULL;
+        }
+
+        if (mem->bucketBytes != TT_BUCKET_BYTES || mem->hashMask != size / sizeof(TTBucket) - 1) {
+            printf("info string shared Hash %s has %d byte Buckets, not %d\n",
+                TTSharedName, (int) mem->bucketBytes, TT_BUCKET_BYTES);
+            return munmap(mem, total), NULL;
+        }
+    }
+
+    TTSharedSeen = __atomic_load_n(&mem->generation, __ATOMIC_RELAXED);
+    return TTShared = mem, (char*) mem + TT_FILE_HEADER;
+}
+
+#endif
+
+static void tt_free() {
+
+#if defined(__linux__) && !defined(__ANDROID__)
+    if (TTShared != NULL) {
+        munmap(TTShared, TT_FILE_HEADER + (Table.hashMask + 1) * sizeof(TTBucket));
+        TTShared = NULL;
+        return;
+    }
+
+    if (TTPageSize || TTFileMapped) {
+        munmap(Table.buckets, (Table.hashMask + 1) * sizeof(TTBucket));
+        return;
+    }
+#endif
+
+    free(Table.buckets);
+}
 
 int tt_init(int nthreads, int megabytes) {
 
     const uint64_t MB = 1ull << 20;
-    uint64_t keySize = 16ull;
+    uint64_t keySize = TT_BUCKET_BYTES == 32 ? 16ull : 15ull;
 
     // Cleanup memory when resizing the table
-    if (Table.hashMask) free(Table.buckets);
+    if (Table.hashMask) tt_free();
 
-    // Default keysize of 16 bits maps to a 2MB TTable
-    assert((1ull << 16ull) * sizeof(TTBucket) == 2 * MB);
+    // Default keysize of 16 (or 15) bits maps to a 2MB TTable
+    assert(sizeof(TTBucket) == TT_BUCKET_BYTES);
+    assert((1ull << keySize) * sizeof(TTBucket) == 2 * MB);
 
     // Find the largest keysize that is still within our given megabytes
     while ((1ull << keySize) * sizeof(TTBucket) <= megabytes * MB / 2) keySize++;
@@ -69,25 +388,173 @@ int tt_init(int nthreads, int megabytes) {
 
 #if defined(__linux__) && !defined(__ANDROID__)
 
-    // On Linux systems we align on 2MB boundaries and request Huge Pages
-    Table.buckets = aligned_alloc(2 * MB, (1ull << keySize) * sizeof(TTBucket));
-    madvise(Table.buckets, (1ull << keySize) * sizeof(TTBucket), MADV_HUGEPAGE);
+    // Attach to a Table shared with other processes, when requested. Only
+    // the process which created the shared memory will clear the Table
+    bool created = FALSE;
+    TTPageSize = 0, TTFileMapped = FALSE;
+    if (   TTSharedName[0] != '\0'
+        && (Table.buckets = tt_alloc_shared((1ull << keySize) * sizeof(TTBucket), &created))) {
+        Table.hashMask   = (1ull << keySize) - 1u;
+        Table.sliceMask  = Table.hashMask;
+        Table.generation = (uint8_t) TTSharedSeen;
+        if (created) tt_clear_sections(nthreads);
+        return ((Table.hashMask + 1) * sizeof(TTBucket)) / MB;
+    }
+
+    // On Linux systems we first try for explicitly reserved Huge Pages. Failing
+    // that, we align on 2MB boundaries and request Transparent Huge Pages instead
+    if (!(Table.buckets = tt_alloc_hugetlb((1ull << keySize) * sizeof(TTBucket)))) {
+        Table.buckets = aligned_alloc(2 * MB, (1ull << keySize) * sizeof(TTBucket));
+        madvise(Table.buckets, (1ull << keySize) * sizeof(TTBucket), MADV_HUGEPAGE);
+    }
 #else
 
     // Otherwise, we simply allocate as usual and make no requests
     Table.buckets = malloc((1ull << keySize) * sizeof(TTBucket));
 #endif
 
-    // Save the lookup mask
-    Table.hashMask = (1ull << keySize) - 1u;
+    // Save the lookup mask, with every Thread sharing the entire Table. A new
+    // Table starts back at the first generation, so that a fresh Table always
+    // ages its entries in the same way, no matter how many searches came before
+    Table.hashMask = Table.sliceMask = (1ull << keySize) - 1u;
+    Table.generation = 0;
+
+    // Apply any NUMA policy before touching the memory
+    tt_numa_place((1ull << keySize) * sizeof(TTBucket));
 
     // Clear the table and load everything into the cache
-    tt_clear(nthreads);
+    tt_clear_sections(nthreads);
 
     // Return the number of MB actually allocated for the TTable
     return ((Table.hashMask + 1) * sizeof(TTBucket)) / MB;
 }
 
+void tt_report_pages() {
+
+    /// Report the page size backing the Table. Transparent Huge Pages are only
+    /// a hint to the kernel, so we report how much of the Table they back
+
+    const uint64_t size = (Table.hashMask + 1) * sizeof(TTBucket);
+
+#if defined(__linux__) && !defined(__ANDROID__)
+
+    if (TTPageSize) {
+        printf("info string Hash using %s huge pages\n", TTPageSize == (1ull << 30) ? "1GB" : "2MB");
+        return;
+    }
+
+    printf("info string Hash using transparent huge pages for %.1f%% of the table\n",
+        MIN(100.0, 100.0 * tt_thp_kilobytes() * 1024 / size));
+
+#else
+    (void) size;
+    printf("info string Hash using default pages\n");
+#endif
+}
+
+bool tt_save(const char *fname) {
+
+    /// Write out the entire Table, preceded by a fixed size header. The header is
+    /// padded to TT_FILE_HEADER bytes, so that the Buckets begin on a page boundary
+    /// within the file, allowing tt_load() to map them into memory directly
+
+    char header[TT_FILE_HEADER] = {0};
+    const uint64_t size = (Table.hashMask + 1) * sizeof(TTBucket);
+    TTFileHeader info = { TT_FILE_MAGIC, TT_BUCKET_BYTES, Table.generation, Table.hashMask };
+    FILE *fout = fopen(fname, "wb");
+
+    if (fout == NULL) return FALSE;
+
+    memcpy(header, &info, sizeof(TTFileHeader));
+
+    bool success = fwrite(header, 1, TT_FILE_HEADER, fout) == TT_FILE_HEADER
+                && fwrite(Table.buckets, 1, size, fout) == size;
+
+    return fclose(fout) == 0 && success;
+}
+
+bool tt_load(const char *fname) {
+
+    /// Replace the Table with the contents of a file written by tt_save(). The
+    /// file must match the current Hash size and Bucket layout. On Linux, the file
+    /// is mapped privately, so the Table is paged in lazily and the file is never
+    /// modified. Otherwise, the Buckets are read into the existing Table. A Table
+    /// attached via HashShared belongs to every attached process, and is refused
+
+    TTFileHeader info;
+    const uint64_t size = (Table.hashMask + 1) * sizeof(TTBucket);
+    FILE *fin;
+
+    if (TTShared != NULL) {
+        printf("info string detach from the shared Hash before loading one\n");
+        return FALSE;
+    }
+
+    if ((fin = fopen(fname, "rb")) == NULL) return FALSE;
+
+    if (   fread(&info, sizeof(TTFileHeader), 1, fin) != 1
+        || info.magic        != TT_FILE_MAGIC
+        || info.bucketBytes  != TT_BUCKET_BYTES
+        || info.hashMask     != Table.hashMask
+        || fseek(fin, TT_FILE_HEADER, SEEK_SET))
+        return fclose(fin), FALSE;
+
+#if defined(__linux__) && !defined(__ANDROID__)
+
+    // Mapping past the end of a truncated file would only fault during a probe
+    struct stat st;
+    if (fstat(fileno(fin), &st) || (uint64_t) st.st_size < TT_FILE_HEADER + size)
+        return fclose(fin), FALSE;
+
+    void *mem = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fileno(fin), TT_FILE_HEADER);
+    fclose(fin);
+
+    if (mem == MAP_FAILED)
+        return FALSE;
+
+    tt_free();
+    Table.buckets = mem;
+    TTPageSize = 0, TTFileMapped = TRUE;
+
+#else
+
+    bool success = fread(Table.buckets, 1, size, fin) == size;
+    fclose(fin);
+
+    if (!success) {
+        memset(Table.buckets, 0, size);
+        return FALSE;
+    }
+
+#endif
+
+    Table.generation = (uint8_t) info.generation;
+    return TRUE;
+}
+
+int tt_set_shared(int nthreads, const char *name) {
+
+    // Reallocate the Table at the same size, either attaching to the named
+    // shared memory segment, or returning to a private Table for "<empty>"
+
+    const uint64_t MB = 1ull << 20;
+    const int megabytes = ((Table.hashMask + 1) * sizeof(TTBucket)) / MB;
+
+    snprintf(TTSharedName, sizeof(TTSharedName), "%s", strcmp(name, "<empty>") ? name : "");
+    tt_init(nthreads, megabytes);
+
+    return TTShared != NULL;
+}
+
+int tt_set_numa(int nthreads, int policy) {
+
+    // Reallocate the Table at the same size, so that the new
+    // placement policy is applied before the memory is touched
+
+    TTNumaPolicy = policy;
+    return tt_init(nthreads, ((Table.hashMask + 1) * sizeof(TTBucket)) >> 20);
+}
+
 int tt_hashfull() {
 
     /// Estimate the permill of the table being used, by looking at a thousand
@@ -103,26 +570,33 @@ int tt_hashfull() {
     return used / TT_BUCKET_NB;
 }
 
-bool tt_probe(uint64_t hash, int height, uint16_t *move, int *value, int *eval, int *depth, int *bound) {
+bool tt_probe(Thread *thread, uint64_t hash, uint16_t *move, int *value, int *eval, int *depth, int *bound) {
 
     /// Search for a Transposition matching the provided Zobrist Hash. If one is found,
     /// we update its age in order to indicate that it is still relevant, before copying
-    /// over its contents and signaling to the caller that an Entry was found.
+    /// over its contents and signaling to the caller that an Entry was found. Each slot
+    /// is copied once, and verified via its key, in order to reject any torn Entries.
 
-    const uint16_t hash16 = hash >> 48;
-    TTEntry *slots = Table.buckets[hash & Table.hashMask].slots;
+    const uint32_t key = tt_hash_key(hash);
+    TTBucket *bucket = tt_bucket(thread, hash);
+    TTEntry *slots = bucket->slots;
+
+    thread->ttstats.probes++;
 
     for (int i = 0; i < TT_BUCKET_NB; i++) {
 
-        if (slots[i].hash16 == hash16) {
+        const TTEntry entry = slots[i];
+
+        if (tt_slot_key(bucket, &entry, i) == key) {
 
-            slots[i].generation = Table.generation | (slots[i].generation & TT_MASK_BOUND);
+            thread->ttstats.hits++;
+            slots[i].generation = Table.generation | (entry.generation & TT_MASK_BOUND);
 
-            *move  = slots[i].move;
-            *value = tt_value_from(slots[i].value, height);
-            *eval  = slots[i].eval;
-            *depth = slots[i].depth;
-            *bound = slots[i].generation & TT_MASK_BOUND;
+            *move  = entry.move;
+            *value = tt_value_from(entry.value, thread->height);
+            *eval  = entry.eval;
+            *depth = entry.depth;
+            *bound = entry.generation & TT_MASK_BOUND;
             return TRUE;
         }
     }
@@ -130,47 +604,125 @@ bool tt_probe(uint64_t hash, int height, uint16_t *move, int *value, int *eval,
     return FALSE;
 }
 
-void tt_store(uint64_t hash, int height, uint16_t move, int value, int eval, int depth, int bound) {
+static bool tt_write(TTBucket *bucket, TTStats *stats, uint64_t hash, uint16_t move, int value, int eval, int depth, int bound) {
 
-    int i;
-    const uint16_t hash16 = hash >> 48;
-    TTEntry *slots = Table.buckets[hash & Table.hashMask].slots;
-    TTEntry *replace = slots; // &slots[0]
+    int i, r = 0;
+    const uint32_t key = tt_hash_key(hash);
+    TTEntry *slots = bucket->slots;
+    TTEntry entry;
 
     // Find a matching hash, or replace using MIN(x1, x2, x3),
     // where xN equals the depth minus 4 times the age difference
-    for (i = 0; i < TT_BUCKET_NB && slots[i].hash16 != hash16; i++)
-        if (   replace->depth - ((259 + Table.generation - replace->generation) & TT_MASK_AGE)
+    for (i = 0; i < TT_BUCKET_NB && tt_slot_key(bucket, &slots[i], i) != key; i++)
+        if (   slots[r].depth - ((259 + Table.generation - slots[r].generation) & TT_MASK_AGE)
             >= slots[i].depth - ((259 + Table.generation - slots[i].generation) & TT_MASK_AGE))
-            replace = &slots[i];
+            r = i;
 
     // Prefer a matching hash, otherwise score a replacement
-    replace = (i != TT_BUCKET_NB) ? &slots[i] : replace;
+    r     = (i != TT_BUCKET_NB) ? i : r;
+    entry = slots[r];
+
+    const bool same = key == tt_slot_key(bucket, &entry, r);
+
+    stats->stores++;
 
     // Don't overwrite an entry from the same position, unless we have
     // an exact bound or depth that is nearly as good as the old one
     if (   bound != BOUND_EXACT
-        && hash16 == replace->hash16
-        && depth < replace->depth - 2)
-        return;
+        && same
+        && depth < entry.depth - 2) {
+        stats->skipped++;
+        return false;
+    }
+
+    // Track the reason for having used this particular slot. Only a slot
+    // of all zeroes was never written; others without a bound were stored
+    if (same)
+        stats->updates++;
+    else if (!entry.hash16 && !entry.depth && !entry.generation)
+        stats->empty++;
+    else if ((entry.generation & TT_MASK_BOUND) == BOUND_NONE)
+        stats->unbound++;
+    else if ((entry.generation & TT_MASK_AGE) != Table.generation)
+        stats->aged++;
+    else
+        stats->shallower++;
 
     // Don't overwrite a move if we don't have a new one
-    if (move || hash16 != replace->hash16)
-        replace->move = (uint16_t) move;
+    if (move || !same)
+        entry.move = (uint16_t) move;
+
+    // Build the new Entry locally, and then write it out at once. The
+    // key is computed last, since it is a function of the Entry's data
+    entry.depth      = (int8_t  ) depth;
+    entry.generation = (uint8_t ) bound | Table.generation;
+    entry.value      = (int16_t ) value;
+    entry.eval       = (int16_t ) eval;
+    tt_write_key(bucket, &entry, r, key);
+    slots[r]         = entry;
+
+    return true;
+}
 
-    // Finally, copy the new data into the replaced slot
-    replace->depth      = (int8_t  ) depth;
-    replace->generation = (uint8_t ) bound | Table.generation;
-    replace->value      = (int16_t ) tt_value_to(value, height);
-    replace->eval       = (int16_t ) eval;
-    replace->hash16     = (uint16_t) hash16;
+void tt_store(Thread *thread, uint64_t hash, uint16_t move, int value, int eval, int depth, int bound) {
+
+    const int stored = tt_value_to(value, thread->height);
+
+    // Deep Entries are also sent to any other processes of a cluster
+    if (    tt_write(tt_bucket(thread, hash), &thread->ttstats, hash, move, stored, eval, depth, bound)
+        &&  ClusterSharing && depth >= ClusterDepth)
+        cluster_share(thread, hash, move, stored, eval, depth, bound);
 }
 
+void tt_store_remote(TTStats *stats, uint64_t hash, uint16_t move, int value, int eval, int depth, int bound) {
+
+    // Entries from other processes of a cluster already hold a value which
+    // is independent of the height. They are placed as if for the first slice
+    tt_write(&Table.buckets[hash & Table.sliceMask], stats, hash, move, value, eval, depth, bound);
+}
+
+static int tt_hardware_threads() {
+
+#if defined(_SC_NPROCESSORS_ONLN)
+    return MAX(1, (int) sysconf(_SC_NPROCESSORS_ONLN));
+#else
+    return 1;
+#endif
+}
+
+uint64_t tt_partition(int slices) {
+
+    // Split the Table into equal slices, so that independent searches may each
+    // own one privately, by setting their Thread's ttSlice. Slicing by one will
+    // undo this. Returns the number of Buckets in a slice, a power of two
+
+    Table.sliceMask = (Table.hashMask + 1) / slices - 1;
+    return Table.sliceMask + 1;
+}
+
+void tt_clear_slice(const Thread *thread) {
+
+    // Wipe only the slice of the Table which belongs to this Thread
+    memset(tt_bucket(thread, 0), 0, (Table.sliceMask + 1) * sizeof(TTBucket));
+}
 
 void tt_clear(int nthreads) {
 
-    // Only use 1/4th of the enabled search Threads
-    int nworkers = MAX(1, nthreads / 4);
+    // A shared Table belongs to every attached process, and is only
+    // cleared by its creator, so that one ucinewgame does not wipe it
+
+    if (TTShared == NULL)
+        tt_clear_sections(nthreads);
+}
+
+static void tt_clear_sections(int nthreads) {
+
+    // Spread the work across every hardware thread, since the first touch of
+    // a large Table is bound by page faults, not memory bandwidth. Anything
+    // smaller than 32MB per worker is not worth the cost of an extra thread
+
+    const uint64_t size = (Table.hashMask + 1) * sizeof(TTBucket);
+    const int nworkers  = MAX(1, MIN(MAX(nthreads, tt_hardware_threads()), (int) (size >> 25)));
     pthread_t pthreads[nworkers];
     struct TTClear ttclears[nworkers];
 
@@ -206,15 +758,134 @@ void *tt_clear_threaded(void *cargo) {
     return NULL;
 }
 
+void tt_merge_stats(TTStats *stats, const TTStats *other) {
+
+    uint64_t *dst = (uint64_t*) stats;
+    const uint64_t *src = (const uint64_t*) other;
+
+    for (size_t i = 0; i < sizeof(TTStats) / sizeof(uint64_t); i++)
+        dst[i] += src[i];
+}
+
+void tt_report_stats(const TTStats *stats) {
+
+    #define PERCENT(x, y) (100.0 * (x) / MAX(1ull, (y)))
+
+    printf("info string tt probes %"PRIu64" hits %.1f%% collisions %"PRIu64
+           " stores %"PRIu64" updates %.1f%% empty %.1f%% unbound %.1f%% aged %.1f%% shallower %.1f%% skipped %.1f%%\n",
+        stats->probes, PERCENT(stats->hits, stats->probes), stats->collisions,
+        stats->stores, PERCENT(stats->updates, stats->stores), PERCENT(stats->empty, stats->stores),
+        PERCENT(stats->unbound, stats->stores),
+        PERCENT(stats->aged, stats->stores), PERCENT(stats->shallower, stats->stores),
+        PERCENT(stats->skipped, stats->stores));
+
+    printf("info string pk probes %"PRIu64" hits %.1f%%\n",
+        stats->pkprobes, PERCENT(stats->pkhits, stats->pkprobes));
+
+    printf("info string eval probes %"PRIu64" hits %.1f%%\n",
+        stats->evprobes, PERCENT(stats->evhits, stats->evprobes));
+
+    if (stats->tbprobes)
+        printf("info string tb probes %"PRIu64" cached %.1f%%\n",
+            stats->tbprobes, PERCENT(stats->tbcached, stats->tbprobes));
+
+    #undef PERCENT
+}
+
+
 /// Simple Pawn+King Evaluation Hash Table, which also stores some additional
 /// safety information for use in King Safety, when not using NNUE evaluations
 
+int PKCacheSize = PK_CACHE_DEFAULT;
+
+void initPKCache(Thread *thread) {
+
+    // Round down to a power of two number of entries, and allow zero to
+    // disable the cache entirely. Only the owning Thread touches the memory
+
+    uint64_t entries = (uint64_t) PKCacheSize * 1024 / sizeof(PKEntry);
+    while (entries & (entries - 1)) entries &= entries - 1;
+
+    thread->pktable = entries ? align_malloc(entries * sizeof(PKEntry)) : NULL;
+    thread->pkmask  = entries ? entries - 1 : 0;
+    clearPKCache(thread);
+}
+
+void clearPKCache(Thread *thread) {
+    if (thread->pktable != NULL)
+        memset(thread->pktable, 0, (thread->pkmask + 1) * sizeof(PKEntry));
+}
+
+void freePKCache(Thread *thread) {
+    align_free(thread->pktable);
+}
+
 PKEntry* getCachedPawnKingEval(Thread *thread, const Board *board) {
-    PKEntry *pke = &thread->pktable[board->pkhash & PK_CACHE_MASK];
+
+    if (thread->pktable == NULL)
+        return NULL;
+
+    PKEntry *pke = &thread->pktable[board->pkhash & thread->pkmask];
+    thread->ttstats.pkprobes++;
+    thread->ttstats.pkhits += pke->pkhash == board->pkhash;
     return pke->pkhash == board->pkhash ? pke : NULL;
 }
 
 void storeCachedPawnKingEval(Thread *thread, const Board *board, uint64_t passed, int eval, int safety[2]) {
-    PKEntry *pke = &thread->pktable[board->pkhash & PK_CACHE_MASK];
+
+    if (thread->pktable == NULL)
+        return;
+
+    PKEntry *pke = &thread->pktable[board->pkhash & thread->pkmask];
     *pke = (PKEntry) { board->pkhash, passed, eval, safety[WHITE], safety[BLACK] };
 }
+
+
+/// Per-Thread cache of complete evaluations, for both the classical evaluation
+/// and the NNUE. Sized by the EvalCache option, and rebuilt along with the Threads
+
+int EvalCacheSize = EVAL_CACHE_DEFAULT;
+
+void initEvalCache(Thread *thread) {
+
+    // Round down to a power of two number of entries, and allow zero to
+    // disable the cache entirely. Only the owning Thread touches the memory
+
+    uint64_t entries = (uint64_t) EvalCacheSize * 1024 / sizeof(uint64_t);
+    while (entries & (entries - 1)) entries &= entries - 1;
+
+    thread->evtable = entries ? align_malloc(entries * sizeof(uint64_t)) : NULL;
+    thread->evmask  = entries ? entries - 1 : 0;
+    clearEvalCache(thread);
+}
+
+void clearEvalCache(Thread *thread) {
+    if (thread->evtable != NULL)
+        memset(thread->evtable, 0, (thread->evmask + 1) * sizeof(uint64_t));
+}
+
+void freeEvalCache(Thread *thread) {
+    align_free(thread->evtable);
+}
+
+bool getCachedEvaluation(Thread *thread, const Board *board, int *eval) {
+
+    if (thread->evtable == NULL)
+        return false;
+
+    const uint64_t entry = thread->evtable[board->hash & thread->evmask];
+    const bool hit = ((entry ^ board->hash) >> 16) == 0;
+
+    thread->ttstats.evprobes++;
+    thread->ttstats.evhits += hit;
+
+    *eval = (int16_t) (entry & 0xFFFF);
+    return hit;
+}
+
+void storeCachedEvaluation(Thread *thread, const Board *board, int eval) {
+
+    // Evaluations outside of 16 bits are not worth keeping
+    if (thread->evtable != NULL && eval == (int16_t) eval)
+        thread->evtable[board->hash & thread->evmask] = (board->hash & ~0xFFFFull) | (uint16_t) eval;
+}
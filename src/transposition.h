@@ -46,9 +46,15 @@
 /// as well as those which come from a lower depth. However, sometimes we do
 /// not replace any such entry, if it would be too harmful to do so.
 ///
+/// When built with USE_TT_BUCKET64, Buckets are instead a full cache-line of
+/// 64-bytes, containing six Entries. A probe then costs the same single line
+/// of memory, but twice as many Entries compete for each replacement. The four
+/// spare bytes pack five more key bits for each Entry, so that the wider search
+/// does not also raise the rate of false matches.
+///
 /// The minimum size of the Transposition Table is 2MB. This is so that we
-/// can lookup the table with at least 16-bits, and so that we may align the
-/// Table on a 2MB memory boundary, when available via the Operating System.
+/// can lookup the table with at least 15 or 16-bits, and so that we may align
+/// the Table on a 2MB memory boundary, when available via the Operating System.
 
 enum {
     BOUND_NONE  = 0,
@@ -58,7 +64,25 @@ enum {
 
     TT_MASK_BOUND = 0x03,
     TT_MASK_AGE   = 0xFC,
-    TT_BUCKET_NB  = 3,
+
+#if defined(USE_TT_BUCKET64)
+    TT_BUCKET_NB    = 6,
+    TT_BUCKET_BYTES = 64,
+    TT_KEY_EXTEND   = 5,
+#else
+    TT_BUCKET_NB    = 3,
+    TT_BUCKET_BYTES = 32,
+#endif
+};
+
+/// On multi-socket Linux systems, the Table may be explicitly placed across the
+/// NUMA nodes, either interleaved page by page, or split into one contiguous slice
+/// per node. By default, placement is left to whichever threads first touch it.
+
+enum {
+    TT_NUMA_NONE       = 0,
+    TT_NUMA_INTERLEAVE = 1,
+    TT_NUMA_BIND       = 2,
 };
 
 struct TTEntry {
@@ -70,25 +94,70 @@ struct TTEntry {
 
 struct TTBucket {
     TTEntry slots[TT_BUCKET_NB];
+#if defined(USE_TT_BUCKET64)
+    uint32_t extended; // TT_KEY_EXTEND more key bits per Entry
+#else
     uint16_t padding;
+#endif
+};
+
+/// Each Thread counts its own accesses to the Table, and to its Pawn King and Eval
+/// tables, in order to judge how well a given Hash size and Bucket layout performs.
+/// Stores are counted by the reason for picking the slot, or for skipping the store.
+/// Syzygy WDL probes are counted here as well, along with those the cache answered
+
+struct TTStats {
+    uint64_t probes, hits, collisions;
+    uint64_t stores, updates, empty, unbound, aged, shallower, skipped;
+    uint64_t pkprobes, pkhits;
+    uint64_t evprobes, evhits;
+    uint64_t tbprobes, tbcached;
+};
+
+/// The Table may be saved to, and later loaded from, disk. Files consist of a
+/// header, padded to 64KB to be page aligned on all common systems, followed by
+/// the raw Buckets. Only files matching the current Hash size may be loaded.
+
+enum {
+    TT_FILE_HEADER = 1 << 16,
 };
 
+#define TT_FILE_MAGIC (0x4554485454424C31ull) // "ETHTTBL1"
+
+typedef struct TTFileHeader {
+    uint64_t magic;
+    uint32_t bucketBytes, generation;
+    uint64_t hashMask;
+} TTFileHeader;
+
 struct TTable {
     TTBucket *buckets;
-    uint64_t hashMask;
+    uint64_t hashMask, sliceMask;
     uint8_t generation;
 };
 
 void tt_update();
-void tt_prefetch(uint64_t hash);
+void tt_prefetch(const Thread *thread, uint64_t hash);
 
 int tt_init(int nthreads, int megabytes);
+int tt_set_numa(int nthreads, int policy);
+int tt_set_shared(int nthreads, const char *name);
+bool tt_save(const char *fname);
+bool tt_load(const char *fname);
+void tt_report_placement();
+void tt_report_pages();
 int tt_hashfull();
-bool tt_probe(uint64_t hash, int height, uint16_t *move, int *value, int *eval, int *depth, int *bound);
-void tt_store(uint64_t hash, int height, uint16_t move, int value, int eval, int depth, int bound);
+bool tt_probe(Thread *thread, uint64_t hash, uint16_t *move, int *value, int *eval, int *depth, int *bound);
+void tt_store(Thread *thread, uint64_t hash, uint16_t move, int value, int eval, int depth, int bound);
+void tt_store_remote(TTStats *stats, uint64_t hash, uint16_t move, int value, int eval, int depth, int bound);
+
+void tt_merge_stats(TTStats *stats, const TTStats *other);
+void tt_report_stats(const TTStats *stats);
 
 struct TTClear { int index, count; };
 void tt_clear(int nthreads);
+uint64_t tt_partition(int slices);
+void tt_clear_slice(const Thread *thread);
 void *tt_clear_threaded(void *cargo);
 
 /// The Pawn King table contains saved evaluations, and additional Pawn information
@@ -97,15 +166,41 @@ void *tt_clear_threaded(void *cargo);
 ///
 /// While this table is seldom accessed when using Ethereal NNUE, the table generally has
 /// an extremely high, 95%+ hit rate, generating a substantial overall speedup to Ethereal.
+/// The size, per Thread, is set by the PKCache UCI option. Many small instances running
+/// side by side may shrink it, or disable it entirely, in order to save memory
 
 enum {
-    PK_CACHE_KEY_SIZE = 16,
-    PK_CACHE_MASK     = 0xFFFF,
-    PK_CACHE_SIZE     = 1 << PK_CACHE_KEY_SIZE,
+    PK_CACHE_DEFAULT = 2048, // Kilobytes per Thread
+    PK_CACHE_MAX     = 65536,
 };
 
 struct PKEntry { uint64_t pkhash, passed; int eval, safetyw, safetyb; };
-typedef PKEntry PKTable[PK_CACHE_SIZE];
+
+void initPKCache(Thread *thread);
+void clearPKCache(Thread *thread);
+void freePKCache(Thread *thread);
 
 PKEntry* getCachedPawnKingEval(Thread *thread, const Board *board);
 void storeCachedPawnKingEval(Thread *thread, const Board *board, uint64_t passed, int eval, int safety[2]);
+
+/// Each Thread also caches complete evaluations, keyed on the full Zobrist hash,
+/// since the quiescence search and re-searches visit the same positions often and
+/// the TT does not always supply the eval. Entries pack the upper 48 bits of the
+/// hash with the final 16 bit evaluation, eight to a cache line, so that a probe
+/// is a single load. The size, per Thread, is set by the EvalCache UCI option.
+///
+/// Since the Table keeps the static eval of nearly every node, including those of
+/// the quiescence search, this cache rarely hits ( under 1% of bench probes, even
+/// at 64KB ), and costs more than it saves. It is disabled unless requested
+
+enum {
+    EVAL_CACHE_DEFAULT = 0, // Kilobytes per Thread
+    EVAL_CACHE_MAX     = 65536,
+};
+
+void initEvalCache(Thread *thread);
+void clearEvalCache(Thread *thread);
+void freeEvalCache(Thread *thread);
+
+bool getCachedEvaluation(Thread *thread, const Board *board, int *eval);
+void storeCachedEvaluation(Thread *thread, const Board *board, int eval);
@@ -18,10 +18,17 @@
 
 #ifdef TUNE
 
+#include <inttypes.h>
 #include <math.h>
+#include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/stat.h>
+
+#if !defined(_WIN32) && !defined(_WIN64)
+    #include <sys/mman.h>
+#endif
 
 #include "bitboards.h"
 #include "board.h"
@@ -38,7 +45,10 @@
 
 // Internal Memory Managment
 TTuple* TupleStack;
-int TupleStackSize = STACKSIZE;
+int TupleStackSize = 0;
+int64_t TupleCount;  // Tuples claimed by all of the Entries
+int NPositions;      // Total Training samples in DATAFILE
+int NTraining;       // Leading Entries trained on, the rest validate
 
 // Tap into evaluate()
 extern EvalTrace T, EmptyTrace;
@@ -122,49 +132,90 @@ void runTuner() {
 
     TEntry *entries;
     TArray methods = {0};
-    TVector params = {0}, cparams = {0}, adagrad = {0};
+    TVector params = {0}, cparams = {0}, best = {0};
+    TOptimizer optimizer;
     Thread *thread = createThreadPool(1);
-    double K, error, rate = LRRATE;
-
-    const int tentryMB = (int)(NPOSITIONS * sizeof(TEntry) / (1 << 20));
-    const int ttupleMB = (int)(STACKSIZE  * sizeof(TTuple) / (1 << 20));
+    double K, error, verror;
 
+    memset(&optimizer, 0, sizeof(TOptimizer));
     setvbuf(stdout, NULL, _IONBF, 0);
     printf("Tuner will be tuning 2x%d Terms\n", NTERMS);
-    printf("Allocating Memory for Tuner Entries [%dMB]\n", tentryMB);
-    printf("Allocating Memory for Tuner Tuple Stack [%dMB]\n", ttupleMB);
     printf("Saving the current value for each Term as a starting point\n");
     printf("Marking each Term based on method { NORMAL, SAFETY, COMPLEXITY }\n\n");
 
-    entries    = calloc(NPOSITIONS, sizeof(TEntry));
-    TupleStack = calloc(STACKSIZE , sizeof(TTuple));
-
     initCurrentParameters(cparams);
     initMethodManager(methods);
-    initTunerEntries(entries, thread, methods);
-    K = computeOptimalK(entries);
 
-    for (int epoch = 0; epoch < MAXEPOCHS; epoch++) {
+    // Entries only change with the dataset, the Terms being tuned, or their
+    // current values. Otherwise, reuse the Entries from the previous run
+
+    const uint64_t key = tunerCacheKey(cparams, methods);
+
+    if ((entries = loadTunerCache(key)) == NULL) {
+
+        NPositions = countTunerEntries();
+        printf("Allocating Memory for Tuner Entries [%dMB]\n",
+            (int)(NPositions * sizeof(TEntry) / (1 << 20)));
+
+        entries = calloc(NPositions, sizeof(TEntry));
+        initTunerEntries(entries, thread, methods);
+        saveTunerCache(entries, key);
+    }
+
+    printf("\nUsing %d Entries [%dMB] and %"PRId64" Tuples [%dMB]\n", NPositions,
+        (int)(NPositions * sizeof(TEntry) / (1 << 20)), TupleCount,
+        (int)(TupleCount * sizeof(TTuple) / (1 << 20)));
+
+    // DATAFILE is expected to be shuffled already, so the trailing Entries
+    // are held out as is. Without any, stop on the training error instead
+
+    NTraining = NPositions - (int) (NPositions * VALIDATION);
+    printf("Training on %d Entries, and validating on %d Entries\n",
+        NTraining, NPositions - NTraining);
+
+    TCheckpoint state = { CHECKPOINTMAGIC, key, OPTIMIZER, NTraining, 0, 0, LRRATE, 1e9 };
+    loadTunerCheckpoint(key, &state, params, best, &optimizer);
+
+    K = computeOptimalK(entries);
 
-        for (int batch = 0; batch < NPOSITIONS / BATCHSIZE; batch++) {
+    for (; state.epoch < MAXEPOCHS; state.epoch++) {
 
+        for (int batch = 0; batch < NTraining / BATCHSIZE; batch++) {
             TVector gradient = {0};
             computeGradient(entries, gradient, params, methods, K, batch);
-
-            for (int i = 0; i < NTERMS; i++) {
-                adagrad[i][MG] += pow((K / 200.0) * gradient[i][MG] / BATCHSIZE, 2.0);
-                adagrad[i][EG] += pow((K / 200.0) * gradient[i][EG] / BATCHSIZE, 2.0);
-                params[i][MG] += (K / 200.0) * (gradient[i][MG] / BATCHSIZE) * (rate / sqrt(1e-8 + adagrad[i][MG]));
-                params[i][EG] += (K / 200.0) * (gradient[i][EG] / BATCHSIZE) * (rate / sqrt(1e-8 + adagrad[i][EG]));
-            }
+            updateParameters(params, gradient, &optimizer, K, state.rate);
         }
 
-        error = tunedEvaluationErrors(entries, params, methods, K);
-        if (epoch && epoch % LRSTEPRATE == 0) rate = rate / LRDROPRATE;
-        if (epoch % REPORTING == 0) printParameters(params, cparams);
+        error  = tunedEvaluationErrors(entries, NTraining, params, methods, K);
+        verror = NTraining == NPositions ? error
+               : tunedEvaluationErrors(entries + NTraining, NPositions - NTraining, params, methods, K);
+
+        // Report the parameters from the best epoch, rather than the last one
+        if (verror < state.best) {
+            state.best = verror, state.stale = 0;
+            memcpy(best, params, sizeof(TVector));
+        } else state.stale++;
+
+        if (state.epoch && state.epoch % LRSTEPRATE == 0) state.rate = state.rate / LRDROPRATE;
+        if (state.epoch % REPORTING == 0) printParameters(params, cparams);
 
-        printf("\rEpoch [%d] Error = [%.9f], Rate = [%g]", epoch, error, rate);
+        printf("\rEpoch [%d] Error = [%.9f], Validation = [%.9f], Rate = [%g]",
+            state.epoch, error, verror, state.rate);
+
+        if (PATIENCE && state.stale >= PATIENCE) {
+            printf("\nStopping, as %d Epochs have passed without improvement\n", PATIENCE);
+            break;
+        }
+
+        // Record this epoch as complete, so a resumed run starts after it
+        if ((state.epoch + 1) % CHECKPOINT == 0) {
+            TCheckpoint saved = state; saved.epoch++;
+            saveTunerCheckpoint(&saved, params, best, &optimizer);
+        }
     }
+
+    printf("\nBest Validation Error = [%.9f]\n", state.best);
+    printParameters(best, cparams);
 }
 
 void initCurrentParameters(TVector cparams) {
@@ -203,12 +254,227 @@ void initCoefficients(TVector coeffs) {
     }
 }
 
+int countTunerEntries() {
+
+    int count = 0;
+    char line[256];
+    FILE *fin = fopen(DATAFILE, "r");
+
+    if (fin == NULL) {
+        printf("Unable to open %s\n", DATAFILE);
+        exit(EXIT_FAILURE);
+    }
+
+    while (fgets(line, 256, fin) != NULL)
+        count++;
+
+    fclose(fin);
+    return count;
+}
+
+uint64_t tunerCacheKey(TVector cparams, TArray methods) {
+
+    // FNV-1a over everything that the Entries are derived from. The dataset
+    // is identified by its size and modification time, rather than reading it.
+    // Entries also depend on the evaluation's logic, which the terms alone do
+    // not capture, so the version and build time of the binary are included
+
+    struct stat st = {0};
+    uint64_t hash = 0xCBF29CE484222325ull;
+
+    const int64_t shape[] = { CACHEVERSION, NTERMS, sizeof(TEntry), sizeof(TTuple) };
+    stat(DATAFILE, &st);
+
+    const int64_t dataset[] = { (int64_t) st.st_size, (int64_t) st.st_mtime };
+    const char build[] = ETHEREAL_VERSION " " __DATE__ " " __TIME__;
+
+    const struct { const void *data; size_t size; } parts[] = {
+        { shape,   sizeof(shape)   }, { dataset, sizeof(dataset) },
+        { cparams, sizeof(TVector) }, { methods, sizeof(TArray)  },
+        { build,   sizeof(build)   },
+    };
+
+    for (size_t i = 0; i < sizeof(parts) / sizeof(parts[0]); i++)
+        for (size_t j = 0; j < parts[i].size; j++)
+            hash = (hash ^ ((const uint8_t*) parts[i].data)[j]) * 0x100000001B3ull;
+
+    return hash;
+}
+
+TEntry* loadTunerCache(uint64_t key) {
+
+    /// Map in the Entries and Tuples saved by a previous run. The Entries are
+    /// mapped privately, since each has its offset into the Tuples replaced by
+    /// a pointer, but the Tuples themselves are simply read from the file
+
+    void *base;
+    TCacheHeader header;
+    FILE *fin = fopen(CACHEFILE, "rb");
+
+    if (fin == NULL)
+        return NULL;
+
+    if (   fread(&header, sizeof(TCacheHeader), 1, fin) != 1
+        || header.magic != CACHEMAGIC || header.key != key) {
+        printf("Ignoring %s, as it was built from other Entries\n", CACHEFILE);
+        fclose(fin);
+        return NULL;
+    }
+
+    const size_t size = sizeof(TCacheHeader)
+                      + header.npositions * sizeof(TEntry)
+                      + header.ntuples    * sizeof(TTuple);
+
+    // An interrupted saveTunerCache() leaves a file shorter than its header claims
+    struct stat st;
+    if (fstat(fileno(fin), &st) || (uint64_t) st.st_size < size) {
+        printf("Ignoring %s, as it is truncated\n", CACHEFILE);
+        fclose(fin);
+        return NULL;
+    }
+
+#if defined(_WIN32) || defined(_WIN64)
+    rewind(fin);
+    base = malloc(size);
+    if (fread(base, 1, size, fin) != size)
+        free(base), base = NULL;
+#else
+    base = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fileno(fin), 0);
+    if (base == MAP_FAILED) base = NULL;
+#endif
+
+    fclose(fin);
+
+    if (base == NULL) {
+        printf("Unable to load %s\n", CACHEFILE);
+        return NULL;
+    }
+
+    TEntry *entries = (TEntry*) ((char*) base + sizeof(TCacheHeader));
+    TTuple *tuples  = (TTuple*) (entries + header.npositions);
+
+    for (int64_t i = 0; i < header.npositions; i++)
+        entries[i].tuples = tuples + (uintptr_t) entries[i].tuples;
+
+    NPositions = (int) header.npositions;
+    TupleCount = header.ntuples;
+
+    printf("Loaded %d Entries from %s\n", NPositions, CACHEFILE);
+    return entries;
+}
+
+void saveTunerCache(TEntry *entries, uint64_t key) {
+
+    /// Save the Entries, followed by all of their Tuples. Each Entry records
+    /// the offset of its first Tuple, in place of the pointer to it
+
+    TCacheHeader header = { CACHEMAGIC, key, NPositions, TupleCount };
+    FILE *fout = fopen(CACHEFILE, "wb");
+    uint64_t offset = 0;
+    bool okay;
+
+    if (fout == NULL) {
+        printf("\nUnable to save the Entries to %s\n", CACHEFILE);
+        return;
+    }
+
+    okay = fwrite(&header, sizeof(TCacheHeader), 1, fout) == 1;
+
+    for (int i = 0; okay && i < NPositions; offset += entries[i++].ntuples) {
+        TEntry entry = entries[i];
+        entry.tuples = (TTuple*) (uintptr_t) offset;
+        okay = fwrite(&entry, sizeof(TEntry), 1, fout) == 1;
+    }
+
+    for (int i = 0; okay && i < NPositions; i++)
+        okay = fwrite(entries[i].tuples, sizeof(TTuple), entries[i].ntuples, fout) == (size_t) entries[i].ntuples;
+
+    fclose(fout);
+
+    // A partial file would be rejected later, but is best removed now
+    if (!okay) remove(CACHEFILE);
+
+    printf("\n%s the Entries to %s\n", okay ? "Saved" : "Unable to save", CACHEFILE);
+}
+
+bool loadTunerCheckpoint(uint64_t key, TCheckpoint *state, TVector params, TVector best, TOptimizer *optimizer) {
+
+    /// Resume from a previous run, provided that it was tuning the same
+    /// Entries, with the same Optimizer, against the same validation split
+
+    TCheckpoint header;
+    FILE *fin = fopen(CHECKPOINTFILE, "rb");
+    bool okay;
+
+    if (fin == NULL)
+        return false;
+
+    okay =  fread(&header, sizeof(TCheckpoint), 1, fin) == 1
+         && header.magic     == CHECKPOINTMAGIC && header.key == key
+         && header.optimizer == state->optimizer
+         && header.ntraining == state->ntraining;
+
+    if (!okay) {
+        printf("Ignoring %s, as it was saved from another setup\n", CHECKPOINTFILE);
+        fclose(fin);
+        return false;
+    }
+
+    okay =  fread(params,    sizeof(TVector),    1, fin) == 1
+         && fread(best,      sizeof(TVector),    1, fin) == 1
+         && fread(optimizer, sizeof(TOptimizer), 1, fin) == 1;
+
+    fclose(fin);
+
+    if (!okay) {
+        printf("Unable to load %s\n", CHECKPOINTFILE);
+        memset(params,    0, sizeof(TVector));
+        memset(best,      0, sizeof(TVector));
+        memset(optimizer, 0, sizeof(TOptimizer));
+        return false;
+    }
+
+    *state = header;
+    printf("Resuming from Epoch [%d] of %s\n", state->epoch, CHECKPOINTFILE);
+    return true;
+}
+
+void saveTunerCheckpoint(TCheckpoint *state, TVector params, TVector best, TOptimizer *optimizer) {
+
+    /// Write to a temporary file, and only then replace the old checkpoint,
+    /// so that being killed part way through a save loses nothing
+
+    FILE *fout = fopen(CHECKPOINTTEMP, "wb");
+    bool okay;
+
+    if (fout == NULL) {
+        printf("\nUnable to save a checkpoint to %s\n", CHECKPOINTFILE);
+        return;
+    }
+
+    okay =  fwrite(state,     sizeof(TCheckpoint), 1, fout) == 1
+         && fwrite(params,    sizeof(TVector),     1, fout) == 1
+         && fwrite(best,      sizeof(TVector),     1, fout) == 1
+         && fwrite(optimizer, sizeof(TOptimizer),  1, fout) == 1;
+
+    okay = (fclose(fout) == 0) && okay;
+
+#if defined(_WIN32) || defined(_WIN64)
+    if (okay) remove(CHECKPOINTFILE);
+#endif
+
+    if (!okay || rename(CHECKPOINTTEMP, CHECKPOINTFILE) != 0) {
+        printf("\nUnable to save a checkpoint to %s\n", CHECKPOINTFILE);
+        remove(CHECKPOINTTEMP);
+    }
+}
+
 void initTunerEntries(TEntry *entries, Thread *thread, TArray methods) {
 
     char line[256];
-    FILE *fin = fopen("FENS", "r");
+    FILE *fin = fopen(DATAFILE, "r");
 
-    for (int i = 0; i < NPOSITIONS; i++) {
+    for (int i = 0; i < NPositions; i++) {
 
         if (fgets(line, 256, fin) == NULL)
             exit(EXIT_FAILURE);
@@ -226,8 +492,8 @@ void initTunerEntries(TEntry *entries, Thread *thread, TArray methods) {
         initTunerEntry(&entries[i], thread, &thread->board, methods);
 
         // Occasional reporting for total completion
-        if ((i + 1) % 10000 == 0 || i == NPOSITIONS - 1)
-            printf("\rSetting up Entries from FENs [%8d of %8d]", i + 1, NPOSITIONS);
+        if ((i + 1) % 10000 == 0 || i == NPositions - 1)
+            printf("\rSetting up Entries from FENs [%8d of %8d]", i + 1, NPositions);
     }
 
     fclose(fin);
@@ -268,19 +534,18 @@ void initTunerEntry(TEntry *entry, Thread *thread, Board *board, TArray methods)
 
 void initTunerTuples(TEntry *entry, TVector coeffs, TArray methods) {
 
-    int ttupleMB, length = 0, tidx = 0;
+    int length = 0, tidx = 0;
 
     // Sum up any actively used terms
     for (int i = 0; i < NTERMS; i++)
         length += (methods[i] == NORMAL &&  coeffs[i][WHITE] - coeffs[i][BLACK] != 0.0)
                || (methods[i] != NORMAL && (coeffs[i][WHITE] != 0.0 || coeffs[i][BLACK] != 0.0));
 
-    // Allocate additional memory if needed
+    // Start another chunk of the arena if needed. Nothing is
+    // freed, so any remainder of the previous chunk is wasted
     if (length > TupleStackSize) {
-        TupleStackSize = STACKSIZE;
-        TupleStack = calloc(STACKSIZE, sizeof(TTuple));
-        ttupleMB = STACKSIZE  * sizeof(TTuple) / (1 << 20);
-        printf(" Allocating Tuner Tuples [%dMB]\n", ttupleMB);
+        TupleStackSize = MAX(TUPLECHUNK, length);
+        TupleStack = malloc(TupleStackSize * sizeof(TTuple));
     }
 
     // Claim part of the Tuple Stack
@@ -288,11 +553,18 @@ void initTunerTuples(TEntry *entry, TVector coeffs, TArray methods) {
     entry->ntuples  = length;
     TupleStack     += length;
     TupleStackSize -= length;
+    TupleCount     += length;
+
+    // Finally setup each of our TTuples. The NORMAL Terms come first, so
+    // that they may be handled without checking the method of each Term
+    for (int i = 0; i < NTERMS; i++)
+        if (methods[i] == NORMAL && coeffs[i][WHITE] - coeffs[i][BLACK] != 0.0)
+            entry->tuples[tidx++] = (TTuple) { i, coeffs[i][WHITE], coeffs[i][BLACK] };
+
+    entry->nnormal = tidx;
 
-    // Finally setup each of our TTuples
     for (int i = 0; i < NTERMS; i++)
-        if (   (methods[i] == NORMAL &&  coeffs[i][WHITE] - coeffs[i][BLACK] != 0.0)
-            || (methods[i] != NORMAL && (coeffs[i][WHITE] != 0.0 || coeffs[i][BLACK] != 0.0)))
+        if (methods[i] != NORMAL && (coeffs[i][WHITE] != 0.0 || coeffs[i][BLACK] != 0.0))
             entry->tuples[tidx++] = (TTuple) { i, coeffs[i][WHITE], coeffs[i][BLACK] };
 }
 
@@ -332,26 +604,26 @@ double staticEvaluationErrors(TEntry *entries, double K) {
 
     #pragma omp parallel shared(total)
     {
-        #pragma omp for schedule(static, NPOSITIONS / NPARTITIONS) reduction(+:total)
-        for (int i = 0; i < NPOSITIONS; i++)
+        #pragma omp for schedule(static) reduction(+:total)
+        for (int i = 0; i < NTraining; i++)
             total += pow(entries[i].result - sigmoid(K, entries[i].seval), 2);
     }
 
-    return total / (double) NPOSITIONS;
+    return total / (double) NTraining;
 }
 
-double tunedEvaluationErrors(TEntry *entries, TVector params, TArray methods, double K) {
+double tunedEvaluationErrors(TEntry *entries, int length, TVector params, TArray methods, double K) {
 
     double total = 0.0;
 
     #pragma omp parallel shared(total)
     {
-        #pragma omp for schedule(static, NPOSITIONS / NPARTITIONS) reduction(+:total)
-        for (int i = 0; i < NPOSITIONS; i++)
+        #pragma omp for schedule(static) reduction(+:total)
+        for (int i = 0; i < length; i++)
             total += pow(entries[i].result - sigmoid(K, linearEvaluation(&entries[i], params, methods, NULL)), 2);
     }
 
-    return total / (double) NPOSITIONS;
+    return total / (double) length;
 }
 
 double sigmoid(double K, double E) {
@@ -363,11 +635,18 @@ double linearEvaluation(TEntry *entry, TVector params, TArray methods, TGradient
 
     double sign, mixed;
     double midgame, endgame, wsafety[2], bsafety[2];
-    double normal[PHASE_NB], safety[PHASE_NB], complexity;
+    double normal[PHASE_NB] = {0}, safety[PHASE_NB], complexity;
     double mg[METHOD_NB][COLOUR_NB] = {0}, eg[METHOD_NB][COLOUR_NB] = {0};
 
-    // Save any modifications for MG or EG for each evaluation type
-    for (int i = 0; i < entry->ntuples; i++) {
+    // NORMAL Terms only ever need the difference of the two coefficients
+    for (int i = 0; i < entry->nnormal; i++) {
+        const double coeff = entry->tuples[i].wcoeff - entry->tuples[i].bcoeff;
+        normal[MG] += coeff * params[entry->tuples[i].index][MG];
+        normal[EG] += coeff * params[entry->tuples[i].index][EG];
+    }
+
+    // Save any modifications for MG or EG for each other evaluation type
+    for (int i = entry->nnormal; i < entry->ntuples; i++) {
         int index = entry->tuples[i].index;
         mg[methods[index]][WHITE] += (double) entry->tuples[i].wcoeff * params[index][MG];
         mg[methods[index]][BLACK] += (double) entry->tuples[i].bcoeff * params[index][MG];
@@ -376,8 +655,8 @@ double linearEvaluation(TEntry *entry, TVector params, TArray methods, TGradient
     }
 
     // Grab the original "normal" evaluations and add the modified parameters
-    normal[MG] = (double) ScoreMG(entry->eval) + mg[NORMAL][WHITE] - mg[NORMAL][BLACK];
-    normal[EG] = (double) ScoreEG(entry->eval) + eg[NORMAL][WHITE] - eg[NORMAL][BLACK];
+    normal[MG] += (double) ScoreMG(entry->eval);
+    normal[EG] += (double) ScoreEG(entry->eval);
 
     // Grab the original "safety" evaluations and add the modified parameters
     wsafety[MG] = (double) ScoreMG(entry->safety[WHITE]) + mg[SAFETY][WHITE];
@@ -417,14 +696,19 @@ double linearEvaluation(TEntry *entry, TVector params, TArray methods, TGradient
 
 void computeGradient(TEntry *entries, TVector gradient, TVector params, TArray methods, double K, int batch) {
 
+    // Each Thread sums its own share of the batch into a private gradient,
+    // and only then are those merged, one Thread at a time. The batch is
+    // split evenly between however many Threads OpenMP has decided to use
+
     #pragma omp parallel shared(gradient)
     {
         TVector local = {0};
 
-        #pragma omp for schedule(static, BATCHSIZE / NPARTITIONS)
+        #pragma omp for schedule(static)
         for (int i = batch * BATCHSIZE; i < (batch + 1) * BATCHSIZE; i++)
             updateSingleGradient(&entries[i], local, params, methods, K);
 
+        #pragma omp critical
         for (int i = 0; i < NTERMS; i++) {
             gradient[i][MG] += local[i][MG];
             gradient[i][EG] += local[i][EG];
@@ -444,18 +728,23 @@ void updateSingleGradient(TEntry *entry, TVector gradient, TVector params, TArra
 
     double complexitySign = (data.egeval > 0.0) - (data.egeval < 0.0);
 
-    for (int i = 0; i < entry->ntuples; i++) {
+    // The EG gradient of the NORMAL Terms is zero if complexity took over
+    double egNormal = data.egeval == 0.0 || data.complexity >= -fabs(data.egeval)
+                    ? egBase * entry->sfactor : 0.0;
+
+    for (int i = 0; i < entry->nnormal; i++) {
+        const int index = entry->tuples[i].index;
+        const int coeff = entry->tuples[i].wcoeff - entry->tuples[i].bcoeff;
+        gradient[index][MG] += mgBase   * coeff;
+        gradient[index][EG] += egNormal * coeff;
+    }
+
+    for (int i = entry->nnormal; i < entry->ntuples; i++) {
 
         int index  = entry->tuples[i].index;
         int wcoeff = entry->tuples[i].wcoeff;
         int bcoeff = entry->tuples[i].bcoeff;
 
-        if (methods[index] == NORMAL)
-            gradient[index][MG] += mgBase * (wcoeff - bcoeff);
-
-        if (methods[index] == NORMAL && (data.egeval == 0.0 || data.complexity >= -fabs(data.egeval)))
-            gradient[index][EG] += egBase * (wcoeff - bcoeff) * entry->sfactor;
-
         if (methods[index] == COMPLEXITY && data.complexity >= -fabs(data.egeval))
             gradient[index][EG] += egBase * wcoeff * complexitySign * entry->sfactor;
 
@@ -468,6 +757,36 @@ void updateSingleGradient(TEntry *entry, TVector gradient, TVector params, TArra
 }
 
 
+void updateParameters(TVector params, TVector gradient, TOptimizer *optimizer, double K, double rate) {
+
+    /// The gradient points towards a lower error already. AdamW's decay pulls
+    /// each Term back towards zero, which is to say towards its current value
+
+    const double steps  = (double) ++optimizer->steps;
+    const double mscale = 1.0 / (1.0 - pow(ADAMBETA1, steps));
+    const double vscale = 1.0 / (1.0 - pow(ADAMBETA2, steps));
+
+    for (int i = 0; i < NTERMS; i++) {
+        for (int j = MG; j <= EG; j++) {
+
+            const double g = (K / 200.0) * gradient[i][j] / BATCHSIZE;
+            double *m = &optimizer->momentum[i][j], *v = &optimizer->velocity[i][j];
+
+            if (OPTIMIZER == ADAGRAD) {
+                *v += pow(g, 2.0);
+                params[i][j] += g * (rate / sqrt(1e-8 + *v));
+            }
+
+            else {
+                *m = ADAMBETA1 * *m + (1.0 - ADAMBETA1) * g;
+                *v = ADAMBETA2 * *v + (1.0 - ADAMBETA2) * g * g;
+                if (OPTIMIZER == ADAMW) params[i][j] -= rate * WEIGHTDECAY * params[i][j];
+                params[i][j] += rate * (*m * mscale) / (sqrt(*v * vscale) + 1e-8);
+            }
+        }
+    }
+}
+
 void printParameters(TVector params, TVector cparams) {
 
     TVector tparams;
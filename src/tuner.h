@@ -20,16 +20,25 @@
 
 #pragma once
 
+#include <stdbool.h>
+
 #include "types.h"
 
-#define NPARTITIONS    (      64) // Total thread partitions
 #define KPRECISION     (      10) // Iterations for computing K
 #define PRETTYIFY      (       0) // Whether to format as if we tune everything
 #define REPORTING      (      50) // How often to print the new parameters
 
+#define OPTIMIZER      ( ADAGRAD) // One of { ADAGRAD, ADAM, ADAMW }
 #define LRRATE         (    0.10) // Global Learning rate
 #define LRDROPRATE     (    1.00) // Cut LR by this each LR-step
 #define LRSTEPRATE     (     250) // Cut LR after this many epochs
+#define ADAMBETA1      (    0.90) // Decay of Adam's first moment
+#define ADAMBETA2      (   0.999) // Decay of Adam's second moment
+#define WEIGHTDECAY    (    0.00) // AdamW's pull towards the current values
+
+#define VALIDATION     (    0.00) // Share of DATAFILE held out of training, if any
+#define PATIENCE       (       0) // Stop after this many epochs without gain, if set
+#define CHECKPOINT     (      50) // How often to save progress to resume from
 
 #define TuneNormal     (       0) // Flag to enable all Normals      (856)
 #define TuneSafety     (       0) // Flag to enable all Safeties     ( 44)
@@ -38,9 +47,15 @@
 #define NTERMS         (       0) // Total terms in the Tuner (904)
 #define MAXEPOCHS      (  100000) // Max number of epochs allowed
 #define BATCHSIZE      (   16384) // Training samples per mini-batch
-#define NPOSITIONS     (42487498) // Total Training samples in the book
+#define TUPLECHUNK     ( 1 << 20) // Tuples allocated per arena chunk
 
-#define STACKSIZE ((int)((double) NPOSITIONS * NTERMS / 64))
+#define DATAFILE       (  "FENS") // Training samples, one FEN per line
+#define CACHEFILE ("FENS.cache") // Entries and Tuples saved from DATAFILE, by this build
+#define CACHEMAGIC (0x4548544543414348ull)
+#define CACHEVERSION   (       2) // Bumped whenever the Entries change
+#define CHECKPOINTFILE ("FENS.checkpoint") // Parameters and Optimizer state
+#define CHECKPOINTTEMP ("FENS.checkpoint.tmp") // Written before replacing it
+#define CHECKPOINTMAGIC (0x4548544543484b50ull)
 
 #define TunePawnValue                   (0 || TuneNormal)
 #define TuneKnightValue                 (0 || TuneNormal)
@@ -117,6 +132,8 @@
 
 enum { NORMAL, COMPLEXITY, SAFETY, METHOD_NB };
 
+enum { ADAGRAD, ADAM, ADAMW };
+
 typedef struct TTuple {
     uint16_t index;
     int8_t wcoeff;
@@ -124,12 +141,17 @@ typedef struct TTuple {
 } TTuple;
 
 typedef struct TEntry {
-    int ntuples, seval, phase, turn;
+    int ntuples, nnormal, seval, phase, turn;
     int eval, safety[COLOUR_NB], complexity;
     double result, sfactor, pfactors[PHASE_NB];
     TTuple *tuples;
 } TEntry;
 
+typedef struct TCacheHeader {
+    uint64_t magic, key;
+    int64_t npositions, ntuples;
+} TCacheHeader;
+
 typedef struct TGradientData {
     double egeval, complexity;
     double wsafetymg, bsafetymg;
@@ -140,23 +162,42 @@ typedef int TArray[NTERMS];
 
 typedef double TVector[NTERMS][PHASE_NB];
 
+typedef struct TOptimizer {
+    TVector momentum, velocity; // AdaGrad only accumulates the velocity
+    int64_t steps;
+} TOptimizer;
+
+typedef struct TCheckpoint {
+    uint64_t magic, key;
+    int optimizer, ntraining;
+    int epoch, stale;
+    double rate, best;
+} TCheckpoint;
+
 
 void runTuner();
 void initCurrentParameters(TVector cparams);
 void initMethodManager(TArray methods);
 void initCoefficients(TVector coeffs);
+int countTunerEntries();
+uint64_t tunerCacheKey(TVector cparams, TArray methods);
+TEntry* loadTunerCache(uint64_t key);
+void saveTunerCache(TEntry *entries, uint64_t key);
 void initTunerEntries(TEntry *entries, Thread *thread, TArray methods);
 void initTunerEntry(TEntry *entry, Thread *thread, Board *board, TArray methods);
 void initTunerTuples(TEntry *entry, TVector coeffs, TArray methods);
+bool loadTunerCheckpoint(uint64_t key, TCheckpoint *state, TVector params, TVector best, TOptimizer *optimizer);
+void saveTunerCheckpoint(TCheckpoint *state, TVector params, TVector best, TOptimizer *optimizer);
 
 double computeOptimalK(TEntry *entries);
 double staticEvaluationErrors(TEntry *entries, double K);
-double tunedEvaluationErrors(TEntry *entries, TVector params, TArray methods, double K);
+double tunedEvaluationErrors(TEntry *entries, int length, TVector params, TArray methods, double K);
 double sigmoid(double K, double E);
 
 double linearEvaluation(TEntry *entry, TVector params, TArray methods, TGradientData *data);
 void computeGradient(TEntry *entries, TVector gradient, TVector params, TArray methods, double K, int batch);
 void updateSingleGradient(TEntry *entry, TVector gradient, TVector params, TArray methods, double K);
+void updateParameters(TVector params, TVector gradient, TOptimizer *optimizer, double K, double rate);
 
 void printParameters(TVector params, TVector cparams);
 void print_0(char *name, TVector params, int i, char *S);
@@ -92,8 +92,13 @@ typedef struct TTEntry TTEntry;
 typedef struct TTBucket TTBucket;
 typedef struct PKEntry PKEntry;
 typedef struct TTable TTable;
+typedef struct TTStats TTStats;
 typedef struct Limits Limits;
 typedef struct UCIGoStruct UCIGoStruct;
+typedef struct PerfCounters PerfCounters;
+typedef struct ClusterHeader ClusterHeader;
+typedef struct ClusterEntry ClusterEntry;
+typedef struct ClusterBatch ClusterBatch;
 
 // Renamings, currently for move ordering
 
@@ -23,18 +23,24 @@
 #include <stdlib.h>
 #include <string.h>
 
+#if defined(__linux__)
+    #include <unistd.h>
+#endif
+
 #include "attacks.h"
 #include "board.h"
+#include "cluster.h"
 #include "cmdline.h"
 #include "evaluate.h"
 #include "history.h"
 #include "masks.h"
 #include "move.h"
 #include "movegen.h"
-#include "network.h"
+#include "perft.h"
 #include "nnue/nnue.h"
 #include "pyrrhic/tbprobe.h"
 #include "search.h"
+#include "syzygy.h"
 #include "thread.h"
 #include "timeman.h"
 #include "transposition.h"
@@ -43,12 +49,24 @@
 #include "zobrist.h"
 
 int NORMALIZE_EVAL = 1;
+int ReportInterval = 0; // Set by UCI options
+
+static UCIReports Reports = { .lock = PTHREAD_MUTEX_INITIALIZER };
 
 extern int MoveOverhead;          // Defined by time.c
+extern int MoveOverheadAuto;      // Defined by time.c
+extern int TimeLog;               // Defined by time.c
 extern unsigned TB_PROBE_DEPTH;   // Defined by syzygy.c
 extern volatile int ABORT_SIGNAL; // Defined by search.c
 extern volatile int IS_PONDERING; // Defined by search.c
-extern PKNetwork PKNN;            // Defined by network.c
+extern int HelperSchedule;        // Defined by search.c
+extern int ParallelMultiPV;       // Defined by search.c
+extern int EvalCacheSize;         // Defined by transposition.c
+extern int PKCacheSize;           // Defined by transposition.c
+extern int PerfCountersEnabled;   // Defined by perfcounters.c
+extern int ClusterDepth;          // Defined by cluster.c
+extern int CarrySearch;           // Defined by search.c
+extern int CarryDepth;            // Defined by search.c
 
 const char *StartPosition = "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1";
 
@@ -66,7 +84,7 @@ int main(int argc, char **argv) {
     // Initialize core components of Ethereal
     initAttacks(); initMasks(); initEval();
     initSearch(); initZobrist(); tt_init(1, 16);
-    initPKNetwork(); nnue_incbin_init();
+    nnue_incbin_init();
 
     // Create the UCI-board and our threads
     threads = createThreadPool(1);
@@ -89,7 +107,11 @@ int main(int argc, char **argv) {
     |       stop |            Signals the search threads to finish and report a bestmove |
     |       quit |             Exits the engine and any searches by killing the UCI loop |
     |      perft |            Custom command to compute PERFT(N) of the current position |
+    |            |            Use "perft divide N" to also list counts for each root move |
     |      print |         Custom command to print an ASCII view of the current position |
+    |     memory |     Custom command to report the resident memory of this process |
+    |   savehash | *       Custom command to write the Transposition Table to a given file |
+    |   loadhash | *    Custom command to map a saved Transposition Table of the same size |
     |------------|-----------------------------------------------------------------------|
     */
 
@@ -100,15 +122,36 @@ int main(int argc, char **argv) {
             printf("id author Andrew Grant, Alayan & Laldon\n");
             printf("option name Hash type spin default 16 min 2 max 131072\n");
             printf("option name Threads type spin default 1 min 1 max 2048\n");
+            printf("option name HelperSchedule type combo default none var none var skip var busy\n");
+            printf("option name TTNuma type combo default none var none var interleave var bind\n");
+            printf("option name HashShared type string default <empty>\n");
+            printf("option name PKCache type spin default %d min 0 max %d\n", PK_CACHE_DEFAULT, PK_CACHE_MAX);
+            printf("option name EvalCache type spin default %d min 0 max %d\n", EVAL_CACHE_DEFAULT, EVAL_CACHE_MAX);
             printf("option name EvalFile type string default <empty>\n");
+            printf("option name NNUEReplicas type check default false\n");
             printf("option name MultiPV type spin default 1 min 1 max 256\n");
+            printf("option name ParallelMultiPV type check default false\n");
+            printf("option name CarrySearch type check default false\n");
+            printf("option name CarryDepth type spin default 0 min 0 max 32\n");
             printf("option name MoveOverhead type spin default 300 min 0 max 10000\n");
+            printf("option name MoveOverheadAuto type check default false\n");
+            printf("option name TimeLog type check default false\n");
+            printf("option name ReportInterval type spin default 0 min 0 max 60000\n");
+            printf("option name PerfCounters type check default false\n");
+            printf("option name ClusterPort type spin default 0 min 0 max 65535\n");
+            printf("option name ClusterPeers type string default <empty>\n");
+            printf("option name ClusterDepth type spin default %d min 1 max 127\n", CLUSTER_DEPTH_DEFAULT);
             printf("option name SyzygyPath type string default <empty>\n");
             printf("option name SyzygyProbeDepth type spin default 0 min 0 max 127\n");
+            printf("option name SyzygyCache type spin default %d min 0 max %d\n", SYZYGY_CACHE_DEFAULT, SYZYGY_CACHE_MAX);
+            printf("option name SyzygyPreload type string default <empty>\n");
             printf("option name Ponder type check default false\n");
             printf("option name Normalize type check default true\n");
             printf("option name UCI_Chess960 type check default false\n");
             printf("info string licensed to " LICENSE_OWNER "\n");
+            if (USE_NNUE) printf("info string using %s NNUE kernels\n", nnue_kernels_name());
+            printf("info string using %s slider lookups\n", sliderIndexName());
+            uciReportMemory();
             printf("uciok\n"), fflush(stdout);
         }
 
@@ -116,7 +159,7 @@ int main(int argc, char **argv) {
             printf("readyok\n"), fflush(stdout);
 
         else if (strEquals(str, "ucinewgame"))
-            resetThreadPool(threads), tt_clear(threads->nthreads);
+            resetThreadPool(threads), tt_clear(threads->nthreads), clearSearchCarry();
 
         else if (strStartsWith(str, "setoption"))
             uciSetOption(str, &threads, &multiPV, &chess960);
@@ -136,11 +179,25 @@ int main(int argc, char **argv) {
         else if (strEquals(str, "quit"))
             break;
 
+        else if (strStartsWith(str, "perft divide "))
+            printf("%"PRIu64"\n", perft(&board, atoi(str + strlen("perft divide ")), threads->nthreads, 64, TRUE)), fflush(stdout);
+
         else if (strStartsWith(str, "perft"))
-            printf("%"PRIu64"\n", perft(&board, atoi(str + strlen("perft ")))), fflush(stdout);
+            printf("%"PRIu64"\n", perft(&board, atoi(str + strlen("perft ")), threads->nthreads, 64, FALSE)), fflush(stdout);
 
         else if (strStartsWith(str, "print"))
             printBoard(&board), fflush(stdout);
+
+        else if (strEquals(str, "memory"))
+            uciReportMemory(), fflush(stdout);
+
+        else if (strStartsWith(str, "savehash "))
+            printf("info string %s hash to %s\n", tt_save(str + strlen("savehash ")) ? "saved" : "failed to save",
+                str + strlen("savehash ")), fflush(stdout);
+
+        else if (strStartsWith(str, "loadhash "))
+            printf("info string %s hash from %s\n", tt_load(str + strlen("loadhash ")) ? "loaded" : "failed to load",
+                str + strlen("loadhash ")), fflush(stdout);
     }
 
     return 0;
@@ -208,6 +265,9 @@ void uciGo(UCIGoStruct *ucigo, pthread_t *pthread, Thread *threads, Board *board
     limits->inc   = (board->turn == WHITE) ?  winc :  binc;
     limits->mtg   = (board->turn == WHITE) ?   mtg :   mtg;
 
+    // Compare the clock with the last search's, when adapting the overhead
+    tm_overhead_update(limits, board->turn, IS_PONDERING);
+
     // Cap our MultiPV search based on the suggested or legal moves
     limits->multiPV = MIN(multiPV, limits->limitedByMoves ? idx : size);
 
@@ -225,44 +285,173 @@ void uciSetOption(char *str, Thread **threads, int *multiPV, int *chess960) {
     // Handle setting UCI options in Ethereal. Options include:
     //  Hash                : Size of the Transposition Table in Megabyes
     //  Threads             : Number of search threads to use
+    //  HelperSchedule      : Which depths the helper threads choose to skip
+    //  TTNuma              : Placement of the Transposition Table across NUMA nodes
+    //  HashShared          : Name of a shared memory Transposition Table to attach to
+    //  PKCache             : Size of each Thread's Pawn King table in Kilobytes
+    //  EvalCache           : Size of each Thread's cache of evaluations in Kilobytes
     //  EvalFile            : Network weights for Ethereal's NNUE evaluation
+    //  NNUEReplicas        : Keep a copy of the Network weights on each NUMA node
     //  MultiPV             : Number of search lines to report per iteration
+    //  ParallelMultiPV     : Split the Threads into groups, to search one line each
+    //  CarrySearch         : Carry root move ordering and histories between searches of a game
+    //  CarryDepth          : Resume that many plies below the depth carried over, or zero
     //  MoveOverhead        : Overhead on time allocation to avoid time losses
+    //  MoveOverheadAuto    : Replace MoveOverhead with the lag measured between moves
+    //  TimeLog             : Report the predicted and actual time of each iteration
+    //  ReportInterval      : Least time in ms between search reports, holding the latest
+    //  PerfCounters        : Report hardware counters for each Thread after every search
+    //  ClusterPort         : UDP port to receive Entries from other processes, or zero
+    //  ClusterPeers        : Processes to send Entries to, eg "node1:7000,node2:7000"
+    //  ClusterDepth        : Minimal Depth of the Entries which are sent to peers
     //  SyzygyPath          : Path to Syzygy Tablebases
     //  SyzygyProbeDepth    : Minimal Depth to probe the highest cardinality Tablebase
+    //  SyzygyCache         : Size of the cache of WDL results in Megabytes
+    //  SyzygyPreload       : Tables to read in ahead of time, eg "wdl=6 dtz=5 lock"
     //  Normalize           : Normalize UCI output to hope that +1.00 is 50% Won, 50% Drawn
     //  UCI_Chess960        : Set when playing FRC, but not required in order to work
 
     if (strStartsWith(str, "setoption name Hash value ")) {
         int megabytes = atoi(str + strlen("setoption name Hash value "));
         printf("info string set Hash to %dMB\n", tt_init((*threads)->nthreads, megabytes));
+        tt_report_pages();
     }
 
     if (strStartsWith(str, "setoption name Threads value ")) {
         int nthreads = atoi(str + strlen("setoption name Threads value "));
-        deleteThreadPool(*threads); *threads = createThreadPool(nthreads);
+        *threads = resizeThreadPool(*threads, nthreads);
         printf("info string set Threads to %d\n", nthreads);
     }
 
+    if (strStartsWith(str, "setoption name HelperSchedule value ")) {
+        char *ptr = str + strlen("setoption name HelperSchedule value ");
+        HelperSchedule = strStartsWith(ptr, "skip") ? HELPER_SCHEDULE_SKIP
+                       : strStartsWith(ptr, "busy") ? HELPER_SCHEDULE_BUSY : HELPER_SCHEDULE_NONE;
+        printf("info string set HelperSchedule to %s\n", ptr);
+    }
+
+    if (strStartsWith(str, "setoption name TTNuma value ")) {
+        char *ptr = str + strlen("setoption name TTNuma value ");
+        int policy = strStartsWith(ptr, "interleave") ? TT_NUMA_INTERLEAVE
+                   : strStartsWith(ptr, "bind")       ? TT_NUMA_BIND : TT_NUMA_NONE;
+        tt_set_numa((*threads)->nthreads, policy);
+        printf("info string set TTNuma to %s\n", ptr);
+        tt_report_placement();
+    }
+
+    if (strStartsWith(str, "setoption name HashShared value ")) {
+        char *ptr  = str + strlen("setoption name HashShared value ");
+        int shared = tt_set_shared((*threads)->nthreads, ptr);
+        printf("info string set HashShared to %s\n", ptr);
+        if (!shared && !strStartsWith(ptr, "<empty>"))
+            printf("info string unable to attach to shared Hash, using a private Table\n");
+    }
+
+    if (strStartsWith(str, "setoption name PKCache value ")) {
+        PKCacheSize = atoi(str + strlen("setoption name PKCache value "));
+        PKCacheSize = MAX(0, MIN(PK_CACHE_MAX, PKCacheSize));
+        *threads = resizeThreadPool(*threads, (*threads)->nthreads);
+        printf("info string set PKCache to %dKB\n", PKCacheSize);
+    }
+
+    if (strStartsWith(str, "setoption name EvalCache value ")) {
+        EvalCacheSize = atoi(str + strlen("setoption name EvalCache value "));
+        EvalCacheSize = MAX(0, MIN(EVAL_CACHE_MAX, EvalCacheSize));
+        *threads = resizeThreadPool(*threads, (*threads)->nthreads);
+        printf("info string set EvalCache to %dKB\n", EvalCacheSize);
+    }
+
     if (strStartsWith(str, "setoption name EvalFile value ")) {
         char *ptr = str + strlen("setoption name EvalFile value ");
         if (!strStartsWith(ptr, "<empty>")) nnue_init(ptr);
         printf("info string set EvalFile to %s\n", ptr);
     }
 
+    if (strStartsWith(str, "setoption name NNUEReplicas value ")) {
+        if (strStartsWith(str, "setoption name NNUEReplicas value true"))
+            printf("info string set NNUEReplicas to true\n"), nnue_set_replicas(1);
+        if (strStartsWith(str, "setoption name NNUEReplicas value false"))
+            printf("info string set NNUEReplicas to false\n"), nnue_set_replicas(0);
+    }
+
     if (strStartsWith(str, "setoption name MultiPV value ")) {
         *multiPV = atoi(str + strlen("setoption name MultiPV value "));
         printf("info string set MultiPV to %d\n", *multiPV);
     }
 
+    if (strStartsWith(str, "setoption name ParallelMultiPV value ")) {
+        if (strStartsWith(str, "setoption name ParallelMultiPV value true"))
+            printf("info string set ParallelMultiPV to true\n"), ParallelMultiPV = 1;
+        if (strStartsWith(str, "setoption name ParallelMultiPV value false"))
+            printf("info string set ParallelMultiPV to false\n"), ParallelMultiPV = 0;
+    }
+
+    if (strStartsWith(str, "setoption name CarrySearch value ")) {
+        if (strStartsWith(str, "setoption name CarrySearch value true"))
+            printf("info string set CarrySearch to true\n"), CarrySearch = 1;
+        if (strStartsWith(str, "setoption name CarrySearch value false"))
+            printf("info string set CarrySearch to false\n"), CarrySearch = 0;
+    }
+
+    if (strStartsWith(str, "setoption name CarryDepth value ")) {
+        CarryDepth = atoi(str + strlen("setoption name CarryDepth value "));
+        CarryDepth = MAX(0, MIN(32, CarryDepth));
+        printf("info string set CarryDepth to %d\n", CarryDepth);
+    }
+
     if (strStartsWith(str, "setoption name MoveOverhead value ")) {
         MoveOverhead = atoi(str + strlen("setoption name MoveOverhead value "));
         printf("info string set MoveOverhead to %d\n", MoveOverhead);
     }
 
+    if (strStartsWith(str, "setoption name ReportInterval value ")) {
+        ReportInterval = atoi(str + strlen("setoption name ReportInterval value "));
+        printf("info string set ReportInterval to %d\n", ReportInterval);
+    }
+
+    if (strStartsWith(str, "setoption name MoveOverheadAuto value ")) {
+        if (strStartsWith(str, "setoption name MoveOverheadAuto value true"))
+            printf("info string set MoveOverheadAuto to true\n"), MoveOverheadAuto = 1;
+        if (strStartsWith(str, "setoption name MoveOverheadAuto value false"))
+            printf("info string set MoveOverheadAuto to false\n"), MoveOverheadAuto = 0;
+    }
+
+    if (strStartsWith(str, "setoption name TimeLog value ")) {
+        if (strStartsWith(str, "setoption name TimeLog value true"))
+            printf("info string set TimeLog to true\n"), TimeLog = 1;
+        if (strStartsWith(str, "setoption name TimeLog value false"))
+            printf("info string set TimeLog to false\n"), TimeLog = 0;
+    }
+
+    if (strStartsWith(str, "setoption name PerfCounters value ")) {
+        if (strStartsWith(str, "setoption name PerfCounters value true"))
+            printf("info string set PerfCounters to true\n"), PerfCountersEnabled = 1;
+        if (strStartsWith(str, "setoption name PerfCounters value false"))
+            printf("info string set PerfCounters to false\n"), PerfCountersEnabled = 0;
+    }
+
+    if (strStartsWith(str, "setoption name ClusterPort value ")) {
+        int port = atoi(str + strlen("setoption name ClusterPort value "));
+        if (!cluster_init(port) && port > 0)
+            printf("info string unable to bind ClusterPort %d\n", port);
+        printf("info string set ClusterPort to %d\n", port);
+    }
+
+    if (strStartsWith(str, "setoption name ClusterPeers value ")) {
+        char *ptr = str + strlen("setoption name ClusterPeers value ");
+        int peers = strStartsWith(ptr, "<empty>") ? cluster_set_peers("") : cluster_set_peers(ptr);
+        printf("info string set ClusterPeers to %s (%d peers)\n", ptr, peers);
+    }
+
+    if (strStartsWith(str, "setoption name ClusterDepth value ")) {
+        ClusterDepth = atoi(str + strlen("setoption name ClusterDepth value "));
+        ClusterDepth = MAX(1, MIN(127, ClusterDepth));
+        printf("info string set ClusterDepth to %d\n", ClusterDepth);
+    }
+
     if (strStartsWith(str, "setoption name SyzygyPath value ")) {
         char *ptr = str + strlen("setoption name SyzygyPath value ");
-        if (!strStartsWith(ptr, "<empty>")) tb_init(ptr);
+        if (!strStartsWith(ptr, "<empty>")) tablebasesInit(ptr);
         printf("info string set SyzygyPath to %s\n", ptr);
     }
 
@@ -271,6 +460,19 @@ void uciSetOption(char *str, Thread **threads, int *multiPV, int *chess960) {
         printf("info string set SyzygyProbeDepth to %u\n", TB_PROBE_DEPTH);
     }
 
+    if (strStartsWith(str, "setoption name SyzygyCache value ")) {
+        int megabytes = atoi(str + strlen("setoption name SyzygyCache value "));
+        megabytes = MAX(0, MIN(SYZYGY_CACHE_MAX, megabytes));
+        tablebasesSetCache(megabytes);
+        printf("info string set SyzygyCache to %dMB\n", megabytes);
+    }
+
+    if (strStartsWith(str, "setoption name SyzygyPreload value ")) {
+        char *ptr = str + strlen("setoption name SyzygyPreload value ");
+        tablebasesSetPreload(ptr);
+        printf("info string set SyzygyPreload to %s\n", ptr);
+    }
+
     if (strStartsWith(str, "setoption name Normalize value ")) {
         if (strStartsWith(str, "setoption name Normalize value true"))
             printf("info string set Normalize to true\n"), NORMALIZE_EVAL = 1;
@@ -328,9 +530,9 @@ void uciPosition(char *str, Board *board, int chess960) {
             }
         }
 
-        // Reset move history whenever we reset the fifty move rule. This way
-        // we can track all positions that are candidates for repetitions, and
-        // are still able to use a fixed size for the history array (512)
+        // Reset move history whenever we reset the fifty move rule. Only the
+        // positions since then are candidates for repetitions, and the history
+        // ring only needs to hold those (see HISTORY_SIZE)
         if (board->halfMoveCounter == 0)
             board->numMoves = 0;
 
@@ -340,6 +542,17 @@ void uciPosition(char *str, Board *board, int chess960) {
 }
 
 
+static void send_held_reports() {
+
+    // Send out every held report, in order of their lines, with one flush
+    for (int i = 0; i < MAX_MOVES; i++)
+        if (Reports.held[i])
+            fputs(Reports.lines[i], stdout), Reports.held[i] = 0;
+
+    Reports.last = get_real_time();
+    fflush(stdout);
+}
+
 void uciReport(Thread *threads, PVariation *pv, int alpha, int beta) {
 
     // Gather all of the statistics that the UCI protocol would be
@@ -352,7 +565,7 @@ void uciReport(Thread *threads, PVariation *pv, int alpha, int beta) {
     int multiPV     = threads->multiPV + 1;
     int elapsed     = elapsed_time(threads->tm);
     int bounded     = MAX(alpha, MIN(pv->score, beta));
-    uint64_t nodes  = nodesSearchedThreadPool(threads);
+    uint64_t nodes  = nodesSearchedThreadPool(threads) + cluster_nodes();
     uint64_t tbhits = tbhitsThreadPool(threads);
     int nps         = (int)(1000 * (nodes / (1 + elapsed)));
 
@@ -368,28 +581,82 @@ void uciReport(Thread *threads, PVariation *pv, int alpha, int beta) {
     char *bound = bounded >=  beta ? " lowerbound "
                 : bounded <= alpha ? " upperbound " : " ";
 
-    printf("info depth %d seldepth %d multipv %d score %s %d%stime %d "
-           "nodes %"PRIu64" nps %d tbhits %"PRIu64" hashfull %d pv ",
-           depth, seldepth, multiPV, type, score, bound, elapsed, nodes, nps, tbhits, hashfull);
+    pthread_mutex_lock(&Reports.lock);
 
-    // Iterate over the PV and print each move
-    for (int i = 0; i < pv->length; i++) {
-        char moveStr[6];
-        moveToString(pv->line[i], moveStr, threads->board.chess960);
-        printf("%s ", moveStr);
+    char *line = Reports.lines[multiPV - 1];
+    int length = snprintf(line, UCI_REPORT_SIZE,
+        "info depth %d seldepth %d multipv %d score %s %d%stime %d "
+        "nodes %"PRIu64" nps %d tbhits %"PRIu64" hashfull %d pv ",
+        depth, seldepth, multiPV, type, score, bound, elapsed, nodes, nps, tbhits, hashfull);
+
+    // Iterate over the PV and add each move, while there is space for one
+    for (int i = 0; i < pv->length && length + 7 < UCI_REPORT_SIZE; i++) {
+        moveToString(pv->line[i], line + length, threads->board.chess960);
+        length += strlen(line + length);
+        line[length++] = ' ';
     }
 
-    // Send out a newline and flush
-    puts(""); fflush(stdout);
+    // Replace any held report for this line. Consider sending them out, but
+    // only once the last of a MultiPV set is in, to keep sets together
+    line[length++] = '\n', line[length] = '\0';
+    Reports.held[multiPV - 1] = 1;
+
+    if (    ReportInterval == 0
+        || (multiPV >= threads->limits->multiPV && get_real_time() - Reports.last >= ReportInterval))
+        send_held_reports();
+
+    pthread_mutex_unlock(&Reports.lock);
 }
 
 void uciReportCurrentMove(Board *board, uint16_t move, int currmove, int depth) {
 
+    // Current moves are only of passing interest, and are never held back
+
     char moveStr[6];
     moveToString(move, moveStr, board->chess960);
-    printf("info depth %d currmove %s currmovenumber %d\n", depth, moveStr, currmove);
-    fflush(stdout);
 
+    pthread_mutex_lock(&Reports.lock);
+
+    if (get_real_time() - Reports.lastmove >= ReportInterval) {
+        printf("info depth %d currmove %s currmovenumber %d\n", depth, moveStr, currmove);
+        Reports.lastmove = get_real_time();
+        fflush(stdout);
+    }
+
+    pthread_mutex_unlock(&Reports.lock);
+}
+
+void uciFlushReports() {
+
+    // Called before the bestmove, so the final PV is never lost to the interval
+    pthread_mutex_lock(&Reports.lock);
+    send_held_reports();
+    pthread_mutex_unlock(&Reports.lock);
+}
+
+void uciReportMemory() {
+
+    // Resident memory of the whole process, in order to judge how many
+    // instances fit on one host. Shared pages, such as a mapped NNUE file
+    // or a shared Hash, are counted by every process which touches them
+
+#if defined(__linux__)
+
+    unsigned long long pages, resident, shared;
+    FILE *fin = fopen("/proc/self/statm", "r");
+
+    if (fin != NULL && fscanf(fin, "%llu %llu %llu", &pages, &resident, &shared) == 3) {
+        const double MB = (double) sysconf(_SC_PAGESIZE) / (1 << 20);
+        printf("info string memory rss %.1fMB shared %.1fMB\n", resident * MB, shared * MB);
+    }
+
+    else printf("info string memory rss unavailable\n");
+
+    if (fin != NULL) fclose(fin);
+
+#else
+    printf("info string memory rss unavailable\n");
+#endif
 }
 
 
@@ -39,14 +39,33 @@
     #define ETHEREAL_VERSION VERSION_ID
 #endif
 
+extern const char *StartPosition;
+
 struct Limits {
     double start, time, inc, mtg, timeLimit;
     int limitedByNone, limitedByTime, limitedBySelf;
     int limitedByDepth, limitedByMoves, limitedByNodes;
     int multiPV, depthLimit; uint64_t nodeLimit;
+    int silent; // No UCI reports, for batches of searches
+    double stopped; // When the main Thread left the search, to measure lag
     uint16_t searchMoves[MAX_MOVES], excludedMoves[MAX_MOVES];
 };
 
+/// Search reports are held per MultiPV line, so that a newer report for a line
+/// replaces an older one, such as a fail high that is resolved a moment later.
+/// Held lines go out together, no more often than every ReportInterval ms
+
+enum {
+    UCI_REPORT_SIZE = 1024,
+};
+
+typedef struct UCIReports {
+    pthread_mutex_t lock;
+    double last, lastmove;
+    int held[MAX_MOVES];
+    char lines[MAX_MOVES][UCI_REPORT_SIZE];
+} UCIReports;
+
 struct UCIGoStruct {
     Thread *threads;
     Board  *board;
@@ -59,6 +78,8 @@ void uciPosition(char *str, Board *board, int chess960);
 
 void uciReport(Thread *threads, PVariation *pv, int alpha, int beta);
 void uciReportCurrentMove(Board *board, uint16_t move, int currmove, int depth);
+void uciFlushReports();
+void uciReportMemory();
 
 int strEquals(char *str1, char *str2);
 int strStartsWith(char *str, char *key);
@@ -0,0 +1,2285 @@
+// Weights of the [224x32, 32x2] PKNetwork, as hexadecimal floats laid out
+// exactly as the PKNetwork struct. The Input Weights are already transposed.
+// Generated from the text form of the Network, by running
+//     ./Ethereal pkconvert weights/pknet_224x32x2.net weights/pknet_224x32x2.h
+
+.inputWeights = {
+    {
+        -0x1.dca8c8p-2, -0x1.183e1cp+0, 0x1.93ae1ep+0, 0x1.49aac2p-2,
+        0x1.6224f2p-1, 0x1.9e7bcep-2, 0x1.e70f7p+0, -0x1.6c0e0ep-2,
+        0x1.3e6eb2p+0, -0x1.de5484p-1, 0x1.189af8p-2, -0x1.c1dcf6p+0,
+        0x1.ed3f9p-2, 0x1.07056p-2, 0x1.3bc1a4p-1, -0x1.587aecp-2,
+        0x1.767decp+0, -0x1.3475cep+0, -0x1.e4b10ep-3, -0x1.a5f924p-4,
+        -0x1.d8578p+1, 0x1.c4cc8ap+1, -0x1.94aed2p-2, 0x1.7389e8p+0,
+        0x1.80256p-1, 0x1.f26152p-2, -0x1.bcfb52p+0, 0x1.e44784p+0,
+        0x1.0b5de2p+1, 0x1.0724d2p-1, 0x1.83f5c2p-1, 0x1.aa9c84p+0
+    },
+    {
+        -0x1.3b085ep+0, -0x1.0636fep+1, -0x1.051b5ap+2, 0x1.1019f2p-1,
+        -0x1.ce24b2p-1, 0x1.2c00f2p+0, 0x1.163b68p+1, 0x1.4e8492p-3,
+        0x1.8f43a6p-1, -0x1.e0a9b2p-1, 0x1.cda68ap-3, -0x1.b69f84p+0,
+        0x1.321692p-5, 0x1.3d794ep-1, 0x1.043fdep+0, -0x1.1c0084p-7,
+        0x1.3adee8p+1, -0x1.cce4bap+0, 0x1.29ff42p+1, 0x1.3cc8p-1,
+        -0x1.10eec8p+0, 0x1.4f099p+1, -0x1.3c3816p-3, 0x1.25fd2cp+1,
+        0x1.a970ecp+0, 0x1.f3053p+0, -0x1.43a268p-3, 0x1.e1bc5p+0,
+        0x1.60d492p+1, 0x1.54fb36p-1, 0x1.886cdap+0, 0x1.1ad252p+1
+    },
+    {
+        -0x1.3fe866p+0, -0x1.7a3746p+0, 0x1.1b6352p+1, 0x1.e982e6p-2,
+        -0x1.a8ba38p-2, -0x1.d0dbc4p-5, 0x1.84ec8cp+0, 0x1.5df976p-3,
+        0x1.f66e74p-5, -0x1.dae8ep-1, 0x1.fbc5d2p-1, -0x1.b975e6p+0,
+        0x1.aebcc6p+0, -0x1.ee6e9ep-1, 0x1.81e90ep+0, -0x1.1dc0c2p-2,
+        0x1.a2ec62p+0, -0x1.305c2ep+2, 0x1.44146p+0, 0x1.44a8acp-1,
+        -0x1.a56a6ep+0, 0x1.1a81bcp+0, 0x1.570bbp-5, 0x1.76a124p+0,
+        0x1.d415aep-1, 0x1.a3dca4p-3, 0x1.a3ac74p-2, 0x1.63324ep+0,
+        0x1.458a26p+1, 0x1.c1b50ep-1, 0x1.8acb52p-1, 0x1.c2d6d8p+0
+    },
+    {
+        0x1.20c774p-3, -0x1.f7298p-1, -0x1.385358p-3, -0x1.17151ep+0,
+        0x1.1ed9ep+0, 0x1.f79adcp-4, 0x1.031218p+1, 0x1.6386d2p+0,
+        0x1.cd207ep-1, -0x1.d0fb88p+0, -0x1.4caae8p-5, -0x1.a39f84p+0,
+        -0x1.9f9c1ap-2, 0x1.19d68cp+2, 0x1.cdc3a8p+1, -0x1.113628p-2,
+        -0x1.820142p+2, -0x1.30d27cp+0, 0x1.c808ap+0, -0x1.859acp-1,
+        -0x1.2e223ep-3, 0x1.6e1588p+0, -0x1.e33fd4p-2, 0x1.a92376p+0,
+        0x1.6b3214p-4, 0x1.7c361ap+0, 0x1.f180ep-1, 0x1.40bdf4p+1,
+        0x1.4dbc14p+1, 0x1.477342p-1, -0x1.b1696cp-1, 0x1.1c7ffcp+1
+    },
+    {
+        -0x1.89583p-3, 0x1.14897ep-1, 0x1.f38c0ep-1, 0x1.8607fp+2,
+        0x1.62275ap-2, 0x1.5831dap+0, -0x1.2daf14p-2, 0x1.349aecp+0,
+        -0x1.7e5ec2p+0, -0x1.1f82dep+0, -0x1.f2e60cp-3, -0x1.bac6eep+0,
+        0x1.1f8d76p+0, -0x1.11471p-1, -0x1.ad468ep-3, 0x1.120688p+0,
+        0x1.cd747ap+0, -0x1.209594p+0, 0x1.a96e5cp+0, -0x1.928912p-2,
+        0x1.e1c3bap-3, 0x1.314ffp-3, 0x1.23209ap+0, 0x1.4fa696p-1,
+        -0x1.8aedd8p-3, 0x1.6eeb92p+0, 0x1.6bad4ep+1, 0x1.f8a3a8p+0,
+        0x1.32b3ecp+1, 0x1.0df3d4p+1, -0x1.43ef8p-1, 0x1.a4a3f4p-1
+    },
+    {
+        -0x1.a844ep-2, 0x1.7b30b6p+0, 0x1.87cb42p-2, -0x1.de70cp-4,
+        0x1.a20dd6p+0, -0x1.a258bp+2, 0x1.11e384p-4, -0x1.f1975p-2,
+        -0x1.c6f9a6p-1, -0x1.3717bcp+1, -0x1.e32b08p-4, -0x1.c05a72p+0,
+        -0x1.9f7dc8p-1, 0x1.37dc58p+0, 0x1.d02684p-4, -0x1.aaf1f4p+0,
+        0x1.293d6p+0, 0x1.cdc8dcp+0, 0x1.b9c7c4p+0, -0x1.9ae078p-2,
+        0x1.35f6d4p-2, 0x1.8721f8p+0, -0x1.14c92ep+0, 0x1.aa5b1ep+0,
+        -0x1.e20e12p-2, 0x1.13f846p+0, -0x1.00bfa8p+2, 0x1.9bb542p+0,
+        0x1.60ebdep+1, 0x1.44cb54p+0, 0x1.1ab326p-2, 0x1.0c86b8p+1
+    },
+    {
+        -0x1.ee45f2p-1, 0x1.017122p+1, 0x1.e4a6c2p-1, 0x1.5893e4p-1,
+        0x1.4d64d2p+1, 0x1.e0d182p+0, 0x1.80a1f6p-1, 0x1.0d5a14p+0,
+        -0x1.4bee1ap-2, -0x1.d496fcp-4, -0x1.58fcb8p+1, -0x1.a45e94p+0,
+        0x1.abf81p+0, 0x1.69b1ap-2, 0x1.3acbbcp+0, 0x1.b6fe28p-1,
+        0x1.f59916p-1, -0x1.66ef6ap-3, 0x1.1b33b6p+1, 0x1.b28adp+1,
+        0x1.1039e4p-1, 0x1.4734e6p-2, 0x1.c11a4ep-1, -0x1.051c2cp-5,
+        0x1.fd82e4p-1, 0x1.710216p-1, 0x1.8541b2p+0, 0x1.0d5f78p+0,
+        0x1.6e348ap+1, 0x1.c2db4ap-4, 0x1.22a5cap-1, 0x1.a84f8cp-1
+    },
+    {
+        0x1.439a9ap-3, 0x1.3d49c4p+0, 0x1.5fc0a4p-1, 0x1.da3f7p-4,
+        0x1.995a0cp+1, -0x1.8483b2p+0, 0x1.4bbecep+0, 0x1.ec16b4p-4,
+        0x1.a66358p-2, 0x1.01273ap+0, -0x1.403c84p+0, -0x1.ed0b02p+0,
+        -0x1.a42a6ap-2, 0x1.56c552p-4, -0x1.019432p-3, -0x1.a49e34p+0,
+        0x1.3f3216p-2, -0x1.a54a84p-3, 0x1.704d5cp+1, 0x1.6d7a6ap+1,
+        0x1.9d183ep+0, 0x1.6cd724p-1, 0x1.b669fcp+0, 0x1.d4ce76p-3,
+        0x1.5ba9b6p-1, 0x1.c3ace4p-1, -0x1.226b3ep+1, -0x1.3f1b1ep-2,
+        0x1.2374ccp+1, 0x1.1c39e2p-1, 0x1.43148cp-1, 0x1.1c6c8ap-1
+    },
+    {
+        -0x1.11d86ap-2, -0x1.f13d5ap-1, 0x1.67a894p+0, 0x1.047d16p-2,
+        0x1.e025bp-1, 0x1.6f3fd8p-2, 0x1.e18248p+0, -0x1.11d46cp-7,
+        0x1.cc3b6p-2, -0x1.5b0facp-1, 0x1.add38ep-3, -0x1.c37a22p+0,
+        0x1.da5f76p-2, 0x1.89f0aep-3, 0x1.1463dcp-2, -0x1.421c6p-3,
+        0x1.5948dp+0, -0x1.c7ac64p-1, -0x1.b0996cp-5, 0x1.7f3d92p-2,
+        -0x1.7ee40cp+2, 0x1.bcd5e2p+1, -0x1.94ad54p-2, 0x1.c4a0c4p+0,
+        0x1.16a0cap-1, 0x1.4a8b76p-1, -0x1.83c91ap+0, 0x1.0e41d8p+1,
+        0x1.1a828cp+1, 0x1.0ad28ap-5, 0x1.4f6302p-1, 0x1.037772p+1
+    },
+    {
+        -0x1.d4bf7ap-1, -0x1.711622p-2, -0x1.ffedeep+1, 0x1.1d0e48p-2,
+        -0x1.fcc536p-1, 0x1.e3e886p-2, 0x1.d9c284p+0, 0x1.4ba6dp-1,
+        0x1.ad396cp-1, -0x1.13f062p+0, 0x1.9747a8p-1, -0x1.c159c6p+0,
+        0x1.29ed86p-1, 0x1.5db014p-1, 0x1.5b8c3cp+0, 0x1.4bd3c4p-3,
+        0x1.1c116ap-1, -0x1.6a7218p+1, 0x1.04414ap+1, 0x1.554526p-2,
+        -0x1.949decp+0, 0x1.2622c2p+1, -0x1.0116dap+0, 0x1.2e425ep+1,
+        0x1.978bb2p+0, 0x1.84aca6p+0, -0x1.1bafc4p+0, 0x1.30920ep+1,
+        0x1.77668p+1, 0x1.5d19e6p-1, 0x1.fa98fcp-1, 0x1.2f359ap+1
+    },
+    {
+        -0x1.5c293ap-1, -0x1.1d848ap+1, 0x1.20ae6ap+1, 0x1.23c786p-1,
+        0x1.1adf74p-2, 0x1.8e6342p-1, 0x1.1cf098p+0, 0x1.8ccfe8p-1,
+        0x1.e992d6p-2, -0x1.03b136p+1, 0x1.d2f152p-2, -0x1.d5bbcap+0,
+        0x1.8300d4p+0, -0x1.eee8bcp+0, 0x1.b1f58ap-1, -0x1.f29444p-1,
+        0x1.c4401p+0, -0x1.7573f6p+1, 0x1.7e6676p-2, -0x1.7582dcp-1,
+        -0x1.033c14p+0, 0x1.cef6bap-2, -0x1.c6a5c4p-2, 0x1.750a1ap+0,
+        0x1.580618p+0, 0x1.7f045ep-1, -0x1.d96e66p+0, 0x1.165d3p+0,
+        0x1.38004ap+1, 0x1.738a7cp-2, -0x1.9407f6p-3, 0x1.ab77b6p+0
+    },
+    {
+        0x1.ac0224p-4, -0x1.231714p-1, -0x1.03139ap-1, -0x1.371b8p+1,
+        0x1.a4ff78p-1, -0x1.d554f2p-3, 0x1.1b1eb8p+0, 0x1.74517ap+0,
+        -0x1.37bd8p-2, -0x1.106ea8p+0, 0x1.25b3bap-2, -0x1.0cb158p+1,
+        0x1.e8c12ap-3, 0x1.4bc7d4p+2, 0x1.b99f5ap+1, 0x1.a2ba7cp+0,
+        -0x1.8a435ap-2, -0x1.0431eep+1, 0x1.062e1ep+1, -0x1.1c0b1ap-1,
+        0x1.5dd14cp-3, 0x1.d4383ep-1, -0x1.04e84cp-1, 0x1.17747ap+0,
+        0x1.786bfp-1, 0x1.1d913ep+0, -0x1.661f2cp-3, 0x1.670bf8p-1,
+        0x1.3dde9ep+1, 0x1.69ca9p-1, -0x1.a233e6p-1, 0x1.b10608p+0
+    },
+    {
+        -0x1.9cce8ep-1, 0x1.62baf6p-1, 0x1.9ec364p-1, 0x1.955024p+2,
+        0x1.3b4598p-1, 0x1.88aaeep+0, -0x1.a7be6ap-2, -0x1.36efc4p-4,
+        -0x1.b51902p-1, -0x1.bb57eep-2, -0x1.dbf62ap-12, -0x1.e20512p+0,
+        0x1.221828p+1, -0x1.1851b6p+0, -0x1.06790ap+0, 0x1.04e57ep+1,
+        0x1.53183ep+1, -0x1.2e6d44p-3, 0x1.96d4bcp+0, -0x1.e0e978p+0,
+        -0x1.18642ap-1, 0x1.664e4ap-2, 0x1.4ad08ap+0, 0x1.fbbf82p-7,
+        0x1.33716cp-2, 0x1.478854p+0, 0x1.78b592p+0, 0x1.4d61a2p-1,
+        0x1.3c0536p+1, 0x1.c9e5c6p-1, -0x1.5d9b3ap-1, 0x1.6f8dep-2
+    },
+    {
+        -0x1.09e01p+0, 0x1.e06c62p+0, 0x1.047ddep+0, -0x1.d70b84p+0,
+        0x1.06df4p+0, -0x1.4d74ep-2, 0x1.628356p-6, 0x1.f2c4f8p-2,
+        -0x1.0933a6p+0, -0x1.f9477ep-1, -0x1.4ade72p+0, -0x1.ffbd8p+0,
+        -0x1.f9e1fcp-3, 0x1.b26092p-1, 0x1.f7ee28p-1, -0x1.fda53ep+0,
+        -0x1.963bb6p+0, 0x1.e4739p-1, 0x1.1bb23ap+1, 0x1.0036acp-3,
+        0x1.6fe3aap-1, 0x1.09d044p-1, -0x1.3e53fp-4, 0x1.a2efd6p-1,
+        0x1.eb37fep-2, 0x1.10d352p+0, -0x1.b78bcap+1, 0x1.0c8e8cp+0,
+        0x1.5198bep+1, 0x1.96f70ep+0, -0x1.04e8bp-3, 0x1.6a8dap+0
+    },
+    {
+        -0x1.61f192p+0, 0x1.60271cp+0, 0x1.0ba512p+0, 0x1.891524p-1,
+        0x1.45dbecp+1, 0x1.3441e4p+2, 0x1.008712p-2, 0x1.90a482p-2,
+        -0x1.7f79e4p-4, -0x1.db2c92p-4, -0x1.646ab4p+1, -0x1.ea3fdep+0,
+        0x1.0f7bd6p+1, 0x1.a9d16ep-3, 0x1.143aa8p-4, 0x1.8a7e9cp+0,
+        0x1.4be704p+0, 0x1.4ce5e2p+0, 0x1.f91a4ap+0, 0x1.d8f204p+1,
+        0x1.13cce2p-3, -0x1.db9cc6p-3, 0x1.510074p+0, -0x1.7851bep-6,
+        0x1.368bacp+0, 0x1.43e376p+0, -0x1.39ba34p+1, 0x1.76468ap-1,
+        0x1.5bcd66p+1, 0x1.32589ap+3, 0x1.b02832p-3, 0x1.13f3d8p+0
+    },
+    {
+        -0x1.60607ep+0, 0x1.06eff6p-1, 0x1.24c8bap+0, 0x1.69c1c4p-3,
+        0x1.2133dap+1, -0x1.6175c6p+0, 0x1.64464ap+0, -0x1.f0c45p-4,
+        0x1.7f6c0ap-3, 0x1.2c168cp-3, -0x1.9ae134p+0, -0x1.f2443ep+0,
+        -0x1.280bdap-1, -0x1.192054p-7, -0x1.0e8e4ap-1, -0x1.208a7p+0,
+        -0x1.2a15f4p-11, 0x1.1263eap-2, 0x1.74c6ap+1, 0x1.313d1ep+1,
+        0x1.c141fp+0, 0x1.1e22e4p-3, 0x1.250a8ep+0, 0x1.0bdec2p-1,
+        -0x1.0ce0b6p-3, 0x1.78a712p-1, -0x1.4cd7e2p+0, 0x1.0c7394p-2,
+        0x1.353b4ep+1, -0x1.0dfeecp+0, 0x1.f35f52p-2, 0x1.6cc1eap+0
+    },
+    {
+        0x1.3a1d94p+0, -0x1.e1a032p+0, 0x1.43741p+0, 0x1.431d72p-6,
+        0x1.2817bep+1, 0x1.452236p-3, 0x1.edd45cp+0, -0x1.03a624p-2,
+        0x1.2ff80cp-3, -0x1.91f002p-1, 0x1.d89f8ep-3, -0x1.b92282p+0,
+        0x1.55012ep-3, -0x1.8aa27cp-3, 0x1.6cceeep-6, -0x1.5bc016p-4,
+        0x1.395f7p+0, -0x1.5477c2p-1, 0x1.d4c4f8p+0, -0x1.585cf8p-7,
+        -0x1.706832p+2, 0x1.79a9c8p+1, -0x1.30c028p+0, 0x1.994ffap+0,
+        0x1.535f9ap-1, 0x1.ecd362p-1, -0x1.00902p+1, 0x1.d17696p+0,
+        0x1.199988p+1, 0x1.508cf4p-3, 0x1.359d4ap+0, 0x1.d3b1f4p+0
+    },
+    {
+        0x1.202122p+0, 0x1.de1558p-1, -0x1.4c6172p+1, 0x1.5ecc3p-2,
+        0x1.f59964p+0, 0x1.2ad63p-2, 0x1.b37824p+0, 0x1.1f3de6p+0,
+        0x1.23a228p+0, -0x1.559adcp-1, 0x1.218172p+0, -0x1.dd3322p+0,
+        0x1.ce5d32p+0, 0x1.7298fp-1, 0x1.92b18ep-1, 0x1.491adcp-4,
+        0x1.244dcap-1, -0x1.ef2de8p-1, 0x1.49308p+0, -0x1.8cb1b8p-1,
+        -0x1.24d3aap-7, 0x1.0454acp+0, -0x1.534aa6p-3, 0x1.31f064p+1,
+        0x1.8379bcp+0, 0x1.194d5p+1, -0x1.b2a12cp+0, 0x1.61c98cp+1,
+        0x1.60f9d6p+1, 0x1.03ea2cp-2, 0x1.978792p-1, 0x1.8a74e6p+1
+    },
+    {
+        -0x1.744dbap-2, -0x1.f7c2d2p-1, 0x1.1e3e46p+1, 0x1.7bc40ep-2,
+        0x1.a195e6p+0, 0x1.182bb4p-1, 0x1.3e9fdp+0, 0x1.79cc28p-2,
+        0x1.552d2cp+0, -0x1.500998p+0, 0x1.1225fep+0, -0x1.fcb314p+0,
+        0x1.70fd5p-3, -0x1.84c85p+0, 0x1.29ae48p+2, -0x1.0f744ep-3,
+        0x1.14d0dap+1, -0x1.2269eep+1, 0x1.fbc828p-1, -0x1.abea1cp-2,
+        -0x1.675d5p-1, 0x1.32ca12p-1, -0x1.f567c8p-1, 0x1.82b492p+0,
+        0x1.c8c6aap+0, 0x1.240fb8p+0, -0x1.42eb3ap-1, 0x1.c0791cp+0,
+        0x1.37a124p+1, 0x1.50ac8cp-1, -0x1.03fcd2p+2, 0x1.9c18d2p+0
+    },
+    {
+        0x1.dd1244p-3, -0x1.286b2ap-3, -0x1.5b9c3ap-1, -0x1.ca21fap+0,
+        0x1.2da254p+0, 0x1.bfafd4p-3, 0x1.febb06p+0, 0x1.2dd512p+1,
+        0x1.d54c22p-1, -0x1.870322p+0, 0x1.54ab2ap+0, -0x1.08964ep+1,
+        0x1.5d8538p+0, 0x1.ef0614p+2, -0x1.2cce4cp+0, 0x1.2d873p-2,
+        0x1.d1ccb6p+0, -0x1.ee8b24p-2, 0x1.aa8a0ep-1, -0x1.9ca49ap+0,
+        -0x1.ded8fp-3, 0x1.50d09ap-2, 0x1.2021cep+0, 0x1.48959cp+0,
+        0x1.aa00a4p+0, 0x1.cdcbc8p-2, -0x1.e41ffap-1, 0x1.4e23cap-1,
+        0x1.72c06ap+1, 0x1.017b92p-2, -0x1.21160ap+2, 0x1.c0830ap+0
+    },
+    {
+        -0x1.730df6p-2, -0x1.0b29ecp+1, 0x1.1cf62ap+0, 0x1.c9e562p+2,
+        0x1.7bfd54p+0, -0x1.fa081p-8, 0x1.51421ep+0, -0x1.d3fcf8p+0,
+        -0x1.71fc7ap-5, -0x1.924b1ep-1, 0x1.0ca9cep+0, -0x1.105048p+1,
+        0x1.63bedep-3, -0x1.7dd0bap-1, 0x1.d7cf24p+1, 0x1.ba688ep+1,
+        0x1.2b4d3ap+0, 0x1.6c9e68p-1, 0x1.e686e4p+0, -0x1.0106a8p+1,
+        -0x1.1d69fcp-3, 0x1.1feb86p-1, 0x1.989b3cp-1, 0x1.05164cp-1,
+        0x1.0e66f6p+0, 0x1.cedf26p+0, 0x1.747762p+1, 0x1.831f7cp-1,
+        0x1.71486p+1, 0x1.928722p+0, -0x1.e39818p-3, 0x1.26a274p+0
+    },
+    {
+        -0x1.5f506ep+0, 0x1.b19ef8p-3, -0x1.35e4a8p-9, -0x1.037274p+1,
+        0x1.e8abeap-1, 0x1.a3cedcp+0, 0x1.5ae23ap+0, 0x1.dac05p-2,
+        -0x1.bdad08p-2, -0x1.c42f2p-3, 0x1.156628p+0, -0x1.2e1f12p+1,
+        0x1.4354f6p-1, 0x1.241fdap-2, -0x1.9b1aa8p-1, -0x1.0f115ap+3,
+        -0x1.5650b4p-1, 0x1.05b58ap+0, 0x1.002a44p+1, 0x1.948172p-1,
+        0x1.eb4dd6p-3, 0x1.99456p-1, 0x1.0ba362p-1, 0x1.e96d5ap-1,
+        0x1.d8d5aep-2, 0x1.4226e8p-1, -0x1.d22d2cp+1, 0x1.30fccep-1,
+        0x1.53ad06p+1, 0x1.dcc4b2p+0, 0x1.1ae2f2p-1, 0x1.0097b6p+0
+    },
+    {
+        -0x1.91ffe4p+1, -0x1.277b86p-1, 0x1.ab6a6ep-1, 0x1.5ed35cp-1,
+        0x1.2c9422p+0, 0x1.d86796p-1, 0x1.4946ep+0, -0x1.f19a2cp-1,
+        0x1.9e8506p-2, -0x1.b14328p-1, -0x1.8b6be8p-1, -0x1.f73362p+0,
+        0x1.624c0ep+0, -0x1.4aa906p-3, 0x1.0e3a9ap-1, 0x1.66a0ap+1,
+        0x1.d2a5ep-2, 0x1.1fdfb6p+0, 0x1.2d028ep+1, 0x1.f57fbep+0,
+        0x1.a801dcp-5, -0x1.8834a6p-6, 0x1.dba89p-1, -0x1.7e3a3cp-2,
+        0x1.59d668p-1, -0x1.79cfbap-6, -0x1.10954cp-2, 0x1.1da95ap-1,
+        0x1.639ba8p+1, 0x1.9c9264p+0, 0x1.c7778p-2, 0x1.53b57cp-1
+    },
+    {
+        -0x1.21e4fep+1, 0x1.18789ap-2, 0x1.5783b2p-1, 0x1.7b0638p-2,
+        0x1.931eep+0, -0x1.306288p+0, 0x1.dc7ab6p+0, -0x1.10552p-3,
+        0x1.69a34p+0, -0x1.84b658p-5, -0x1.d0979p-1, -0x1.0538dcp+1,
+        0x1.65d69p-5, -0x1.2ad30ap-4, 0x1.5fce5cp-3, -0x1.ccbbb2p+0,
+        0x1.3a8342p-1, -0x1.8b539ep-4, 0x1.ac854cp+1, 0x1.e85586p+0,
+        0x1.66aa96p+0, 0x1.383604p-1, 0x1.a8e276p+0, 0x1.d766c4p-2,
+        -0x1.074d04p-6, 0x1.06953ep-6, -0x1.fe1d04p+0, 0x1.3f0edcp-1,
+        0x1.3a3404p+1, 0x1.ef6806p+0, 0x1.ec7a5cp-2, 0x1.7b8a92p+0
+    },
+    {
+        0x1.a7c176p+0, -0x1.39aff2p+1, 0x1.34bd58p+0, 0x1.7a2f74p-4,
+        0x1.23441ap+1, 0x1.75d97p-4, 0x1.61aefep+1, 0x1.c4186cp-2,
+        0x1.900eeep+0, -0x1.bb31fap-2, -0x1.605f02p-3, -0x1.c8621ap+0,
+        -0x1.a53d18p-2, 0x1.311134p-2, -0x1.2f0448p+0, 0x1.312c02p-5,
+        0x1.00dd1cp+0, 0x1.a15998p-4, 0x1.e0b12p+1, -0x1.e7c0aap-3,
+        -0x1.2c1b6cp+3, -0x1.8849bap+1, -0x1.25302ep+1, 0x1.9fa13ap+0,
+        -0x1.5fc3f4p-2, 0x1.4f5202p+0, -0x1.4ea4p+0, 0x1.1dad14p+1,
+        0x1.091c4ap+1, -0x1.264c3cp-9, 0x1.12efd2p-2, 0x1.94f76ep+0
+    },
+    {
+        0x1.24092cp+1, 0x1.5fb514p+0, 0x1.41079ap-1, 0x1.4a0f3cp-2,
+        0x1.2fde58p+1, 0x1.216436p-4, 0x1.aafa5cp+0, 0x1.5d35bep+0,
+        0x1.1a25f4p+0, -0x1.5df79ep-1, 0x1.35c48ep+0, -0x1.07cb4ap+1,
+        0x1.6c3e52p+1, 0x1.d07a6cp-3, 0x1.b94ed8p+0, -0x1.28112cp-1,
+        0x1.4c83c6p-1, -0x1.9b9026p+0, 0x1.e1e98p-1, -0x1.c016c6p+0,
+        0x1.85801ep+1, 0x1.1a94ccp+1, -0x1.0bb04ep-2, 0x1.42ce4cp+1,
+        0x1.3a276ap-1, 0x1.09ddc4p+1, 0x1.1f468ap+0, 0x1.98a2dep+1,
+        0x1.4d514ep+1, 0x1.aa2ac2p-1, 0x1.37bb48p-1, 0x1.a317bap+1
+    },
+    {
+        0x1.7f12f6p+0, 0x1.148feep-3, -0x1.0bfeeap-1, 0x1.431388p-2,
+        0x1.04631cp+1, 0x1.f04b54p-3, 0x1.06ab9cp+1, 0x1.35ef98p+0,
+        0x1.7377fep-1, -0x1.bca4b6p+0, 0x1.939cfap+0, -0x1.0b48bp+1,
+        -0x1.817f8ap+3, 0x1.bf0152p-5, -0x1.002bdep-1, 0x1.d9c28ep-1,
+        0x1.0fcbc4p+1, 0x1.57e1e6p-2, 0x1.ff2c48p-1, -0x1.58a062p-1,
+        -0x1.a0dbaep+0, -0x1.1a8f12p-4, -0x1.268016p-1, 0x1.1def52p+1,
+        0x1.c4c9fp-2, 0x1.e7a7a6p+0, -0x1.33cbbcp+1, 0x1.627e98p+0,
+        0x1.0ae646p+1, -0x1.8d1218p-3, -0x1.80da8cp+0, 0x1.195306p+1
+    },
+    {
+        0x1.14883p+0, -0x1.24a1bp+1, 0x1.c65612p-2, -0x1.07ace2p+0,
+        0x1.776688p+1, 0x1.8a924ep-2, 0x1.3fe3cap+0, 0x1.7737d6p+1,
+        0x1.9dc74cp+0, -0x1.c851cp+0, 0x1.fe6a32p+0, -0x1.a755b4p+0,
+        0x1.8883b8p+1, 0x1.6e3c5p-5, 0x1.ca2e7ep+1, -0x1.6bae16p+0,
+        0x1.b9d36ap+1, 0x1.810efcp-1, 0x1.7e2852p-1, -0x1.11d868p+1,
+        0x1.5870ecp-1, -0x1.566afcp+0, -0x1.b908cep-1, 0x1.da4e26p+0,
+        0x1.70fd4p+0, -0x1.6232c4p-2, -0x1.5c1bf8p+0, 0x1.8e3912p+0,
+        0x1.1ec648p+1, 0x1.197a0ap-2, -0x1.025e8ep+3, 0x1.045a9cp+1
+    },
+    {
+        -0x1.745fcp-2, -0x1.dd76a4p+1, -0x1.e49252p-3, 0x1.5374dcp+0,
+        0x1.00f98p+1, -0x1.397f3ap-1, 0x1.de24f4p+0, -0x1.ec116p+1,
+        0x1.312b26p-3, -0x1.365a18p+0, 0x1.5af234p+0, -0x1.f6d62ap+0,
+        -0x1.7b1056p+2, -0x1.e5bd04p-1, 0x1.4db596p-1, 0x1.540074p+1,
+        0x1.cfdb08p-1, 0x1.f7891p+0, 0x1.3671d2p+1, -0x1.d792d4p-3,
+        -0x1.0af506p+0, 0x1.78de1ep+0, 0x1.d9a056p-1, 0x1.1db0ep+0,
+        0x1.a4a364p-1, 0x1.044492p-2, -0x1.4988eep+0, -0x1.1a4a5ap-1,
+        0x1.3fc1bap+1, -0x1.c80dfp-1, -0x1.306ac4p-2, 0x1.9f4b4cp+0
+    },
+    {
+        -0x1.9b1f8ap+0, -0x1.1ae95ap+0, -0x1.480b44p-2, -0x1.47a34ep-2,
+        0x1.9b4ab8p-3, 0x1.211bf6p+0, 0x1.2166aap+1, 0x1.499534p+0,
+        0x1.708582p-1, -0x1.77d0c6p-2, 0x1.a36662p+0, -0x1.09308ap+1,
+        0x1.898d42p+1, -0x1.3093p-1, 0x1.5326ecp+0, -0x1.4649a8p+0,
+        0x1.a1edcp-1, 0x1.211f94p+0, 0x1.487734p+1, 0x1.bdbe36p-1,
+        -0x1.2646c2p-2, -0x1.d747b2p-5, 0x1.4c5c68p+0, -0x1.6e2956p+1,
+        -0x1.fd12d8p-3, -0x1.b5f922p-1, -0x1.22881cp-1, 0x1.26998ap-1,
+        0x1.46413ap+1, 0x1.0355acp+0, 0x1.de45d6p-3, 0x1.05f3p+1
+    },
+    {
+        -0x1.7fb5bep+1, 0x1.7533dcp-1, 0x1.275cccp+0, 0x1.b41a36p-2,
+        0x1.6afa84p+0, 0x1.434408p+0, 0x1.26d96p+1, 0x1.2993bap-5,
+        0x1.4b80aep+0, -0x1.74dd8cp-3, 0x1.41cafap-1, -0x1.17cea8p+1,
+        -0x1.f396eap-1, 0x1.4184a8p-2, -0x1.2b3f08p+1, 0x1.a7b7e2p+0,
+        -0x1.07531ep-1, 0x1.f15a2ep-1, 0x1.eeaec4p+0, 0x1.a9b338p+0,
+        -0x1.f514bep-2, -0x1.e81e4ap-2, 0x1.6ad854p+0, 0x1.3f1958p+1,
+        -0x1.471f8cp+0, -0x1.e6d87p-1, -0x1.38e5cap-2, -0x1.de4cc2p-1,
+        0x1.5126eap+1, 0x1.65729ep-1, -0x1.0fb574p-1, 0x1.6f3458p+0
+    },
+    {
+        -0x1.428b28p+1, -0x1.12952ap-1, -0x1.a07436p-2, 0x1.145476p-1,
+        0x1.51705ap+0, 0x1.914798p-4, 0x1.24a886p+1, 0x1.f1db6ep-4,
+        0x1.e6f0e4p+0, -0x1.05f9c6p+1, -0x1.59e9b2p-1, -0x1.0dd11ep+1,
+        0x1.5a49ccp+0, 0x1.dc976ap-3, 0x1.6f0e2ap+0, -0x1.3169c2p+0,
+        0x1.7d1f48p+0, 0x1.aeaa52p-2, 0x1.59803ap+1, 0x1.2fa396p+0,
+        0x1.1b9554p-2, 0x1.d0f554p-1, -0x1.107p-2, -0x1.5e127p+1,
+        -0x1.63306ap-2, -0x1.5d4286p-5, -0x1.188b24p+0, -0x1.502c5cp-2,
+        0x1.331324p+1, 0x1.d07784p-1, 0x1.8f8fa2p-2, 0x1.5f8b66p+1
+    },
+    {
+        0x1.72d49p+1, -0x1.76074p+0, 0x1.9d2512p+1, 0x1.99acfap-2,
+        0x1.288db8p+0, 0x1.0b2c3p-1, 0x1.3c0fap+2, 0x1.338de8p+0,
+        0x1.4d4e78p+1, -0x1.84cedcp+1, -0x1.fbe3d8p-3, -0x1.ffa9fap+0,
+        0x1.3ee5a2p+0, 0x1.8e7cf8p+0, -0x1.5783f8p-4, 0x1.009848p-1,
+        0x1.fbb82cp-7, 0x1.141dfap-2, 0x1.a457a4p+1, 0x1.9d7574p-6,
+        -0x1.0000dep+2, 0x1.a94d1ap-2, -0x1.4ba5e8p+1, 0x1.29587cp+0,
+        -0x1.5e0cdp+0, 0x1.9f5198p+0, 0x1.076f18p-2, 0x1.83e76p+0,
+        0x1.d6bf24p+0, -0x1.c49a02p-2, -0x1.da457ap-3, 0x1.52187cp+0
+    },
+    {
+        0x1.e3b2ecp+1, 0x1.ffbd64p+1, 0x1.d092ccp-3, 0x1.78070ap-1,
+        0x1.443b58p+0, -0x1.b5f0c8p-2, 0x1.03de2cp+2, 0x1.1240f8p+1,
+        0x1.08c678p+1, -0x1.d763acp-1, 0x1.367194p+1, -0x1.281a7p+1,
+        0x1.598858p+1, 0x1.0a45b2p-2, -0x1.bf362ep-3, -0x1.06528ap+0,
+        0x1.e83a34p+1, -0x1.9351b8p-1, 0x1.21567ap+1, -0x1.4254b4p+1,
+        0x1.db76cap+0, 0x1.9e309ep+0, 0x1.46f7a8p+0, 0x1.8610aep+1,
+        -0x1.9ae13ap-1, 0x1.54035ap+1, 0x1.f6e754p-2, 0x1.29c77ap+1,
+        0x1.d2cd18p+0, 0x1.4b7712p-2, 0x1.7461eep-5, 0x1.ef9632p+1
+    },
+    {
+        0x1.781ce6p+1, 0x1.19f532p-2, -0x1.2b5092p-1, 0x1.19ccp-1,
+        0x1.fec748p+0, -0x1.6350cap-3, 0x1.148c04p+2, 0x1.c1db3p-1,
+        0x1.28cabp+1, -0x1.06e716p+1, 0x1.3bb088p+1, -0x1.8076fcp+0,
+        -0x1.180492p+3, 0x1.5a833ep-1, -0x1.ef3f7ep-5, -0x1.5c5c76p+0,
+        0x1.8333c8p+1, 0x1.7c1d8ep+0, 0x1.23dc0ap+1, -0x1.8c5bd2p+0,
+        0x1.4c2108p-1, 0x1.747abap-1, 0x1.6cfe72p+0, 0x1.554e04p+1,
+        -0x1.3fe8fep-2, 0x1.ac4d26p-5, 0x1.4fcc2p+0, 0x1.a1f3aap+1,
+        0x1.68af78p+0, -0x1.d06c48p-3, -0x1.52b42p-1, 0x1.94f156p+1
+    },
+    {
+        0x1.8c0206p+1, 0x1.a42988p+0, 0x1.10a1fcp+0, 0x1.bcd53ep-1,
+        0x1.856548p+0, -0x1.73bd4cp+0, 0x1.3b972ap+2, -0x1.5278fep-2,
+        0x1.2d8658p+1, -0x1.e7c7d4p+0, 0x1.a69b12p+1, -0x1.c29206p+0,
+        0x1.bb8acp-3, 0x1.3c5072p-1, 0x1.2c34bp+0, -0x1.54f364p+4,
+        0x1.3a08cap+2, 0x1.07da98p+1, 0x1.618fb6p-1, -0x1.facee6p+0,
+        0x1.0dbcecp-4, 0x1.090178p-1, 0x1.ea82acp+1, 0x1.f0711p+0,
+        -0x1.93bcfap+0, -0x1.3745dap-1, 0x1.b3244cp+0, 0x1.e75aap+0,
+        0x1.01dd42p+1, -0x1.2f2324p+0, -0x1.ba4d2ap+1, 0x1.9fea3p+1
+    },
+    {
+        0x1.65cac6p+0, -0x1.43755p+1, -0x1.f30704p-1, 0x1.e972a2p+0,
+        0x1.860b2cp-1, -0x1.449138p-1, 0x1.33b826p+2, -0x1.caaa84p+2,
+        0x1.e9be32p+0, -0x1.7374eap+1, 0x1.e06a4cp+1, -0x1.b8df6ap+0,
+        -0x1.a72dcp+2, 0x1.8a085p+0, 0x1.8223ecp+0, -0x1.05cebap+5,
+        0x1.d31372p+0, 0x1.884d68p+1, 0x1.50bf62p+1, -0x1.dc17b8p+0,
+        -0x1.2389fep+0, 0x1.f8075ep-5, 0x1.728fap+2, 0x1.4ce9e8p+1,
+        -0x1.4ac444p+0, -0x1.491ceap-3, 0x1.7556fap-2, 0x1.2e851p-2,
+        0x1.0b2dd2p+1, 0x1.c033fcp-2, -0x1.65ae48p-5, 0x1.16154p+1
+    },
+    {
+        -0x1.314994p+0, -0x1.624cd4p+0, -0x1.7b74e2p+1, 0x1.91bb5cp+0,
+        -0x1.415e8ap-2, 0x1.85ce32p+0, 0x1.e4ce7cp+1, 0x1.a4469ap-2,
+        0x1.e4233ap+0, -0x1.16c9dp+1, 0x1.6b8a0ap+1, -0x1.2f6f74p+1,
+        0x1.7e2e66p+0, -0x1.8cb91p-2, 0x1.ed3f6cp+0, 0x1.87f6p+0,
+        0x1.13779p-2, 0x1.2a9544p+1, 0x1.b3a374p+0, 0x1.5f9082p+0,
+        -0x1.c1082p+0, -0x1.2e81bap-1, 0x1.c64a12p+0, 0x1.88e85ep+0,
+        -0x1.d0b188p-2, -0x1.ceba0ap-1, 0x1.4e3112p-11, 0x1.48bbecp-2,
+        0x1.060acep+1, 0x1.1f8a46p+0, -0x1.44e334p-1, 0x1.435d0ap+0
+    },
+    {
+        -0x1.9c9e6p-3, -0x1.be1476p+0, 0x1.2ba936p+0, 0x1.4fa0e6p-2,
+        -0x1.40bf1cp-2, 0x1.5e583cp-1, 0x1.782398p+1, 0x1.58d196p-4,
+        0x1.1b5858p+1, -0x1.597736p+2, 0x1.0b8336p+0, -0x1.4061ecp+1,
+        -0x1.977fap+0, 0x1.491224p+1, -0x1.f6179ep-6, 0x1.2aef14p-2,
+        0x1.2b9c16p+1, 0x1.76617p+1, 0x1.3433p+0, 0x1.18336cp+0,
+        0x1.e413f4p-5, -0x1.7f32cap+1, -0x1.3ece5cp+2, 0x1.305f7cp+1,
+        -0x1.832ddp+1, -0x1.5d8888p-1, -0x1.6cb16p+0, 0x1.be891cp-6,
+        0x1.2d9138p+0, 0x1.728dacp+1, -0x1.1ad108p+0, 0x1.b8a936p-2
+    },
+    {
+        -0x1.8ffc7p-2, -0x1.a91586p-1, 0x1.61abc4p-5, 0x1.eb18e8p+0,
+        0x1.9d882p-1, 0x1.5394e4p+0, 0x1.8b478p+1, 0x1.24a192p-1,
+        0x1.7a376ap+1, -0x1.32a75cp+2, -0x1.c85636p+1, -0x1.1b4146p+1,
+        -0x1.1a80ep-3, 0x1.50e486p+0, -0x1.70f006p+0, -0x1.859de4p+0,
+        -0x1.387d34p+0, 0x1.cce1c6p-1, 0x1.6f5ae8p+0, 0x1.a3e5cp+0,
+        -0x1.3e17cep-2, -0x1.c828a6p-6, -0x1.32ce12p+1, 0x1.a26a1cp+0,
+        -0x1.1b2fb6p+0, 0x1.9f266ep-5, -0x1.87da18p-1, -0x1.e39abcp-4,
+        0x1.710666p+0, 0x1.fd7af6p-1, 0x1.8db068p-1, 0x1.15b1f8p-1
+    },
+    {
+        0x1.fcf7fep+2, -0x1.923afcp+0, 0x1.549ec6p-2, -0x1.530d7ep-3,
+        -0x1.e0292ep+1, -0x1.21d6fcp+0, 0x1.6418b8p+2, 0x1.9c218ap+0,
+        0x1.10475ep+2, -0x1.5ae8a4p+3, 0x1.378b9p+1, -0x1.656b88p+0,
+        -0x1.28668cp+0, 0x1.99b4aap+0, -0x1.5b5acep+0, 0x1.d63032p+0,
+        0x1.188324p+2, -0x1.9222b8p-3, 0x1.bc7fecp+1, -0x1.949fe8p+1,
+        -0x1.07776ep+2, 0x1.d87f4p+2, 0x1.c612bap-5, 0x1.76157p+0,
+        -0x1.9591ccp+1, 0x1.3d763ap+1, -0x1.31e9f4p-3, -0x1.d59a28p-1,
+        -0x1.853438p-5, -0x1.c99248p-2, -0x1.4c6e84p+4, 0x1.546af8p-1
+    },
+    {
+        0x1.cdedf8p+2, 0x1.e6b5bep+1, -0x1.2c90bep+4, -0x1.7f43a6p-2,
+        -0x1.9e6faep+2, -0x1.ef3d2ap+0, 0x1.a1a738p+2, 0x1.20ca9ap+2,
+        0x1.075b72p+2, -0x1.6e1b7cp+2, 0x1.f061a6p+1, -0x1.92078ap+0,
+        0x1.056584p+2, 0x1.51b654p-2, 0x1.3e6ffp+3, 0x1.1b23fcp+0,
+        0x1.b75dd6p+1, 0x1.5ea4e4p-1, 0x1.18a20ap+1, -0x1.5bc67ap+4,
+        0x1.35abb4p+1, 0x1.d86c12p+2, 0x1.0adac8p+1, 0x1.697efep-4,
+        -0x1.f5314cp+1, 0x1.b2d9eep+2, 0x1.46e086p+0, 0x1.ffc932p+1,
+        0x1.bb1d62p-2, 0x1.c1409cp-1, -0x1.77b31cp+2, 0x1.904dfap+0
+    },
+    {
+        0x1.b532b4p+2, 0x1.011dd6p+2, -0x1.8656bep+4, 0x1.79716cp-3,
+        -0x1.5dc3c2p+0, -0x1.2fe21ap+0, 0x1.19b084p+2, 0x1.7f2cb2p-4,
+        0x1.04240cp+2, -0x1.f50a4ep+2, 0x1.c29cb2p+1, -0x1.498248p+0,
+        -0x1.4ff92p+4, 0x1.72888cp+0, -0x1.6279e6p+0, -0x1.07b06p-1,
+        0x1.3afe2ep+2, 0x1.3bbb7p+2, 0x1.7b78fp+1, -0x1.25ced2p+2,
+        -0x1.7b40cp+0, 0x1.32e58p+2, 0x1.b86f76p+2, 0x1.87035p+0,
+        -0x1.c1f236p+1, -0x1.3a6eb4p+1, 0x1.9ee986p-2, 0x1.218f06p+2,
+        0x1.172da4p+0, -0x1.627f4p+1, -0x1.65f022p+3, 0x1.dd0118p+0
+    },
+    {
+        0x1.69750cp+2, 0x1.5b0a84p+2, 0x1.af535ep+0, 0x1.3446a6p-2,
+        -0x1.65b3fep+1, -0x1.b39bfcp+1, 0x1.04ae5cp+2, -0x1.135328p+0,
+        0x1.a6da4cp+1, -0x1.400ab6p+2, 0x1.40af28p+2, -0x1.37da2ep+1,
+        0x1.538faep+3, 0x1.932a24p-1, 0x1.3c8866p+0, -0x1.9b3dbcp+4,
+        0x1.bff1fap+2, 0x1.972512p+1, 0x1.fab0b8p-2, -0x1.61b466p+0,
+        0x1.26cfd2p-3, -0x1.e6828cp+2, 0x1.1a72aap+3, 0x1.18630cp+2,
+        -0x1.ac68dap+0, -0x1.3770fcp+0, 0x1.fc339p+1, 0x1.21aa5ap+2,
+        0x1.f5728ep+0, -0x1.063c3p+0, -0x1.64b764p+2, 0x1.12bc6ep+2
+    },
+    {
+        0x1.495f7cp+1, 0x1.e0d65p+1, 0x1.d40ad2p+0, -0x1.75082p-2,
+        0x1.f178ccp-2, -0x1.0a57fap+0, 0x1.813cbap+2, -0x1.cb6cp-1,
+        0x1.3450f8p+2, -0x1.fbc7b8p+1, 0x1.5f483ap+1, -0x1.0f563ep+1,
+        -0x1.b197c2p+4, 0x1.544d4ap+0, -0x1.3f53fap-1, -0x1.4ad56ep+4,
+        0x1.c63122p-1, 0x1.50583cp+2, -0x1.49118p-1, 0x1.f9b3acp+2,
+        -0x1.e311cep+0, -0x1.a30cep+1, 0x1.40a118p+2, 0x1.5859p+2,
+        -0x1.22e45ep+2, -0x1.3126f2p+2, 0x1.9b526p-2, 0x1.cdb422p+0,
+        0x1.5d49e6p+0, -0x1.7c2598p+0, -0x1.13bdaap+1, 0x1.a467d4p+1
+    },
+    {
+        0x1.f2b0ep-2, 0x1.868a3cp-1, 0x1.7f4a58p+2, 0x1.d134cep-1,
+        -0x1.2b5682p+0, 0x1.02572p+1, 0x1.02be04p+2, -0x1.dee2eep+1,
+        0x1.8cac3ap+1, -0x1.e37e7ap+1, 0x1.ace176p+1, -0x1.4ea2bep+1,
+        0x1.11c522p+2, 0x1.62e38ep+1, 0x1.0c6706p+3, -0x1.759a66p+4,
+        0x1.0f1f54p+4, 0x1.5277fep+1, -0x1.6a97fep+0, -0x1.7c7dfcp+1,
+        -0x1.cc3652p+0, -0x1.2097ecp+2, 0x1.76a57ep+2, 0x1.0620bap+0,
+        -0x1.443f0ap+2, -0x1.4da512p-1, 0x1.674d18p+2, -0x1.934628p+1,
+        0x1.2f0efp-3, -0x1.2427dep-2, -0x1.401f7cp+1, -0x1.2dbe66p-2
+    },
+    {
+        -0x1.e71486p+0, -0x1.94c90ap+1, 0x1.f2c60ep+2, -0x1.67db4ap+0,
+        -0x1.2788ccp-1, -0x1.d052a2p+2, 0x1.3fcc72p+2, 0x1.12f304p+2,
+        0x1.08c93ep+1, -0x1.80400ap+3, 0x1.8826c2p-1, -0x1.0c437p+3,
+        0x1.e76b18p+0, 0x1.730cdcp+2, 0x1.9e245ep+1, 0x1.3f1b46p-3,
+        0x1.3a329cp+0, 0x1.567384p+1, 0x1.03019ep+0, 0x1.585f1cp+1,
+        -0x1.269fep+1, -0x1.62cc8ep+0, 0x1.27e90ap+3, 0x1.097ebap+3,
+        -0x1.b39d7p+1, -0x1.4f8b42p+3, -0x1.15249p-1, -0x1.ca7014p+1,
+        0x1.0267e8p+2, -0x1.eb3788p+1, -0x1.6f5698p+3, -0x1.8b3c6ep+2
+    },
+    {
+        0x1.aaf08cp+0, 0x1.32dcb8p+1, -0x1.0f383p+1, 0x1.b462ap-1,
+        0x1.87604ep+0, -0x1.5e1032p+2, 0x1.154542p+2, -0x1.3e4a92p+0,
+        0x1.63dc66p+2, -0x1.339dbcp+2, 0x1.25400cp+0, -0x1.b6394cp+0,
+        -0x1.45ab6cp-3, 0x1.7a070cp+1, 0x1.68f1a2p+1, 0x1.c8ba3p+0,
+        0x1.59e0dep+3, 0x1.595db8p+1, 0x1.0199fep+1, 0x1.ad9ef8p+2,
+        -0x1.acf694p-2, -0x1.88e50cp+0, 0x1.51e1f8p+2, -0x1.ee9664p-1,
+        -0x1.1f8d3ap+3, -0x1.f431a2p+0, 0x1.40cdd4p+2, -0x1.55d46ep+1,
+        0x1.5c3eb4p-1, -0x1.0c69cap+0, -0x1.41b71ap+1, -0x1.493e52p-1
+    },
+    {
+        -0x1.470be4p-1, -0x1.064ec8p+1, 0x1.2cc384p+2, 0x1.459efp-2,
+        -0x1.dfe9dep+2, 0x1.86d55ap-2, 0x1.88e9f2p+0, 0x1.0f6d0cp+0,
+        -0x1.3b022ep-1, 0x1.429b6ap-1, -0x1.f8e662p+0, -0x1.4ec3ecp-2,
+        0x1.e8b5aep-2, -0x1.0d5eccp-5, 0x1.a9e5d4p+0, 0x1.9712bep-3,
+        -0x1.213442p+1, -0x1.e33542p+0, -0x1.1abbacp+0, 0x1.c378b6p-1,
+        0x1.d5dcb2p-3, -0x1.a38054p+1, -0x1.5c1702p+0, -0x1.04989cp+0,
+        -0x1.7421fp+1, -0x1.966e08p-2, 0x1.fde7dep+1, 0x1.0de38cp-3,
+        -0x1.aded0cp-1, 0x1.76032p-2, -0x1.41f114p+1, -0x1.0dbc5p+0
+    },
+    {
+        -0x1.16e6b4p-3, -0x1.53370ap+0, 0x1.b2cf04p-6, 0x1.116248p-3,
+        -0x1.2fd4fap+3, 0x1.05c8c4p+0, 0x1.822138p+1, 0x1.1dde18p-2,
+        0x1.53660ap-2, 0x1.8376e8p+0, -0x1.abeec8p-1, -0x1.27ddbcp-2,
+        0x1.cd7134p-4, -0x1.c866acp-1, -0x1.008a2ep+0, 0x1.972cecp-1,
+        -0x1.475acep+0, -0x1.d42b1p+0, -0x1.c5777ap-2, 0x1.50a91ap-1,
+        -0x1.811c02p-1, -0x1.356268p+0, -0x1.e5c044p-2, -0x1.e7679ep+0,
+        -0x1.24e856p+1, 0x1.3b3744p-2, 0x1.5ef2d4p-1, -0x1.566f4ap+0,
+        -0x1.caa95p-3, 0x1.454ba2p-2, -0x1.3290fap+0, -0x1.b39d58p+0
+    },
+    {
+        -0x1.0aa22p-2, -0x1.31a88ep+0, 0x1.0d86eep-3, 0x1.07377cp-1,
+        -0x1.9d9edap+2, 0x1.6c71c4p+1, 0x1.3bd68p+1, -0x1.b503bcp-2,
+        -0x1.9d9b68p-3, 0x1.9e404ep+0, -0x1.babba8p+0, -0x1.0c5f56p-1,
+        -0x1.1e3112p-1, 0x1.ac65cep-1, 0x1.5d22bp+0, 0x1.a4baf8p-1,
+        -0x1.1d4cbap+1, -0x1.9a82c4p+0, -0x1.0c3fc6p-1, 0x1.914076p+0,
+        0x1.ba7496p+0, -0x1.20a7eep+2, -0x1.cb83p-1, -0x1.420e6p+1,
+        -0x1.dc350cp-1, -0x1.e3b8aap+0, 0x1.aa4e4ap+0, -0x1.148ae8p+1,
+        0x1.c03f22p-6, 0x1.b630f4p-1, 0x1.5f1852p+0, -0x1.455196p+1
+    },
+    {
+        -0x1.af8d44p-1, -0x1.615e88p-1, -0x1.7aeb1cp-2, -0x1.3afa2cp-1,
+        0x1.8211e6p-2, 0x1.4bc4c2p-1, 0x1.bdcf1ep-1, -0x1.eebc8cp-2,
+        -0x1.3e467p+0, 0x1.b29652p+0, -0x1.701a3ep+1, -0x1.6a6672p-1,
+        -0x1.8076b4p+1, 0x1.6f2a6cp+0, 0x1.08daf6p+1, 0x1.22cdf8p-2,
+        -0x1.5b2e32p+1, 0x1.ace9fep+1, -0x1.29c022p-1, -0x1.186d18p-2,
+        -0x1.93578ap-8, -0x1.ac2fd2p+2, -0x1.1062dap+1, -0x1.d5d1c4p+0,
+        0x1.8d5f1ap+0, 0x1.b9192cp+0, -0x1.0ab412p+1, -0x1.59d402p+1,
+        -0x1.c968e6p-2, -0x1.b0a826p+1, 0x1.bea9e2p-7, -0x1.c4db4ap+0
+    },
+    {
+        0x1.76e4e4p-2, 0x1.22c9f4p+0, -0x1.8f8f76p+0, 0x1.9394c2p-1,
+        -0x1.e201bap-5, 0x1.cb13f4p-3, -0x1.d8623p+0, -0x1.c38256p-1,
+        -0x1.d667dap+0, 0x1.b98eb8p+0, -0x1.6e2b24p+1, -0x1.1060eap+0,
+        -0x1.b0bfap-1, -0x1.74688ep-1, 0x1.2d4716p+0, -0x1.c7f5d6p-1,
+        -0x1.bb873ap+1, -0x1.71800cp+1, 0x1.e7fc92p-3, -0x1.9ac408p+3,
+        0x1.81ba64p-1, -0x1.f5b93p+0, -0x1.144552p+0, -0x1.7d8418p+0,
+        0x1.dc77p-2, -0x1.a604cap-3, -0x1.78afa2p+1, -0x1.0e6ecp+0,
+        -0x1.c15294p-3, -0x1.4819cp+0, 0x1.7d8bp+1, -0x1.4cfeacp+0
+    },
+    {
+        -0x1.295a8ap-1, 0x1.ceaddap-2, -0x1.6b6252p+1, -0x1.3fa76p-1,
+        0x1.41c3aap+1, 0x1.e862ap-1, -0x1.06a978p+0, -0x1.c01e1ap+0,
+        -0x1.65222ep+0, 0x1.febedap+0, -0x1.1a201ep+1, -0x1.dd8b1ap-2,
+        -0x1.cb8568p-1, -0x1.e1a93ap+0, -0x1.b88314p-6, -0x1.321b4p-4,
+        -0x1.05fb08p+0, -0x1.6ca4a8p-1, -0x1.45b8b8p-1, -0x1.0b8ffap+1,
+        0x1.bfa3fp-2, -0x1.3d8f18p+2, -0x1.7b2fccp+1, -0x1.3dde3p+0,
+        -0x1.ecbd48p-8, 0x1.d23696p-1, -0x1.5ac98ap+0, 0x1.226c6p-1,
+        -0x1.a8833cp-2, -0x1.32b64cp-1, 0x1.009ba2p+0, -0x1.9e46cep-2
+    },
+    {
+        0x1.fce34p-1, 0x1.36f7a6p+0, -0x1.6c2808p+0, -0x1.921582p-1,
+        0x1.d60ba8p+1, 0x1.c84cb2p-3, -0x1.179e8cp+1, 0x1.ee1f96p-2,
+        -0x1.148aa6p+0, 0x1.9c71acp-3, -0x1.692b7p+0, -0x1.d9ebd2p-3,
+        -0x1.7834f4p-1, -0x1.343566p+0, 0x1.398e44p-3, 0x1.d8ea3ep-3,
+        -0x1.0ee8f4p+0, -0x1.5229bep-2, -0x1.0a18b8p+0, -0x1.5f98p+1,
+        0x1.f0e592p-3, -0x1.124058p+1, -0x1.89aca4p+0, 0x1.0a0d82p-1,
+        -0x1.672666p+1, 0x1.7dc9e6p-2, -0x1.705a32p+0, -0x1.1acce2p-3,
+        -0x1.953dbcp-2, -0x1.aed078p-1, -0x1.babcdep-3, 0x1.4214fep+0
+    },
+    {
+        0x1.f5713ep-1, -0x1.7a01ccp-2, -0x1.8ca7f8p-2, -0x1.ad6b38p-2,
+        0x1.c11cc4p+1, 0x1.9a6d8ap+0, -0x1.8efd2ep+1, 0x1.10b41p-1,
+        -0x1.9769aep+0, -0x1.17e51ep-3, -0x1.389c1p+0, -0x1.0ab6acp-4,
+        -0x1.799b14p-1, -0x1.711be6p-1, -0x1.9689d8p-2, -0x1.2a20d4p-2,
+        -0x1.1697bep+0, -0x1.632662p-3, -0x1.3ad4a8p-1, -0x1.b8f972p+1,
+        -0x1.61933cp-3, -0x1.befbbep-1, -0x1.0be60ap+1, 0x1.153bd2p-3,
+        -0x1.374018p+1, 0x1.9dbe3ep-1, -0x1.eef97ep-1, -0x1.0efd2ap-8,
+        -0x1.d20754p-1, -0x1.f01bc8p-2, -0x1.f3c1c8p-2, 0x1.915dap-2
+    },
+    {
+        -0x1.c1a29ap-4, -0x1.f5266p+1, 0x1.fdde4p+1, 0x1.70aceap-3,
+        -0x1.404ebap+2, -0x1.16c62ap+0, 0x1.c30b0ap+1, 0x1.24712cp+0,
+        0x1.99927cp-3, -0x1.70109ap+0, -0x1.0969cap+1, 0x1.bede0ep-2,
+        -0x1.1c7f88p-1, -0x1.040ff4p-1, 0x1.23cd38p+0, -0x1.976af8p-2,
+        -0x1.38802ep+1, -0x1.c01072p+1, -0x1.14dd88p-1, 0x1.520a8cp+1,
+        0x1.8f18dp+0, -0x1.d1f53ap+1, -0x1.65d6e2p+0, -0x1.447edcp+0,
+        -0x1.e36ceap+1, 0x1.afc7ccp-2, 0x1.73ff3cp+2, 0x1.5f0996p-2,
+        -0x1.4b7cdap-1, -0x1.232b64p+0, -0x1.4ab564p-2, -0x1.5152b6p+0
+    },
+    {
+        -0x1.310354p-2, -0x1.2abee8p-1, 0x1.c9b644p-3, 0x1.e00ab2p-1,
+        -0x1.7fde2ep+2, -0x1.2a62f4p+1, 0x1.24c39cp+2, 0x1.b7eab4p-1,
+        0x1.beb14p-1, 0x1.375c32p+1, -0x1.59a2f4p+0, 0x1.3bbbbcp-4,
+        0x1.17711ap-3, -0x1.f3bf54p-2, 0x1.da8308p-5, -0x1.5ad3cap-2,
+        0x1.bff2acp-1, -0x1.47e856p+1, 0x1.035ccep-2, 0x1.890af8p+1,
+        -0x1.516b8p-1, 0x1.f6983ap-4, -0x1.1cf614p-2, -0x1.05cb36p+0,
+        -0x1.7a6266p+1, 0x1.c79f8ap-1, 0x1.241572p+2, 0x1.10338ep-1,
+        0x1.680a96p-7, 0x1.742868p-3, -0x1.62c882p-3, -0x1.056a38p+0
+    },
+    {
+        -0x1.4569d8p-1, -0x1.f2003ap-1, 0x1.e02acp-4, 0x1.d5a746p-2,
+        -0x1.1155f4p+3, 0x1.169d7ap+0, 0x1.18ad32p+2, 0x1.8a11a2p+0,
+        0x1.594128p-1, 0x1.a71446p+1, -0x1.f2f9aep-1, -0x1.848baap-3,
+        -0x1.e3599cp-3, 0x1.f2557cp-1, 0x1.26cda8p-1, -0x1.61e5d8p-1,
+        0x1.e2fabap+0, -0x1.bf426p+0, -0x1.43e6aep+0, 0x1.2db4d8p+2,
+        0x1.5b7622p-2, -0x1.802aa8p+0, -0x1.4e5bd2p+0, -0x1.f608dap+0,
+        -0x1.e70d12p+0, 0x1.a4d536p-4, 0x1.257d4ap+2, 0x1.2043ap-1,
+        0x1.1711c6p-3, 0x1.42fb2ap-1, 0x1.db234ap-1, -0x1.5db50ep+0
+    },
+    {
+        -0x1.bae914p+0, -0x1.3c233cp+1, 0x1.44f966p+0, 0x1.c3d71ap-7,
+        -0x1.2e8e0ep+1, 0x1.6a9d6ap-1, 0x1.46ce52p+2, -0x1.572ec6p+0,
+        0x1.c359ccp-1, 0x1.f18c12p+1, -0x1.05aabap+1, -0x1.62adecp-3,
+        0x1.34fc88p-4, 0x1.36e33cp-1, -0x1.e5ae7ap-5, -0x1.824218p-2,
+        0x1.0da88cp-1, 0x1.ed38c8p-9, 0x1.2a4f48p-2, 0x1.09ef96p+0,
+        0x1.568fdp-3, 0x1.97c646p+0, -0x1.ba1bep-2, -0x1.5ab8dap+1,
+        -0x1.a80676p+0, 0x1.37ee12p+0, 0x1.335f4p+2, 0x1.70cd24p-3,
+        0x1.aeda1ap-5, 0x1.4c0edep+1, 0x1.ab95bp-2, -0x1.11a126p+1
+    },
+    {
+        -0x1.f938aep+0, 0x1.6c7bd2p+0, -0x1.d45386p-3, 0x1.3fa45ap-1,
+        -0x1.df2cc6p+0, -0x1.66938ap+1, 0x1.af31aap-1, 0x1.09c262p+0,
+        -0x1.4c540ep-3, 0x1.562756p+1, -0x1.3ea3e2p+0, -0x1.6d1ab4p-3,
+        -0x1.b1f564p-1, 0x1.6298aap-2, -0x1.3e284ep-4, -0x1.ca803cp-4,
+        -0x1.c024aap-1, -0x1.92d822p+0, -0x1.da7c66p-4, -0x1.d46e1p+0,
+        0x1.a4445ap-1, 0x1.1cb71p+0, -0x1.df842cp-1, -0x1.cafceep+0,
+        -0x1.2ef4cp+0, 0x1.13ce0ap-1, 0x1.0bbeb8p-1, 0x1.25d94p-1,
+        -0x1.200626p-4, -0x1.f76854p+0, 0x1.036e64p+0, -0x1.50b4cep+0
+    },
+    {
+        -0x1.0377e8p+1, 0x1.99461ep+0, -0x1.a4420ep+0, 0x1.175c96p-3,
+        0x1.7ea34ap-1, -0x1.308a9p+1, 0x1.6c09c6p-5, -0x1.06cca2p+1,
+        -0x1.9858d6p-1, 0x1.935654p-1, -0x1.071fap-1, -0x1.c3a5b8p-4,
+        -0x1.4fb1dcp-1, -0x1.1dce7p+0, 0x1.596fd8p-3, -0x1.6191d6p+0,
+        0x1.732042p+0, 0x1.a7a758p-1, -0x1.bd7c14p-2, -0x1.01fc1ap-1,
+        0x1.a2da0ep-3, -0x1.4532a2p+0, -0x1.bb18aap-2, -0x1.8ca62ep+0,
+        -0x1.d8af64p+0, 0x1.f96ebep-1, -0x1.081144p+0, 0x1.0a8dbap+0,
+        -0x1.73faeap-3, 0x1.600796p+1, -0x1.318p-2, -0x1.27943ep+0
+    },
+    {
+        -0x1.bf8ec4p+0, 0x1.513542p-3, -0x1.3967bep-1, -0x1.06213ep-2,
+        -0x1.030234p-1, -0x1.a7d1ep-1, 0x1.273c02p-3, 0x1.06d492p-2,
+        -0x1.2c6c22p+0, 0x1.a8b6cep-1, -0x1.0239a8p+0, -0x1.a49e32p-5,
+        -0x1.3bf67ep+0, -0x1.f090a8p-1, -0x1.3b2714p-2, -0x1.503cf8p-1,
+        -0x1.0283cp-1, 0x1.fb2f7ap-3, -0x1.fafaa4p-1, -0x1.f22c68p-3,
+        -0x1.94be2cp-3, -0x1.0104dp+0, 0x1.001b12p-1, -0x1.098c26p+0,
+        -0x1.9aaae4p+1, 0x1.a4be84p-2, 0x1.11fcp+0, 0x1.6a92fep-1,
+        -0x1.ac6feep-2, 0x1.30e734p-5, -0x1.25e00cp-3, -0x1.e3ec06p-6
+    },
+    {
+        -0x1.b6fec6p-3, -0x1.a42aa2p-2, -0x1.2c2d24p+0, -0x1.9b2c88p-2,
+        0x1.3d1dcep+0, 0x1.d80544p+1, 0x1.bd0a84p-2, 0x1.6bc2a6p-1,
+        -0x1.edeaaap-1, 0x1.56f43p-2, -0x1.dd15p+0, 0x1.7115acp-3,
+        -0x1.5c29d6p-1, -0x1.a8015p-3, -0x1.395d5cp-3, -0x1.f62098p-1,
+        -0x1.06d5fcp+1, 0x1.e360fcp-1, -0x1.7f9bf8p+0, -0x1.bad378p+1,
+        -0x1.eb88bcp-1, -0x1.6358cep+0, 0x1.3744e8p+0, 0x1.968444p-7,
+        -0x1.b37dfap+1, 0x1.cc9512p-1, 0x1.51a6f4p+1, 0x1.21921p+0,
+        -0x1.16814ap-1, 0x1.b79f8p-7, -0x1.b69e14p-2, 0x1.9c2756p-1
+    },
+    {
+        0x1.00e266p-1, -0x1.bea768p+1, 0x1.fdbf6cp+0, 0x1.8a23fap-5,
+        -0x1.90027ep+1, -0x1.0dd07cp+1, 0x1.f3e69ep+1, 0x1.6ecf56p+1,
+        0x1.637d2ep-4, 0x1.f072fcp+0, 0x1.6233a2p+0, 0x1.ff833ep-2,
+        0x1.30a72cp-2, 0x1.544a6p-3, 0x1.be0b12p-1, -0x1.10a3a6p-5,
+        0x1.5f2fc6p+1, -0x1.d8a528p+1, -0x1.ebf53ep-1, 0x1.5571ccp+2,
+        0x1.c5ae78p+1, -0x1.a60f48p+2, -0x1.26f314p+1, -0x1.918fa2p+1,
+        -0x1.a5595p+1, 0x1.aee574p+1, 0x1.e6f40ep+2, 0x1.2a3b7p-1,
+        -0x1.80f204p-1, 0x1.b877e4p-3, -0x1.b142cp+0, -0x1.981fccp+0
+    },
+    {
+        0x1.eb2bbcp-1, -0x1.3ce7aap+2, 0x1.003ae4p+0, 0x1.d766ccp-3,
+        -0x1.4bebc8p+2, 0x1.e98f0ep-7, 0x1.8e8a5p+1, 0x1.6933cep+1,
+        0x1.565c3cp-1, -0x1.72c43cp+4, 0x1.f7a4a6p-2, 0x1.2a8624p-4,
+        -0x1.720e76p-1, -0x1.c8c3f8p-1, -0x1.24476ap+0, -0x1.132e3p+0,
+        0x1.bdbabep+1, -0x1.10014p+1, 0x1.04c7p+0, 0x1.bfb42p+2,
+        0x1.64038ep+0, -0x1.6eaaa8p+2, -0x1.319162p+1, -0x1.783f2ap+1,
+        -0x1.5bb394p+1, 0x1.9ea2e6p+1, 0x1.0b8eeap+2, 0x1.6832b4p+0,
+        0x1.e4845ap-3, -0x1.8043ecp-2, 0x1.4fdcbap+0, -0x1.710faap+0
+    },
+    {
+        -0x1.36b86cp-2, -0x1.48b39cp+1, 0x1.119304p+0, -0x1.90d506p-3,
+        -0x1.5b1538p+2, -0x1.ea4db2p-2, 0x1.7fccep+2, 0x1.fbc638p-1,
+        0x1.4de2c6p-1, 0x1.fab662p+1, 0x1.aed578p-2, 0x1.926d2ap-6,
+        -0x1.8e45b6p+0, 0x1.8cdce2p+0, 0x1.379328p+0, -0x1.c8ebb2p-3,
+        0x1.cc0c8ap+0, 0x1.1b8442p+0, -0x1.df3cb2p-3, 0x1.8ff92ap+1,
+        0x1.5062cap-2, 0x1.3e214p+3, 0x1.14d49cp-2, -0x1.711982p+1,
+        -0x1.30190cp+1, 0x1.3b3fcp-1, 0x1.a23176p+1, 0x1.d220f4p-4,
+        0x1.450ed8p-1, 0x1.3fee1p+1, -0x1.b5ed64p+0, -0x1.c5458p+0
+    },
+    {
+        -0x1.abd186p+0, 0x1.c53cap+0, -0x1.b634bcp-1, 0x1.048d6p+0,
+        -0x1.d7c9bp+0, -0x1.8eebbcp-1, 0x1.7043a8p+2, 0x1.ce430ap-2,
+        0x1.c82e24p-1, 0x1.8158dcp+2, 0x1.9585c6p-4, -0x1.74609ep-3,
+        -0x1.0a61b8p-3, -0x1.073094p-3, -0x1.18a40ap+1, -0x1.45e3a4p+0,
+        0x1.b34be2p+0, -0x1.bd41a4p-3, -0x1.2debccp+0, 0x1.96821p-1,
+        0x1.e751ep-2, 0x1.fc5eaep+2, 0x1.f9b522p-1, -0x1.7dd8a2p+1,
+        -0x1.f527eap+0, 0x1.f3bad6p-1, 0x1.6633c2p+1, 0x1.749784p-1,
+        0x1.94620cp-2, -0x1.1df20ep-1, 0x1.ce6e4cp+0, -0x1.56b748p+1
+    },
+    {
+        -0x1.a87c64p+1, 0x1.9d3d26p+1, -0x1.8c0b58p-2, 0x1.2ba35cp+0,
+        -0x1.5539e8p+1, -0x1.c529cep-1, 0x1.7cc96cp-1, -0x1.5910aap-1,
+        0x1.bd5d0ep-2, 0x1.7a7bep+1, -0x1.5871ep-5, -0x1.643438p-3,
+        -0x1.4e289p+1, 0x1.7108b2p+0, -0x1.6609b2p-1, -0x1.a1252ep+0,
+        -0x1.f0ecf2p-2, -0x1.7f28d6p-6, 0x1.9d99e2p-6, 0x1.33f4bep-2,
+        0x1.c8d68ap-2, 0x1.079cbp+2, -0x1.0558d8p+0, -0x1.c7a63ep+1,
+        -0x1.dbe6dep+0, 0x1.6da00cp-1, -0x1.b5f89p+0, 0x1.83547ep-3,
+        0x1.7c6c16p-4, 0x1.201d34p-3, -0x1.1d7712p-2, -0x1.4c4892p+1
+    },
+    {
+        -0x1.0fae54p+2, 0x1.42867ap+2, -0x1.06d956p+0, 0x1.f534bep-2,
+        -0x1.cda3a6p-1, -0x1.947ceap-1, -0x1.7ba318p+0, -0x1.d61886p-1,
+        -0x1.976376p-1, 0x1.bb5f1ep+0, 0x1.34028ap+1, -0x1.1dd6dcp-3,
+        -0x1.3a59fep+0, -0x1.aafb58p+0, -0x1.1aad0cp-1, -0x1.0b600ep+1,
+        0x1.37243ap+1, 0x1.872acep-1, -0x1.e956ccp+0, 0x1.c821aep-1,
+        0x1.653276p-2, 0x1.157e74p+1, 0x1.4ce126p+0, -0x1.bd9c46p-1,
+        -0x1.ed4bfep+0, 0x1.9b2fcp-2, -0x1.104abap+1, 0x1.8a97fep-1,
+        -0x1.3dd952p-2, -0x1.1cce22p-1, 0x1.3c2d74p-3, -0x1.d2de48p-2
+    },
+    {
+        -0x1.36494ep+2, 0x1.a73892p+0, -0x1.156a4ap-2, -0x1.14e052p+0,
+        -0x1.0b19cep+0, 0x1.020c6ep+1, -0x1.528ee8p+1, -0x1.62546p+0,
+        -0x1.2fc86cp+0, -0x1.2e99ecp+0, -0x1.6ce95cp+1, -0x1.fdc932p-5,
+        -0x1.7e79bep+0, -0x1.c8d08ap+0, 0x1.49f19ep+0, -0x1.a3b34cp-1,
+        -0x1.71b05cp-1, 0x1.ce0cd8p-1, -0x1.0648dep+1, 0x1.955b7cp+1,
+        -0x1.9b2f86p+0, -0x1.a7e312p+1, 0x1.7b2c38p-2, -0x1.10fb62p+1,
+        -0x1.052bfap+2, -0x1.0f0f6ep-2, -0x1.464c2p+1, 0x1.8482b2p-2,
+        -0x1.01416p-1, 0x1.1c532cp+3, -0x1.551b8ep-1, -0x1.e8eee2p-3
+    },
+    {
+        -0x1.0a713ep+2, 0x1.dba36ep+0, -0x1.b08f46p+1, -0x1.60cd1ep-1,
+        0x1.8c1d06p-1, 0x1.508f86p+2, -0x1.3b6244p+1, 0x1.8ff40ep+0,
+        -0x1.3cc1c4p+1, -0x1.2a1e02p-1, -0x1.19bd2p+1, -0x1.5b57bcp-4,
+        -0x1.6068dap-1, -0x1.481c16p-2, 0x1.033168p-7, -0x1.563fb2p-1,
+        -0x1.869fdap+0, 0x1.285ecap-1, -0x1.745d32p+1, 0x1.4156dcp-1,
+        -0x1.2c92bcp+1, -0x1.730f4ep+0, 0x1.e91b9ap-2, -0x1.9b2536p+0,
+        -0x1.5d41c4p+2, -0x1.1625ccp+1, 0x1.33e5dap-1, -0x1.b12b78p-10,
+        -0x1.9f1f2p-1, 0x1.f7c668p+2, -0x1.541ddp-1, -0x1.8d2156p-4
+    },
+    {
+        0x1.55700ap+0, 0x1.8df03cp+0, 0x1.edfe72p-3, -0x1.010cbep-1,
+        -0x1.57c34ap+0, -0x1.5e5fd6p+2, 0x1.ac8a5p+1, 0x1.99198p+1,
+        0x1.cecd32p+1, -0x1.3b9f6cp-3, 0x1.e1fd26p+2, 0x1.060512p+0,
+        0x1.0620e2p+0, -0x1.e792a2p-1, 0x1.b8dd94p-3, -0x1.75ef96p-1,
+        0x1.a59e76p+1, -0x1.8eebeap+1, 0x1.b1e9d4p-1, 0x1.841404p+3,
+        0x1.3bc88cp+0, 0x1.916026p+2, -0x1.294242p+2, -0x1.4c150ap+2,
+        -0x1.7fcfc2p+2, 0x1.09c1aep+2, 0x1.3e8a16p+0, 0x1.6b5a5ap+0,
+        0x1.ad1d2cp-5, 0x1.fdca8ep-1, -0x1.8058a2p+1, -0x1.75b126p+2
+    },
+    {
+        0x1.dd0a1ep-1, 0x1.e6112p+1, 0x1.04e5aep+0, -0x1.dd0ae8p-2,
+        -0x1.510decp+2, 0x1.930d88p+0, 0x1.4c6a06p+2, 0x1.5981a8p+2,
+        0x1.4b9782p+1, 0x1.e1d638p+2, 0x1.0709c4p+2, 0x1.6bc5aap-1,
+        -0x1.43140ap+1, -0x1.e4f112p+0, -0x1.418cbp+2, 0x1.31759ep-1,
+        0x1.472366p+1, 0x1.f8fc8p-3, 0x1.b2d586p+0, 0x1.2c7d22p+2,
+        0x1.fe6d9ap+1, 0x1.5d01fep+3, -0x1.b14a2ep+0, -0x1.30c706p+2,
+        -0x1.bf5accp+0, 0x1.c991a2p+1, -0x1.b5b29cp-1, -0x1.421b12p-1,
+        0x1.975a8ap-3, -0x1.7d5756p-4, 0x1.429df8p-3, -0x1.a631f4p+2
+    },
+    {
+        -0x1.09d61ap-1, 0x1.a5552ep+1, 0x1.d6ecfap+0, -0x1.bdbba6p-2,
+        -0x1.47dbdcp+1, -0x1.2f1f12p-1, 0x1.62c0aep+2, 0x1.99193p+2,
+        0x1.a64226p+0, 0x1.2af016p+3, 0x1.b18e38p+0, -0x1.20a3a6p-6,
+        0x1.37e202p-2, 0x1.5acf66p-1, -0x1.42b9bp+2, 0x1.04469cp+1,
+        0x1.168e48p+1, 0x1.aa5a34p-5, -0x1.de0834p+0, 0x1.8f06a6p+1,
+        0x1.6d179ap+1, 0x1.309228p+3, -0x1.9baf1ep-2, -0x1.71cff2p+2,
+        -0x1.1a31a4p+1, 0x1.e8be5p-1, -0x1.c22234p-2, 0x1.2c6382p-4,
+        0x1.7b1566p-1, -0x1.0e26dp+0, -0x1.0c36a6p-3, -0x1.102aa6p+2
+    },
+    {
+        -0x1.b18492p+0, 0x1.29e646p+2, -0x1.23eb4p+0, 0x1.373176p-1,
+        -0x1.9b125cp+0, -0x1.da94ccp+1, 0x1.26ba8cp+2, 0x1.779732p-2,
+        0x1.f5d206p+0, 0x1.656bc4p+2, 0x1.62491cp+1, -0x1.ea170cp-3,
+        -0x1.13236p+1, 0x1.00d2b8p+0, -0x1.37b6acp+1, -0x1.1cb5fp-1,
+        0x1.f782fp-1, 0x1.69458ep-1, -0x1.4be04cp-1, -0x1.16c4dcp+1,
+        0x1.26869cp+0, 0x1.158434p+3, -0x1.c81e2ap-1, -0x1.73dbcap+2,
+        -0x1.57edc4p+1, 0x1.621ac8p+0, -0x1.b30972p+1, -0x1.c8b98p-1,
+        0x1.1e65dep-1, 0x1.8682dcp+0, 0x1.b372d4p+1, -0x1.601da4p+2
+    },
+    {
+        -0x1.803c56p+1, 0x1.9d696ap+2, -0x1.cb9d42p+1, 0x1.b5c16ap+0,
+        -0x1.7b0664p+0, -0x1.8f8db6p-1, 0x1.00a178p-1, -0x1.69faacp+1,
+        0x1.b99616p-3, 0x1.058746p+2, 0x1.124218p-2, -0x1.01902ep-2,
+        -0x1.985622p-2, -0x1.7e9696p-1, -0x1.08d5ep+2, -0x1.68d014p+0,
+        0x1.aaf082p-4, -0x1.0d041ep+0, -0x1.8172ep+0, -0x1.c0234p+0,
+        0x1.ad2418p-1, 0x1.c23132p+2, 0x1.1f0828p-2, -0x1.41639p+2,
+        -0x1.16e1e4p+2, 0x1.018cf8p+0, -0x1.38d1c2p+0, -0x1.6799f6p-2,
+        0x1.2123d6p-3, -0x1.7f481ap-4, -0x1.850efcp-2, -0x1.257f32p+2
+    },
+    {
+        -0x1.46915ep+2, 0x1.4caf22p+2, -0x1.fb67c2p+0, -0x1.506f4ap-3,
+        -0x1.1e17a4p+0, 0x1.65df3ep-1, -0x1.c2254ep+0, 0x1.eda852p+0,
+        -0x1.24ab82p-1, 0x1.941398p-1, 0x1.9db0c8p+0, -0x1.56931cp-3,
+        -0x1.0df378p-1, -0x1.1f78fep+1, -0x1.790922p-3, -0x1.e42f0cp+1,
+        0x1.45eb08p+0, 0x1.3149fep+0, -0x1.74ba92p+1, 0x1.2f6562p-2,
+        -0x1.63bc8cp-1, 0x1.43c47p+2, 0x1.9e0502p-2, -0x1.8d917p+0,
+        -0x1.ab7da6p+2, -0x1.32515ep-3, -0x1.1d77f6p+2, -0x1.b05p-1,
+        -0x1.519c2ap-3, -0x1.ad4388p+0, -0x1.731f54p-1, -0x1.b3879cp+0
+    },
+    {
+        -0x1.87cefep+2, 0x1.669124p+1, -0x1.4ddd36p-3, -0x1.1bffbcp+1,
+        -0x1.72279ap+0, 0x1.307fcap+3, -0x1.85a878p+1, -0x1.50347cp-1,
+        -0x1.0a07a6p+0, -0x1.2fd25p-1, 0x1.45fb78p+1, 0x1.1850f8p-2,
+        -0x1.1bac42p+0, -0x1.700774p+1, 0x1.048f86p+1, 0x1.44f08ep-1,
+        -0x1.6129eap+2, 0x1.00ce4ep+1, -0x1.a86e7ep+1, 0x1.1dc7ecp+0,
+        -0x1.e6f20ep+0, 0x1.37f88ep+2, 0x1.17591p+1, 0x1.46204ap+1,
+        -0x1.6ba9c2p+2, -0x1.dba3d4p-1, 0x1.de3ab4p+0, -0x1.83249cp-2,
+        -0x1.3f125cp-3, 0x1.0cf71cp+2, -0x1.1c5a64p+0, 0x1.55173ap+2
+    },
+    {
+        -0x1.4b6ee2p+2, 0x1.3cc76ap+0, -0x1.429168p-1, -0x1.2553fcp+1,
+        -0x1.620b64p+0, 0x1.e5cd2p+1, -0x1.c37244p+1, 0x1.2b790cp+0,
+        -0x1.bdc6f8p+0, -0x1.32a256p+1, 0x1.898bdep+0, 0x1.f7c338p-2,
+        -0x1.fdf414p+0, -0x1.4d8aecp+0, 0x1.bd55cep+0, 0x1.0d6ad4p+0,
+        0x1.4e6184p+1, 0x1.5a258cp+1, -0x1.a6d906p+1, -0x1.15a828p-1,
+        -0x1.c7965ep+1, 0x1.38e4cep+1, 0x1.2380ep+2, 0x1.052182p+2,
+        -0x1.35dfa8p+3, -0x1.8d80aep+1, 0x1.1390dcp+2, -0x1.3556b4p+0,
+        -0x1.a8c984p-3, 0x1.529668p+2, -0x1.7e99b2p+0, 0x1.3b349cp+2
+    },
+    {
+        0x1.d6f624p+1, 0x1.4b4ddp-2, 0x1.bd2f7ep+2, -0x1.dd63dcp-2,
+        -0x1.d4c252p+0, -0x1.f5fc44p+1, 0x1.6d443ap-1, 0x1.47c8f8p+0,
+        0x1.7c4ap+1, -0x1.085d36p+4, 0x1.5052ep+3, 0x1.7ac7dcp-1,
+        -0x1.011236p+1, -0x1.da9d8ap+0, -0x1.cff75p+2, 0x1.a97c2ep+0,
+        0x1.bde1eap-2, -0x1.45e554p+1, 0x1.127b1cp+2, 0x1.c4a622p+3,
+        0x1.c4ced6p-1, -0x1.942148p-1, 0x1.9e4c9ep-2, -0x1.628ed6p+3,
+        -0x1.f09cbap+2, 0x1.5c6d3p+2, -0x1.7b4758p+1, 0x1.26e68cp+0,
+        0x1.550b5ap-1, -0x1.ad596cp+0, -0x1.b41f24p+0, -0x1.14f3aap+3
+    },
+    {
+        0x1.0e4344p+1, 0x1.4597c2p+2, -0x1.b314fep+0, -0x1.02220ep+0,
+        -0x1.bcff78p+1, -0x1.382aaap+2, 0x1.e97f02p+1, 0x1.a5c4dep+2,
+        0x1.636914p+1, 0x1.341b46p+3, 0x1.eaff74p+2, 0x1.57e8f8p-1,
+        0x1.f2ada4p+2, -0x1.e22648p+0, -0x1.b43eep+2, 0x1.b61ee4p+0,
+        0x1.5b9d3ap-2, -0x1.99b0aap+0, 0x1.78fedp+0, 0x1.ec28a4p+3,
+        0x1.03241ap+3, 0x1.f180dep+2, -0x1.4e1818p-2, -0x1.51450ep+3,
+        0x1.2f1148p+2, 0x1.8cabe4p+1, 0x1.3edc4cp+0, 0x1.b0037ap-1,
+        0x1.4eb226p+0, 0x1.577038p-4, -0x1.895e76p+0, -0x1.81ffecp+2
+    },
+    {
+        0x1.0f7da2p+1, 0x1.25eed6p+2, 0x1.111d7cp-3, 0x1.c75c58p-3,
+        -0x1.0d6bd2p+0, -0x1.0c6968p+2, 0x1.04dcc4p+2, -0x1.3b7858p+0,
+        0x1.647106p+1, 0x1.44b71ap+3, 0x1.48c11p+2, 0x1.00a698p-2,
+        0x1.52a6a8p+2, -0x1.7dd86cp+0, -0x1.1c5b3ep+4, 0x1.797ddep+1,
+        -0x1.4a5bcap-1, -0x1.0dab3p+1, -0x1.64caf2p-1, 0x1.1fc6c2p+3,
+        0x1.93b03cp+2, 0x1.c750d2p+2, -0x1.1883c4p-2, -0x1.1eb9ap+3,
+        0x1.244d72p+1, 0x1.6e4e6cp+0, 0x1.b6de9ep+0, -0x1.1028a2p-1,
+        0x1.6c659ep+0, 0x1.4e9b56p+0, 0x1.9d2b26p+0, -0x1.ec5a02p+3
+    },
+    {
+        -0x1.5e555cp-1, 0x1.bc9f46p-1, -0x1.a7a406p+2, -0x1.39d114p-2,
+        -0x1.6fd15ap+0, -0x1.d95a3ap+0, 0x1.72ae26p+1, 0x1.2aabd8p+2,
+        0x1.21be8ep+1, 0x1.49d59p+2, 0x1.456abcp+2, -0x1.60b5a4p-2,
+        0x1.20e99ap+2, 0x1.81a586p-1, -0x1.3d2182p+1, 0x1.952796p-3,
+        -0x1.6735e2p+1, 0x1.377faap+0, 0x1.ac2d38p-6, 0x1.8561aap+1,
+        0x1.1218d4p+1, 0x1.be3122p+2, -0x1.1efcbp+1, -0x1.406116p+4,
+        0x1.5ed81cp+3, -0x1.958694p-4, -0x1.5ae6fcp+2, -0x1.14f6b6p+0,
+        0x1.af4608p+0, -0x1.1a6f98p+0, -0x1.a762a4p+2, -0x1.267704p+4
+    },
+    {
+        -0x1.ab00bcp+0, -0x1.7af3p+4, -0x1.1f7ee8p+1, 0x1.b56002p-1,
+        -0x1.ed90cep+0, -0x1.27488ap+0, -0x1.382932p+1, -0x1.bbdcp+0,
+        -0x1.ca534p-5, -0x1.3fde44p+3, 0x1.6ba2cp+2, -0x1.50a49ep-3,
+        0x1.849d3p+2, -0x1.2f7cd6p+0, -0x1.b6a25p+0, -0x1.d595a8p+1,
+        -0x1.5b14bap+4, 0x1.854e48p-1, -0x1.654ad8p-1, 0x1.9354bep+0,
+        -0x1.f45c4cp+0, 0x1.8baa38p+2, 0x1.f0c42p-1, -0x1.dae21p+1,
+        0x1.3783fap+3, 0x1.bfef48p-2, -0x1.440086p+2, -0x1.e6d33ap-2,
+        0x1.8d66dep-1, -0x1.53a7e2p-1, -0x1.0fde26p-1, -0x1.0379dep+3
+    },
+    {
+        -0x1.618f2p+2, 0x1.73a312p+2, -0x1.3fb148p+3, -0x1.a8ae4cp+0,
+        -0x1.6bad82p+0, 0x1.ba5f7ep+1, -0x1.0af808p+1, -0x1.402866p-3,
+        -0x1.0cb962p-1, 0x1.32ea2cp+0, 0x1.c1c302p+1, -0x1.b3f986p-8,
+        0x1.ded6a4p+2, -0x1.350014p+3, 0x1.ec198ap-1, 0x1.a4ba0ep-1,
+        -0x1.361c5cp+0, 0x1.75554ep+2, -0x1.4d0cbap+1, 0x1.5fa7eap+1,
+        -0x1.00817ap+2, 0x1.757938p+2, 0x1.491e06p+1, -0x1.888288p-2,
+        0x1.3feb06p+3, -0x1.4bb506p-1, -0x1.071f6p+2, -0x1.3418cep-2,
+        0x1.6448e4p-2, 0x1.4dd1d2p-4, -0x1.4ea0a6p+1, -0x1.13df44p-1
+    },
+    {
+        -0x1.d77006p+2, -0x1.32a054p+3, -0x1.ff78aep+1, -0x1.34a33ep+1,
+        -0x1.6aafbcp+1, -0x1.14401p+2, -0x1.c4aa9p+1, -0x1.64bbeep-1,
+        -0x1.6f9262p-1, -0x1.215ccap+2, 0x1.103b0ep+2, 0x1.a4a4eep-2,
+        0x1.205e1ep+2, -0x1.742828p+1, -0x1.0b37b6p+0, 0x1.2a4d82p+0,
+        -0x1.e8ca72p+1, 0x1.357186p+1, -0x1.5bd69ap+2, -0x1.87a4c6p+1,
+        -0x1.bd4f5ep+2, 0x1.04933ap+2, 0x1.1860ep+1, 0x1.a868aap+2,
+        -0x1.85b02p+3, -0x1.92f2a2p+0, -0x1.17fad6p-1, 0x1.5f4fcap-3,
+        0x1.788d36p-3, 0x1.3f879ep+1, -0x1.4b69bep+0, 0x1.199bc4p+2
+    },
+    {
+        -0x1.6a272p+1, -0x1.390896p+4, -0x1.4577cp+2, -0x1.93eaf6p+0,
+        -0x1.843c3cp+1, -0x1.164ba8p+4, -0x1.a306p+1, 0x1.18a20ep+1,
+        -0x1.b6d20ap-1, -0x1.08170ap+3, 0x1.12d3fp+3, 0x1.5ccef6p+0,
+        0x1.79a808p+2, -0x1.4ffe7p+0, 0x1.5e517ep+2, -0x1.2201c6p+1,
+        0x1.10c252p+1, 0x1.5e4d1ep+1, -0x1.702508p+2, -0x1.014e28p+2,
+        -0x1.27278ep+3, 0x1.03640ep+2, 0x1.08fb12p+2, 0x1.ccd616p+2,
+        -0x1.05703ap+3, -0x1.1f33bp+1, 0x1.d0f27p+1, 0x1.f56856p-2,
+        -0x1.424768p-1, 0x1.9ecd94p+1, -0x1.10f6d4p+0, 0x1.d9b7a8p+2
+    },
+    {
+        0x1.838fa8p+2, -0x1.12392ep+3, 0x1.7f0016p+3, -0x1.fbbe4cp-1,
+        -0x1.db174ap+0, -0x1.941528p+0, -0x1.003a68p+0, 0x1.924a0ep+1,
+        0x1.23d45ap+1, -0x1.7f969ap+3, 0x1.d8121ap+3, 0x1.ef595ep+0,
+        -0x1.0b1e7p+1, -0x1.bd6378p+1, -0x1.3d2936p+2, 0x1.14ddbcp+1,
+        -0x1.1a8284p+1, -0x1.888e24p+0, 0x1.40f0d4p+2, 0x1.14764cp+3,
+        0x1.3fa322p+0, 0x1.0d3d92p+3, 0x1.896798p-1, -0x1.092df8p+4,
+        0x1.dd99c8p+2, -0x1.06323ap+0, -0x1.e762b8p-2, 0x1.4eefa8p+1,
+        0x1.87749p-2, 0x1.5fb2aep-6, -0x1.730ce6p+0, -0x1.63170ap+3
+    },
+    {
+        0x1.e8d348p+1, 0x1.d0b0f6p+3, -0x1.8e60eep+2, -0x1.dbb5ecp-3,
+        -0x1.d37054p+1, 0x1.6f305ep+2, -0x1.ed5712p+1, 0x1.ef0644p+1,
+        0x1.23e8e6p+0, 0x1.de1c0ep+2, 0x1.55c83cp+3, 0x1.7aa9f6p-2,
+        0x1.72712cp+3, -0x1.7fb13ep+0, -0x1.39dd48p+3, 0x1.b6f5a8p+0,
+        -0x1.61a5a6p+4, -0x1.a3e3b8p+1, 0x1.341fdcp+0, 0x1.b70fbap+3,
+        0x1.7f89c4p+2, 0x1.b3d912p+2, 0x1.5729a8p+2, -0x1.144fe4p+3,
+        0x1.455992p+3, 0x1.3f07e4p+0, -0x1.b3455p+1, -0x1.fa8e2p+1,
+        0x1.ac641cp-1, -0x1.843412p-1, -0x1.b0bd8cp+0, -0x1.231c6ap+4
+    },
+    {
+        0x1.6f06e2p+1, 0x1.bfd7a8p+2, 0x1.ad6392p+0, -0x1.1d03bcp+0,
+        -0x1.cadaaap+1, 0x1.dece2p+2, 0x1.e1caacp-3, 0x1.9928bp+2,
+        0x1.ee8ae2p+1, 0x1.7216d8p+2, 0x1.6b0da2p+2, -0x1.2842f4p-4,
+        0x1.64a7c6p+3, -0x1.5c1132p+2, -0x1.a99f0cp+2, 0x1.7b32fap+2,
+        -0x1.13858ap+1, -0x1.7d6f5p-1, -0x1.8eeb34p-2, 0x1.4e7f9p+3,
+        0x1.098acep+3, 0x1.00c9bep+3, 0x1.595226p+0, -0x1.26fccap+3,
+        0x1.ad9146p+3, 0x1.1f225cp+0, -0x1.bf53b4p+1, -0x1.3e1896p+1,
+        0x1.16d5cp+1, -0x1.29ab52p-3, -0x1.11041cp+2, -0x1.ae8166p+3
+    },
+    {
+        0x1.62636p+1, 0x1.b67ea8p-1, -0x1.9c985ep+2, -0x1.418a9ep+0,
+        -0x1.86da0ep+0, 0x1.42691p+1, -0x1.37dfd6p+1, -0x1.9090f8p+0,
+        0x1.c06bdp+0, -0x1.14c8a6p+4, 0x1.4e75cp+2, -0x1.ca6e46p-3,
+        0x1.0591b4p+3, -0x1.17684p+2, -0x1.1f5662p+4, 0x1.0a5bp+2,
+        -0x1.08a814p+1, -0x1.dcf76cp-1, -0x1.027774p+2, 0x1.97049p+3,
+        0x1.1b6a5ep-1, 0x1.aae782p+2, -0x1.07c436p+0, -0x1.770a1ap+2,
+        0x1.9f1c8ep+3, 0x1.ae4e8ap+0, -0x1.59efb2p+1, -0x1.f5b296p+0,
+        0x1.48684cp+1, -0x1.e133b4p-2, -0x1.4c0848p+3, -0x1.f17786p+3
+    },
+    {
+        -0x1.da8ff2p-1, -0x1.94e574p+4, -0x1.5577e4p+1, -0x1.2a9b02p+1,
+        -0x1.e67c66p+1, -0x1.7a7d52p+0, -0x1.cb012cp+1, -0x1.151ea6p+0,
+        0x1.7c3228p+0, -0x1.2f3adep+4, 0x1.7b83f6p+2, -0x1.dfed52p-3,
+        0x1.45d9ep+3, -0x1.a1daeep+2, -0x1.b6a618p+2, 0x1.262022p+3,
+        -0x1.0d7cb2p+0, 0x1.a49f92p+1, -0x1.f880ecp+0, 0x1.6075dp+0,
+        -0x1.14a77ep+2, 0x1.f8c836p+2, -0x1.a6423cp+3, -0x1.ebdb02p+3,
+        0x1.e8861ap+3, -0x1.698592p+0, -0x1.1b9834p+2, -0x1.68fbap+0,
+        0x1.80858p+0, -0x1.f20dp-1, -0x1.561388p-1, -0x1.49f756p+2
+    },
+    {
+        -0x1.174826p+0, -0x1.6d83c8p+4, -0x1.c995dp+3, -0x1.84f256p+2,
+        -0x1.7b737cp+1, 0x1.538136p-1, -0x1.0939ap+2, -0x1.d10baap+2,
+        0x1.bfe9c8p-1, -0x1.40502p+1, 0x1.a0b44ap+2, 0x1.37b8c4p-3,
+        0x1.ebff08p+2, -0x1.2a3d58p+2, -0x1.c4dd7ap+1, 0x1.0adc8p+2,
+        -0x1.f33b08p+1, 0x1.5ba45p+2, -0x1.2d1f1cp+2, -0x1.babc26p+1,
+        -0x1.038fb8p+2, 0x1.4dc13p+2, -0x1.3304f6p+0, 0x1.197a7ep+3,
+        0x1.69033p+3, -0x1.a6afaap+0, -0x1.0e3ca8p+2, 0x1.2a69a6p-1,
+        0x1.2f96fep+0, -0x1.01bff6p+0, -0x1.2d2b5cp+0, -0x1.de6f96p+3
+    },
+    {
+        -0x1.803508p+2, -0x1.7fc498p+4, 0x1.80405cp-1, -0x1.bed9c2p+1,
+        -0x1.914cp+1, -0x1.70cfap-2, -0x1.3085c8p+2, -0x1.7470a8p+2,
+        0x1.b3dac8p+0, -0x1.3015fp+2, 0x1.725ba8p+2, 0x1.3f69cp-2,
+        -0x1.8a5cb8p+3, -0x1.27ba8p+2, 0x1.9382c2p+1, 0x1.4763f6p+2,
+        -0x1.d52b9p-5, 0x1.aced98p+2, -0x1.254e76p+2, -0x1.c3de0cp+2,
+        -0x1.cda60cp+2, -0x1.2dc04ap-1, 0x1.54091cp+1, 0x1.2b268ap+3,
+        -0x1.533804p+2, -0x1.2a881p+1, -0x1.f54c04p+2, 0x1.13c592p+0,
+        0x1.03681ap-1, 0x1.ac4b36p+3, -0x1.1f5e28p+2, 0x1.186e08p+0
+    },
+    {
+        -0x1.0b0746p+1, -0x1.794a36p+4, -0x1.af2518p+3, -0x1.5aa32ep+0,
+        -0x1.e0505ep+1, 0x1.73c244p+1, -0x1.ec1b08p+1, -0x1.f5ac3cp+0,
+        0x1.320402p-1, -0x1.8b73a4p+2, 0x1.962828p+3, 0x1.2f8e98p+0,
+        -0x1.a94bcap+2, -0x1.0979ap+4, 0x1.00d7fep+2, -0x1.4355fep+2,
+        -0x1.ee951ep+3, 0x1.9813e4p+2, -0x1.42291ep+2, -0x1.268838p+3,
+        -0x1.199962p+3, 0x1.1c7f9p-2, -0x1.26ce9ap+2, 0x1.1bbap+3,
+        -0x1.153314p+1, -0x1.0109dep+1, 0x1.8d786ap-1, 0x1.164a4cp+1,
+        0x1.054f34p-2, 0x1.7d8988p+2, -0x1.48f02cp+0, 0x1.f2bd96p+2
+    },
+    {
+        0x1.83fd92p+2, -0x1.833ea4p+2, 0x1.02abdcp+4, -0x1.272e32p-4,
+        -0x1.4aa34ep-1, 0x1.e4256p+0, -0x1.a09c7ep-3, 0x1.e22a8ep-2,
+        0x1.62c8cap+1, -0x1.0fa824p+3, 0x1.6b9692p+3, 0x1.bb0832p-3,
+        -0x1.bacbd2p+3, -0x1.5bb92cp+0, -0x1.f212c2p+2, 0x1.02e2f4p+1,
+        -0x1.cd3dbp+3, -0x1.91e216p+1, 0x1.5d3d1cp+2, 0x1.4fd3bp+3,
+        -0x1.1873e8p+0, 0x1.fc222ep+2, 0x1.60b7d2p-1, -0x1.0346d8p+3,
+        0x1.6fd672p+3, -0x1.c7d0cap+1, 0x1.26788cp+0, -0x1.520664p-2,
+        0x1.4289aep+1, -0x1.857206p+1, -0x1.726042p+1, -0x1.e80652p+3
+    },
+    {
+        0x1.d6bb6p+1, 0x1.abc562p+2, -0x1.59b7e8p+2, -0x1.98ba86p-3,
+        -0x1.bf1002p+2, 0x1.458332p+2, -0x1.ceb9cap+2, 0x1.5d9a72p+2,
+        0x1.0c2a8ap+2, -0x1.b28fdap+2, 0x1.e4065p+2, 0x1.41d4b8p+1,
+        0x1.8bc91p+3, -0x1.4aba12p+2, -0x1.27f874p+2, 0x1.ccf29ep+0,
+        -0x1.0313eep+1, -0x1.7c0c06p+0, -0x1.44f876p-1, 0x1.73f73p+3,
+        0x1.3d0f2ep+3, 0x1.91e666p+2, 0x1.2a15c2p+2, -0x1.cda412p+3,
+        0x1.6e3504p+3, 0x1.6c373ep+0, 0x1.9ef13ep+0, -0x1.ec310ap+2,
+        -0x1.7cbe32p-1, -0x1.c82acep-1, -0x1.5b076ap+2, -0x1.5f59ccp+3
+    },
+    {
+        0x1.c327e4p+1, 0x1.e36e1p+3, -0x1.144468p+2, -0x1.cba26ep-1,
+        -0x1.71545ap+2, 0x1.ffb01cp+1, -0x1.53fb4p+2, 0x1.a2b95ap+1,
+        0x1.5ee80ep+1, 0x1.898e3ap+2, 0x1.a26c6ap+2, -0x1.0a524ep-2,
+        0x1.37eb62p+3, -0x1.c4917p+3, -0x1.03eed2p+4, 0x1.491632p+3,
+        -0x1.227858p+2, -0x1.85cac2p+0, 0x1.a2e2dap-1, 0x1.65bfbcp+3,
+        0x1.4df626p+2, 0x1.728c7ep+2, -0x1.b2c0fep+1, -0x1.cabe48p+3,
+        0x1.6157acp+3, -0x1.f525bep-1, -0x1.f0e64p+1, -0x1.9cef92p+2,
+        0x1.1513b4p+1, 0x1.87cdap+1, -0x1.0a2d38p+4, -0x1.af1c28p+3
+    },
+    {
+        0x1.8fe7cep+1, 0x1.380a04p+3, -0x1.bdb44ep+1, -0x1.16d006p-1,
+        -0x1.70756cp+2, 0x1.190d6p+1, -0x1.235244p+0, -0x1.f28284p-1,
+        0x1.b81b5cp+1, 0x1.7a6438p+2, 0x1.299286p+2, 0x1.7bfd4ep-3,
+        0x1.474648p+3, -0x1.043a2cp+4, -0x1.944796p+0, 0x1.b3bf68p+3,
+        -0x1.0642bap+2, 0x1.2ffb9ep+0, 0x1.416182p-5, 0x1.7bb28ep+2,
+        0x1.6e5a28p+2, 0x1.e7a1bcp+2, -0x1.ae86acp+3, -0x1.ec8ab2p+3,
+        0x1.a12398p+3, -0x1.565456p-2, 0x1.f8e314p-2, -0x1.e3823cp+1,
+        0x1.fd6b92p+1, 0x1.935706p-1, -0x1.1b5558p+4, -0x1.701c82p+3
+    },
+    {
+        0x1.fbc6e6p+0, -0x1.983098p+4, -0x1.bca0b4p+0, -0x1.2d62f6p+2,
+        -0x1.324a44p+2, -0x1.15e28cp+1, -0x1.b9436cp+0, -0x1.0896acp+3,
+        0x1.14c538p+1, -0x1.865708p+3, 0x1.119d6p+2, 0x1.c869e8p-3,
+        0x1.6b5ad2p+3, -0x1.4331b2p+2, -0x1.e89efap+2, 0x1.05e9cep+4,
+        -0x1.a795e8p+3, 0x1.3011b8p+2, -0x1.0a725ap+0, 0x1.be78a6p+3,
+        -0x1.6426a8p+2, -0x1.025e46p+3, -0x1.1b3952p+3, -0x1.45fae8p+4,
+        0x1.b20448p+3, -0x1.28eebap+0, 0x1.989a46p-1, 0x1.1fb968p-2,
+        0x1.08929cp+2, 0x1.14ffep-3, -0x1.4db49cp+2, -0x1.2ebc68p+3
+    },
+    {
+        -0x1.57c648p+0, -0x1.a5e07ap+4, -0x1.f41a9cp-2, -0x1.f4a99p+1,
+        -0x1.ad5536p+1, 0x1.07bacp-1, -0x1.aacd64p+1, -0x1.d8406cp+2,
+        0x1.bb02f2p-1, -0x1.c36c9ap+2, 0x1.cd1b4p+2, 0x1.9fc85cp-3,
+        0x1.a6b60ep+3, -0x1.23c736p+4, 0x1.a6019ep+2, 0x1.5efc3cp+3,
+        -0x1.f237a4p+3, 0x1.7fbff6p+2, -0x1.365b6cp+2, -0x1.7b1e5ap+3,
+        -0x1.e4500ep+1, 0x1.7ddc5p+2, -0x1.0473e8p+4, 0x1.6bed24p+1,
+        0x1.6e84ccp+2, -0x1.76df4cp+1, 0x1.7e8a74p+1, 0x1.d17852p-1,
+        0x1.ebdabcp+1, 0x1.56325cp+2, -0x1.6510ecp+0, 0x1.258716p+3
+    },
+    {
+        -0x1.245fd2p+1, -0x1.61420cp+4, -0x1.f328dap+2, -0x1.7ce2e6p+1,
+        -0x1.c4a4cep+0, 0x1.c5c49ap+0, -0x1.0abp+2, -0x1.561308p+2,
+        0x1.792bd8p+1, -0x1.382f62p+2, 0x1.61c748p+1, 0x1.7ec77ep+0,
+        0x1.981598p+2, -0x1.123f7p+4, -0x1.dbad9ep+2, 0x1.3d81a8p+2,
+        -0x1.f90402p+3, 0x1.41d42cp+2, -0x1.9bd0ap+3, -0x1.550636p+4,
+        -0x1.f2ea46p+2, -0x1.b77db2p+2, -0x1.09dc6cp+3, 0x1.4ab69p+3,
+        -0x1.0cadb4p+3, -0x1.6569dep+1, 0x1.90b64cp-1, 0x1.d765fap+0,
+        0x1.3fe05ap+0, 0x1.82b7e8p+3, -0x1.2887eep+2, -0x1.6efe46p+3
+    },
+    {
+        0x1.2f9acep-1, -0x1.0eba2ep+4, -0x1.9d4ee8p+2, -0x1.271a4ap+2,
+        -0x1.42bce6p+1, 0x1.2d1fdap+2, -0x1.0e102cp+2, -0x1.256df4p-1,
+        0x1.05042p+2, -0x1.c579aap+1, 0x1.0155bep+3, 0x1.379042p+2,
+        -0x1.4806c2p+3, -0x1.5cddap+1, 0x1.00ddcp+3, -0x1.11b2d2p+3,
+        0x1.861bc4p+3, 0x1.dda55ap+3, -0x1.a887bp+2, -0x1.0c29a8p+4,
+        -0x1.2b864cp+3, 0x1.a2a782p+0, -0x1.e4c062p+2, 0x1.cd6a06p+2,
+        -0x1.82fb8cp+2, -0x1.1dd8aap+3, 0x1.1d2eacp+3, -0x1.5c441ep+2,
+        -0x1.5c6cc8p-2, -0x1.56a34ep-1, -0x1.208922p+1, 0x1.6893bep+3
+    },
+    {
+        0x1.0317bcp+2, -0x1.5e0c08p+3, 0x1.6e8006p+4, -0x1.66c634p+1,
+        0x1.52d5eap+2, 0x1.d4aaecp+1, 0x1.b4a60ep+0, 0x1.20ad34p+3,
+        -0x1.2bbd22p+3, 0x1.dd00a2p+3, 0x1.17d87cp+4, 0x1.819bbap-5,
+        -0x1.07681p+4, -0x1.adec38p-3, -0x1.2262d6p+4, 0x1.b44b3ap+2,
+        0x1.14d94ep+1, 0x1.e27264p-1, 0x1.0512d8p-1, -0x1.f411dp-2,
+        -0x1.8b31f6p+2, -0x1.38651ep+3, -0x1.2f8478p+3, -0x1.eb8d8p+2,
+        0x1.196f56p+3, -0x1.c47282p-1, 0x1.5a49d4p+1, 0x1.139e48p+2,
+        -0x1.1192a2p+1, 0x1.330762p+3, -0x1.70dd66p+3, -0x1.131b48p+3
+    },
+    {
+        0x1.125a16p+1, 0x1.4bed3cp-1, 0x1.5306a2p+4, 0x1.5124dp-1,
+        -0x1.cf9d82p-3, -0x1.84517ap-1, -0x1.17ce1p+3, 0x1.a9fa0ap+1,
+        0x1.1a1b2cp+0, -0x1.25df28p+4, 0x1.0886b6p+3, -0x1.a3be3p-4,
+        0x1.ef9ce8p+2, -0x1.a9f0cp+1, -0x1.73e4d2p+3, 0x1.6ea92p+3,
+        -0x1.2ef296p+3, 0x1.0e5d9p+2, 0x1.4f0d4ap-1, 0x1.104cecp+0,
+        -0x1.3b84c8p+2, 0x1.6d27bap+3, -0x1.051992p+3, -0x1.ef8aa8p+2,
+        0x1.4c6348p+0, -0x1.bb363cp+0, 0x1.321ec2p+1, -0x1.a4faf2p+3,
+        0x1.37c174p+0, -0x1.ce88b4p-1, -0x1.1a406ap+2, -0x1.725516p+3
+    },
+    {
+        0x1.79cca8p+0, -0x1.5b96f2p+1, 0x1.8b5356p+4, -0x1.3701cap+1,
+        -0x1.0f87d2p+4, 0x1.fa94bap+0, -0x1.fa1478p+2, 0x1.5bb008p+1,
+        0x1.f946a4p-1, -0x1.d6322ap+3, 0x1.318a56p+3, -0x1.4e0a3ep-2,
+        0x1.ce76f2p+3, -0x1.20c50ap+2, -0x1.0753c8p+1, 0x1.35281cp+3,
+        -0x1.dcceeap+2, 0x1.4f84p+2, -0x1.4644c6p+1, 0x1.0fd7eap+2,
+        0x1.9f67d2p+1, 0x1.535e6ep+2, -0x1.8bf816p+3, -0x1.65c18ep+2,
+        0x1.94a82ap+3, -0x1.974ba8p-4, 0x1.1a8e1p+2, -0x1.5d07a4p+3,
+        0x1.5d3c1ep+0, -0x1.0a66eep+0, -0x1.8763ep+2, -0x1.022ea6p+3
+    },
+    {
+        0x1.5c5398p+1, -0x1.bbef3p+1, -0x1.9d377ep+0, 0x1.235b5ep-10,
+        -0x1.f552b8p-3, 0x1.8f64e4p+1, -0x1.74f3ecp+1, -0x1.7165d4p+3,
+        0x1.58b518p+1, -0x1.126de6p+1, 0x1.49dd7p+2, -0x1.5fa3b2p-1,
+        -0x1.754ddcp+3, 0x1.0dd49p-2, -0x1.ec729ep+2, 0x1.d45634p+4,
+        0x1.3606cap-3, 0x1.fc6b52p+2, 0x1.6038d4p+0, 0x1.6aba08p+2,
+        -0x1.c31e38p+2, 0x1.1b271ap+2, -0x1.71a696p+3, -0x1.66da98p+2,
+        -0x1.56ff1cp+1, 0x1.dabca2p-2, 0x1.260232p+0, -0x1.2b9628p+3,
+        0x1.941e62p+0, -0x1.494accp-1, -0x1.58f2c8p+1, -0x1.fd3628p+2
+    },
+    {
+        0x1.6440dep+0, 0x1.d4cd78p+3, 0x1.b9be5p+2, -0x1.8fedep+2,
+        -0x1.16f0cp+3, 0x1.794c42p-3, -0x1.944956p+1, 0x1.050de4p+2,
+        0x1.1cd16ap+2, 0x1.1512a4p+3, 0x1.1aafa2p+1, 0x1.f2130cp-4,
+        0x1.2e60cap+4, -0x1.80d7aep-2, -0x1.dec7fp+0, 0x1.166616p+4,
+        -0x1.e11316p+3, 0x1.eb8998p+2, -0x1.2ef262p+1, 0x1.042d04p+3,
+        0x1.222684p+2, -0x1.32cf4p+2, -0x1.f12af6p+3, -0x1.fcf1ecp+3,
+        0x1.846e66p+1, -0x1.b0f0cep+0, 0x1.5d9292p+3, -0x1.c9f29ep+0,
+        0x1.c728f2p-1, 0x1.00411p+0, -0x1.8ecfcap+0, -0x1.2f033cp+1
+    },
+    {
+        0x1.34cae6p-3, -0x1.f126fep+3, -0x1.55f15ep+3, -0x1.4f01bcp-2,
+        -0x1.dee8f6p+1, -0x1.285434p+2, -0x1.92bd24p+1, -0x1.6f3faep+3,
+        0x1.3d85a4p+2, -0x1.4c8d5cp+2, 0x1.5e19d2p+2, 0x1.b70f9ap-1,
+        -0x1.10ab7cp+4, -0x1.1900dp+3, -0x1.069cf4p-4, 0x1.355efep+4,
+        -0x1.00dd86p+4, 0x1.54f142p+2, -0x1.21694ep+3, -0x1.461462p+4,
+        0x1.873482p+1, 0x1.95aa32p+3, -0x1.74c478p+1, 0x1.97f602p+3,
+        0x1.4f469ap+2, -0x1.6c5362p+1, 0x1.32094ap+3, -0x1.94de8cp-2,
+        0x1.82576ep-3, 0x1.0e4404p+0, -0x1.36e4e8p-1, 0x1.0dbd9ap+2
+    },
+    {
+        -0x1.b0f21ap+2, -0x1.2d11aap+2, 0x1.e19adep+2, -0x1.97aa9cp+0,
+        -0x1.d73db2p+1, 0x1.89b828p+2, -0x1.d309aap+1, -0x1.32ccccp+1,
+        0x1.36adf2p+2, -0x1.6798f2p+2, 0x1.d89552p+2, 0x1.30b274p+2,
+        0x1.c78c4p-6, -0x1.18208ap+3, -0x1.7fe2a4p+1, 0x1.2aabd8p+2,
+        -0x1.bec884p+3, 0x1.446ef8p+3, -0x1.a73504p+3, -0x1.fffdc8p+1,
+        -0x1.685466p+1, 0x1.d0922ep+3, -0x1.d963ep+1, 0x1.c7dfa6p+2,
+        0x1.71de1p+1, -0x1.2b4832p+2, 0x1.2e376p+3, -0x1.2899c6p+2,
+        -0x1.2229fep-2, 0x1.38a9d4p+0, -0x1.5d308ap-1, 0x1.ad0972p+3
+    },
+    {
+        -0x1.d80768p+0, 0x1.fe880ap-2, -0x1.d29df8p+3, -0x1.66b26ap+2,
+        -0x1.c5da1ap-2, 0x1.40434p+2, -0x1.12de84p+2, -0x1.6d15f4p+1,
+        -0x1.6f5036p+2, -0x1.e2c8d8p+1, 0x1.1d3ca2p+3, -0x1.0b803ep+1,
+        -0x1.375f96p+0, -0x1.f35adp+1, 0x1.8eeab2p+0, -0x1.133f0ep+3,
+        0x1.97cc4p+1, -0x1.82e12cp+3, -0x1.49b9f4p+2, -0x1.2be8d8p+3,
+        -0x1.ae3e48p+3, -0x1.4549ep+2, -0x1.078b4p+2, 0x1.90e02cp+3,
+        -0x1.664544p+2, -0x1.30bcacp+2, 0x1.99fa72p+1, -0x1.3f398p+2,
+        -0x1.06de4p+0, 0x1.2dc998p+3, -0x1.acef2cp+0, -0x1.34d6fap+2
+    },
+    {
+        -0x1.db901cp+0, -0x1.42119ap+3, 0x1.cd41bp+1, 0x1.82f244p-1,
+        0x1.b84b3ep+2, -0x1.56841ep+0, -0x1.91038ep+1, 0x1.baca2cp+0,
+        -0x1.6eb8f6p+1, 0x1.08950ep+0, -0x1.fec41ep-3, -0x1.e521ecp+0,
+        0x1.4f2f6cp+1, 0x1.6fa18ap-1, -0x1.7e174ep-3, 0x1.7098c8p-1,
+        -0x1.d0f83p+2, -0x1.03ff3ap+2, 0x1.e6c55ep+1, 0x1.abb292p-1,
+        0x1.82d80ep+2, 0x1.01d82ep+0, -0x1.57e55ap+2, -0x1.67370ap+3,
+        0x1.06921p+2, -0x1.0c8a7p+2, 0x1.e588dcp+0, -0x1.eed4dep-2,
+        -0x1.c4d4f6p+0, 0x1.24e16ep+0, -0x1.e52488p+2, -0x1.5206e6p+2
+    },
+    {
+        -0x1.733a4ep+1, -0x1.3e5498p+2, -0x1.980762p+2, 0x1.2a38dp+1,
+        0x1.c3843p+2, -0x1.8aac06p-1, -0x1.283dfcp+2, -0x1.f58b1cp-1,
+        -0x1.cc6864p-2, 0x1.4fd3f2p+2, -0x1.1476bcp+0, 0x1.d48ae2p-1,
+        0x1.5d2af2p+0, 0x1.6d5e3ap-1, -0x1.9fa196p+0, 0x1.551p-3,
+        -0x1.b176cep+2, -0x1.eda96ep+0, 0x1.36a516p+2, -0x1.aff67cp+1,
+        0x1.62ef8p+2, 0x1.b3654ap-2, -0x1.9575f2p+1, -0x1.7f602ap+0,
+        0x1.edd31p+1, -0x1.9b6ec4p+0, 0x1.01fb8ep+2, -0x1.20ef56p-1,
+        -0x1.c14d2p+1, -0x1.3731c2p+2, 0x1.fae1b8p+0, -0x1.2a6ff4p+2
+    },
+    {
+        -0x1.9abf2ep-2, -0x1.1fbaecp+3, -0x1.b1c338p+2, -0x1.c11eep-2,
+        0x1.d1369ap+2, 0x1.101316p+1, -0x1.430342p+2, 0x1.ff4178p-1,
+        -0x1.32fa6p-1, 0x1.c0b32cp+0, -0x1.4fc064p+1, 0x1.9ac458p-3,
+        0x1.a7e532p+2, -0x1.c5a7fp-1, -0x1.1fa08p+1, 0x1.e79218p-2,
+        -0x1.3801dcp+1, -0x1.196b6p+4, 0x1.2f362cp+2, 0x1.33350ap+2,
+        -0x1.5e218ep+0, -0x1.cac1ecp+0, -0x1.2509b4p+3, -0x1.a98598p+0,
+        0x1.ab9602p+2, -0x1.24d13cp+1, 0x1.b73fc4p+1, 0x1.2b37b2p-2,
+        -0x1.31e08p+1, 0x1.5c4b16p+0, -0x1.daa3bcp+0, 0x1.8b56cp-4
+    },
+    {
+        0x1.0ca002p-1, -0x1.5b194ep-2, -0x1.0a0256p+1, -0x1.e5c67cp-6,
+        0x1.cca86ap+2, -0x1.382f26p-8, -0x1.ff8f9ap+1, -0x1.8f8926p-2,
+        -0x1.2cb9fp-2, 0x1.76108p+2, -0x1.9b4ef2p+4, 0x1.5f4842p-2,
+        0x1.5da6e8p+2, -0x1.990738p+2, -0x1.5b80cep+3, 0x1.01063p-2,
+        -0x1.05598cp+2, -0x1.a1b65cp-1, 0x1.4e9a4ep+1, -0x1.7a4bfcp-3,
+        -0x1.143c4cp+0, -0x1.ed45dep+4, -0x1.723662p+1, 0x1.95b722p-3,
+        0x1.7b4ee8p+2, -0x1.179c5ap+1, 0x1.8844fap+1, 0x1.9e16dp+0,
+        -0x1.37b574p+1, 0x1.9a65b2p-2, 0x1.780b78p+1, 0x1.8369f4p+0
+    },
+    {
+        0x1.1370c2p+0, -0x1.61b64ap+0, 0x1.4dee06p+0, 0x1.ddfa96p+1,
+        0x1.06fb44p+2, -0x1.3dc852p-1, -0x1.4cb29ap+0, -0x1.cf2042p+4,
+        -0x1.4e7b2p-3, 0x1.ab71e8p+2, -0x1.41002ep+4, 0x1.1bdf74p-2,
+        0x1.052d2cp-1, -0x1.394a5p+0, -0x1.f15bacp+2, 0x1.e4a802p+0,
+        -0x1.14e0f8p+2, 0x1.4dc6d8p+0, 0x1.15cf2ep+0, -0x1.514816p+1,
+        -0x1.77619ap+1, 0x1.c4cda6p-1, -0x1.e98bdcp+1, 0x1.933f78p-3,
+        0x1.588418p+1, -0x1.6a4cbap+1, 0x1.4be64p+2, 0x1.698fc6p+1,
+        -0x1.1bb5c6p+1, 0x1.509d24p+1, -0x1.8b7ee8p-1, 0x1.595564p-1
+    },
+    {
+        0x1.1d91acp+0, -0x1.31bc36p+1, 0x1.52353cp+1, 0x1.8b571ap-3,
+        0x1.e7ae72p+0, 0x1.1236fcp+1, -0x1.b1d342p-3, -0x1.fb8414p+3,
+        -0x1.dfce3p+1, 0x1.0fe05ep-2, -0x1.bff3fp+4, 0x1.aa1dd8p-2,
+        0x1.2e831ep-1, -0x1.d62bd8p-1, -0x1.5b03d6p+1, 0x1.fea22cp-2,
+        0x1.6a6a18p+1, 0x1.d43f1cp+1, -0x1.673568p+0, -0x1.98a73ap+2,
+        -0x1.96964ap+1, 0x1.286edcp+1, -0x1.7fdb1ap+2, -0x1.899deap+1,
+        0x1.81b32cp+1, -0x1.a26592p+0, 0x1.34cb14p+2, -0x1.0c459ep+2,
+        -0x1.00aaf8p+2, 0x1.1342bap-1, -0x1.5c20acp+3, -0x1.441db4p+0
+    },
+    {
+        0x1.ec0796p+0, -0x1.f575ccp+1, 0x1.e465ecp+0, 0x1.7caa82p+1,
+        -0x1.621082p+0, 0x1.f6f7bp+2, -0x1.0b45c6p-2, -0x1.45cefcp+0,
+        -0x1.4db964p+1, -0x1.ab9474p+1, -0x1.ab466p+3, 0x1.63fe34p-3,
+        0x1.5d552cp+1, 0x1.414f8p+1, -0x1.3128ccp+0, 0x1.0ef3c8p+1,
+        0x1.2cbbfp+1, 0x1.b29cccp+2, -0x1.d76936p+1, -0x1.4c9cbap+2,
+        -0x1.cb590ep+1, 0x1.74b654p-2, -0x1.78da0cp+3, -0x1.8cb3c6p+2,
+        0x1.a5cf64p+0, -0x1.106c72p+0, 0x1.2289fp+1, -0x1.576fb6p+1,
+        -0x1.a325d2p+1, 0x1.136fb2p+3, -0x1.3ac2b2p+4, -0x1.10ae6ap+2
+    },
+    {
+        0x1.4d3cf2p+1, -0x1.7cac24p+1, -0x1.a9b8ccp+1, 0x1.1e34b2p+1,
+        0x1.0ece3ap+2, 0x1.7cfdbap+0, 0x1.e14064p-1, -0x1.e21d8cp-1,
+        -0x1.15dfd6p+1, 0x1.015f0ep+2, -0x1.503e0ep+2, 0x1.c7339ep-1,
+        0x1.64044p-2, 0x1.684d92p-1, -0x1.a4b40cp+1, -0x1.560064p-1,
+        0x1.21f62ap+1, 0x1.810edcp+2, -0x1.061304p+1, -0x1.5040fcp+3,
+        -0x1.d261aap+0, -0x1.7f6086p+4, -0x1.95c134p+2, -0x1.b04524p-1,
+        0x1.0636eap+2, 0x1.4ee166p+0, -0x1.ba09f4p+1, -0x1.add4c2p+1,
+        -0x1.c00a22p+1, -0x1.3b6116p+1, 0x1.51e684p+0, -0x1.1a9708p-1
+    },
+    {
+        0x1.4f1aaep+0, 0x1.0f5976p-3, -0x1.c95548p+1, -0x1.fd8d9ap-4,
+        0x1.7e3f82p+1, -0x1.acde0ep-1, -0x1.6232aap+1, -0x1.b94edep-2,
+        -0x1.ecb35cp+0, 0x1.216a4p+2, 0x1.50a038p+1, 0x1.4341d6p+0,
+        0x1.6f3b78p+0, 0x1.0f728cp-2, -0x1.3dbab4p+1, 0x1.ddb938p-1,
+        0x1.15bcd4p-1, 0x1.7df35cp-2, 0x1.a7522p+1, -0x1.7c895p-1,
+        0x1.78c2e6p-1, 0x1.5b1aaap+0, 0x1.7fef9ep-2, -0x1.3bd65p-1,
+        0x1.7a727cp+1, -0x1.c8e622p+1, 0x1.ddc41ap+0, -0x1.6ed4ccp+0,
+        -0x1.dca60ep+0, -0x1.51ebd8p-1, -0x1.ac4936p+0, -0x1.aa3a4p-3
+    },
+    {
+        0x1.f069bep-1, -0x1.77e5b8p+1, -0x1.57eadcp+2, 0x1.411c8ep-1,
+        0x1.c9ab5ep+1, -0x1.02a572p+0, -0x1.1489ap+2, 0x1.3994dp+0,
+        0x1.ec61ccp-1, 0x1.9e6bbap-1, 0x1.3ccedcp+0, 0x1.7e5eb8p+0,
+        0x1.98312cp-1, 0x1.e511e2p-5, -0x1.2467dep-1, 0x1.1a67b4p+0,
+        -0x1.68225cp+0, 0x1.4642d8p-1, 0x1.fc4ceap+1, 0x1.f666b8p-4,
+        0x1.03f65ep+1, -0x1.457ef6p+1, -0x1.a0f0e2p+0, -0x1.f6053ap+0,
+        0x1.72faaep+1, -0x1.b37b48p-1, 0x1.e5126ap-4, -0x1.1d845ep-3,
+        -0x1.7aac8p+1, -0x1.6d5e5cp+0, 0x1.c51b0cp-1, -0x1.3e71b2p+1
+    },
+    {
+        0x1.c2e9ap+0, -0x1.daa17cp+1, 0x1.5ef076p-3, 0x1.a5466ep-2,
+        0x1.64b114p+1, 0x1.58f76cp-2, -0x1.35a2b8p+2, -0x1.6f663p-2,
+        0x1.38298p-2, -0x1.6ddaaap+0, 0x1.28a472p-4, 0x1.e34306p-1,
+        0x1.fadd14p+0, 0x1.e704a4p-3, -0x1.a4084ep+0, 0x1.36f76ep-1,
+        -0x1.4912e4p+1, -0x1.b0e9bp+1, 0x1.913192p+1, 0x1.7c26a6p-1,
+        -0x1.052028p-1, -0x1.8bb2c6p+0, -0x1.d5bebep+0, -0x1.0a5dccp+0,
+        0x1.bd90dp+1, -0x1.37cc88p+0, 0x1.2e7e48p+0, 0x1.24fa3cp-1,
+        -0x1.d05212p+0, -0x1.fffbd8p-1, -0x1.885866p-1, -0x1.421a9ap+0
+    },
+    {
+        0x1.7bd1dp-1, -0x1.6dec58p+1, 0x1.639d1ap+0, 0x1.3ad58ap-4,
+        0x1.42e1d4p+1, 0x1.a8ff46p-1, -0x1.0b0d46p+2, 0x1.3c1c94p+0,
+        -0x1.d5481ep-2, -0x1.d3a55ep+0, -0x1.57e3b4p+4, 0x1.9df628p-1,
+        0x1.cc6878p+0, -0x1.cde9bp-4, -0x1.45b4a4p+1, 0x1.3027b6p-3,
+        -0x1.619b04p+2, -0x1.9b4152p-5, 0x1.87034p+0, 0x1.355b3cp+1,
+        -0x1.818d8cp-5, -0x1.80ab3p-2, -0x1.e15086p+1, -0x1.c7a76ep-2,
+        0x1.d8b4d2p+1, -0x1.fab7ccp+0, 0x1.ab74dp-1, 0x1.9a3588p-3,
+        -0x1.f2521cp+0, -0x1.b9306ap+0, -0x1.4d144ep+1, 0x1.0a9ba4p-1
+    },
+    {
+        0x1.97fc18p+0, -0x1.44d1ecp+1, -0x1.64f83ap+0, 0x1.4acf26p+2,
+        0x1.d07704p+0, -0x1.82fffcp+2, -0x1.35423p+1, -0x1.463034p+1,
+        0x1.d897d6p-4, -0x1.c10b32p+0, -0x1.f70744p+4, 0x1.a4e8ap-1,
+        0x1.f17256p-1, -0x1.faec4ap-2, -0x1.653d06p+1, -0x1.eb114ep-2,
+        -0x1.2742dap+1, 0x1.31cb5cp-1, -0x1.2070a4p+0, 0x1.dc9fa2p+0,
+        -0x1.1336cap+0, -0x1.9e9d4p-1, -0x1.1f2a8ep+2, 0x1.8673aep-1,
+        0x1.891f9ep+0, 0x1.750ec8p-4, 0x1.30162ep-1, -0x1.a97946p-2,
+        -0x1.12fe94p+1, -0x1.f03eaap-1, 0x1.7396fcp-2, 0x1.e93bd2p-6
+    },
+    {
+        0x1.56db52p-1, -0x1.ae520ep+1, -0x1.00df02p-2, 0x1.47c83p+1,
+        -0x1.54658cp-1, 0x1.20ec72p+0, -0x1.c18c2ap-1, 0x1.899f56p-1,
+        0x1.ad780cp-4, -0x1.01dc76p+0, -0x1.272cb2p+4, 0x1.4443cap+0,
+        0x1.5bb6ecp+0, 0x1.d859f6p-2, -0x1.ae9174p+0, -0x1.6b8dc2p-1,
+        -0x1.bebea6p-3, 0x1.ef123p+1, -0x1.1747dep+1, -0x1.fe32bcp-2,
+        -0x1.57a506p+0, 0x1.35b106p+1, -0x1.56555cp+4, 0x1.ca9ebep-1,
+        0x1.057536p-2, -0x1.397504p+1, 0x1.29cf4p+1, -0x1.7ab0bap-1,
+        -0x1.51100ep+1, 0x1.52ff0cp+0, 0x1.1cdd6ep-1, 0x1.1f7f68p+0
+    },
+    {
+        0x1.29a418p-1, -0x1.be625ep+3, -0x1.ff068ep-1, 0x1.a645f8p-2,
+        0x1.b6651ap-1, -0x1.1c406ep+0, -0x1.578392p+0, -0x1.b21582p+0,
+        -0x1.20e68ap+0, -0x1.8c5b1ap+0, 0x1.c53c76p-1, 0x1.948348p-1,
+        0x1.30ca68p+1, 0x1.93a78ap-1, 0x1.93acc4p-1, 0x1.02aa54p-2,
+        0x1.31b578p+0, -0x1.948018p-2, -0x1.cac0cap+1, -0x1.48784cp+0,
+        -0x1.56b922p+1, -0x1.b72af4p-1, -0x1.52faf2p+2, 0x1.5f646p-4,
+        -0x1.4cc4cp-1, -0x1.3baf5cp+0, 0x1.f0aafap-1, -0x1.b12f8cp+1,
+        -0x1.6b7f5cp+1, -0x1.80bc94p+0, -0x1.4e36a4p+4, -0x1.02efdcp+0
+    },
+    {
+        0x1.1baae6p+0, -0x1.2e6ffep+0, -0x1.2e9d0ep+1, -0x1.133abep-6,
+        -0x1.811bc2p-4, -0x1.5ec99ep+1, -0x1.760534p-1, -0x1.24f59cp-1,
+        -0x1.343412p-1, 0x1.28ee1ep+2, 0x1.7df1eap+0, 0x1.6f83ecp+0,
+        0x1.c2166ep-2, -0x1.521a9p-1, 0x1.10141cp-2, 0x1.9fa904p+0,
+        0x1.f5fd84p-3, 0x1.7ce03ep+1, -0x1.a2bbcap-2, 0x1.1ee96cp-3,
+        -0x1.60c2cp+0, -0x1.4bb27ep-1, -0x1.8e1084p+0, -0x1.609eb6p+0,
+        0x1.4a2764p+0, -0x1.3dca8cp-1, -0x1.139342p+0, -0x1.bf6a68p-1,
+        -0x1.4d1efp+1, 0x1.3b2fb4p-2, -0x1.cccdaep-1, -0x1.a975cep+0
+    },
+    {
+        0x1.490b7ap+1, -0x1.26e66ap-2, -0x1.2d2c4cp+2, 0x1.ba2616p-3,
+        0x1.45ff8ep+1, -0x1.4d3b0ep-2, -0x1.95b0eep+1, -0x1.3eb2d2p+0,
+        0x1.7511bp-2, -0x1.df90e8p+0, 0x1.2b996ep+0, 0x1.16a5a2p+1,
+        0x1.c4ff14p-2, -0x1.a1b9aap-3, -0x1.ba7808p+0, 0x1.3ad1ecp-2,
+        -0x1.56636ap-1, -0x1.91ff42p-4, 0x1.7455e6p+1, 0x1.ce498p-3,
+        0x1.a68ab6p+0, 0x1.cb1c96p-2, 0x1.24a168p-2, -0x1.1f764cp-3,
+        0x1.cdc0c6p+0, -0x1.492bdcp+2, 0x1.4b292ap+1, -0x1.e8d08ap-1,
+        -0x1.ceee9p+0, -0x1.03a838p-1, -0x1.804376p-3, 0x1.af18d4p-4
+    },
+    {
+        0x1.127c2ap+1, -0x1.9acf82p-1, 0x1.8e3a8p+1, -0x1.973e18p-4,
+        0x1.aa189ap+1, -0x1.359f0cp-1, -0x1.6ce0c8p+1, -0x1.1fae98p-1,
+        0x1.e98544p+0, -0x1.9bb7eap+0, 0x1.94a578p+0, 0x1.1b9a3cp+1,
+        0x1.ae554p-2, 0x1.4ae66ap-2, -0x1.f3c8c2p-2, 0x1.020f34p-2,
+        0x1.6019bep-2, 0x1.0eeca6p-1, 0x1.c2a744p-1, 0x1.1a3db4p-1,
+        0x1.3a37fp+1, -0x1.5a95eep+1, -0x1.372162p-4, -0x1.38fffp+0,
+        0x1.bbfffep+0, -0x1.20073ep-1, 0x1.54a956p-2, -0x1.1660a4p-2,
+        -0x1.39fd64p+1, -0x1.19b0dap-1, -0x1.1e5a9ep-1, -0x1.b228cap+0
+    },
+    {
+        0x1.7c3f9ep+1, -0x1.162364p+1, 0x1.4caa82p+0, 0x1.217834p-2,
+        0x1.90398cp+1, -0x1.4e8624p+0, -0x1.f6157ep+0, -0x1.4632d8p-1,
+        0x1.b31b5p+0, 0x1.5a4a86p-3, 0x1.ed9ff8p-1, 0x1.fa2b18p+0,
+        0x1.e055e8p-1, 0x1.11a9cep-1, -0x1.50a668p+0, 0x1.842052p-1,
+        -0x1.446b08p-1, -0x1.249dfcp+2, 0x1.1b9704p+0, 0x1.46575p-2,
+        0x1.953664p-1, -0x1.33b8bcp-1, -0x1.4d189p+0, -0x1.6f293cp-1,
+        0x1.b99238p-1, -0x1.838f4ap+1, 0x1.860686p+1, 0x1.24ffa8p+0,
+        -0x1.c807fep+0, -0x1.239064p-1, -0x1.014a32p+0, -0x1.6a8a38p-2
+    },
+    {
+        0x1.73214ap+1, -0x1.b3e326p-1, 0x1.cf13eep-4, 0x1.8e22c8p+1,
+        0x1.72b058p+1, 0x1.e802aap-3, -0x1.ed76cep+0, -0x1.91a898p+0,
+        0x1.e0a254p+0, -0x1.b13dd6p+0, 0x1.17a3c6p+0, 0x1.2dd82cp+1,
+        -0x1.86cbfep-1, -0x1.a73dap-1, -0x1.0159e6p+1, -0x1.cf0746p-1,
+        -0x1.ba4fbcp-5, 0x1.7d716ap+0, 0x1.3f52ecp-2, 0x1.495e2cp-2,
+        0x1.d9a0f4p-1, 0x1.9d847cp-3, -0x1.928b06p+0, -0x1.c3c91cp-2,
+        0x1.175b4p+0, -0x1.ca91aep-1, 0x1.12058cp+1, 0x1.da954ep-2,
+        -0x1.596736p+1, -0x1.5ec94ep-1, 0x1.b2e3dp-1, -0x1.30a036p-1
+    },
+    {
+        0x1.1a7234p+1, -0x1.320cdcp+0, -0x1.2c1b28p+0, 0x1.78f7cap+1,
+        0x1.12443ep-4, -0x1.5efffap+0, -0x1.98bca4p-1, -0x1.1d24c4p-1,
+        0x1.50dd62p+0, -0x1.c4b4ep+1, -0x1.bb63ccp-1, 0x1.23727p+1,
+        -0x1.004c8ap-1, 0x1.9755b2p+0, -0x1.9b7f6p+0, -0x1.999ca2p+1,
+        -0x1.667436p-1, 0x1.3819f4p-1, -0x1.0f9f22p+1, 0x1.c8ed5p+0,
+        -0x1.2d07d4p-1, -0x1.6ddd36p+0, -0x1.9a531cp+0, 0x1.4d5d9p-1,
+        0x1.5ef4bep-2, -0x1.e67bccp-1, 0x1.dda3dap+1, 0x1.7e49ccp-3,
+        -0x1.23e22p+1, -0x1.a16056p+0, 0x1.4543c2p-4, 0x1.efa092p-1
+    },
+    {
+        0x1.e48af8p-1, -0x1.d3f3a8p-5, 0x1.8fb572p-2, 0x1.ae8252p+0,
+        -0x1.be457ap+0, 0x1.c9d37cp+1, -0x1.45ea3p-1, 0x1.3efa72p-5,
+        0x1.6c996p-1, -0x1.852586p+0, -0x1.064a3ap-3, 0x1.1764a8p+1,
+        0x1.6be16cp+0, 0x1.c65382p-2, -0x1.006ddap+1, -0x1.4a1b94p-1,
+        0x1.9afe48p-5, 0x1.558438p+1, -0x1.1e78b2p+1, -0x1.69564p+0,
+        -0x1.c159f6p-1, 0x1.603a28p-4, -0x1.3297f6p-1, 0x1.49b63ap-2,
+        0x1.0aaf24p-1, -0x1.4e905p-1, 0x1.cda50ap+1, -0x1.e1790ap-1,
+        -0x1.45fc5ap+1, -0x1.4c515p+2, -0x1.a0cdacp-2, 0x1.506884p-1
+    },
+    {
+        0x1.05172ep+1, 0x1.08c492p+0, 0x1.93ea0ep-1, 0x1.7a5eap-3,
+        -0x1.32a2aep+1, 0x1.34dbaep+2, -0x1.157796p-3, 0x1.919a42p-4,
+        0x1.073e98p-1, 0x1.04133ep+0, -0x1.4a2d36p+0, 0x1.1a59ap+1,
+        0x1.3cec82p-1, 0x1.ed427ep-1, 0x1.a2160ep-1, 0x1.07a8ccp+0,
+        -0x1.18e034p-1, 0x1.00f916p+1, -0x1.8eac86p+0, 0x1.571048p-1,
+        -0x1.1856eep-1, 0x1.c5ed84p+0, -0x1.ae7d92p+0, -0x1.0ed074p+0,
+        0x1.bb025p-1, -0x1.c7d5a6p-1, 0x1.273458p+1, -0x1.1e2ba2p+0,
+        -0x1.305a08p+1, 0x1.2acd7ap+2, -0x1.bbbddep+0, 0x1.715026p-3
+    },
+    {
+        0x1.04cc6cp+1, -0x1.892facp-1, -0x1.0a54dp-1, -0x1.0853dp-2,
+        -0x1.4ec442p+1, 0x1.95929cp-1, 0x1.6b4c1ap-2, -0x1.9e318cp-1,
+        -0x1.9d938ep-3, 0x1.1ac33ep-1, 0x1.024a26p-2, 0x1.c454a6p+0,
+        -0x1.3e9a8cp-4, 0x1.adb86p-2, -0x1.e0ca08p-3, 0x1.1f3c9ap+1,
+        0x1.594762p-3, 0x1.617ebep+1, -0x1.be7dfep+0, 0x1.a1525p+0,
+        -0x1.32681ep-1, -0x1.4dc404p-1, -0x1.8f6b98p+0, -0x1.1fa7dcp+0,
+        0x1.048f46p+0, 0x1.6c2498p-4, 0x1.8886a8p+1, -0x1.9af4dep-1,
+        -0x1.2bb8c2p+1, -0x1.0886aep+3, -0x1.4e1048p-1, -0x1.0d7efap-1
+    },
+    {
+        0x1.efebd4p+0, -0x1.984334p-1, -0x1.64d06ap-1, -0x1.cb52ep-2,
+        0x1.75e02p-1, -0x1.1d59bap-1, -0x1.117a1p+1, -0x1.853ac2p+0,
+        0x1.5b4938p+0, -0x1.1fde18p+1, 0x1.6f5fe6p-1, 0x1.32d9b8p+1,
+        -0x1.81ce4ap-7, -0x1.f3330cp-3, -0x1.b34a58p+0, 0x1.65bd2ap-2,
+        -0x1.5dbec4p-3, 0x1.06c152p-4, 0x1.15761ap+1, 0x1.6e25a2p-2,
+        0x1.f212aap-2, -0x1.04accp-1, 0x1.3baabep-1, 0x1.64be5cp-3,
+        0x1.7488e6p+0, -0x1.55483cp+2, 0x1.be00eap+1, 0x1.51a304p-3,
+        -0x1.97fcaep+0, -0x1.32e1e4p-3, 0x1.a8280cp-6, 0x1.90cf2ep-2
+    },
+    {
+        0x1.a2c8ecp+0, -0x1.4a0c34p+1, 0x1.b37098p+1, -0x1.76e92ep-3,
+        0x1.e39122p+0, -0x1.1c299cp-1, -0x1.8eb3ap+0, -0x1.ccf382p-1,
+        0x1.ac823cp+1, -0x1.891e8ap+0, 0x1.0da23ep-2, 0x1.6ba036p+1,
+        0x1.8c8c34p-2, 0x1.877c9ap-1, -0x1.5c920ap-1, 0x1.a056c4p-1,
+        0x1.f9d414p-6, 0x1.88d75cp-2, 0x1.92b5e2p-2, 0x1.c949b4p-1,
+        0x1.b8dbdp+0, -0x1.f0b2bep+0, -0x1.09d46ap-6, -0x1.26b48ep+0,
+        0x1.448cb2p+0, -0x1.59eb8cp+0, 0x1.a59e1p+1, 0x1.25e3ecp+0,
+        -0x1.2252dcp+1, -0x1.416084p-1, -0x1.22de2p+1, -0x1.d7552ap-1
+    },
+    {
+        0x1.5251p+1, 0x1.5a2ea8p-7, 0x1.358036p-1, 0x1.13687ap-3,
+        0x1.fde6cap-1, -0x1.1b52a8p-3, -0x1.ac4c68p-1, -0x1.fd87c2p-2,
+        0x1.1a3ab2p+1, -0x1.3e379ep-1, 0x1.318328p+0, 0x1.5596c4p+1,
+        -0x1.66d256p+0, 0x1.ea1ef6p+0, -0x1.abf33cp+1, -0x1.1e7642p-3,
+        0x1.09ec2p-1, 0x1.a1926ap-4, 0x1.a679c4p-3, 0x1.d2dbcap-5,
+        0x1.7b259ep-1, 0x1.3cf2cep+0, -0x1.b15e42p-3, -0x1.00bb2p-2,
+        0x1.691d92p+0, -0x1.4afe1p+1, 0x1.1eaac6p+1, 0x1.026d74p+0,
+        -0x1.1474d2p+1, -0x1.3277aap-5, 0x1.239c56p+1, -0x1.8eadap-2
+    },
+    {
+        0x1.d7c484p+0, -0x1.0f91f4p+0, 0x1.e33b16p+0, 0x1.fd9e94p+0,
+        0x1.8cef8ep+0, -0x1.944d64p-3, -0x1.7fe13ap-1, -0x1.e44756p+0,
+        0x1.877b82p+1, -0x1.82c768p-2, 0x1.1f98fap-4, 0x1.3475e2p+1,
+        -0x1.a94e5ep-1, 0x1.b0fc2ap+0, -0x1.e224ecp+1, -0x1.b6a69p-3,
+        0x1.1269ccp-5, 0x1.2a63e2p+0, -0x1.ad7798p+0, 0x1.31fd3cp+0,
+        0x1.dc6c2p-1, -0x1.6246b6p+0, -0x1.176338p+0, -0x1.42723cp-3,
+        0x1.36cde4p-1, -0x1.cde2c2p-1, 0x1.ddba84p+1, 0x1.14fb5ep+0,
+        -0x1.4268e2p+1, -0x1.e25bacp-1, -0x1.970cb6p+2, -0x1.b45a54p-5
+    },
+    {
+        0x1.0d11c4p+1, -0x1.52245ep+0, -0x1.d2b08cp-1, 0x1.ead6f8p-1,
+        0x1.3cf01p-2, -0x1.d29a52p-3, 0x1.2faca2p-3, 0x1.0a5e6ap+2,
+        0x1.651f54p+1, -0x1.6d37f2p+0, 0x1.70044ap-1, 0x1.333a32p+1,
+        -0x1.035352p-1, 0x1.25126p+0, -0x1.1ea284p+0, -0x1.3236bep+1,
+        -0x1.02bcd2p-1, 0x1.3422cep-1, -0x1.3234p+0, 0x1.fdabb6p+0,
+        0x1.1bae1ap-1, -0x1.d97c8p-5, -0x1.c23342p+0, 0x1.373b92p-1,
+        0x1.fde286p-1, -0x1.7bfc44p-1, 0x1.983fb8p-3, 0x1.293316p-2,
+        -0x1.38a01p+1, -0x1.04d0eep+0, 0x1.e48344p-1, -0x1.939e3ap-1
+    },
+    {
+        0x1.9f797cp+0, 0x1.2acf94p+0, 0x1.3c4872p-5, 0x1.dceb64p+0,
+        -0x1.25761p+0, 0x1.f5af16p-1, -0x1.31c206p-2, -0x1.926a22p+1,
+        0x1.9be232p+0, -0x1.dd3062p-1, 0x1.0d29bep-2, 0x1.4b4a22p+1,
+        0x1.01de56p-3, 0x1.17d38p-1, 0x1.28aff4p+0, -0x1.1a0822p+1,
+        -0x1.1a43p-2, 0x1.4fc7fp+0, -0x1.c9717ep+0, 0x1.7881fep+0,
+        -0x1.1681aep-2, -0x1.73b0bp-6, -0x1.2dd2fp-2, 0x1.6c5b24p-1,
+        0x1.b4f7dp-2, -0x1.720666p-2, 0x1.0c59a4p+2, -0x1.11e552p-1,
+        -0x1.267e3ep+1, -0x1.50e3ccp-1, -0x1.0e8fcp+0, -0x1.a6183ep-4
+    },
+    {
+        0x1.425dp+1, 0x1.bc7694p-1, -0x1.3658cp+0, 0x1.0488a8p-1,
+        -0x1.91e364p+0, 0x1.1635aap+1, 0x1.c73516p-2, 0x1.c0b254p+0,
+        0x1.c6bf5cp+0, 0x1.0fd428p-1, -0x1.01d20ap+0, 0x1.4973f2p+1,
+        0x1.3c0ad4p-2, 0x1.f594ep-1, -0x1.cfb324p-4, -0x1.7e7ec6p-1,
+        -0x1.d0e47ep-3, 0x1.82fb24p+0, -0x1.4e088p+1, 0x1.d6d2dep+0,
+        -0x1.a43de6p-1, 0x1.063626p-1, -0x1.ae9568p+0, -0x1.bbfac6p-1,
+        0x1.443746p-1, -0x1.e7664cp-1, 0x1.47ca2cp+1, -0x1.a28768p-1,
+        -0x1.075e22p+1, -0x1.db1a68p-1, -0x1.59bb7ap-1, 0x1.0d5e6cp-1
+    },
+    {
+        0x1.6ac73ep+1, 0x1.094edcp+1, -0x1.ea444ap-3, -0x1.a46c4ap-3,
+        -0x1.cba9ap-1, -0x1.90a1b2p-2, -0x1.ef009p-3, -0x1.e0fab2p-1,
+        0x1.7e3f16p-1, 0x1.8ec20cp-1, -0x1.32be6cp-1, 0x1.0d5616p+1,
+        -0x1.1de7a2p+0, 0x1.b3e78cp-2, -0x1.01b59ap-2, 0x1.14ca9p+1,
+        -0x1.34e77ap-2, 0x1.0095bep+1, -0x1.8a4748p+0, 0x1.99ceb2p+0,
+        -0x1.7a3f74p-2, 0x1.8185d6p-3, 0x1.5a5bep-2, -0x1.40c87cp-1,
+        0x1.01b10ap+1, 0x1.63fd94p-1, 0x1.dff1ecp+0, -0x1.44ee3p-1,
+        -0x1.1f56ep+1, -0x1.5d0a86p+1, -0x1.f68348p-3, -0x1.5dddf8p-1
+    },
+    {
+        0x1.19bf88p-1, -0x1.c4a00cp-1, -0x1.f6b4f8p-3, -0x1.141edap-1,
+        -0x1.255b4ep-1, -0x1.7f8134p-1, -0x1.5422c4p+0, -0x1.714b16p+0,
+        0x1.04929ap+1, -0x1.9fdcb6p+0, 0x1.79eee6p-1, 0x1.3a0fb4p+1,
+        0x1.e3a3a6p-4, -0x1.2c855ap-5, -0x1.499656p+0, 0x1.893e96p-2,
+        -0x1.432ffp-7, 0x1.0e779p-1, 0x1.a6a3bep+0, 0x1.2da112p-2,
+        -0x1.075632p+0, -0x1.4e85b2p-2, 0x1.3792e8p-1, -0x1.0126d4p-4,
+        0x1.d24d22p+0, -0x1.500a4ep+2, 0x1.8be938p+1, 0x1.4d1a96p-1,
+        -0x1.69348ep+0, -0x1.ad9232p-4, -0x1.ba4cc8p-3, 0x1.208ebep-1
+    },
+    {
+        -0x1.15ff8ep-1, -0x1.c2c98ep+1, 0x1.135698p+1, -0x1.4e2eccp-2,
+        -0x1.d5ebdap-1, -0x1.d391bep-1, -0x1.d462fep-1, -0x1.f5a5d2p+0,
+        0x1.6f1032p+1, -0x1.237d6cp+1, 0x1.b84324p-8, 0x1.661ac8p+1,
+        -0x1.a2b662p-2, 0x1.039efp-1, -0x1.898abep-1, 0x1.a9432ap-1,
+        -0x1.66c816p-3, 0x1.e5868cp-4, -0x1.578c8ap+0, 0x1.20dcc4p-1,
+        0x1.b817f4p+0, 0x1.5794cp+0, 0x1.2ec2a2p-1, -0x1.20d69p+0,
+        0x1.c07156p-1, -0x1.57fbe2p+0, 0x1.ed658ep+1, 0x1.1a7708p+1,
+        -0x1.082584p+1, -0x1.557754p-3, -0x1.bc335cp+0, -0x1.b8582ap-1
+    },
+    {
+        0x1.020e98p-2, -0x1.c39db6p-2, -0x1.1405bap-1, 0x1.3b2df6p-3,
+        -0x1.e5241ep-3, -0x1.6f337p-2, -0x1.1e6fd4p+0, -0x1.2f1c94p-2,
+        0x1.e19134p+1, -0x1.d1fb72p+0, 0x1.fdf2dp-1, 0x1.5671cp+1,
+        -0x1.d7e1d4p+0, -0x1.fe1378p-3, -0x1.0950f2p+1, 0x1.8aedf8p-1,
+        0x1.f3e1fp-1, 0x1.200556p+1, -0x1.1dc6e8p+0, 0x1.aef3bep-5,
+        0x1.a7a4b6p-1, -0x1.0f27e6p+0, 0x1.76ef9ep-2, -0x1.0e567cp-1,
+        0x1.3ff638p+0, -0x1.5a904ap+1, 0x1.44368p-1, 0x1.e332b2p+0,
+        -0x1.16956ep+1, -0x1.d38de8p-2, 0x1.2bc3a2p+1, -0x1.26522p-2
+    },
+    {
+        0x1.5dc2d6p+0, -0x1.680f1ap-1, 0x1.f55d74p-1, 0x1.44f3aap-1,
+        0x1.b1cb6ep+0, 0x1.2a6196p-4, -0x1.981098p-3, -0x1.324c9p+1,
+        0x1.68608cp+1, -0x1.a05ec6p-2, 0x1.447d04p-3, 0x1.26d2ap+1,
+        -0x1.b44ea6p+0, 0x1.3c02bp+0, -0x1.b3d164p-3, -0x1.096fb2p+0,
+        0x1.0525cep+1, -0x1.1b6b08p+0, -0x1.a6c988p+0, -0x1.806372p+0,
+        0x1.8c2104p-1, -0x1.8c9e48p+0, -0x1.81a854p-1, -0x1.486eaap-1,
+        -0x1.ac3f6p-3, 0x1.3af702p-1, 0x1.0c15a4p+1, -0x1.583368p-2,
+        -0x1.14e17cp+1, -0x1.b85a06p-1, -0x1.a93196p+2, -0x1.c50636p+0
+    },
+    {
+        0x1.1ebef2p+0, -0x1.ee5454p-1, 0x1.a32a48p-2, 0x1.cb2dc4p-1,
+        -0x1.fe7878p-3, 0x1.ac29fep-3, 0x1.7aeba6p-1, 0x1.46ed52p+2,
+        0x1.3ae114p+1, 0x1.096432p+0, 0x1.4f196ap-1, 0x1.60e5fep+1,
+        -0x1.0358eep+0, 0x1.2477e4p+0, 0x1.e86da8p-2, -0x1.b88c36p+1,
+        -0x1.69368ep-8, 0x1.e4eafap+0, -0x1.36f8ccp+0, 0x1.9b02b4p-1,
+        0x1.2bacbep-2, -0x1.484b76p-2, -0x1.226b52p-1, -0x1.e4803p-1,
+        0x1.fa80fep-1, -0x1.fc81d2p+0, 0x1.695272p-1, -0x1.37954p+0,
+        -0x1.22f02cp+1, -0x1.42b826p-1, 0x1.51e87ap+0, -0x1.9552fap-1
+    },
+    {
+        0x1.fd5202p+0, 0x1.95d9bp+0, -0x1.a66bfp-5, 0x1.ff9522p-1,
+        -0x1.757608p-1, 0x1.182eb4p-2, 0x1.35edbcp-1, -0x1.9585ccp+1,
+        0x1.0398fep+1, 0x1.bbc99cp+0, 0x1.2d8fb8p+0, 0x1.4fc0f8p+1,
+        -0x1.5a4854p-6, 0x1.36ed2p-1, -0x1.72ec3ep-3, -0x1.9758e8p+0,
+        -0x1.ccbe42p+0, -0x1.00fca8p-1, -0x1.364018p+0, 0x1.7bcf34p+0,
+        0x1.2c6798p-4, 0x1.677ba2p-1, 0x1.0d652cp+1, -0x1.1abb54p-2,
+        0x1.93cdb2p-1, 0x1.0992b6p-1, 0x1.dff16cp+1, -0x1.01008p+0,
+        -0x1.2a5268p+1, -0x1.7ba24p-1, -0x1.1f8342p+0, -0x1.bed42ap-1
+    },
+    {
+        0x1.b395b6p+1, 0x1.6c15c6p+0, 0x1.cfbdcep-2, -0x1.f8549p-4,
+        -0x1.6bd59p-2, -0x1.be8012p-4, 0x1.30491p+0, 0x1.0a1886p+0,
+        0x1.2572dcp+1, 0x1.aea71ap+0, -0x1.226cecp-2, 0x1.6d5decp+1,
+        0x1.fdcbbp-1, 0x1.b37044p-1, 0x1.09cf7p+0, 0x1.33fae8p+0,
+        -0x1.e0f3d8p-2, 0x1.db2426p+0, -0x1.4b11aap+0, 0x1.289d0ep+1,
+        -0x1.149bc8p-2, -0x1.8976dp-1, 0x1.4e8c86p+2, 0x1.94db9ap+2,
+        0x1.79b9e8p-1, -0x1.beb168p-1, 0x1.0c20fp+2, -0x1.f2eb4ep-2,
+        -0x1.b7ce7cp+0, -0x1.57a9fp+0, -0x1.bc4e02p-2, -0x1.4ff3cp+3
+    },
+    {
+        0x1.a9d39p+1, 0x1.32b978p+1, -0x1.01ac7ep-3, -0x1.0be27p-4,
+        -0x1.aaca9cp-3, -0x1.996f8p-1, 0x1.199352p-5, -0x1.1667dap+0,
+        0x1.c77798p-1, 0x1.4fc46ap-1, -0x1.94ba8ap-4, 0x1.1cda4ep+1,
+        -0x1.86b93ap-1, 0x1.3d59e6p-1, 0x1.8b7328p-1, 0x1.3f28aap+0,
+        0x1.0e7c1ep-2, 0x1.bfe362p+0, -0x1.e3c93cp-2, 0x1.d567fep+0,
+        -0x1.71b58cp-7, -0x1.957c94p-4, 0x1.a01b98p+0, -0x1.5c90acp+0,
+        0x1.046504p+1, 0x1.e121dap-1, 0x1.3d4bd4p+1, -0x1.25af3p+0,
+        -0x1.fe972p+0, -0x1.43fb74p+1, -0x1.ea02d8p-3, 0x1.6aaf2p-2
+    },
+    {
+        0x1.18b418p+0, -0x1.9eacc8p-1, 0x1.01526p-2, -0x1.46390cp-1,
+        -0x1.f07552p-4, -0x1.7d9dc6p-1, -0x1.307bcep+0, -0x1.227da2p+0,
+        0x1.d6c0b4p+0, -0x1.b6aebep+0, 0x1.d5cf92p-1, 0x1.2a567p+1,
+        -0x1.d44d6cp-7, -0x1.157d0ep-7, -0x1.c5115cp-1, 0x1.f94cfcp-3,
+        -0x1.368614p-2, -0x1.955126p-3, 0x1.47f814p-4, 0x1.b4cb62p-6,
+        -0x1.69ff3ep+0, 0x1.0d4bfcp-1, 0x1.6cab7ep-2, -0x1.0bceaap-4,
+        0x1.b3de94p+0, -0x1.442fbap+2, 0x1.63b7fep+1, 0x1.d0c08p-1,
+        -0x1.b0349ep+0, 0x1.2f8056p-5, -0x1.2414a2p-2, 0x1.5d62dp-2
+    },
+    {
+        0x1.2932ap-2, -0x1.a6b1eep+1, -0x1.530c6ap+0, -0x1.1f3e74p-2,
+        0x1.924456p-5, -0x1.49a7ap-1, -0x1.3cd21p+0, -0x1.556008p+0,
+        0x1.8b2222p+1, -0x1.8e7cecp+1, -0x1.1304b8p-2, 0x1.597c52p+1,
+        -0x1.184ea8p-2, -0x1.3cf4ccp-8, -0x1.155542p-1, 0x1.4d24d6p+0,
+        -0x1.5fdfeep-2, 0x1.6ac3b2p-2, -0x1.ad70aap+0, 0x1.ae70b2p-2,
+        0x1.fb4318p+0, 0x1.11b04ap+0, 0x1.41dc3p+0, -0x1.5322fcp+0,
+        0x1.3389c4p+0, -0x1.c87e2cp+0, 0x1.6a6a5ap+1, 0x1.699decp+1,
+        -0x1.0182dap+1, -0x1.a087cap-4, -0x1.2afdfp+0, -0x1.ebec6cp-1
+    },
+    {
+        0x1.c754f4p-1, 0x1.d76838p-5, 0x1.bb2554p-2, -0x1.516556p-1,
+        -0x1.81a2ccp-3, 0x1.8595b8p-3, -0x1.13c64p+0, -0x1.1901cp-3,
+        0x1.a0ead8p+1, -0x1.64dbdap+0, 0x1.0c7cfap-1, 0x1.45231ap+1,
+        -0x1.c7eaccp+1, -0x1.650d1cp-1, -0x1.0ffep+1, 0x1.950f98p-1,
+        0x1.11634cp+0, 0x1.0fbdc8p+1, -0x1.7cff3p+0, -0x1.291d3p-1,
+        0x1.163ec8p-1, 0x1.a15606p-2, -0x1.b3f7ccp-1, -0x1.583eb2p-1,
+        0x1.7e2a18p+0, -0x1.21adccp+1, -0x1.035926p+0, 0x1.468b92p+0,
+        -0x1.f0a9ecp+0, -0x1.42603ep-2, 0x1.1655p+0, -0x1.c25778p-1
+    },
+    {
+        0x1.6349bcp+0, -0x1.590652p-2, -0x1.b033dep-5, 0x1.464dbep-1,
+        -0x1.60c258p-2, -0x1.1bb14cp-4, -0x1.8548a4p-1, -0x1.5a0746p+1,
+        0x1.6e6db4p+1, 0x1.35f76ap-4, 0x1.adf9a6p-1, 0x1.543ecp+1,
+        -0x1.af54eap-1, 0x1.9934a6p+0, -0x1.c5ba9p+0, -0x1.245d98p-6,
+        0x1.355436p+0, 0x1.6feebp-1, -0x1.f1f57ep+0, -0x1.99e1e4p-1,
+        0x1.2fc3b8p+0, -0x1.1dd972p+0, -0x1.cd4dc8p-1, -0x1.5a4ac8p+0,
+        0x1.27b70ap+1, 0x1.ff8e32p-2, 0x1.82414ep-3, -0x1.20a0d6p+0,
+        -0x1.576eb8p+1, -0x1.5fc3cp-2, -0x1.c0783p+2, -0x1.191168p+1
+    },
+    {
+        0x1.1c6bccp+0, -0x1.3de8dap+0, 0x1.cb59ccp-2, 0x1.68485ap-1,
+        0x1.42de86p-1, 0x1.2a0134p-2, -0x1.5dc3dp-3, 0x1.d6d6f4p+1,
+        0x1.39769p+1, 0x1.1e220ep+0, 0x1.bc394cp-1, 0x1.4d1858p+1,
+        -0x1.cf7292p+0, 0x1.d5e568p-2, 0x1.65a636p-2, 0x1.34ef62p-2,
+        -0x1.b7aa66p-2, 0x1.11024p+1, -0x1.a65c8p+0, -0x1.13a928p-4,
+        0x1.10f786p-1, 0x1.e7f29p-3, -0x1.c82e5cp-1, -0x1.555aa4p-1,
+        0x1.fadaeep+0, -0x1.a431bcp+0, -0x1.7e977p-1, -0x1.088a42p+1,
+        -0x1.12d41cp+1, -0x1.295886p-1, 0x1.685becp+0, -0x1.14474ap+0
+    },
+    {
+        0x1.fce3acp+0, -0x1.51710ep+0, 0x1.47ba0cp-8, -0x1.4782c2p-3,
+        -0x1.c2859ap-4, 0x1.5830ep-6, -0x1.610ee2p-1, -0x1.2225c8p+1,
+        0x1.0a135ap+0, 0x1.c6ab62p-1, 0x1.c473acp+0, 0x1.596312p+1,
+        0x1.ed2704p+0, 0x1.4260b4p-3, 0x1.667c14p+0, -0x1.bcea2p+0,
+        -0x1.4b5eep-1, -0x1.50cfa8p+0, -0x1.34749p+0, 0x1.7b1278p+0,
+        -0x1.8730c2p-2, -0x1.0ea51cp-3, 0x1.79571p+0, -0x1.4799ecp-1,
+        0x1.df365ap+0, 0x1.fa8fdp-4, 0x1.bcf71ep+0, -0x1.f95008p+0,
+        -0x1.179bbp+1, -0x1.89cc3cp-1, -0x1.85a7ccp-1, -0x1.25032ep+1
+    },
+    {
+        0x1.9e1538p+1, 0x1.d1911p+0, 0x1.b90c72p-3, -0x1.ed9be8p-5,
+        -0x1.0d5904p-3, -0x1.41145ap-3, 0x1.19be8ep-1, 0x1.5645a4p-1,
+        0x1.885e54p+0, 0x1.2f27e6p+1, -0x1.f1915p-2, 0x1.57e5bap+1,
+        -0x1.30957ep-1, 0x1.7814dap-1, -0x1.9f0c9ap-4, 0x1.ce325ep-1,
+        -0x1.c84ae4p-4, 0x1.19b474p+1, -0x1.329192p+0, 0x1.8c2ba4p+0,
+        -0x1.26f5c8p-2, -0x1.d72052p+0, 0x1.119a3ep+2, -0x1.1f4056p+1,
+        0x1.757882p+0, -0x1.9349f2p-1, 0x1.c1a8b2p+0, -0x1.bb1f74p-1,
+        -0x1.a4001ep+0, -0x1.2bec9ap+0, -0x1.9344dap-2, 0x1.58fb46p-1
+    },
+    {
+        0x1.8ba318p+1, 0x1.882fd4p+1, 0x1.315ab4p-1, -0x1.b58ffep-5,
+        0x1.87166ep-1, -0x1.5aa4fcp-1, -0x1.11f796p-3, -0x1.0373p+0,
+        0x1.a44bfap-2, 0x1.597c72p+0, -0x1.1fd508p+0, 0x1.051c9ap+1,
+        -0x1.4dad3p+0, 0x1.6a00f4p-1, 0x1.0c06ep-1, 0x1.47ac82p+0,
+        0x1.7cbf9ap-2, 0x1.efa482p+0, -0x1.ecb918p-2, 0x1.36dd2p+0,
+        0x1.27c288p-1, -0x1.f9957cp-3, 0x1.c6fdbp+0, -0x1.a25f32p-2,
+        0x1.88703ap+0, 0x1.9b6ee2p-1, 0x1.558eb2p+1, -0x1.4bd086p-2,
+        -0x1.f28d96p+0, -0x1.adf80ap+0, -0x1.41afaep-1, -0x1.452b34p-5
+    },
+    {
+        0x1.1d2f64p+3, 0x1.a4620cp+3, -0x1.172a2p+3, -0x1.7ea9d8p+2,
+        0x1.558b28p+3, -0x1.9ef88ap+2, -0x1.eedaecp+2, 0x1.c78366p+1,
+        -0x1.713fp+1, 0x1.d76dbp+2, 0x1.c11e58p+2, -0x1.f0720ap-1,
+        0x1.e7ca94p-2, 0x1.69363ep+2, -0x1.68945p+3, -0x1.170c64p+1,
+        -0x1.1966e8p+2, -0x1.af393ap+0, -0x1.a99f34p+3, -0x1.168faap+2,
+        0x1.671c4p+1, -0x1.d79326p+3, -0x1.9380a6p+2, 0x1.0c6bdep+4,
+        -0x1.b10d98p+3, -0x1.d329fp+2, -0x1.176dp+3, 0x1.9fcb08p+1,
+        0x1.3ce8bap-5, 0x1.5dd85cp+3, -0x1.265e54p+2, 0x1.869536p-2
+    },
+    {
+        -0x1.e0037cp+0, -0x1.5d8968p+2, -0x1.87defep-2, 0x1.c9d0e4p-4,
+        0x1.ae022ep+3, 0x1.e62a32p+1, -0x1.b8edecp+3, 0x1.4867c8p+2,
+        -0x1.820354p+1, -0x1.1424b4p+4, 0x1.2ef73cp+3, 0x1.995e28p-3,
+        0x1.42da86p+3, 0x1.38e0ep+2, -0x1.9e1abap+1, 0x1.8de942p+1,
+        -0x1.09a1bcp+1, 0x1.630224p+3, 0x1.847ba2p+1, 0x1.68a25ep+2,
+        -0x1.e00c8cp-2, -0x1.e587bep+2, -0x1.cb91ccp+3, 0x1.a630a4p+3,
+        -0x1.08da8ep+4, -0x1.a736fcp+0, -0x1.36cec6p+1, 0x1.26f076p+1,
+        0x1.3c89e4p+0, 0x1.26a4f4p+3, -0x1.198f2ep+3, -0x1.4673cep-2
+    },
+    {
+        -0x1.96cd34p+3, -0x1.2219fep+1, 0x1.6018ccp+0, 0x1.bff362p+2,
+        0x1.41b3aep+3, 0x1.b3ba4p+1, -0x1.48a21ap+3, 0x1.3ffefap+1,
+        -0x1.7cd344p+2, -0x1.51a766p+4, 0x1.55a71ap+3, 0x1.fbee48p-2,
+        0x1.5998cp-1, 0x1.68011p+3, -0x1.af049cp+3, 0x1.e5b206p-2,
+        -0x1.418f1cp+0, 0x1.dc6a1ap+3, 0x1.c6b578p+1, 0x1.a84d66p+2,
+        -0x1.32408ap+3, -0x1.9e81f6p+0, -0x1.bd2288p+3, 0x1.bc864cp+1,
+        -0x1.ec7d44p+3, 0x1.a08bcap+1, -0x1.914d84p+2, 0x1.6ea65ep+2,
+        0x1.c18decp-4, -0x1.518a34p+1, 0x1.28239ap+2, -0x1.3f533ap-2
+    },
+    {
+        0x1.05239p-1, 0x1.6497dap+3, 0x1.3c0bd6p+0, 0x1.014e84p+3,
+        0x1.000e3ap+2, 0x1.54edd4p+2, -0x1.51af82p+2, 0x1.9a00f6p+1,
+        -0x1.374cb6p+1, -0x1.76038ap+4, 0x1.72f8eep+4, 0x1.89c07p+0,
+        0x1.0a5e14p+3, 0x1.6f3a52p-1, -0x1.3d9c3ep+3, 0x1.88025ep-1,
+        0x1.6bc5f2p-2, 0x1.49a8cap+1, 0x1.80e044p+1, -0x1.3b057ap+0,
+        -0x1.26a5a8p-1, 0x1.1dd9bep+4, -0x1.b579d6p+3, 0x1.f987b8p+2,
+        -0x1.d347bp+1, -0x1.65190ap+1, -0x1.0f40a8p+1, 0x1.02f8eep-1,
+        -0x1.447018p-3, 0x1.4eb1fp+2, -0x1.ab65b2p+2, 0x1.77822ep+1
+    },
+    {
+        -0x1.959358p+3, 0x1.336df6p+3, 0x1.1b1f7cp+0, 0x1.c8c9c6p+2,
+        0x1.4f7132p+2, 0x1.89673cp+2, -0x1.b58c88p-2, 0x1.179e4cp+4,
+        0x1.0e67aep-3, 0x1.35352ap+2, 0x1.0cdd96p+4, 0x1.9aafdap+0,
+        0x1.544f92p-1, -0x1.c1f2fep+2, -0x1.4fd76cp+1, -0x1.307d1ap-2,
+        0x1.a81aeep+0, 0x1.af5222p+0, 0x1.46552ap+0, 0x1.1ce292p+0,
+        0x1.f0cadep-2, 0x1.19263cp+3, -0x1.b0908p+1, 0x1.60eb1ap+2,
+        -0x1.7808c6p+3, 0x1.e31f7ep+2, -0x1.0102eap+3, 0x1.2bb948p+3,
+        0x1.584c64p-3, -0x1.a0845ap+0, 0x1.563ee6p-1, 0x1.8083b6p+2
+    },
+    {
+        -0x1.cba1a2p+1, -0x1.24e26cp+1, 0x1.d78b12p+0, 0x1.77610ap+2,
+        0x1.21d506p+0, 0x1.5cd6c2p+3, 0x1.53dfc4p+2, 0x1.7053ecp+3,
+        -0x1.4f5124p+0, 0x1.9f9f12p+1, 0x1.580e2ep+4, 0x1.836b4ep-1,
+        0x1.9ec304p+1, 0x1.b625d4p+3, -0x1.27317ep+2, -0x1.f6d88ap+1,
+        0x1.04ccbcp+2, -0x1.986728p+1, 0x1.3eb8c2p+2, 0x1.342312p+2,
+        -0x1.c114eep+0, -0x1.39c6p+1, -0x1.994586p+3, 0x1.a03778p+2,
+        -0x1.a905fep+1, 0x1.9f2ec8p+0, -0x1.f57e4p+1, -0x1.31eb58p+2,
+        0x1.9fc782p-1, 0x1.fe2bdap+2, 0x1.c8dec8p+3, 0x1.1c671p+2
+    },
+    {
+        -0x1.d82416p+0, 0x1.9313dcp+3, -0x1.4bea24p-1, 0x1.5149fep+2,
+        -0x1.ab249ep+2, 0x1.8b273ap+0, 0x1.aa4f04p+1, -0x1.b0cacp-3,
+        -0x1.a49b82p-1, 0x1.bdd232p+1, 0x1.1e8b48p+4, 0x1.15f6a6p+0,
+        0x1.efcd0ap+2, 0x1.916138p+1, 0x1.8f2848p+0, 0x1.89e0b6p+2,
+        0x1.8c01a2p+3, 0x1.42a1a6p+0, 0x1.04aa2ap+2, -0x1.37027p+0,
+        -0x1.f1e51cp+1, -0x1.d59a12p+2, -0x1.8615dcp+3, 0x1.3fda5cp+3,
+        -0x1.370734p+4, -0x1.305804p+3, -0x1.5bc4aap+0, -0x1.79f41ep+0,
+        0x1.4f7b7cp+2, 0x1.24fa7ap-1, 0x1.8ee5f2p+3, 0x1.3828dap+1
+    },
+    {
+        -0x1.55f586p+1, -0x1.7df3a8p+2, 0x1.986156p+2, 0x1.e733a2p-2,
+        -0x1.1ad85p+1, 0x1.252f06p+2, 0x1.2a201p+1, -0x1.2b5fecp+2,
+        0x1.86d3d4p-4, 0x1.0e9d3p+2, 0x1.11b374p+1, -0x1.95b5f8p+2,
+        0x1.542cb6p+3, -0x1.7d690ep+1, 0x1.dfd4dp+0, 0x1.5e7dcap+3,
+        0x1.4cf618p+1, 0x1.28a6f2p+0, -0x1.a42376p+1, 0x1.015ab6p-1,
+        -0x1.94ab8ep-3, -0x1.62ab26p+3, -0x1.c2faa6p+3, 0x1.41dc64p+3,
+        -0x1.20bf88p+3, -0x1.78a0b4p+2, 0x1.989f86p-1, -0x1.978de4p+2,
+        -0x1.5468dp-1, 0x1.00675p+2, 0x1.32d386p+4, -0x1.26967ap+4
+    },
+    {
+        0x1.40dffcp+2, -0x1.279c5ep+4, 0x1.cecf76p+1, 0x1.f63108p-4,
+        0x1.b8edf2p+3, 0x1.737dd2p+1, -0x1.834bf6p+2, 0x1.81f748p+1,
+        -0x1.b4d7f6p+2, -0x1.a2992p+0, 0x1.262daep+2, -0x1.9f6452p-2,
+        0x1.315a76p+2, 0x1.3d9ca8p+2, -0x1.a74ec4p+3, 0x1.8129b8p-1,
+        -0x1.ca422p+0, 0x1.3d199ep+1, 0x1.9597dep+2, -0x1.2b96d2p+3,
+        -0x1.7d24p+1, -0x1.319d3cp+1, -0x1.d7c512p+3, 0x1.7418d2p+2,
+        -0x1.35d592p-1, -0x1.de9944p+0, -0x1.45bd2ep+1, 0x1.2b9d78p+3,
+        0x1.f8d12ep+1, 0x1.022b86p+3, -0x1.20234ap+2, -0x1.a6042ep-2
+    },
+    {
+        -0x1.0e116cp-1, -0x1.2c9f94p+3, 0x1.7fa08p+1, 0x1.a56efep+1,
+        0x1.7e6a4ep+3, -0x1.740f04p+0, -0x1.aa42ccp+3, 0x1.ddf8ccp+1,
+        -0x1.e01e46p+1, -0x1.6b868ap+2, 0x1.9281e6p-2, 0x1.1e67bep-2,
+        0x1.e285a2p+1, 0x1.aaa6f2p+2, -0x1.c7b744p+3, -0x1.6e5384p-2,
+        0x1.e1780ap+1, 0x1.730632p+3, 0x1.044c56p+3, -0x1.c5f128p+0,
+        0x1.c3afd4p+2, -0x1.4a09f6p+3, -0x1.baaf6ap+3, 0x1.069228p+1,
+        -0x1.14898ep+4, 0x1.13f914p+3, -0x1.abbd6ep-1, 0x1.3bdf24p+2,
+        0x1.903d7ep+1, -0x1.e3ee28p+1, -0x1.1932eep+1, 0x1.b7a6eap+1
+    },
+    {
+        -0x1.57b2acp+2, 0x1.259442p+3, 0x1.ca8f06p+2, 0x1.d9ba9ep+1,
+        0x1.34b9aep+2, -0x1.5dca26p+0, -0x1.3485c6p+3, 0x1.ecb8a8p+1,
+        -0x1.17f4e2p+2, 0x1.160c6cp+1, 0x1.804d58p+2, 0x1.d9b5bap+0,
+        0x1.56ec86p+2, 0x1.5c9cc6p+2, -0x1.0052dp+3, -0x1.2cee2cp+2,
+        0x1.62b846p+1, 0x1.cadf16p+1, 0x1.4ac32p+2, 0x1.bdae5p+1,
+        -0x1.3e051ep+0, -0x1.af6196p+2, -0x1.7307fp+3, 0x1.63b62cp+2,
+        -0x1.3d025ep+4, 0x1.e49afp+1, 0x1.a28ab4p-5, 0x1.04b03ap+2,
+        -0x1.7f824ep-4, 0x1.0c5d58p+3, -0x1.0eb50cp+3, 0x1.ea32f6p-7
+    },
+    {
+        -0x1.eeeac6p+0, 0x1.6d25d4p+3, 0x1.88f07p+1, 0x1.e2edeep+2,
+        0x1.ce2edp+1, 0x1.387ccp+1, -0x1.72efep+2, 0x1.809e2ep+1,
+        -0x1.af0ca8p+1, 0x1.4164a2p+2, 0x1.f92252p+3, 0x1.c43b5cp+1,
+        0x1.97df92p+1, 0x1.c57d24p+2, -0x1.708246p+3, -0x1.a480aap+0,
+        -0x1.73f428p+2, 0x1.3a01b6p+2, 0x1.ac4c64p+2, 0x1.3048aep+2,
+        0x1.34e70ap+0, 0x1.b0c5p+0, -0x1.55679p+2, 0x1.d62456p+2,
+        -0x1.f2e566p+3, 0x1.b7002ap+2, 0x1.64e374p+0, 0x1.93ca28p+2,
+        0x1.597c7ap-4, 0x1.6de792p+2, 0x1.6748c2p+1, 0x1.da9fdcp+1
+    },
+    {
+        -0x1.a35a0ep+1, -0x1.777e2p+1, 0x1.454224p+2, 0x1.a17232p+1,
+        0x1.ca19dap+1, 0x1.3d2d66p+3, -0x1.c1b91p+1, 0x1.75e3eep+2,
+        -0x1.21d16p+1, -0x1.58211ep+4, 0x1.742744p+4, 0x1.9f329ap+1,
+        0x1.5ce9dcp+2, 0x1.8f9b8ep+1, -0x1.984fbep+1, -0x1.21410ap+2,
+        0x1.32a84ep+1, 0x1.f772c4p-2, 0x1.9e04c4p+0, 0x1.ac5d24p+3,
+        -0x1.31b33ep+0, -0x1.2ad5e2p+2, -0x1.423f8cp+2, 0x1.a3c9d6p+2,
+        -0x1.2b7152p+4, -0x1.b45ac4p+0, -0x1.4d9e74p-1, 0x1.a92aep+0,
+        0x1.c1597p-3, 0x1.4a7ffp+2, -0x1.2c2fp+2, 0x1.475f66p+2
+    },
+    {
+        -0x1.9d9a76p+0, -0x1.08b126p+2, 0x1.ffa5bp+0, 0x1.dd051cp+2,
+        0x1.4554ecp+0, 0x1.6d5672p+2, -0x1.6d919p-3, 0x1.16c7acp+4,
+        -0x1.30da08p+0, 0x1.7c67fap+1, 0x1.2a5f2p+4, 0x1.0f1224p+2,
+        0x1.619f54p-2, 0x1.bf4b24p+2, 0x1.de0fb6p-2, -0x1.3b3044p+0,
+        -0x1.10d60cp+3, 0x1.435384p+1, -0x1.a77e4ap-1, -0x1.00141ap+1,
+        -0x1.ed686ap-1, -0x1.b26002p+3, -0x1.34174ep+4, 0x1.6b887ap+2,
+        -0x1.9f69b6p+3, -0x1.9bea18p+2, -0x1.375818p+1, -0x1.488cfep+2,
+        0x1.e7bfacp-4, -0x1.01a366p+3, 0x1.7f7c1p+1, 0x1.15be22p+1
+    },
+    {
+        -0x1.c72a24p-1, -0x1.c4a27cp+2, 0x1.69f342p+2, 0x1.3d7728p+2,
+        0x1.1fac82p-5, 0x1.563ae2p+2, 0x1.29cfaap+0, 0x1.9a172ep+1,
+        0x1.de6c2ap-1, -0x1.1482d8p+4, 0x1.175ef2p+3, 0x1.c9688cp+1,
+        0x1.69bfb2p+2, 0x1.00a2b2p+3, -0x1.a24dc6p+2, -0x1.18531p-1,
+        0x1.d8dde4p+0, -0x1.f6817p+2, 0x1.789108p-1, -0x1.df83bep-1,
+        -0x1.bf2358p+1, 0x1.38042cp+3, -0x1.6acbf4p+3, 0x1.625ebcp+2,
+        -0x1.1a5d02p+4, -0x1.d851dep+2, 0x1.7ab4f2p+0, -0x1.eade78p+2,
+        0x1.8f906ap-1, 0x1.6faa9p+3, 0x1.daa378p+3, 0x1.47ca84p+2
+    },
+    {
+        -0x1.25d7d8p+2, -0x1.e25c8cp+2, 0x1.3c4b78p-1, 0x1.0f5e6ep+2,
+        0x1.2c38bcp+0, 0x1.84fd94p+0, 0x1.48113ep+2, -0x1.debed4p+2,
+        -0x1.cbf768p+0, 0x1.73ff96p+1, 0x1.97b96p+3, 0x1.a398aep-2,
+        0x1.3f1deap+3, 0x1.b8213p+2, -0x1.6fce4cp-1, -0x1.1e134ep-1,
+        -0x1.63cb4ep-1, -0x1.745882p+3, -0x1.dbf858p-4, 0x1.0bd15ep+0,
+        -0x1.cf53b4p+2, -0x1.a0069cp+3, -0x1.1992cap+3, 0x1.0e043cp+2,
+        -0x1.beefe4p+2, -0x1.4cef48p+3, 0x1.93915ap+1, -0x1.a18224p+3,
+        0x1.0d852ep+0, -0x1.0e478ap+3, 0x1.fa688ep+0, 0x1.78012cp+0
+    },
+    {
+        0x1.4fd0aep+2, -0x1.582506p+4, 0x1.d608a6p+2, -0x1.66cbb4p-2,
+        0x1.6f1b62p+3, -0x1.09be4cp+2, -0x1.aa4e24p+2, 0x1.8e8ac2p+1,
+        -0x1.7f1efcp+2, -0x1.9382d8p+2, 0x1.72dd2ap+0, -0x1.114e8ap-2,
+        0x1.dfd0ccp+2, 0x1.8a800cp+2, -0x1.11249cp+0, 0x1.85ce68p-3,
+        -0x1.73d54ep+3, 0x1.824626p+1, 0x1.2c8aecp+1, -0x1.bd780ap+2,
+        0x1.0e256cp+0, 0x1.996866p+0, -0x1.7de662p+3, 0x1.fcebaap+0,
+        -0x1.e7bd7ep+3, -0x1.898572p+0, -0x1.270a8ep+2, 0x1.aee00cp+1,
+        0x1.6d3f1cp+1, 0x1.18c94p+3, 0x1.9f363p+1, 0x1.275a5ep+2
+    },
+    {
+        -0x1.854c5ep-2, 0x1.a57caap+3, 0x1.b05da4p+0, 0x1.16c3eap-2,
+        0x1.646f2ap+2, -0x1.094922p-3, -0x1.d082f8p+2, 0x1.2c6962p+1,
+        -0x1.587fep+1, 0x1.48408cp+2, -0x1.26aed2p-2, 0x1.70795p-1,
+        0x1.f8ec04p+0, 0x1.b628ecp+2, -0x1.e0adbep+3, -0x1.7d0396p+0,
+        -0x1.554dbp+3, 0x1.cb488cp+2, 0x1.3ece7ap+1, 0x1.57bdbap-4,
+        0x1.38ac56p+1, -0x1.b6b914p+3, -0x1.0eb6bep+4, -0x1.a6e1cap-1,
+        -0x1.8ea15ep+1, 0x1.52cf48p+2, -0x1.32e566p+2, 0x1.748d38p+2,
+        0x1.a51acap-4, 0x1.4296bcp+3, -0x1.6a85fp+2, 0x1.4fabcep+0
+    },
+    {
+        0x1.537b5p-7, 0x1.62e59ep+3, 0x1.902bf8p+2, 0x1.e1fccp+1,
+        0x1.28772p+2, -0x1.1aba3ap+1, -0x1.998c5ep+2, 0x1.6c4254p+2,
+        -0x1.0bfae8p+2, -0x1.c828ep-1, 0x1.078bdep+1, 0x1.48cf7p+0,
+        0x1.42c1dcp+0, 0x1.abc1aap+2, -0x1.ba51bcp+1, -0x1.345f48p+1,
+        -0x1.75d77cp+1, 0x1.c0b04p+2, 0x1.f9de4ap+0, 0x1.a1f418p+1,
+        -0x1.1735b2p-1, -0x1.cbfbd4p-1, -0x1.0f3968p+4, -0x1.08fd68p+0,
+        -0x1.14ca06p+4, 0x1.53bdecp+1, 0x1.a8623ap+1, 0x1.bc0996p+2,
+        0x1.f453dap-3, -0x1.cb977p-2, 0x1.1d25e2p+0, 0x1.1c87dp-1
+    },
+    {
+        0x1.c9da14p-2, 0x1.1ff066p+3, 0x1.c8c98ap+0, 0x1.f60386p+1,
+        0x1.14373cp+2, 0x1.c5f72cp+2, -0x1.b5fc9cp+1, 0x1.1c75a4p+2,
+        -0x1.8f6ab8p+1, 0x1.3e7302p+2, 0x1.0fa06ap+2, 0x1.0a092ap+1,
+        0x1.49bbbep-1, 0x1.7254acp+2, -0x1.a38dap+3, -0x1.b68f1ep+0,
+        -0x1.5df75ap+1, 0x1.9954dp+0, 0x1.ad7492p+1, -0x1.f85918p+0,
+        0x1.c6ac94p-1, -0x1.a41036p+2, -0x1.f931e6p+2, 0x1.491746p+1,
+        -0x1.f44dcep+3, 0x1.1d5cbp+0, -0x1.1515c2p-4, 0x1.84afcep+1,
+        0x1.3aee32p-1, 0x1.2edc46p+3, -0x1.7e70ccp+2, 0x1.1d5336p+2
+    },
+    {
+        -0x1.8d117cp-2, 0x1.f7c22ep+2, 0x1.ab5fe6p+1, 0x1.c0ad86p+2,
+        0x1.6cc3c6p+1, 0x1.15f912p+3, -0x1.65417ep+1, 0x1.74c114p+3,
+        -0x1.81997cp+1, 0x1.658088p+1, 0x1.b21beap+2, 0x1.eb75ap+0,
+        0x1.31b104p-3, 0x1.332754p+2, -0x1.1fce74p+1, -0x1.74af6ep+0,
+        -0x1.4aadb2p+4, 0x1.1f23dap+1, -0x1.8a4a5p-3, -0x1.0446e6p-1,
+        -0x1.5d530cp-2, -0x1.3194b6p+2, -0x1.8ca178p+3, 0x1.14b84p+2,
+        -0x1.4b68aap+4, -0x1.4bbcbp+0, -0x1.47db68p+0, 0x1.fc0676p+0,
+        0x1.1b7d58p-2, 0x1.849dep+2, -0x1.c3d47ap+2, 0x1.55529p+2
+    },
+    {
+        -0x1.b0a8f2p+1, -0x1.2cf12ep+3, -0x1.ca9ec4p+0, 0x1.5625b4p+1,
+        0x1.1cb794p+1, 0x1.647f3cp+3, -0x1.7ff47ep-1, 0x1.0fda3ap+1,
+        -0x1.56411cp+1, -0x1.664d6p+4, 0x1.46d67ap+3, 0x1.c8afbp+0,
+        0x1.a0c8e4p-1, 0x1.8d8c02p+1, -0x1.7dac6ep-1, -0x1.b199c6p+1,
+        -0x1.e24c78p+2, 0x1.af41a2p+0, -0x1.dd02a2p+0, -0x1.5010a4p+0,
+        -0x1.0c382ep+1, -0x1.8993a4p+1, -0x1.83e448p+3, 0x1.6d7468p+2,
+        -0x1.a8adc2p+3, -0x1.9ae0f2p+1, 0x1.688952p+1, -0x1.cb93f2p+1,
+        0x1.860b22p-3, 0x1.f2532p+2, -0x1.6fc472p+1, 0x1.fa1812p+2
+    },
+    {
+        -0x1.911dcap+1, -0x1.5d2b9p+2, -0x1.15544cp+1, 0x1.81144cp+1,
+        -0x1.20c40ap+1, 0x1.4f95ecp+1, -0x1.57b014p+0, 0x1.5a76ccp+2,
+        -0x1.7f647ap+0, -0x1.a4b7d8p+4, 0x1.9bbc84p+2, 0x1.244882p+0,
+        0x1.fdb156p+1, 0x1.27fe62p+3, 0x1.1e8f5cp+0, 0x1.fe76f6p-3,
+        0x1.103502p+1, -0x1.449e52p-1, -0x1.87f644p-5, -0x1.619406p-1,
+        -0x1.309878p+2, -0x1.b8847ep+1, -0x1.4dc616p+3, 0x1.644958p+2,
+        -0x1.efeb36p+3, -0x1.a8317ep+2, 0x1.cd05dp+1, -0x1.77fbbep+2,
+        0x1.30a9p-1, 0x1.244f4ep+2, 0x1.5905eap+0, 0x1.116ad6p+2
+    },
+    {
+        -0x1.45fbd2p+2, -0x1.7a5734p+1, 0x1.4257c2p+0, 0x1.873a06p+1,
+        0x1.4da79cp+0, 0x1.a92e7ap+2, 0x1.3bbffep+0, -0x1.bf288ep+1,
+        -0x1.3cd44p-1, 0x1.f65bb4p+0, 0x1.3befdp+3, 0x1.b0c88p-1,
+        0x1.05c0cap+2, 0x1.595394p+2, -0x1.d16592p+1, -0x1.e7feccp-3,
+        -0x1.3c311ep+2, 0x1.a7a0f8p+1, -0x1.365b1p+1, -0x1.4462dcp+2,
+        -0x1.9d095ap+0, -0x1.328e4cp+4, -0x1.12c1dep+2, 0x1.3032fcp+2,
+        -0x1.87c8a8p+3, -0x1.82922cp+2, -0x1.181c78p+1, -0x1.920ee8p+2,
+        0x1.663f42p+0, -0x1.75b5eap+1, 0x1.23975cp+1, 0x1.744d32p+1
+    },
+    {
+        0x1.80da06p-3, -0x1.272282p+4, 0x1.bed59p-2, -0x1.7d5048p-1,
+        0x1.806b1p+2, -0x1.d4d424p+0, -0x1.dd96e6p+2, 0x1.0527eap+1,
+        -0x1.c2b348p+1, -0x1.1f4712p+2, -0x1.f7a494p+1, -0x1.a8f652p-3,
+        0x1.e62e5p+1, 0x1.31b6b4p+2, -0x1.6fe11cp+2, -0x1.8711acp-3,
+        -0x1.1e263cp+2, -0x1.978006p-1, 0x1.9d5dacp-1, -0x1.974726p+3,
+        0x1.ef6cc6p+0, 0x1.37ab5ap+0, -0x1.6398a2p+2, -0x1.4f9734p+3,
+        0x1.c3164ep+0, -0x1.177c6ap-1, -0x1.faeb86p+1, 0x1.53c65ep+1,
+        0x1.444c08p-3, 0x1.12581cp+2, 0x1.db526p+0, -0x1.a7674p+2
+    },
+    {
+        -0x1.d0066cp-3, 0x1.2360a4p+3, 0x1.05b85cp+0, 0x1.1c4c72p-2,
+        0x1.1b5cecp+2, 0x1.46683cp-1, -0x1.91a6c4p+2, 0x1.64bcf8p+1,
+        -0x1.753294p+1, 0x1.0a042p+1, -0x1.41c486p+2, 0x1.235cb2p-1,
+        0x1.2d29f2p+2, 0x1.33ea82p+2, -0x1.9da812p+2, -0x1.3f39fap-1,
+        -0x1.e97d72p+3, -0x1.913dp-2, 0x1.485f78p+0, -0x1.b17f56p-1,
+        0x1.bce0eep+1, -0x1.bc0bfcp-2, -0x1.3892bp+2, -0x1.0dce24p+2,
+        -0x1.078214p-1, 0x1.cb87cep+1, -0x1.1b0798p+0, 0x1.14c83ap+2,
+        0x1.1ee2dcp-3, 0x1.0619aap+3, -0x1.da5e0ap-8, -0x1.17d0eap+1
+    },
+    {
+        -0x1.02d65p-1, 0x1.4a108cp+3, 0x1.2f6ec8p+1, -0x1.92366cp-4,
+        0x1.772748p+1, 0x1.c7c0f8p-1, -0x1.58834ep+2, 0x1.d09fecp+1,
+        -0x1.b0f5fap+0, 0x1.68039ep+1, -0x1.cdb6bp-1, 0x1.ca4716p-1,
+        0x1.f7d8fp-1, 0x1.77721p+1, -0x1.1c5b6ap+4, -0x1.e08782p+0,
+        -0x1.1ce38p+4, 0x1.01755p-3, 0x1.8fdd76p+0, 0x1.8abe66p+0,
+        -0x1.3b4a34p-1, -0x1.49243p+2, -0x1.2d7454p+2, -0x1.4f0af6p+0,
+        -0x1.c31a48p-3, 0x1.b2075cp+0, -0x1.6f72p+1, 0x1.29cf2cp+2,
+        0x1.5b87a6p-3, 0x1.e90f36p+2, -0x1.6dd972p-1, -0x1.e411c4p+1
+    },
+    {
+        0x1.7985fep-1, 0x1.c87c48p+2, 0x1.5e963cp+1, -0x1.0d3a3ap+0,
+        0x1.672dbep-2, 0x1.eb3fe2p+2, -0x1.f8df44p+1, 0x1.4eddp-1,
+        -0x1.34feaap+1, 0x1.4d943cp-1, 0x1.8adfa6p+1, 0x1.5ac496p+0,
+        0x1.ffa1eap-1, 0x1.130a6ep+3, -0x1.bbdfbp+3, -0x1.02827ep-1,
+        -0x1.259a2ep-1, 0x1.77298ep-2, 0x1.2cc206p+0, -0x1.3b390ep+0,
+        -0x1.ed5fa6p-2, -0x1.ab51a4p+2, -0x1.d0e2d4p+0, -0x1.612c18p-1,
+        -0x1.05c986p+4, 0x1.252a7p-5, 0x1.ea006cp+1, 0x1.f25c5p+0,
+        -0x1.564b92p-4, 0x1.4c3d2p-1, -0x1.89fe76p+1, 0x1.49782p+1
+    },
+    {
+        0x1.1d3578p-1, 0x1.002a24p+3, 0x1.1e5312p+1, 0x1.52fc7ep+2,
+        0x1.3122fp+0, 0x1.b8e394p-3, -0x1.4acceap+1, 0x1.322dd6p-2,
+        -0x1.14121cp+1, 0x1.d61f82p+1, 0x1.7aa75ap+1, 0x1.008f14p+0,
+        -0x1.5b9e68p-3, 0x1.73bceap-4, -0x1.2df65cp+1, 0x1.4f567p-1,
+        -0x1.921ccp+2, 0x1.9f9d48p+0, -0x1.b65a6cp+0, -0x1.0e69a4p-1,
+        0x1.f930bap-3, -0x1.4b82a2p+2, -0x1.5e8856p+3, 0x1.88a52ep+0,
+        -0x1.0be27ep+3, -0x1.9c743p-3, 0x1.42ca52p-2, 0x1.4fa966p+0,
+        0x1.7744fap-4, 0x1.286296p+2, -0x1.2862dep+1, 0x1.e80c3cp+1
+    },
+    {
+        -0x1.3026a4p+0, -0x1.bcf0a6p+1, -0x1.72059ap+0, 0x1.4ad7d2p+0,
+        0x1.230488p+1, 0x1.9227b6p+1, 0x1.88cfaap+0, 0x1.06dba4p+0,
+        -0x1.1b8c2p+1, 0x1.703356p+1, 0x1.b595c8p+0, 0x1.809b38p-1,
+        -0x1.e4ab12p-2, 0x1.1491b4p+1, -0x1.75b4b6p+0, -0x1.64fb52p-2,
+        -0x1.729b0ep+3, 0x1.bd335ep+1, -0x1.014cfap+2, -0x1.8a25dp+1,
+        -0x1.40862cp-3, -0x1.a71414p+2, -0x1.2630a2p+3, 0x1.09de7ep+2,
+        -0x1.54632ep+3, -0x1.57c122p+0, 0x1.c1f06p+1, -0x1.3cb21cp+2,
+        0x1.08cf58p-2, -0x1.86ced4p+1, -0x1.58c0fp+0, 0x1.1135a4p+2
+    },
+    {
+        -0x1.572632p+1, -0x1.185c1ep+2, -0x1.02bfc6p+0, 0x1.977898p+0,
+        -0x1.6a4762p+2, -0x1.9dbcp-1, 0x1.c1b3d6p+0, 0x1.027ed2p-1,
+        -0x1.938c3p+0, 0x1.4bf874p+1, -0x1.6483ep-1, 0x1.50d77p-3,
+        0x1.c1a9a6p+1, 0x1.f674a6p+0, -0x1.535082p+0, 0x1.519b42p+0,
+        -0x1.8252ep+3, 0x1.03c3d2p+0, -0x1.8b0a7ap+1, -0x1.fbaa06p+1,
+        -0x1.8519a6p-1, -0x1.4e942p+2, -0x1.c9ff72p+3, 0x1.0daeb2p+2,
+        -0x1.8163f8p+1, -0x1.3da48ap+2, -0x1.7109d2p+0, -0x1.3d384ep+2,
+        0x1.0b5732p+0, 0x1.ce6314p+3, -0x1.bebf34p+0, 0x1.b2832p+1
+    },
+    {
+        -0x1.2bf89ep+2, -0x1.bd361cp+2, -0x1.9f683cp+0, 0x1.a88c9ep+0,
+        -0x1.96d9bep+0, 0x1.221efp+1, 0x1.e25e6cp+1, -0x1.222742p+2,
+        -0x1.2f9532p+0, 0x1.afb3d4p+1, 0x1.4493bap-3, -0x1.02845ap-4,
+        0x1.395c38p+2, -0x1.c59054p+0, -0x1.1ada56p-2, 0x1.21b9d6p+0,
+        -0x1.a0853cp+3, 0x1.5f5b2p+2, -0x1.b61b98p+1, -0x1.d58474p+1,
+        -0x1.f2587cp+0, -0x1.2b3496p+2, -0x1.16fb32p+3, 0x1.08f2d8p+2,
+        -0x1.0ad3acp+1, -0x1.2f1ed6p+2, 0x1.28cb94p+1, -0x1.ce1a96p+2,
+        0x1.381ac8p+0, -0x1.625f04p+3, -0x1.0b9652p+1, 0x1.280f34p-3
+    },
+    {
+        -0x1.f470fcp-2, -0x1.28df1ap+4, -0x1.9856f8p+3, -0x1.7d63c6p-2,
+        0x1.10190cp+2, -0x1.72ed18p-2, -0x1.2ef5cap+2, 0x1.b13288p-3,
+        -0x1.1ef926p+0, -0x1.fc9218p-1, -0x1.d559dap+2, -0x1.950bbcp-3,
+        0x1.98175ep+2, 0x1.37dd9ep+1, -0x1.7dc66ap+0, 0x1.5a3926p-3,
+        -0x1.a9b1c8p+1, -0x1.9164e4p+0, -0x1.616176p-3, -0x1.089a94p+3,
+        0x1.390c16p+2, -0x1.a381dep+3, -0x1.ba2c82p+2, -0x1.e857ap+0,
+        0x1.a7777ap+0, 0x1.185a7ap-1, 0x1.1b06aep-1, 0x1.6dc232p+2,
+        0x1.3d8fb6p+0, -0x1.7efc0ep+1, 0x1.5def4p+0, -0x1.7d6864p+1
+    },
+    {
+        -0x1.e82d14p+0, 0x1.30f608p+3, 0x1.b2f0ecp-1, 0x1.da66d4p-2,
+        0x1.d64246p+0, 0x1.6ccecep-2, -0x1.411eb6p+2, 0x1.239dep+0,
+        -0x1.03c6cep+1, 0x1.b8a908p-4, -0x1.3ca606p+2, 0x1.020134p-4,
+        0x1.2a776p+0, 0x1.1a0976p-2, -0x1.21fea2p+3, -0x1.08a4dp-1,
+        -0x1.d5c09ap+3, -0x1.285f36p+1, 0x1.bc2486p-1, -0x1.4d7b1ep+0,
+        0x1.1ee7dap+2, 0x1.3be6b4p+0, -0x1.14f72ep+2, -0x1.51998cp+1,
+        0x1.d1693ep-1, 0x1.d7ca62p-1, 0x1.3a24a6p-2, 0x1.c893eep+0,
+        0x1.240fe4p-2, 0x1.eb37fp-7, 0x1.92d16p-2, -0x1.3edd66p+2
+    },
+    {
+        -0x1.44802p+0, 0x1.630136p+3, 0x1.e3c236p-4, -0x1.f6816p-4,
+        -0x1.2c1a0cp-2, -0x1.4d95f2p+0, -0x1.0b7606p+2, 0x1.0fd138p+0,
+        -0x1.238ce4p+0, 0x1.3d056cp+0, -0x1.517b1cp+2, 0x1.4e02d4p-1,
+        -0x1.4e5e2ep-5, -0x1.7a9e66p-1, 0x1.75a112p+1, -0x1.8c2f26p-3,
+        -0x1.6dbff2p+1, -0x1.c8f5dep+0, 0x1.5bb34cp+0, 0x1.0cc104p+1,
+        -0x1.bf6938p+0, -0x1.dc44ap+0, -0x1.14f69p+0, -0x1.e6c308p+3,
+        0x1.5874bp-1, 0x1.19b086p-1, 0x1.d44ccap-2, 0x1.7b5208p+0,
+        0x1.22845cp-3, -0x1.ab5152p-2, -0x1.6dfdb6p-3, -0x1.b3cd78p+2
+    },
+    {
+        -0x1.89ad66p-2, 0x1.b5ce08p+2, 0x1.f08c38p+0, -0x1.1b5bb8p+1,
+        -0x1.30ee5ap+1, 0x1.1a4514p+0, -0x1.a897dp+1, 0x1.89144p+0,
+        -0x1.e578ccp+0, 0x1.49a00ep+1, 0x1.ce5184p-2, 0x1.0ebe6cp-1,
+        0x1.254318p+1, -0x1.a961dcp+1, -0x1.fa70d4p+2, 0x1.3d75e8p-1,
+        -0x1.99a3a8p+3, -0x1.4cf74cp-1, -0x1.a94a56p-2, 0x1.5ceb66p+0,
+        0x1.371312p-1, 0x1.9fca06p-1, -0x1.037fa8p-2, -0x1.8fe188p+0,
+        -0x1.039a32p+0, -0x1.e72406p-3, -0x1.62d358p-2, 0x1.df92a2p+0,
+        -0x1.94def2p-6, 0x1.41910cp+0, -0x1.d4195ep-1, -0x1.5edab8p-3
+    },
+    {
+        -0x1.3ff458p-1, 0x1.03742cp+3, -0x1.b1bcfcp-4, -0x1.4edd1cp+1,
+        -0x1.8d9736p+1, -0x1.1406fap-4, -0x1.960b4p+0, 0x1.08ae24p+1,
+        -0x1.486c7cp+0, 0x1.b4bc2ap+1, 0x1.9e958cp+0, 0x1.ba9752p-5,
+        -0x1.2fd7fep+0, -0x1.e79e18p+0, 0x1.6ac7b8p+0, 0x1.0a1bf8p+1,
+        -0x1.0c58a6p+2, 0x1.6f72fp+0, -0x1.ae292ep+0, 0x1.608d38p+1,
+        0x1.108ee6p+0, -0x1.0ff626p+2, -0x1.d4a4f2p+1, 0x1.0b8c44p+0,
+        -0x1.2a14ecp-1, 0x1.912344p-1, -0x1.1db1ap+0, 0x1.222afcp+0,
+        0x1.e87b6ep-2, 0x1.02f0fcp-1, -0x1.da708cp-1, 0x1.c3b396p+0
+    },
+    {
+        -0x1.ec6e3ap-1, -0x1.0d858p+0, -0x1.338628p+1, 0x1.31f8p-2,
+        -0x1.f059dep+1, 0x1.0a7de8p+1, 0x1.a32abcp+1, 0x1.3fe4e6p+0,
+        -0x1.0fec6ap+1, 0x1.1e1d5ap+2, 0x1.f9471p-2, -0x1.3cce74p-3,
+        0x1.08893p+0, -0x1.fbdbeap-2, -0x1.1e6d2ap-3, 0x1.a1a7a6p+0,
+        -0x1.60672cp+1, 0x1.294f16p+0, -0x1.b43f6p+1, -0x1.744f16p+1,
+        0x1.e267acp-2, -0x1.856a14p+1, -0x1.654b48p+3, 0x1.dff454p-1,
+        0x1.c1051cp-2, 0x1.ec9f6cp-3, 0x1.19b36cp+2, -0x1.636ab8p+1,
+        0x1.a7f6a4p-2, 0x1.e223a6p-3, -0x1.1230d2p-1, 0x1.7525a4p+1
+    },
+    {
+        -0x1.9f7f3p+0, -0x1.357e8p+1, -0x1.9c6744p+0, 0x1.5cbbfap-2,
+        -0x1.dfe6c2p+1, 0x1.9e2624p+0, 0x1.66689ep+2, -0x1.b42294p-1,
+        -0x1.72e5ccp-1, 0x1.0d268cp+2, -0x1.653bfcp+0, -0x1.9228acp-3,
+        0x1.391044p-2, 0x1.db9e62p+0, 0x1.6c4ccp+0, 0x1.483102p-1,
+        -0x1.eefc86p+0, 0x1.65d1ap+0, -0x1.3a8214p+2, -0x1.198c2ap+1,
+        -0x1.4daaeap+0, -0x1.bfd2c8p+1, -0x1.3b0098p+4, -0x1.d2198ep-1,
+        -0x1.2de7f6p+0, -0x1.76fc34p+0, 0x1.9dc4a6p+2, -0x1.fb6e54p+1,
+        0x1.e18836p-1, -0x1.6efdd2p-1, 0x1.0f1e58p-4, 0x1.dba9a8p+0
+    },
+    {
+        -0x1.4bc2e8p+1, -0x1.8a3e6cp+2, -0x1.7d210ep+2, 0x1.1f1444p+0,
+        -0x1.35de64p+2, 0x1.4c693ep+1, 0x1.27c5bap+2, -0x1.eaaad6p+0,
+        -0x1.6cbe5cp+0, 0x1.b0fceep+1, -0x1.10e8dap+1, -0x1.3c7b84p-2,
+        0x1.070b96p+0, -0x1.0629dep+0, -0x1.d94e0ap-2, 0x1.f526c2p-1,
+        -0x1.e3b61p+2, 0x1.5f8316p+1, -0x1.1baacap+2, -0x1.33aa1p+2,
+        -0x1.4be94ap+1, -0x1.82ed7cp-1, -0x1.07187cp+3, 0x1.1efd82p-2,
+        -0x1.c186dcp-1, -0x1.6a3af8p+1, 0x1.5cc936p-4, -0x1.6c606cp+2,
+        0x1.d3401cp-1, 0x1.27640ep+0, 0x1.e01176p-3, 0x1.32ae6cp+0
+    },
+    {
+        -0x1.83cd64p-1, 0x1.28778cp-4, -0x1.30b6bcp+1, -0x1.fca69ap-2,
+        -0x1.23e50ap-1, 0x1.c0a42ap+1, -0x1.1e773cp+2, 0x1.355fa6p-1,
+        -0x1.c4fd88p+0, -0x1.343b62p+2, -0x1.7fafb4p+2, -0x1.a14c44p-1,
+        -0x1.4bf84p+0, 0x1.0b3c56p-2, -0x1.4d2068p+2, 0x1.1fca3ap-2,
+        -0x1.4e53c2p+0, -0x1.4ad96cp-1, 0x1.4e178p-2, -0x1.eec6ep+1,
+        0x1.31bb1ap+2, 0x1.14f65cp+2, -0x1.f2e6c8p+1, -0x1.b8f116p+1,
+        0x1.9b6f98p+0, 0x1.1f254ap-1, -0x1.b8b37cp+1, 0x1.0d52b4p+0,
+        0x1.030e18p-2, -0x1.1190e8p+0, 0x1.37109p-1, -0x1.108ddap+2
+    },
+    {
+        -0x1.38ab4ep+1, -0x1.7cc226p+3, 0x1.22c1f6p-5, -0x1.f7a33ap-1,
+        0x1.35d4bep-2, -0x1.2950cp-1, -0x1.32e1fp+2, -0x1.955032p-1,
+        -0x1.480156p+0, -0x1.273cc8p+2, -0x1.ab658ap+1, -0x1.2c30bp-4,
+        -0x1.8b6372p-1, -0x1.b3c2c8p+1, -0x1.0e76ccp-2, -0x1.37e342p-2,
+        -0x1.33a5b4p+3, -0x1.6a407cp-1, 0x1.f5d65cp-1, -0x1.957e6ap+0,
+        0x1.71b6bcp+1, -0x1.a7a4e4p+1, -0x1.2b3778p+1, -0x1.1683aep+2,
+        0x1.5c4564p+0, 0x1.39f592p-2, -0x1.8cd21cp+1, 0x1.2071bap+1,
+        -0x1.95c19ap-3, -0x1.070916p-1, 0x1.66f51cp+1, -0x1.9d7dacp+2
+    },
+    {
+        -0x1.1a9e44p+1, 0x1.0fcce6p+2, 0x1.4d959ep-5, -0x1.09183ap+0,
+        -0x1.0aa716p-1, 0x1.1c4474p+1, -0x1.d340d4p+1, -0x1.d4c4ecp+0,
+        -0x1.5d039p+0, -0x1.1224dcp+1, -0x1.c9e3b8p+2, 0x1.32cc2p-2,
+        0x1.7c55eap-3, -0x1.366ce4p-1, -0x1.af697cp+1, -0x1.a0abf8p-1,
+        -0x1.015fb8p+2, -0x1.dc8b68p+0, 0x1.390b5ep+0, -0x1.4cf312p-1,
+        -0x1.98437p+0, -0x1.3e0fc8p-4, -0x1.a76c0ep+0, -0x1.25e344p+2,
+        0x1.a06e34p+0, -0x1.d97f5ep-2, 0x1.62b5b6p-4, 0x1.70fee4p-1,
+        0x1.8d2c7p-6, 0x1.e253dp-1, -0x1.8dc4ep-4, -0x1.cfec08p+2
+    },
+    {
+        -0x1.73aff8p+0, 0x1.9f89bp+2, -0x1.cb7b78p-2, -0x1.0d1b7cp+0,
+        -0x1.0b097p+1, -0x1.7984f2p-2, -0x1.5afd8ap+1, 0x1.b76a3p-1,
+        -0x1.39dd6p-2, 0x1.f88cf6p+0, -0x1.7fc2bep+1, 0x1.dbbc8p-4,
+        0x1.a3444p+0, -0x1.67c8f6p+0, 0x1.c90f26p+0, 0x1.3d3d9ap-1,
+        -0x1.385234p+3, -0x1.5b36c2p-3, 0x1.518f42p-5, 0x1.fb0606p+0,
+        -0x1.8a20f6p-4, -0x1.b4899p+1, -0x1.d114c6p-6, -0x1.f3c9e2p+1,
+        0x1.b06a0ep+0, 0x1.270afap-2, -0x1.4d235cp+0, 0x1.ae3162p-1,
+        0x1.016782p-2, 0x1.8f91ap-2, -0x1.4a79bep-1, -0x1.defb4p+0
+    },
+    {
+        -0x1.ec1facp-2, 0x1.d95538p+2, -0x1.425752p+0, -0x1.7998dp+0,
+        -0x1.7192bp+1, 0x1.03f904p+1, -0x1.ff0142p-1, -0x1.6058dcp-1,
+        -0x1.6645e4p-1, 0x1.e03842p+1, -0x1.43e80ap-3, 0x1.1d1b84p-4,
+        -0x1.3b8fcap-2, -0x1.35cff2p+0, -0x1.9d4ab8p+1, 0x1.fd02ecp-2,
+        -0x1.333b1ap+1, -0x1.d34fccp-3, -0x1.8affc4p+0, -0x1.aeff62p-1,
+        0x1.9a21f2p-1, -0x1.a7823p+0, -0x1.4e8d98p-1, -0x1.261094p-1,
+        0x1.a302f6p-1, 0x1.c19aap-2, 0x1.d21956p-1, 0x1.2fb25cp-1,
+        0x1.f0e19ep-3, -0x1.b3270cp+0, -0x1.20434ep-1, 0x1.a3e298p-2
+    },
+    {
+        -0x1.64d29ep-1, 0x1.e6ae8ap+0, -0x1.927aa4p-1, -0x1.d94432p-4,
+        -0x1.0f1e74p+2, 0x1.7aa782p+0, 0x1.2297dap+1, 0x1.d882a8p-2,
+        -0x1.25c788p-1, 0x1.3976cp+2, -0x1.54a992p-1, -0x1.b24634p-2,
+        -0x1.882c7p-2, -0x1.616716p+0, 0x1.fe576p-4, 0x1.f535aep-5,
+        -0x1.4890e6p+0, -0x1.573d8cp-2, -0x1.35eb4p+1, -0x1.ad8638p+0,
+        0x1.efa73p-1, -0x1.b31372p+0, -0x1.632274p+2, 0x1.aa2eep-2,
+        0x1.7d9492p+0, 0x1.30b12cp+0, 0x1.97c4dp+0, -0x1.ae1816p+0,
+        0x1.15f696p-2, -0x1.7ef776p-2, 0x1.a6b2c8p-2, 0x1.0110e4p+1
+    },
+    {
+        -0x1.85ce6p+0, 0x1.64a128p+1, -0x1.d9e698p+0, -0x1.20f476p+0,
+        -0x1.d84ef8p+1, 0x1.6f8a5ap-2, 0x1.1e491p+1, -0x1.789542p+0,
+        -0x1.dc5abap-2, 0x1.3b8bbp+2, -0x1.6c4e56p-1, -0x1.352d76p-2,
+        0x1.5a0fa6p-2, -0x1.d19c88p-2, 0x1.99538p-2, 0x1.90f674p-1,
+        -0x1.3f56f2p+1, -0x1.c2dcep+0, -0x1.7d3f0ap+1, 0x1.df16f4p-4,
+        -0x1.e7a8a6p-2, -0x1.55a648p+1, -0x1.41560ap+1, 0x1.b0495cp+2,
+        -0x1.98817p-2, 0x1.35e888p-4, 0x1.758c58p+0, -0x1.d35146p+1,
+        0x1.5bde18p-2, -0x1.c0e6d8p+0, 0x1.2ea684p-3, -0x1.07a65p+3
+    },
+    {
+        -0x1.c08722p+0, -0x1.686c6ep-1, -0x1.3f106ap+2, -0x1.20a948p-1,
+        -0x1.8269dp+2, 0x1.9950b2p-1, 0x1.28c2f2p+1, -0x1.65f448p-2,
+        -0x1.04d3fep-3, 0x1.f6a026p+1, -0x1.246d5ep+1, -0x1.37f376p-1,
+        -0x1.5ef42ep-2, -0x1.26cedap+0, 0x1.68fd9ap+0, 0x1.0e36bep+1,
+        -0x1.eaf014p+0, 0x1.86d076p+0, -0x1.720fa8p+1, -0x1.2ce6e8p+0,
+        -0x1.600286p+0, -0x1.351774p+1, -0x1.b3b2d6p+2, 0x1.54b3eep-2,
+        -0x1.d6a724p-1, -0x1.12f65ep+0, -0x1.a60afcp+0, -0x1.48c7ecp+2,
+        0x1.5be09ep-2, -0x1.1950dp+0, -0x1.9ebe9ap-2, 0x1.53501ep-4
+    },
+    {
+        -0x1.1cedf4p+2, -0x1.0dda62p+0, -0x1.0901eap+1, -0x1.7974b6p+0,
+        -0x1.9b891cp+0, -0x1.b074c4p-2, -0x1.32ebbap+2, -0x1.40524cp-3,
+        -0x1.424cp-3, -0x1.baa2c4p+1, -0x1.dee668p+1, -0x1.27b8p+0,
+        -0x1.f520e6p-1, -0x1.3102dap-3, -0x1.1565ap+1, 0x1.d4ffb2p-1,
+        -0x1.3d0b18p-1, 0x1.8cb78ap-2, -0x1.6e614ep-6, -0x1.9e426ep+1,
+        -0x1.d3067cp-1, 0x1.a4209ap-2, -0x1.3eb7eep+1, -0x1.b45b66p+2,
+        0x1.12f8fcp+0, 0x1.447a3ap+0, -0x1.783068p+2, 0x1.67a72cp+1,
+        0x1.2259c6p-2, 0x1.bf54f6p-3, 0x1.8361acp-1, -0x1.222e34p+3
+    },
+    {
+        -0x1.412336p+2, -0x1.d32b68p+3, -0x1.7d2b68p-1, -0x1.e76f52p-1,
+        0x1.29919ep-5, 0x1.1ce71ep+2, -0x1.e0ec78p+1, 0x1.3f53fap-2,
+        -0x1.a638eep-2, -0x1.b98836p+2, -0x1.f54b56p+2, -0x1.7e7346p-1,
+        -0x1.05c6dap+0, -0x1.c20cb2p-1, -0x1.06859ep+1, 0x1.5c2b24p-4,
+        -0x1.2ea97p+2, 0x1.8e6c7ep+0, -0x1.a2758p+0, -0x1.c3014p+0,
+        0x1.2be75ap-1, 0x1.d12082p-2, -0x1.88aa54p+0, -0x1.734c1cp+2,
+        0x1.7c2e44p-4, -0x1.56b73cp-1, -0x1.2da1f4p+1, 0x1.3f1eb8p+1,
+        -0x1.3cb696p-6, -0x1.15fe9p-6, 0x1.e56aaap-2, -0x1.7c72e4p+2
+    },
+    {
+        -0x1.2ce93ep+2, -0x1.8f2d1cp+0, 0x1.53d752p-1, -0x1.3a2152p-1,
+        -0x1.65cdf2p-2, 0x1.f7c0a2p+0, -0x1.525e2ap+1, -0x1.04153ap-1,
+        0x1.092fb4p-3, -0x1.3a28aap+2, -0x1.08108ap+3, -0x1.f8a74ep-2,
+        -0x1.18d488p+1, -0x1.793646p+1, -0x1.e22cep-1, -0x1.8275dep-4,
+        -0x1.9c220cp+0, 0x1.0a19b2p-1, -0x1.1eff08p-2, -0x1.0bda6cp-1,
+        -0x1.20c0e4p-1, 0x1.1741e6p-1, -0x1.a79158p-1, -0x1.531f1ap+2,
+        -0x1.51233ep-1, 0x1.5baea8p-2, -0x1.c44ea8p-1, 0x1.990daap+1,
+        0x1.54c6fep-5, 0x1.121ac2p-2, 0x1.c023e8p-5, -0x1.2d0cbap+2
+    },
+    {
+        -0x1.0b0182p+0, 0x1.2c0dfcp+1, -0x1.586b6ap+1, -0x1.2fc1ccp+0,
+        -0x1.2de5fcp+1, 0x1.cb0da2p-4, -0x1.02cdccp+1, -0x1.178754p-3,
+        0x1.58ad84p-3, -0x1.7428eep-1, -0x1.27f9e2p+2, -0x1.3d7d52p-3,
+        0x1.f3c096p-2, 0x1.ac9804p-4, -0x1.3868fcp-2, 0x1.377b02p-6,
+        -0x1.07e924p+2, 0x1.639c06p-2, -0x1.0e76fcp-4, -0x1.026cfep-3,
+        -0x1.5a1636p-1, 0x1.38c1bep+0, -0x1.7a5d2p-1, -0x1.484262p+1,
+        -0x1.4e409ap-5, -0x1.b55cccp-1, -0x1.9a2f0ep+1, 0x1.24328p-1,
+        0x1.ac1126p-4, -0x1.72578ep-1, -0x1.0d2f6p-1, -0x1.8d3618p+1
+    },
+    {
+        -0x1.583876p-3, 0x1.6d19b4p-1, -0x1.dc9386p-3, -0x1.09c6e2p-1,
+        -0x1.cac1fap+0, 0x1.3298c8p-2, 0x1.436a6ep+0, -0x1.c2460cp-5,
+        0x1.fe8baap-2, 0x1.a07872p+1, -0x1.a0d454p+0, -0x1.3ba4f8p-2,
+        -0x1.2905acp-1, -0x1.56c248p+1, -0x1.066d7cp-1, 0x1.06c9p-1,
+        -0x1.3e5b04p+1, -0x1.cead1ep+0, -0x1.3861bep+0, -0x1.f3ecb6p+0,
+        0x1.52182ap+0, -0x1.d0c34cp-3, -0x1.7cf32ap-1, -0x1.14f60ep+1,
+        -0x1.5c8c66p-2, 0x1.29b738p+0, 0x1.a3e6c2p-3, 0x1.e5c008p-1,
+        0x1.71f1fcp-3, -0x1.1d67ep-1, -0x1.bc1e94p-6, -0x1.39d048p-1
+    },
+    {
+        0x1.0e673cp-1, -0x1.309a2ap+0, -0x1.57c196p+0, -0x1.ffe098p-1,
+        -0x1.241f8cp+1, 0x1.b1368ep+0, 0x1.4ede34p+0, 0x1.8dd7d4p-3,
+        -0x1.80b258p-2, 0x1.9b2b46p+1, -0x1.fb1436p-1, -0x1.a0b2c6p-2,
+        -0x1.db4c3cp-8, -0x1.a6c49cp-1, -0x1.3d3a7cp-2, -0x1.fc9cf8p-1,
+        -0x1.ac77d6p+1, -0x1.475a84p-2, -0x1.165a14p+1, 0x1.5447acp-5,
+        0x1.24affp+0, 0x1.11f3c4p-2, -0x1.8fae2ep+1, 0x1.bf8f12p-1,
+        -0x1.1f433ap-3, 0x1.83b696p-2, -0x1.3418eep-1, -0x1.38ba14p+1,
+        0x1.682e5p-3, -0x1.ea421ep-2, 0x1.fcaf88p-3, -0x1.0c7a9p-1
+    },
+    {
+        -0x1.c1ef02p-1, 0x1.194428p+0, -0x1.ed5936p-2, -0x1.1c4adap-1,
+        -0x1.2ea8c2p+1, 0x1.a3acaap-3, 0x1.051bf8p+0, 0x1.b4a314p-3,
+        -0x1.0a540ep-6, 0x1.5cb3bp+1, -0x1.15134p+0, -0x1.5173f4p-1,
+        0x1.492d16p-5, -0x1.5bdb6cp-3, 0x1.af0d6p-1, 0x1.ca08eep-7,
+        -0x1.77c2eep+0, -0x1.e02cep-1, -0x1.c4286ap-1, -0x1.5b15a2p+1,
+        0x1.14366ap-1, -0x1.064566p+1, -0x1.f25a96p+0, -0x1.1d6848p-2,
+        -0x1.0cf4dp-3, 0x1.babb6ep-2, -0x1.2ee96p+0, -0x1.edc39ep+1,
+        0x1.7af6b2p-2, -0x1.8f20a6p-1, -0x1.62d896p-2, 0x1.025ab4p-1
+    },
+    {
+        -0x1.2221bap-1, 0x1.087ca4p-1, -0x1.12ed2ep+0, 0x1.cfc56cp-5,
+        -0x1.af1a9ap+0, -0x1.5913d8p-1, 0x1.a78d08p-2, -0x1.f45f4ep-2,
+        -0x1.8a8322p-3, 0x1.42891ep+0, -0x1.4e6ebcp-1, -0x1.7558b2p-1,
+        0x1.be47dap-2, -0x1.4d8e82p-2, 0x1.99698ep+0, 0x1.20c8ecp-1,
+        -0x1.7c51a8p+0, -0x1.35c2eap-3, 0x1.65deeep-7, -0x1.2a63fcp+0,
+        -0x1.469e3cp-5, -0x1.66fbd4p+0, -0x1.c95e06p-3, -0x1.5033b8p-2,
+        -0x1.7224c2p-4, -0x1.b922bep-1, -0x1.4875ecp+0, -0x1.64c05cp+2,
+        0x1.42a3b6p-1, 0x1.681746p-2, -0x1.633112p-2, 0x1.ecb6e8p-2
+    },
+    {
+        -0x1.5f7ebap+2, 0x1.bd4902p-1, -0x1.d3d1c4p+1, -0x1.3c1dc4p-5,
+        -0x1.85fa4ep+0, 0x1.03be16p-4, -0x1.58cbe4p+1, 0x1.5b335ap-2,
+        -0x1.32c2cp-2, -0x1.a6a538p+3, -0x1.d0f732p+0, -0x1.85b12cp+0,
+        -0x1.0a6f8cp+0, 0x1.1c961cp-3, -0x1.822e24p+0, -0x1.a061cap-1,
+        -0x1.c10e56p+1, 0x1.01b666p-1, 0x1.3b914ep-2, -0x1.6df678p+0,
+        -0x1.527eaap+1, -0x1.8117fcp+2, -0x1.a074cep-1, -0x1.b399bp+2,
+        -0x1.9c2a6ep-3, 0x1.07aed6p+0, -0x1.08b766p+2, 0x1.449e3p+0,
+        -0x1.4f99dap-2, 0x1.a800dep-2, 0x1.4287bcp-1, -0x1.88eb84p+2
+    },
+    {
+        -0x1.189866p+3, -0x1.9f789p-7, -0x1.098b8ap+0, -0x1.c21ccap-3,
+        -0x1.1502f4p+1, 0x1.db72d2p-1, -0x1.0cadap+1, 0x1.9d12cep-7,
+        0x1.6fe602p-1, -0x1.787c02p+1, -0x1.141e14p+2, -0x1.96db24p-1,
+        -0x1.49132cp+0, -0x1.e65e8cp-3, -0x1.aa3bb4p-2, -0x1.6d4d14p-1,
+        -0x1.5d4226p+1, 0x1.7a98aep-1, -0x1.394f74p+0, -0x1.02dd02p+1,
+        -0x1.9d9c96p-4, 0x1.2aef78p+0, -0x1.06f3c8p-1, -0x1.517fcp+2,
+        -0x1.a846b8p-1, -0x1.0b665cp-1, -0x1.54eb9ep-3, 0x1.e2ea24p+1,
+        -0x1.644278p-3, -0x1.a4c6c2p-5, 0x1.75d594p-1, -0x1.1a647ap+2
+    },
+    {
+        -0x1.086834p+3, 0x1.a89cdap-2, -0x1.8eb644p-1, -0x1.85febcp-1,
+        -0x1.09f2fp+0, 0x1.1a253p-1, -0x1.22e876p+0, 0x1.64db7ap-2,
+        0x1.9422a6p-1, -0x1.c5e016p+2, -0x1.ce5f5ap+1, -0x1.74ba92p-1,
+        -0x1.b80de2p+1, -0x1.916562p+1, -0x1.90de3cp-1, -0x1.2bd4cep-1,
+        -0x1.a62f44p+0, 0x1.dda564p-1, -0x1.200884p-2, -0x1.fee038p-6,
+        -0x1.0d2bcp+2, 0x1.04a312p-1, 0x1.779b22p-3, -0x1.092ddap+2,
+        -0x1.1f0daep+1, 0x1.133c5ap+1, -0x1.39f3acp+1, 0x1.0e89ep+1,
+        -0x1.62b18cp-3, -0x1.f85b44p-8, 0x1.f11ddep-3, -0x1.aa422ep+1
+    },
+    {
+        -0x1.581fccp-4, 0x1.4272bcp+1, -0x1.5961bp-1, -0x1.0e048cp+0,
+        -0x1.a6300ep+0, -0x1.02da4ep-2, 0x1.80345p+1, -0x1.1d418p-3,
+        0x1.fae488p+1, -0x1.3d878cp+0, -0x1.3dba68p+0, -0x1.704d8cp-1,
+        0x1.02e60ap+1, -0x1.139464p-1, 0x1.966568p-3, -0x1.1dbe8cp+1,
+        -0x1.0b43a8p+1, -0x1.17a364p-4, -0x1.929076p-1, 0x1.5246cap+0,
+        0x1.225a04p+0, -0x1.7472e4p-2, 0x1.f6f098p+1, -0x1.e7984ep+1,
+        -0x1.29e418p+2, 0x1.99d538p+0, 0x1.265b76p+0, 0x1.5075fep+1,
+        0x1.8ebbcp-3, -0x1.c36552p-2, -0x1.f2888p+0, -0x1.99d2aap-2
+    },
+    {
+        0x1.885532p+1, 0x1.764f18p-4, -0x1.61431ap-1, -0x1.01748ap+1,
+        -0x1.3c9014p+0, 0x1.60c42ep-2, 0x1.06835ap+2, 0x1.9c167ap+0,
+        0x1.6e1eep+2, 0x1.47e912p+1, -0x1.71f106p-1, 0x1.4be57cp+1,
+        -0x1.3a6e9ep+2, -0x1.9967aep+1, -0x1.ecaf56p-3, 0x1.107ad8p+0,
+        -0x1.03412p-3, -0x1.3eca6p+1, -0x1.edf5dap+0, -0x1.4b619ap-2,
+        0x1.5f78f8p-1, -0x1.b2157p+0, 0x1.06d75p+0, -0x1.60bf0ep+0,
+        -0x1.62f94ep+1, 0x1.d990cp+0, 0x1.54fcp+2, 0x1.cce886p+0,
+        -0x1.bf053p+2, 0x1.eed3a8p-2, 0x1.c71766p-4, -0x1.1c35cap-1
+    },
+    {
+        0x1.b3888ap+0, 0x1.61bf7ap-1, -0x1.545c46p-1, -0x1.5a307cp-1,
+        -0x1.b1d29p-1, -0x1.fcf8c6p+0, 0x1.ed85e8p+0, -0x1.b4c5a8p-10,
+        0x1.06c8d2p-1, 0x1.447572p+1, 0x1.60cdaap-2, -0x1.8eeea8p-2,
+        -0x1.e06d2ep-4, -0x1.442c3ap-2, 0x1.6ed34cp+0, -0x1.7f897ep+1,
+        -0x1.e509d2p-1, -0x1.3b02f8p+0, -0x1.6f031ep+0, 0x1.1464fcp+0,
+        0x1.cfd8eap-1, 0x1.f7ea74p-4, -0x1.d3e474p+0, -0x1.989b7ep-1,
+        -0x1.adf958p+1, -0x1.677a7ap-4, 0x1.097316p+0, -0x1.5f772ap+0,
+        -0x1.7303e2p-3, -0x1.d5b60ep-1, 0x1.12901ap+0, -0x1.ef8008p-5
+    },
+    {
+        0x1.a57d9ap+0, -0x1.25c5bcp-1, -0x1.0a72dcp-1, 0x1.7ceca8p-6,
+        -0x1.17cd2ep-4, -0x1.228382p-2, 0x1.7920ecp+1, -0x1.3186b8p-2,
+        -0x1.1cd422p-1, 0x1.aa83ep+1, 0x1.9ecbfp-1, -0x1.bc2074p-1,
+        -0x1.361c4p-2, -0x1.e2457cp-2, 0x1.01455ap+0, 0x1.2a8dfep-3,
+        -0x1.be20cap-1, -0x1.9dea14p-1, -0x1.ae1f62p-1, -0x1.ca934cp-4,
+        0x1.7b143cp-1, -0x1.6fd564p+0, -0x1.5ee116p+0, -0x1.c6e246p-3,
+        -0x1.94406p+0, 0x1.6319cep-1, 0x1.d07f66p+0, -0x1.e01e54p+1,
+        0x1.c68e28p-4, 0x1.2db644p-3, 0x1.e0ed3ap-1, 0x1.3de8b2p+0
+    },
+    {
+        0x1.64aab6p+1, -0x1.92af9cp-2, -0x1.e7527p-1, 0x1.a0fc72p-3,
+        -0x1.a3c7dap-2, -0x1.610c56p+0, 0x1.287a6p+2, -0x1.9cff52p-3,
+        0x1.af31c2p-4, 0x1.119246p+1, 0x1.3b088ep+0, -0x1.10f6c8p+0,
+        -0x1.0127c8p-2, -0x1.40bd0ap-2, 0x1.a9f868p-1, 0x1.d40e2cp-3,
+        -0x1.b8d2cep-1, -0x1.224d82p-1, 0x1.720bbcp-4, -0x1.940564p+0,
+        0x1.0e24eap-1, -0x1.1db72cp+0, -0x1.93c5acp-3, 0x1.d28f1ap-5,
+        -0x1.39d2d8p+0, -0x1.878fe6p-2, 0x1.58325ap+0, -0x1.1082fcp+2,
+        0x1.0e28a2p-1, 0x1.cca854p-2, -0x1.30203ep-4, 0x1.accff2p+0
+    },
+},
+
+.inputBiases = {
+    -0x1.59ba4cp+2, 0x1.0c005p+1, -0x1.350fe6p+1, -0x1.29c292p+0,
+    -0x1.68934ep+2, 0x1.e75f4cp+1, 0x1.6bd256p+1, 0x1.9101f2p+0,
+    -0x1.8a919p+1, 0x1.34edf6p+2, -0x1.00c10cp+1, -0x1.8a7ff4p-1,
+    -0x1.339892p-1, -0x1.b94c7cp+1, 0x1.2ef032p-1, 0x1.18c9ccp-2,
+    -0x1.418b66p+2, -0x1.95134cp-1, -0x1.c5b808p+1, -0x1.a95198p+1,
+    0x1.7ce3cap+0, -0x1.fec0d2p+1, -0x1.f94cdp+1, -0x1.0cce76p+2,
+    -0x1.e349f8p+2, 0x1.c8556p+0, 0x1.0b2de4p+3, -0x1.7d35dep+0,
+    -0x1.dab1e6p-1, 0x1.f31c7p-2, 0x1.c8dbfp-2, -0x1.20ac62p+1
+},
+
+.layer1Weights = {
+    {
+        -0x1.ee809p+2, 0x1.0f2eap+3, -0x1.c83a2p+2, -0x1.50c0bcp+3,
+        0x1.1ea33ap+3, -0x1.1143f8p+3, 0x1.0b205cp+1, 0x1.f00dfep+2,
+        0x1.31bd26p+2, -0x1.33e6f2p+3, 0x1.c79cbap+3, -0x1.06c6bap+4,
+        -0x1.f1ea1ep+2, -0x1.45b494p+3, -0x1.e992ep+2, -0x1.6bfbe4p+2,
+        -0x1.018568p+3, 0x1.95fc56p+2, -0x1.0d86a6p+3, -0x1.0c932p+3,
+        -0x1.bb6e16p+2, -0x1.f6ab8cp+2, -0x1.01bf4ep+3, -0x1.b894eep+3,
+        0x1.c4f42ep+3, 0x1.1320dep+3, 0x1.03573ap+4, -0x1.2756fcp+3,
+        0x1.0f2ef4p+4, 0x1.2832dap+3, 0x1.d15986p+2, -0x1.754b2p+3
+    },
+    {
+        0x1.8671ecp+3, -0x1.02bfbp+2, -0x1.75a2ep+0, -0x1.d7da1p+1,
+        -0x1.3100fep+3, -0x1.e7ca1ap-1, -0x1.aaeb34p+3, 0x1.033c0ap+1,
+        0x1.52a4cp+3, 0x1.58b408p+2, 0x1.08eacp+0, -0x1.374b28p+4,
+        -0x1.02ba3ap+1, -0x1.1f064cp+1, -0x1.054dap+0, -0x1.b18e7cp+1,
+        -0x1.3abd62p-1, 0x1.bc2ff4p+1, -0x1.1ef10ep+2, 0x1.f7c01p-2,
+        -0x1.eb1bf6p+1, 0x1.d27a98p+1, -0x1.d2e3ap-1, -0x1.217b78p+1,
+        0x1.7cd078p+0, 0x1.536c4ep+2, 0x1.e85582p+1, -0x1.8fc3dep+2,
+        0x1.f755bap+3, 0x1.d99e9ep-2, 0x1.898a1p+1, -0x1.c710fap+0
+    },
+},
+
+.layer1Biases = {
+    -0x1.cd289cp+6, 0x1.6564c6p+3
+},
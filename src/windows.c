@@ -21,11 +21,170 @@
 #pragma GCC diagnostic ignored "-Wcast-function-type"
 #endif
 
+#if defined(__linux__)
+#define _GNU_SOURCE
+#endif
+
 #include "windows.h"
 
-#ifndef _WIN32
+#if defined(__linux__)
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+
+static pthread_once_t ProcessMaskOnce = PTHREAD_ONCE_INIT;
+static cpu_set_t ProcessMask; // Affinity of the threads before any were bound
+
+static void readProcessMask() {
+    if (sched_getaffinity(0, sizeof(cpu_set_t), &ProcessMask))
+        CPU_ZERO(&ProcessMask);
+}
+
+static int readCPUList(const char *fname, cpu_set_t *mask) {
+
+    // Parse a Linux cpulist, such as "0-7,16-23", into a cpu_set_t.
+    // Returns the number of CPUs found, or zero if the file is missing
+
+    int first, last, count = 0;
+    FILE *fin = fopen(fname, "r");
+
+    CPU_ZERO(mask);
+    if (fin == NULL) return 0;
+
+    while (fscanf(fin, "%d", &first) == 1) {
+
+        if (fscanf(fin, "-%d", &last) != 1)
+            last = first;
+
+        for (int cpu = first; cpu <= last && cpu < CPU_SETSIZE; cpu++)
+            CPU_SET(cpu, mask), count++;
+
+        if (fgetc(fin) != ',') break;
+    }
+
+    fclose(fin);
+    return count;
+}
+
+static int isPhysicalCore(int cpu) {
+
+    // A logical processor is counted as a physical core when it is the
+    // first of its siblings. Without topology info we assume no SMT
+
+    char fname[128];
+    cpu_set_t siblings;
+
+    sprintf(fname, "/sys/devices/system/cpu/cpu%d/topology/thread_siblings_list", cpu);
+    if (!readCPUList(fname, &siblings))
+        return 1;
+
+    for (int i = 0; i < cpu; i++)
+        if (CPU_ISSET(i, &siblings)) return 0;
+
+    return 1;
+}
+
+static int bestNode(int index, cpu_set_t *mask) {
+
+    // bestNode() reads the NUMA topology exposed via sysfs, and returns the best
+    // node for the thread with a given index, while also filling in the CPU mask
+    // of that node. Follows the same distribution as bestGroup() does on Windows
+
+    char fname[128];
+    cpu_set_t cpus;
+    int groupSize = 0, groups[2048];
+    int nodes = 0, cores = 0, threads = 0, nodeIds[256];
+
+    // Count up all nodes, cores, and threads. Node ids need not be contiguous
+    for (int node = 0; node < 1024 && nodes < 256; node++) {
+
+        sprintf(fname, "/sys/devices/system/node/node%d/cpulist", node);
+        if (!readCPUList(fname, &cpus)) continue;
+
+        for (int cpu = 0; cpu < CPU_SETSIZE; cpu++)
+            if (CPU_ISSET(cpu, &cpus))
+                threads++, cores += isPhysicalCore(cpu);
+
+        nodeIds[nodes++] = node;
+    }
+
+    // Nothing to gain when there is only a single node
+    if (nodes <= 1) return -1;
+
+    // Run as many threads as possible on the same node until
+    // core limit is reached, then move on filling the next node.
+    for (int n = 0; n < nodes; n++)
+        for (int i = 0; i < cores / nodes && groupSize < 2048; i++)
+            groups[groupSize++] = n;
+
+    // In case a core has more than one logical processor and we still
+    // have threads to allocate, then spread them across available nodes.
+    for (int t = 0; t < threads - cores && groupSize < 2048; t++)
+        groups[groupSize++] = t % nodes;
+
+    // If we still have more threads than the total number of logical
+    // processors then return -1 and let the OS to decide what to do.
+    if (index >= groupSize) return -1;
+
+    sprintf(fname, "/sys/devices/system/node/node%d/cpulist", nodeIds[groups[index]]);
+    readCPUList(fname, mask);
+    return nodeIds[groups[index]];
+}
+
+int bindThisThread(int index) {
+
+    // bindThisThread() sets the CPU affinity of the current thread to the CPUs
+    // of a single NUMA node. Anything first written by this thread afterwards
+    // will then be placed on that node by the kernel's default memory policy.
+    // Returns the node which was chosen, or -1 when the thread was left alone
+
+    cpu_set_t mask;
+    pthread_once(&ProcessMaskOnce, readProcessMask);
+    const int node = bestNode(index, &mask);
+
+    if (node != -1 && sched_setaffinity(0, sizeof(cpu_set_t), &mask))
+        return -1;
+
+    return node;
+}
+
+int unbindThisThread() {
+
+    // unbindThisThread() returns the current thread to the affinity which
+    // threads had before any were bound, since bound threads may be reused
+    // by a smaller Thread Pool, which has no NUMA placement to gain from
+
+    pthread_once(&ProcessMaskOnce, readProcessMask);
+
+    if (CPU_COUNT(&ProcessMask))
+        sched_setaffinity(0, sizeof(cpu_set_t), &ProcessMask);
+
+    return -1;
+}
 
-void bindThisThread(int index) { (void)index; };
+int getMemoryNodes(int *nodes, int max) {
+
+    // getMemoryNodes() lists the NUMA nodes which have memory attached,
+    // using the same cpulist format as is used for the CPUs of each node
+
+    int count = 0;
+    cpu_set_t mask;
+
+    if (!readCPUList("/sys/devices/system/node/has_memory", &mask))
+        return 0;
+
+    for (int node = 0; node < CPU_SETSIZE && count < max; node++)
+        if (CPU_ISSET(node, &mask)) nodes[count++] = node;
+
+    return count;
+}
+
+#elif !defined(_WIN32)
+
+int bindThisThread(int index) { (void)index; return -1; };
+int unbindThisThread() { return -1; }
+int getMemoryNodes(int *nodes, int max) { (void)nodes; (void)max; return 0; }
 
 #else
 
@@ -89,25 +248,47 @@ static int bestGroup(int index) {
     return index < groupSize ? groups[index] : -1;
 }
 
-void bindThisThread(int index) {
+int bindThisThread(int index) {
 
-    // bindThisThread() sets the group affinity of the current thread
+    // bindThisThread() sets the group affinity of the current thread,
+    // and returns the node which was chosen, or -1 when left alone
 
     GROUP_AFFINITY affinity;
     int group = bestGroup(index);
 
     // Check for a need to bind the thread
-    if (group == -1) return;
+    if (group == -1) return -1;
 
     // Early exit if the needed APIs are not available at runtime
     HMODULE k32 = GetModuleHandle("Kernel32.dll");
     fun2_t fun2 = (fun2_t)GetProcAddress(k32, "GetNumaNodeProcessorMaskEx");
     fun3_t fun3 = (fun3_t)GetProcAddress(k32, "SetThreadGroupAffinity");
-    if (!fun2 || !fun3) return;
+    if (!fun2 || !fun3) return -1;
 
     // Set the Affinity
-    if (fun2(group, &affinity))
-        fun3(GetCurrentThread(), &affinity, NULL);
+    if (fun2(group, &affinity) && fun3(GetCurrentThread(), &affinity, NULL))
+        return group;
+
+    return -1;
 }
 
-#endif
\ No newline at end of file
+int unbindThisThread() {
+
+    // unbindThisThread() returns the current thread to the affinity of the
+    // process, within the process's own group, undoing any earlier binding
+
+    DWORD_PTR process, system;
+
+    if (GetProcessAffinityMask(GetCurrentProcess(), &process, &system))
+        SetThreadAffinityMask(GetCurrentThread(), process);
+
+    return -1;
+}
+
+int getMemoryNodes(int *nodes, int max) {
+
+    // Memory placement is left entirely to Windows
+    (void)nodes; (void)max; return 0;
+}
+
+#endif
@@ -39,4 +39,6 @@ typedef int (*fun3_t) (HANDLE, CONST GROUP_AFFINITY*, PGROUP_AFFINITY);
 
 #endif
 
-void bindThisThread(int index);
+int bindThisThread(int index);
+int unbindThisThread();
+int getMemoryNodes(int *nodes, int max);
@@ -16,8 +16,12 @@
   along with this program.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <assert.h>
 #include <stdint.h>
 
+#include "attacks.h"
+#include "bitboards.h"
+#include "move.h"
 #include "types.h"
 #include "zobrist.h"
 
@@ -26,6 +30,9 @@ uint64_t ZobristEnpassKeys[FILE_NB];
 uint64_t ZobristCastleKeys[SQUARE_NB];
 uint64_t ZobristTurnKey;
 
+uint64_t CuckooKeys[CUCKOO_SIZE];
+uint16_t CuckooMoves[CUCKOO_SIZE];
+
 uint64_t rand64() {
 
     // http://vigna.di.unimi.it/ftp/papers/xorshift.pdf
@@ -57,4 +64,53 @@ void initZobrist() {
 
     // Init the Zobrist key for side to move
     ZobristTurnKey = rand64();
+
+    initCuckoo();
+}
+
+void initCuckoo() {
+
+    // Cuckoo table of the hash differences made by every reversible move of
+    // a non-Pawn piece, on an otherwise empty board. See Marcel van Kervinck's
+    // idea, "Detecting upcoming repetitions", as used by boardHasGameCycle()
+
+    int count = 0;
+
+    for (int piece = KNIGHT; piece <= KING; piece++) {
+        for (int colour = WHITE; colour <= BLACK; colour++) {
+            for (int sq1 = 0; sq1 < SQUARE_NB; sq1++) {
+                for (int sq2 = sq1 + 1; sq2 < SQUARE_NB; sq2++) {
+
+                    const uint64_t attacks
+                        = piece == KNIGHT ? knightAttacks(sq1)
+                        : piece == BISHOP ? bishopAttacks(sq1, 0ull)
+                        : piece == ROOK   ? rookAttacks(sq1, 0ull)
+                        : piece == QUEEN  ? queenAttacks(sq1, 0ull) : kingAttacks(sq1);
+
+                    if (!testBit(attacks, sq2)) continue;
+
+                    uint16_t move = MoveMake(sq1, sq2, NORMAL_MOVE);
+                    uint64_t key  = ZobristKeys[makePiece(piece, colour)][sq1]
+                                  ^ ZobristKeys[makePiece(piece, colour)][sq2]
+                                  ^ ZobristTurnKey;
+
+                    // Displace entries between their two slots until one is empty
+                    for (int i = CuckooH1(key); move != NONE_MOVE; ) {
+
+                        uint64_t tkey  = CuckooKeys[i];
+                        uint16_t tmove = CuckooMoves[i];
+
+                        CuckooKeys[i] = key, CuckooMoves[i] = move;
+                        key = tkey, move = tmove;
+
+                        i = i == (int) CuckooH1(key) ? CuckooH2(key) : CuckooH1(key);
+                    }
+
+                    count++;
+                }
+            }
+        }
+    }
+
+    assert(count == 3668); (void) count;
 }
@@ -27,5 +27,14 @@ extern uint64_t ZobristEnpassKeys[FILE_NB];
 extern uint64_t ZobristCastleKeys[SQUARE_NB];
 extern uint64_t ZobristTurnKey;
 
+enum { CUCKOO_SIZE = 8192 };
+
+extern uint64_t CuckooKeys[CUCKOO_SIZE];
+extern uint16_t CuckooMoves[CUCKOO_SIZE];
+
+#define CuckooH1(key) ((key) & (CUCKOO_SIZE - 1))
+#define CuckooH2(key) (((key) >> 16) & (CUCKOO_SIZE - 1))
+
 uint64_t rand64();
 void initZobrist();
+void initCuckoo();